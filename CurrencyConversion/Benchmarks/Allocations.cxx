@@ -0,0 +1,81 @@
+#include "pch.h"
+
+#include "Allocations.hxx"
+
+#include <TUESL/SQLite/SQLite3PCH.hxx>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+	std::atomic<std::uint64_t> heap_allocations{0};
+	std::atomic<std::uint64_t> sqlite_allocations{0};
+
+	// SQLite's Default Allocator, Wrapped
+	sqlite3_mem_methods sqlite_default_methods{};
+
+	void* countingMalloc(int p_bytes)
+	{
+		sqlite_allocations.fetch_add(1, std::memory_order_relaxed);
+		return sqlite_default_methods.xMalloc(p_bytes);
+	}
+	void* countingRealloc(void* p_pointer, int p_bytes)
+	{
+		sqlite_allocations.fetch_add(1, std::memory_order_relaxed);
+		return sqlite_default_methods.xRealloc(p_pointer, p_bytes);
+	}
+} // namespace
+
+namespace Benchmarks
+{
+	AllocationCount allocationCount() noexcept
+	{
+		return AllocationCount{heap_allocations.load(std::memory_order_relaxed),
+									  sqlite_allocations.load(std::memory_order_relaxed)};
+	}
+
+	bool countSQLiteAllocations() noexcept
+	{
+		static bool is_counting = false;
+		if (is_counting)
+			return true;
+
+		// Configuration is only Accepted while SQLite is not Initialised
+		if (sqlite3_shutdown() != SQLITE_OK)
+			return false;
+
+		if (sqlite3_config(SQLITE_CONFIG_GETMALLOC, &sqlite_default_methods) != SQLITE_OK)
+			return false;
+
+		sqlite3_mem_methods counting_methods = sqlite_default_methods;
+		counting_methods.xMalloc				 = &countingMalloc;
+		counting_methods.xRealloc				 = &countingRealloc;
+
+		if (sqlite3_config(SQLITE_CONFIG_MALLOC, &counting_methods) != SQLITE_OK)
+			return false;
+
+		is_counting = sqlite3_initialize() == SQLITE_OK;
+		return is_counting;
+	}
+} // namespace Benchmarks
+
+// Replaced for the whole Executable
+// The Array and No Throw Forms Forward here by Default
+void* operator new(std::size_t p_bytes)
+{
+	heap_allocations.fetch_add(1, std::memory_order_relaxed);
+
+	if (void* pointer = std::malloc(p_bytes != 0 ? p_bytes : 1))
+		return pointer;
+	throw std::bad_alloc{};
+}
+void operator delete(void* p_pointer) noexcept
+{
+	std::free(p_pointer);
+}
+void operator delete(void* p_pointer, std::size_t) noexcept
+{
+	std::free(p_pointer);
+}
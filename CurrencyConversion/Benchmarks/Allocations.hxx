@@ -0,0 +1,34 @@
+#pragma once
+
+// Counts Allocations made by the Benchmarks
+// operator new is Replaced for the whole Executable
+// SQLite's own Allocations are Counted once countSQLiteAllocations was called
+//
+// Example
+//	const auto before = Benchmarks::allocationCount();
+//	... Work ...
+//	const auto made = Benchmarks::allocationCount() - before;
+
+#include <cstdint>
+
+namespace Benchmarks
+{
+	struct AllocationCount
+	{
+		std::uint64_t heap	= 0;
+		std::uint64_t sqlite = 0;
+
+		AllocationCount operator-(const AllocationCount& p_other) const noexcept
+		{
+			return AllocationCount{heap - p_other.heap, sqlite - p_other.sqlite};
+		}
+	};
+
+	// Totals since the Process Started
+	AllocationCount allocationCount() noexcept;
+
+	// Routes SQLite's Allocator through a Counter
+	// SQLite can only be Reconfigured while no Connection is Open
+	// Returns false if it could not be
+	bool countSQLiteAllocations() noexcept;
+} // namespace Benchmarks
@@ -0,0 +1,149 @@
+#include "pch.h"
+
+#include "Harness.hxx"
+#include "StandInService.hxx"
+
+#include "ResponseArchive.hxx"
+
+#include <TUESL/SQLite/Database.hxx>
+
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Archiving Upstream Responses as the Converter does, into an In Memory Database
+//
+// conversion are Rate Responses, a few Dozen Bytes each
+// list are Currency Lists, as the Stand In Service Serves them
+// Each is Archived without a Dictionary, and with one Trained on earlier Responses
+//
+// write is Compressing every Response and Streaming its Blocks in, in MB of Body per Second
+// read is Streaming them back out through the Reader
+// ratio is Bytes of Body over Bytes Stored, the Dictionary not Counted
+
+namespace
+{
+	using Benchmarks::StandInService;
+	using Currency::ArchiveOptions;
+	using Currency::ResponseArchive;
+
+	using namespace std::string_literals;
+
+	constexpr const std::size_t CONVERSION_RESPONSES = 10'000;
+	constexpr const std::size_t LIST_RESPONSES		 = 200;
+	constexpr const std::size_t LIST_CURRENCIES		 = 170;
+	// As many as the Archive Trains on by Default
+	constexpr const std::size_t TRAINING_RESPONSES = ArchiveOptions{}.training_responses;
+	constexpr const std::size_t READ_BUFFER_SIZE	  = 4096;
+
+	constexpr const auto URI = L"https://free.currconv.com/api/v7/convert";
+
+	std::vector<std::string> conversionResponses(const std::size_t p_count)
+	{
+		std::vector<std::string> responses;
+		responses.reserve(p_count);
+
+		for (std::size_t i = 0; i < p_count; ++i)
+		{
+			const auto from = StandInService::currencyCode(i % LIST_CURRENCIES);
+			const auto to	 = StandInService::currencyCode((i * 7 + 1) % LIST_CURRENCIES);
+
+			char text[64];
+			std::snprintf(text,
+							  sizeof(text),
+							  R"({"%s_%s":%.6f})",
+							  from.c_str(),
+							  to.c_str(),
+							  StandInService::rateFor(from, to));
+			responses.emplace_back(text);
+		}
+		return responses;
+	}
+
+	// Every List the same, as the Upstream's rarely Changes
+	std::vector<std::string> listResponses(const std::size_t p_count)
+	{
+		std::string list = R"({"results":{)";
+		for (std::size_t i = 0; i < LIST_CURRENCIES; ++i)
+		{
+			const auto code = StandInService::currencyCode(i);
+			if (i != 0)
+				list += ',';
+			list += R"(")" + code + R"(":{"currencyName":"Currency )" + code +
+					  R"(","currencySymbol":"$","id":")" + code + R"("})";
+		}
+		list += "}}";
+
+		return std::vector<std::string>(p_count, list);
+	}
+
+	void archiveResponses(Benchmarks::Reporter&			p_reporter,
+								 const std::string&				p_name,
+								 const std::vector<std::string>& p_responses)
+	{
+		std::size_t raw_bytes = 0;
+		for (const auto& response : p_responses)
+			raw_bytes += std::size(response);
+
+		for (const auto with_dictionary : {false, true})
+		{
+			const auto label = "archive/"s + p_name + (with_dictionary ? "/dictionary" : "/none");
+
+			// Trained here alone, as such the Dictionary never Changes while Timed
+			ArchiveOptions options;
+			options.train_after_responses = 0;
+
+			TUESL::SQLite::Database db{":memory:"};
+			std::mutex					mutex;
+			ResponseArchive			archive{db, mutex, options};
+
+			if (with_dictionary)
+			{
+				for (std::size_t i = 0; i < TRAINING_RESPONSES; ++i)
+					archive.Archive(URI, p_responses[i % std::size(p_responses)], 0);
+				archive.TrainDictionary(TRAINING_RESPONSES);
+			}
+			const auto before = archive.Statistics();
+
+			const auto write_seconds = Benchmarks::secondsFor([&] {
+				for (const auto& response : p_responses)
+					Benchmarks::doNotOptimize(archive.Archive(URI, response, 0));
+			});
+
+			const auto stored_bytes = archive.Statistics().stored_bytes - before.stored_bytes;
+
+			p_reporter.report(
+				 label, "responses_per_sec", std::size(p_responses) / write_seconds);
+			p_reporter.report(label, "write_mb_per_sec", raw_bytes / write_seconds / 1'000'000.0);
+			if (stored_bytes != 0)
+				p_reporter.report(label, "ratio", static_cast<double>(raw_bytes) / stored_bytes);
+
+			const auto responses = archive.RecentResponses(std::size(p_responses));
+
+			std::size_t read_bytes = 0;
+			const auto	read_seconds = Benchmarks::secondsFor([&] {
+				 char buffer[READ_BUFFER_SIZE];
+				 for (const auto& response : responses)
+				 {
+					 auto reader = archive.Open(response.id);
+					 if (!reader.has_value())
+						 continue;
+
+					 while (const auto read = reader->read(buffer, sizeof(buffer)))
+						 read_bytes += read;
+				 }
+			 });
+			Benchmarks::doNotOptimize(read_bytes);
+
+			p_reporter.report(
+				 label, "read_mb_per_sec", read_bytes / read_seconds / 1'000'000.0);
+		}
+	}
+} // namespace
+
+BENCHMARK(UpstreamResponseArchive)
+{
+	archiveResponses(reporter, "conversion", conversionResponses(CONVERSION_RESPONSES));
+	archiveResponses(reporter, "list", listResponses(LIST_RESPONSES));
+}
@@ -0,0 +1,290 @@
+#include "pch.h"
+
+#include "Harness.hxx"
+#include "StandInService.hxx"
+
+#include "HistoricalQuotes.hxx"
+#include "ReferenceRates.hxx"
+
+#include <TUESL/Metrics/Registry.hxx>
+#include <TUESL/SQLite/Database.hxx>
+
+#include <algorithm>
+#include <cmath>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Historical Quotes Cached under a Byte Budget, by a plain LRU and by the W-TinyLFU Tier
+//
+// Traces are of Quotes, a Pair and a Day, Drawn from QUOTES Distinct ones
+//	zipf		Popularity falls off as 1 / rank^ZIPF_EXPONENT, as Quotes Users Ask for do
+//	zipf_scan	As zipf, but every other Block of SCAN_LENGTH is a Chart, a Pair across
+//				as many Days, none of which is Asked for again
+//
+// A Miss is Filled by a put, as the Converter does once the Network Answered
+// hit_ratio is Hits over Lookups, lookups_per_sec of the Cache alone
+//
+// tiered is the whole HistoricalQuoteCache, its Database in Memory and Pruned to
+// STORED_QUOTES, memory_hit_ratio and hit_ratio as HistoricalQuoteStatistics has them
+
+namespace
+{
+	using Benchmarks::StandInService;
+
+	using Currency::HistoricalQuoteCache;
+	using Currency::HistoricalQuoteKey;
+	using Currency::HistoricalQuoteKeyHash;
+	using Currency::HistoricalQuoteOptions;
+
+	using TUESL::Numeric::Rate;
+
+	using winrt::hstring;
+
+	using namespace std::string_literals;
+
+	constexpr const std::size_t CURRENCY_COUNT = 170;
+	constexpr const std::size_t QUOTES			  = 500'000;
+	constexpr const double		 ZIPF_EXPONENT  = 0.9;
+	constexpr const std::size_t LOOKUPS		  = 1'000'000;
+	constexpr const std::size_t SCAN_LENGTH	  = 1'000;
+	// Days the Quotes are Spread over, ten Years back
+	constexpr const std::int64_t DAYS = 3'650;
+
+	// Through the Database, as such far fewer
+	constexpr const std::size_t TIERED_LOOKUPS = 200'000;
+	constexpr const std::size_t STORED_QUOTES	 = 50'000;
+
+	constexpr const std::size_t BUDGETS[] = {1024 * 1024, 4 * 1024 * 1024};
+
+	constexpr const std::int64_t TICKS_PER_DAY = 864'000'000'000;
+
+	// Evicts the Least Recently Used, whatever it costs, as a Baseline
+	// Weighs as the W-TinyLFU Tier, as such both hold about as many Quotes
+	class LruCache
+	{
+	 private:
+		using Entry = std::pair<HistoricalQuoteKey, Rate>;
+
+		std::list<Entry> m_entries;
+		std::unordered_map<HistoricalQuoteKey, std::list<Entry>::iterator, HistoricalQuoteKeyHash>
+						m_index;
+		std::size_t m_weight = 0;
+		std::size_t m_max_weight;
+
+	 public:
+		explicit LruCache(const std::size_t p_max_weight) : m_max_weight{p_max_weight} {}
+
+		std::optional<Rate> get(const HistoricalQuoteKey& p_key)
+		{
+			const auto found = m_index.find(p_key);
+			if (found == std::end(m_index))
+				return std::nullopt;
+
+			m_entries.splice(std::begin(m_entries), m_entries, found->second);
+			return found->second->second;
+		}
+
+		// Only ever on a Miss, as such p_key is not held yet
+		void put(const HistoricalQuoteKey& p_key, const Rate p_rate)
+		{
+			m_entries.emplace_front(p_key, p_rate);
+			m_index.emplace(p_key, std::begin(m_entries));
+			m_weight += HistoricalQuoteCache::Weigh(p_key, p_rate);
+
+			while (m_weight > m_max_weight)
+			{
+				const auto& last = m_entries.back();
+				m_weight -= HistoricalQuoteCache::Weigh(last.first, last.second);
+				m_index.erase(last.first);
+				m_entries.pop_back();
+			}
+		}
+	};
+
+	// Finaliser of SplitMix64, Spreads Ranks over Pairs and Days
+	std::uint64_t mix(std::uint64_t p_value) noexcept
+	{
+		p_value ^= p_value >> 30;
+		p_value *= 0xbf58476d1ce4e5b9ull;
+		p_value ^= p_value >> 27;
+		p_value *= 0x94d049bb133111ebull;
+		p_value ^= p_value >> 31;
+		return p_value;
+	}
+
+	class TraceBuilder
+	{
+	 private:
+		std::vector<hstring> m_codes;
+		std::int64_t			m_today;
+
+	 public:
+		TraceBuilder() :
+			 m_today{Currency::ReferenceDayOf(winrt::clock::now().time_since_epoch().count())}
+		{
+			for (std::size_t i = 0; i < CURRENCY_COUNT; ++i)
+				m_codes.push_back(winrt::to_hstring(StandInService::currencyCode(i)));
+		}
+
+		HistoricalQuoteKey quote(const std::size_t p_from,
+										 const std::size_t p_to,
+										 const std::int64_t p_days_back) const
+		{
+			return {m_codes[p_from], m_codes[p_to], m_today - p_days_back * TICKS_PER_DAY};
+		}
+
+		// The Quote of p_rank, its Pair never of a Currency with itself
+		HistoricalQuoteKey ranked(const std::size_t p_rank) const
+		{
+			const auto hash = mix(p_rank);
+			const auto from = hash % CURRENCY_COUNT;
+			const auto to	 = (from + 1 + (hash >> 16) % (CURRENCY_COUNT - 1)) % CURRENCY_COUNT;
+			return quote(from, to, 1 + static_cast<std::int64_t>((hash >> 32) % DAYS));
+		}
+
+		std::vector<HistoricalQuoteKey> build(const std::size_t p_lookups,
+														  const bool		  p_with_scans) const
+		{
+			// Cumulative Weights of the Ranks, Drawn from by Binary Search
+			std::vector<double> cumulative(QUOTES);
+			double				  total = 0.0;
+			for (std::size_t rank = 0; rank < QUOTES; ++rank)
+			{
+				total += 1.0 / std::pow(static_cast<double>(rank + 1), ZIPF_EXPONENT);
+				cumulative[rank] = total;
+			}
+
+			std::mt19937_64								  random{42};
+			std::uniform_real_distribution<double> uniform{0.0, total};
+
+			std::vector<HistoricalQuoteKey> trace;
+			trace.reserve(p_lookups);
+
+			std::size_t scans = 0;
+			for (std::size_t i = 0; i < p_lookups; ++i)
+			{
+				const auto block = i / SCAN_LENGTH;
+				if (p_with_scans && block % 2 == 1)
+				{
+					// Older than any Ranked Quote, as such never Asked for again
+					const auto from = scans % CURRENCY_COUNT;
+					const auto to =
+						 (from + 1 + (scans / CURRENCY_COUNT) % (CURRENCY_COUNT - 1)) % CURRENCY_COUNT;
+					const auto day = DAYS + 1 + static_cast<std::int64_t>(i % SCAN_LENGTH);
+					trace.push_back(quote(from, to, day));
+
+					if (i % SCAN_LENGTH == SCAN_LENGTH - 1)
+						++scans;
+					continue;
+				}
+
+				const auto rank = static_cast<std::size_t>(
+					 std::lower_bound(std::begin(cumulative), std::end(cumulative), uniform(random)) -
+					 std::begin(cumulative));
+				trace.push_back(ranked((std::min)(rank, QUOTES - 1)));
+			}
+			return trace;
+		}
+	};
+
+	Rate rateOf(const HistoricalQuoteKey& p_key)
+	{
+		return Rate::fromDouble(StandInService::rateFor(winrt::to_string(p_key.from_code),
+																		winrt::to_string(p_key.to_code),
+																		std::to_string(p_key.day)))
+			 .value_or(Rate{Rate::SCALE});
+	}
+
+	template <typename Cache>
+	void replay(Benchmarks::Reporter&						p_reporter,
+					const std::string&							p_label,
+					Cache&											p_cache,
+					const std::vector<HistoricalQuoteKey>& p_trace,
+					const std::vector<Rate>&					p_rates)
+	{
+		std::size_t hits	  = 0;
+		const auto	seconds = Benchmarks::secondsFor([&] {
+			 for (std::size_t i = 0; i < std::size(p_trace); ++i)
+			 {
+				 if (p_cache.get(p_trace[i]).has_value())
+					 ++hits;
+				 else
+					 p_cache.put(p_trace[i], p_rates[i]);
+			 }
+		 });
+
+		p_reporter.report(p_label, "hit_ratio", static_cast<double>(hits) / std::size(p_trace));
+		p_reporter.report(p_label, "lookups_per_sec", std::size(p_trace) / seconds);
+	}
+
+	void replayTiered(Benchmarks::Reporter&						p_reporter,
+							const std::string&							p_label,
+							const std::vector<HistoricalQuoteKey>& p_trace,
+							const std::vector<Rate>&					p_rates)
+	{
+		HistoricalQuoteOptions options;
+		options.max_stored_quotes = STORED_QUOTES;
+
+		// Of its own, as such the Counts are of this Run alone
+		TUESL::Metrics::Registry registry;
+		TUESL::SQLite::Database	 db{":memory:"};
+		std::mutex					 write_mutex;
+		HistoricalQuoteCache		 quotes{db, write_mutex, options, registry};
+
+		const auto lookups = (std::min)(std::size(p_trace), TIERED_LOOKUPS);
+		const auto seconds = Benchmarks::secondsFor([&] {
+			for (std::size_t i = 0; i < lookups; ++i)
+			{
+				const auto& key = p_trace[i];
+				if (!quotes.Find(key.from_code, key.to_code, key.day).has_value())
+					quotes.Store(key.from_code, key.to_code, key.day, p_rates[i]);
+			}
+		});
+
+		const auto statistics = quotes.Statistics();
+		p_reporter.report(p_label, "memory_hit_ratio", statistics.memoryHitRatio());
+		p_reporter.report(p_label, "hit_ratio", statistics.hitRatio());
+		p_reporter.report(p_label, "lookups_per_sec", lookups / seconds);
+		p_reporter.report(p_label, "stored_quotes", static_cast<double>(statistics.stored_quotes));
+		p_reporter.report(
+			 p_label, "memory_kb", static_cast<double>(statistics.memory_bytes) / 1024.0);
+	}
+} // namespace
+
+BENCHMARK(HistoricalQuoteCaches)
+{
+	const TraceBuilder builder;
+
+	for (const auto with_scans : {false, true})
+	{
+		const auto trace = builder.build(LOOKUPS, with_scans);
+		const auto name	= with_scans ? "zipf_scan"s : "zipf"s;
+
+		// Rated up front, as such neither Cache is Timed Formatting them
+		std::vector<Rate> rates;
+		rates.reserve(std::size(trace));
+		for (const auto& key : trace)
+			rates.push_back(rateOf(key));
+
+		for (const auto budget : BUDGETS)
+		{
+			const auto label = "quote_cache/"s + name + "/" + std::to_string(budget / 1024) + "kb/";
+
+			LruCache lru{budget};
+			replay(reporter, label + "lru", lru, trace, rates);
+
+			HistoricalQuoteCache::MemoryTier::Options options;
+			options.max_weight		  = budget;
+			options.expected_entries = budget / HistoricalQuoteCache::Weigh(trace.front(), Rate{});
+			HistoricalQuoteCache::MemoryTier tiny_lfu{options, HistoricalQuoteCache::Weigh};
+			replay(reporter, label + "wtinylfu", tiny_lfu, trace, rates);
+		}
+
+		replayTiered(reporter, "quote_cache/"s + name + "/tiered", trace, rates);
+	}
+}
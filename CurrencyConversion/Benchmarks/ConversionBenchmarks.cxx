@@ -0,0 +1,209 @@
+#include "pch.h"
+
+#include "Harness.hxx"
+
+#include <TUESL/Numeric/FixedPoint.hxx>
+#include <TUESL/Numeric/VectorKernels.hxx>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+// Throughput of the Kernels behind CurrencyConverter::ConvertBatch
+// Rates are Resolved before the Kernels run, as such only the Multiply is Measured
+// amounts_per_sec counts every Amount once per Target Currency
+
+namespace
+{
+	namespace Numeric = TUESL::Numeric;
+
+	using namespace std::string_literals;
+
+	constexpr const std::size_t AMOUNT_COUNTS[] = {1'000, 100'000, 10'000'000};
+	constexpr const std::size_t TARGET_COUNT	  = 16;
+
+	// Enough Passes that Small Batches run for a Measurable Time
+	constexpr const std::size_t CONVERSIONS_PER_RUN = 200'000'000;
+
+	struct Batch
+	{
+		std::vector<double> amounts;
+		std::vector<double> rates;
+		std::vector<double> values;
+	};
+
+	Batch makeBatch(const std::size_t p_amount_count)
+	{
+		std::mt19937_64								engine{7};
+		std::uniform_real_distribution<double> amount{0.01, 100'000.0};
+		std::uniform_real_distribution<double> rate{0.001, 500.0};
+
+		Batch batch;
+		batch.amounts.resize(p_amount_count);
+		batch.rates.resize(TARGET_COUNT);
+		batch.values.resize(p_amount_count * TARGET_COUNT);
+
+		for (auto& value : batch.amounts)
+			value = amount(engine);
+		for (auto& value : batch.rates)
+			value = rate(engine);
+		return batch;
+	}
+
+	template <typename Kernel>
+	void measure(Benchmarks::Reporter&  p_reporter,
+					 const std::string_view p_kernel_name,
+					 Kernel						p_kernel)
+	{
+		for (const auto count : AMOUNT_COUNTS)
+		{
+			auto		  batch	= makeBatch(count);
+			const auto passes = (std::max)(std::size_t{1},
+													 CONVERSIONS_PER_RUN / (count * TARGET_COUNT));
+
+			// Touches every Page of the Output before Timing
+			p_kernel(batch);
+
+			const auto seconds = Benchmarks::secondsFor([&] {
+				for (std::size_t pass = 0; pass < passes; ++pass)
+					p_kernel(batch);
+			});
+			Benchmarks::doNotOptimize(batch.values.back());
+
+			const auto label = "convert_batch/"s + std::string{p_kernel_name} + "/" +
+									 std::to_string(count);
+			p_reporter.report(
+				 label, "amounts_per_sec", double(count) * TARGET_COUNT * passes / seconds);
+		}
+	}
+
+} // namespace
+
+BENCHMARK(ConvertBatchKernels)
+{
+	// One Rate at a Time, as Callers of GetConvertedCurrencyValue do
+	measure(reporter, "per_amount", [](Batch& p_batch) {
+		const auto count = std::size(p_batch.amounts);
+		for (std::size_t row = 0; row < TARGET_COUNT; ++row)
+			for (std::size_t i = 0; i < count; ++i)
+				Numeric::Kernels::scaleScalar(&p_batch.amounts[i],
+														1,
+														p_batch.rates[row],
+														&p_batch.values[row * count + i]);
+	});
+
+	measure(reporter, "scalar", [](Batch& p_batch) {
+		const auto count = std::size(p_batch.amounts);
+		for (std::size_t row = 0; row < TARGET_COUNT; ++row)
+			Numeric::Kernels::scaleScalar(std::data(p_batch.amounts),
+													count,
+													p_batch.rates[row],
+													std::data(p_batch.values) + row * count);
+	});
+
+	if (Numeric::detectInstructionSet() == Numeric::InstructionSet::AVX2)
+	{
+		measure(reporter, "avx2", [](Batch& p_batch) {
+			const auto count = std::size(p_batch.amounts);
+			for (std::size_t row = 0; row < TARGET_COUNT; ++row)
+				Numeric::Kernels::scaleAVX2(std::data(p_batch.amounts),
+													 count,
+													 p_batch.rates[row],
+													 std::data(p_batch.values) + row * count);
+		});
+	}
+
+	// What ConvertBatch runs, Tiled and Dispatched
+	measure(reporter, "scale_outer", [](Batch& p_batch) {
+		Numeric::scaleOuter(std::data(p_batch.amounts),
+								  std::size(p_batch.amounts),
+								  std::data(p_batch.rates),
+								  std::size(p_batch.rates),
+								  std::data(p_batch.values));
+	});
+}
+
+// Fixed Point against the double Path on the same Amounts and Rates
+// Amounts are Whole Minor Units, Rates have 6 Decimals as Quoted by the Service
+// double_mismatches counts double Results which, Rounded to Money::DECIMALS,
+// differ from the Exact Result
+BENCHMARK(ConvertBatchFixedPoint)
+{
+	using Numeric::Money;
+	using Numeric::Rate;
+
+	for (const auto count : AMOUNT_COUNTS)
+	{
+		std::mt19937_64									engine{11};
+		std::uniform_int_distribution<std::int64_t> amount{1, 10'000'000'000};
+		std::uniform_int_distribution<std::int64_t> rate{1'000, 500'000'000};
+
+		std::vector<Money>  amounts(count);
+		std::vector<double> double_amounts(count);
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			amounts[i]			 = Money{amount(engine)};
+			double_amounts[i] = amounts[i].toDouble();
+		}
+
+		std::vector<Rate>	 rates(TARGET_COUNT);
+		std::vector<double> double_rates(TARGET_COUNT);
+		for (std::size_t i = 0; i < TARGET_COUNT; ++i)
+		{
+			rates[i]			  = Rate{rate(engine) * 1'000};
+			double_rates[i] = rates[i].toDouble();
+		}
+
+		std::vector<Money>  values(count * TARGET_COUNT);
+		std::vector<double> double_values(count * TARGET_COUNT);
+
+		const auto passes =
+			 (std::max)(std::size_t{1}, CONVERSIONS_PER_RUN / (count * TARGET_COUNT));
+
+		const auto run_fixed = [&] {
+			return Numeric::convertOuter(std::data(amounts),
+												  count,
+												  std::data(rates),
+												  TARGET_COUNT,
+												  std::data(values));
+		};
+		const auto run_double = [&] {
+			Numeric::scaleOuter(std::data(double_amounts),
+									  count,
+									  std::data(double_rates),
+									  TARGET_COUNT,
+									  std::data(double_values));
+		};
+
+		run_fixed();
+		run_double();
+
+		const auto fixed_seconds = Benchmarks::secondsFor([&] {
+			for (std::size_t pass = 0; pass < passes; ++pass)
+				Benchmarks::doNotOptimize(run_fixed());
+		});
+		const auto double_seconds = Benchmarks::secondsFor([&] {
+			for (std::size_t pass = 0; pass < passes; ++pass)
+				run_double();
+		});
+		Benchmarks::doNotOptimize(double_values.back());
+
+		std::size_t mismatches = 0;
+		for (std::size_t i = 0; i < std::size(values); ++i)
+		{
+			const auto rounded = std::llround(double_values[i] * Money::SCALE);
+			if (rounded != values[i].units)
+				++mismatches;
+		}
+
+		const double conversions = double(count) * TARGET_COUNT * passes;
+		const auto	 label		  = "convert_batch/fixed_point/"s + std::to_string(count);
+
+		reporter.report(label, "amounts_per_sec", conversions / fixed_seconds);
+		reporter.report(label, "double_amounts_per_sec", conversions / double_seconds);
+		reporter.report(label, "slowdown_vs_double", fixed_seconds / double_seconds);
+		reporter.report(label, "double_mismatches", double(mismatches));
+	}
+}
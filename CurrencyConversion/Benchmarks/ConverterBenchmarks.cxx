@@ -0,0 +1,239 @@
+#include "pch.h"
+
+#include "Harness.hxx"
+#include "StandInService.hxx"
+
+#include "CurrencyConverter.hxx"
+
+#include <TUESL/SQLite/Database.hxx>
+#include <TUESL/SQLite/PrepareStatement.hxx>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// CurrencyConverter as the App uses it, against a Stand in for the Converter Service
+// At each Scale the Rates Table holds that many Rows before anything is Timed
+//
+// ingest_currencies	Fetches and Stores the Currency List on a Cold Start
+// insert				InsertCurrencyValue, which Stores a Rate and its Inverse
+// hit					GetConvertedCurrencyValue of a Pair already in Memory
+// miss					GetConvertedCurrencyValue of a Pair nowhere Cached
+//							Searches the Table by its Pair Index, then Fetches from the Stand in
+// expire				Removes every Row through the Bounded Batches the Service runs
+//
+// The Rate Graph is Dense over the Currency List, as such the List is never Longer
+// than the Service could Plausibly Return, whatever the Scale
+// At 10M Rows the Database takes about a Gigabyte of Memory
+
+namespace
+{
+	namespace SQLite = TUESL::SQLite;
+
+	using Benchmarks::StandInService;
+
+	using Currency::CurrencyConverter;
+	using Currency::DatabaseMode;
+	using Currency::StorageFolders;
+	using Currency::UpstreamProvider;
+	using Currency::UpstreamService;
+
+	using winrt::hstring;
+
+	using namespace std::string_literals;
+
+	constexpr const std::size_t MAX_CURRENCY_COUNT = 1'000;
+	// Rates are Inserted and Looked up among the first Codes of the List
+	// Misses use Codes after them, which no Route can reach
+	constexpr const std::size_t CACHED_CODE_COUNT = 32;
+
+	constexpr const std::size_t INSERT_COUNT = 10'000;
+	constexpr const std::size_t HIT_COUNT	  = 100'000;
+	// Each Miss Waits on the Stand in, as such few of them are enough
+	constexpr const std::size_t MISS_COUNT	  = 20;
+	// Codes Seeded Rows are Stored under, none of them is Listed
+	constexpr const std::size_t SEED_CODE_COUNT = 170;
+
+	std::string label(const std::string_view p_operation, const std::size_t p_count)
+	{
+		return "converter/"s + std::string{p_operation} + "/" + std::to_string(p_count);
+	}
+
+	// Generous enough that the Scheduler never holds a Request back
+	UpstreamService standInUpstream(const StandInService& p_service)
+	{
+		TUESL::Net::RequestScheduler::Options budget;
+		budget.requests_per_second = 1'000'000.0;
+		budget.burst					= 1'000'000.0;
+		budget.max_in_flight			= 16;
+
+		UpstreamService upstream;
+		upstream.providers.push_back(UpstreamProvider::ForConverterAPI(
+			 "stand_in", hstring{p_service.rootUrl()}, budget));
+		return upstream;
+	}
+
+	// Appends p_count Rows to the Table the Converter Flushed to Disk
+	// Rows are as Recent as those the Converter Inserts, as such none of them Expire early
+	void seedRates(const std::wstring& p_directory, const std::size_t p_count)
+	{
+		SQLite::Database db{winrt::to_string(p_directory) + "\\" + Currency::DATABASE_NAME};
+
+		std::vector<std::string> codes;
+		for (std::size_t i = 0; i < SEED_CODE_COUNT; ++i)
+		{
+			char code[8];
+			std::snprintf(code, sizeof(code), "S%03zu", i);
+			codes.push_back(code);
+		}
+
+		SQLite::PrepareStatement ps{
+			 db,
+			 "INSERT INTO "s + Currency::TableNames::TABLE_CURRENCY_VALUES + " VALUES(?,?,?,?);"};
+		const auto time = winrt::clock::now().time_since_epoch().count();
+
+		db.transactionBegin();
+		for (std::size_t i = 0; i < p_count; ++i)
+		{
+			ps.restart();
+			ps.bind(std::string_view{codes[i % SEED_CODE_COUNT]});
+			ps.bind(std::string_view{codes[(i / SEED_CODE_COUNT + i + 1) % SEED_CODE_COUNT]});
+			ps.bind(static_cast<SQLite::DataTypes::Int64>(TUESL::Numeric::Rate::SCALE));
+			// A Tick apart, as a Pair holds one Rate per Time
+			ps.bind(static_cast<SQLite::DataTypes::Int64>(time - static_cast<std::int64_t>(i)));
+			ps.execute();
+		}
+		db.transactionEnd();
+	}
+
+	double percentileMicroseconds(std::vector<double> p_microseconds, const double p_percentile)
+	{
+		if (std::empty(p_microseconds))
+			return 0.0;
+
+		std::sort(std::begin(p_microseconds), std::end(p_microseconds));
+		const auto last = static_cast<double>(std::size(p_microseconds) - 1);
+		return p_microseconds[static_cast<std::size_t>(p_percentile / 100.0 * last)];
+	}
+} // namespace
+
+BENCHMARK(Converter)
+{
+	for (const auto count : Benchmarks::rowScales())
+	{
+		const auto currency_count = (std::min)(count, MAX_CURRENCY_COUNT);
+
+		StandInService service{currency_count};
+		if (std::empty(service.rootUrl()))
+			return;
+
+		const auto directory =
+			 Benchmarks::scratchDirectory(L"Converter" + std::to_wstring(count));
+		const StorageFolders folders{hstring{directory}, hstring{directory}};
+
+		// Cold Start, the List is Fetched and then Written to Disk
+		{
+			CurrencyConverter converter{
+				 DatabaseMode::IN_MEMORY, folders, standInUpstream(service)};
+
+			const auto seconds =
+				 Benchmarks::secondsFor([&] { converter.SetupTableCurrencyIDs().get(); });
+			reporter.report(
+				 label("ingest_currencies", count), "currencies", double(currency_count));
+			reporter.report(label("ingest_currencies", count), "currencies_per_sec",
+								 currency_count / seconds);
+
+			converter.FlushDatabase();
+		}
+
+		seedRates(directory, count);
+
+		// Restored with the Seeded Rows, the List is then Loaded from the Database
+		CurrencyConverter converter{DatabaseMode::IN_MEMORY, folders, standInUpstream(service)};
+		converter.SetupTableCurrencyIDs().get();
+
+		std::vector<hstring> codes;
+		for (std::size_t i = 0; i < currency_count; ++i)
+			codes.push_back(winrt::to_hstring(StandInService::currencyCode(i)));
+
+		const auto pair_codes = (std::min)(CACHED_CODE_COUNT, currency_count);
+		const auto from_code	 = [&](const std::size_t p_i) { return codes[p_i % pair_codes]; };
+		const auto to_code	 = [&](const std::size_t p_i) {
+			 return codes[(p_i / pair_codes + p_i + 1) % pair_codes];
+		};
+
+		const auto insert_seconds = Benchmarks::secondsFor([&] {
+			for (std::size_t i = 0; i < INSERT_COUNT; ++i)
+			{
+				if (from_code(i) == to_code(i))
+					continue;
+				converter.InsertCurrencyValue(
+					 from_code(i),
+					 to_code(i),
+					 TUESL::Numeric::Rate::fromDouble(
+						  StandInService::rateFor(winrt::to_string(from_code(i)),
+														  winrt::to_string(to_code(i))))
+						  .value_or(TUESL::Numeric::Rate{TUESL::Numeric::Rate::SCALE}));
+			}
+		});
+		// Each Stores the Rate and its Inverse
+		reporter.report(
+			 label("insert", count), "rows_per_sec", 2 * INSERT_COUNT / insert_seconds);
+
+		const auto hit_seconds = Benchmarks::secondsFor([&] {
+			double sum = 0.0;
+			for (std::size_t i = 0; i < HIT_COUNT; ++i)
+				sum += converter.GetConvertedCurrencyValue(from_code(i), to_code(i)).get();
+			Benchmarks::doNotOptimize(sum);
+		});
+		reporter.report(label("hit", count), "lookups_per_sec", HIT_COUNT / hit_seconds);
+
+		// Pairs Disjoint from each other and from those Cached
+		std::vector<double> miss_microseconds;
+		const auto			  requests_before = service.requests();
+		for (std::size_t i = 0; i < MISS_COUNT && pair_codes + 2 * i + 1 < currency_count; ++i)
+		{
+			const auto seconds = Benchmarks::secondsFor([&] {
+				Benchmarks::doNotOptimize(
+					 converter
+						  .GetConvertedCurrencyValue(codes[pair_codes + 2 * i],
+															  codes[pair_codes + 2 * i + 1])
+						  .get());
+			});
+			miss_microseconds.push_back(seconds * 1'000'000.0);
+		}
+		if (!std::empty(miss_microseconds))
+		{
+			double total = 0.0;
+			for (const auto microseconds : miss_microseconds)
+				total += microseconds;
+
+			reporter.report(label("miss", count), "latency_mean_us",
+								 total / std::size(miss_microseconds));
+			reporter.report(label("miss", count), "latency_p99_us",
+								 percentileMicroseconds(miss_microseconds, 99.0));
+			reporter.report(label("miss", count), "upstream_requests",
+								 double(service.requests() - requests_before));
+		}
+
+		// Every Row is older than this
+		const auto cutoff = winrt::clock::now().time_since_epoch() + std::chrono::hours{1};
+
+		std::int64_t				  rows_reclaimed = 0;
+		std::chrono::microseconds max_pause{0};
+		const auto					  expire_seconds = Benchmarks::secondsFor([&] {
+			 while (true)
+			 {
+				 const auto statistics = converter.ExpireCurrencyValuesOlderThanTime(cutoff);
+				 rows_reclaimed += statistics.rows_reclaimed;
+				 max_pause = (std::max)(max_pause, statistics.max_pause);
+				 if (statistics.rows_reclaimed == 0)
+					 break;
+			 }
+		});
+		reporter.report(label("expire", count), "rows_per_sec", rows_reclaimed / expire_seconds);
+		reporter.report(label("expire", count), "max_pause_us", double(max_pause.count()));
+	}
+}
@@ -0,0 +1,91 @@
+#include "pch.h"
+
+#include "Harness.hxx"
+
+#include <TUESL/Utility/FileSystem.hxx>
+
+#include <algorithm>
+#include <iomanip>
+
+namespace Benchmarks
+{
+	void Reporter::report(const std::string_view p_benchmark,
+								 const std::string_view p_metric,
+								 const double			  p_value)
+	{
+		// Names are Internal Identifiers, as such never need Escaping
+		m_out << R"({"benchmark":")" << p_benchmark << R"(","metric":")" << p_metric
+				<< R"(","value":)" << std::setprecision(17) << p_value << "}\n";
+		m_out.flush();
+	}
+
+	Registration::Registration(const char* p_name, BenchmarkFunction p_function)
+	{
+		registry().push_back(RegisteredBenchmark{p_name, p_function});
+	}
+
+	std::vector<RegisteredBenchmark>& registry()
+	{
+		// Function Local so that it is Constructed before any Registration
+		static std::vector<RegisteredBenchmark> benchmarks;
+		return benchmarks;
+	}
+
+	void escape(const void* p_value) noexcept
+	{
+		static const void* volatile sink;
+		sink = p_value;
+	}
+
+	namespace
+	{
+		std::vector<std::size_t>& mutableRowScales()
+		{
+			static std::vector<std::size_t> scales{1'000, 100'000, 10'000'000};
+			return scales;
+		}
+	} // namespace
+
+	const std::vector<std::size_t>& rowScales()
+	{
+		return mutableRowScales();
+	}
+
+	void limitRowScales(const std::size_t p_max_rows)
+	{
+		auto& scales = mutableRowScales();
+		scales.erase(std::remove_if(std::begin(scales),
+											 std::end(scales),
+											 [&](const std::size_t p_rows) { return p_rows > p_max_rows; }),
+						 std::end(scales));
+	}
+
+	std::wstring scratchDirectory(const std::wstring_view p_name)
+	{
+		wchar_t temp_path[MAX_PATH + 1]{};
+		GetTempPathW(MAX_PATH + 1, temp_path);
+
+		const std::wstring root = std::wstring{temp_path} + L"CurrencyBenchmarks";
+		TUESL::Utility::FileSystem::createDirectory(root);
+
+		const std::wstring directory = root + L"\\" + std::wstring{p_name};
+		TUESL::Utility::FileSystem::createDirectory(directory);
+
+		// Leftovers from a Previous Run would Skew the Results
+		WIN32_FIND_DATAW find_data{};
+		const std::wstring pattern = directory + L"\\*";
+
+		const HANDLE find = FindFirstFileW(pattern.c_str(), &find_data);
+		if (find != INVALID_HANDLE_VALUE)
+		{
+			do
+			{
+				if ((find_data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) == 0)
+					DeleteFileW((directory + L"\\" + find_data.cFileName).c_str());
+			} while (FindNextFileW(find, &find_data));
+			FindClose(find);
+		}
+
+		return directory;
+	}
+} // namespace Benchmarks
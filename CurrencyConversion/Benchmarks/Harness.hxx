@@ -0,0 +1,84 @@
+#pragma once
+
+// Minimal Benchmark Harness
+// Results are written as one JSON Object per Line
+// So that Runs of different Versions can be Parsed and Compared
+//
+// Example
+//	BENCHMARK(TimeSeriesIngest)
+//	{
+//		const auto seconds = Benchmarks::secondsFor([&] { ... });
+//		reporter.report("timeseries/ingest", "samples_per_sec", n / seconds);
+//	}
+
+#include <chrono>
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Benchmarks
+{
+	class Reporter
+	{
+	 private:
+		std::ostream& m_out;
+
+	 public:
+		explicit Reporter(std::ostream& p_out) : m_out{p_out} {}
+
+		void report(const std::string_view p_benchmark,
+						const std::string_view p_metric,
+						const double			  p_value);
+	};
+
+	using BenchmarkFunction = void (*)(Reporter&);
+
+	struct Registration
+	{
+		Registration(const char* p_name, BenchmarkFunction p_function);
+	};
+
+	struct RegisteredBenchmark
+	{
+		const char*			name;
+		BenchmarkFunction function;
+	};
+
+	std::vector<RegisteredBenchmark>& registry();
+
+	template <typename Function>
+	double secondsFor(Function&& p_function)
+	{
+		using std::chrono::duration;
+		using std::chrono::steady_clock;
+
+		const auto start = steady_clock::now();
+		p_function();
+		return duration<double>(steady_clock::now() - start).count();
+	}
+
+	// Defined out of Line, as such the Optimiser must assume p_value is Read
+	void escape(const void* p_value) noexcept;
+
+	// Prevents the Optimiser from Discarding a Result
+	template <typename Value>
+	void doNotOptimize(const Value& p_value)
+	{
+		escape(&p_value);
+	}
+
+	// Fresh Directory under the Temporary Folder for one Benchmark
+	std::wstring scratchDirectory(const std::wstring_view p_name);
+
+	// Row Counts that Benchmarks which Scale are Run at, 1k, 100k and 10M
+	// Less those above the Limit given to limitRowScales
+	const std::vector<std::size_t>& rowScales();
+	void									  limitRowScales(const std::size_t p_max_rows);
+} // namespace Benchmarks
+
+#define BENCHMARK(name)                                                    \
+	static void									  name(Benchmarks::Reporter&);      \
+	static const Benchmarks::Registration name##_registration{#name, &name}; \
+	static void									  name(Benchmarks::Reporter& reporter)
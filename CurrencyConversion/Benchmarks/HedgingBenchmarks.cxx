@@ -0,0 +1,176 @@
+#include "pch.h"
+
+#include "Harness.hxx"
+#include "StandInService.hxx"
+
+#include "HedgedUpstream.hxx"
+
+#include <TUESL/Metrics/Registry.hxx>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Rate Lookups through HedgedUpstream, against Stand ins whose Answers have a Tail
+//
+// Every Stand in Answers in TYPICAL_DELAY, bar SLOW_FRACTION of Answers which take
+// SLOW_DELAY, Picked independently per Stand in
+// The Fraction is below 5 Percent, as such each Provider's p95 is its Typical Latency
+//
+// single		The Primary alone, the Tail is Waited out
+// hedged		A Backup with another Schema, Asked once the Primary is past its p95
+// hedged_two	Two Backups, each Asked once the one before is past its p95
+//
+// p50, p95 and p99 are of whole Lookups, in Milliseconds
+// requests_per_lookup is what Hedging costs in Upstream Budget, 1 without it
+// wrong_rates Counts Lookups whose Rate is not the one Served, always 0
+
+namespace
+{
+	using Benchmarks::InjectedDelay;
+	using Benchmarks::StandInService;
+
+	using Currency::HedgedUpstream;
+	using Currency::HedgeOptions;
+	using Currency::UpstreamProvider;
+
+	using TUESL::Numeric::Rate;
+
+	using winrt::hstring;
+
+	using namespace std::chrono_literals;
+	using namespace std::string_literals;
+
+	constexpr const std::size_t CURRENCY_COUNT = 170;
+	// Enough for every Provider's Window to hold HedgeOptions::min_samples Answers
+	constexpr const std::size_t WARM_UP_LOOKUPS = 64;
+	constexpr const std::size_t LOOKUPS			= 400;
+
+	constexpr const auto	  TYPICAL_DELAY = 2ms;
+	constexpr const auto	  SLOW_DELAY	 = 200ms;
+	constexpr const double SLOW_FRACTION = 0.03;
+
+	// Generous enough that the Scheduler never holds a Request back
+	TUESL::Net::RequestScheduler::Options standInBudget()
+	{
+		TUESL::Net::RequestScheduler::Options budget;
+		budget.requests_per_second = 1'000'000.0;
+		budget.burst					= 1'000'000.0;
+		budget.max_in_flight			= 16;
+		return budget;
+	}
+
+	// As the Stand in Formats it
+	Rate servedRate(const std::string& p_from_code, const std::string& p_to_code)
+	{
+		char text[32];
+		std::snprintf(text, sizeof(text), "%.6f", StandInService::rateFor(p_from_code, p_to_code));
+		return Rate::parse(text).value_or(Rate{});
+	}
+
+	double percentileMilliseconds(std::vector<double> p_milliseconds, const double p_percentile)
+	{
+		if (std::empty(p_milliseconds))
+			return 0.0;
+
+		std::sort(std::begin(p_milliseconds), std::end(p_milliseconds));
+		const auto last = static_cast<double>(std::size(p_milliseconds) - 1);
+		return p_milliseconds[static_cast<std::size_t>(p_percentile / 100.0 * last)];
+	}
+
+	void lookUpRates(Benchmarks::Reporter&								  p_reporter,
+						  const std::string&									  p_name,
+						  const std::vector<std::unique_ptr<StandInService>>& p_services,
+						  std::vector<UpstreamProvider>						  p_providers)
+	{
+		const auto label = "hedging/"s + p_name;
+
+		HedgeOptions options;
+		options.max_backups = std::size(p_providers) - 1;
+
+		// Of its own, as such the Counts are of this Run alone
+		TUESL::Metrics::Registry registry;
+		HedgedUpstream				 upstream{std::move(p_providers), options, registry};
+
+		std::size_t next_pair = 0;
+		const auto	lookUp	 = [&] {
+			 const auto from = StandInService::currencyCode(next_pair % CURRENCY_COUNT);
+			 const auto to	  = StandInService::currencyCode((next_pair * 7 + 1) % CURRENCY_COUNT);
+			 ++next_pair;
+
+			 const auto units =
+				  upstream.FetchRate(winrt::to_hstring(from), winrt::to_hstring(to)).get();
+			 return units == servedRate(from, to).units;
+		 };
+
+		for (std::size_t i = 0; i < WARM_UP_LOOKUPS; ++i)
+			lookUp();
+
+		std::uint64_t requests_before = 0;
+		for (const auto& service : p_services)
+			requests_before += service->requests();
+
+		std::vector<double> milliseconds;
+		milliseconds.reserve(LOOKUPS);
+		std::size_t wrong_rates = 0;
+
+		for (std::size_t i = 0; i < LOOKUPS; ++i)
+		{
+			bool is_right = false;
+			milliseconds.push_back(
+				 Benchmarks::secondsFor([&] { is_right = lookUp(); }) * 1'000.0);
+			if (!is_right)
+				++wrong_rates;
+		}
+
+		std::uint64_t requests_after = 0;
+		for (const auto& service : p_services)
+			requests_after += service->requests();
+
+		p_reporter.report(label, "p50_ms", percentileMilliseconds(milliseconds, 50.0));
+		p_reporter.report(label, "p95_ms", percentileMilliseconds(milliseconds, 95.0));
+		p_reporter.report(label, "p99_ms", percentileMilliseconds(milliseconds, 99.0));
+		p_reporter.report(label,
+								"requests_per_lookup",
+								static_cast<double>(requests_after - requests_before) / LOOKUPS);
+		p_reporter.report(label, "wrong_rates", static_cast<double>(wrong_rates));
+		p_reporter.report(
+			 label,
+			 "primary_hedge_delay_ms",
+			 std::chrono::duration<double, std::milli>(upstream.HedgeDelay(0)).count());
+	}
+} // namespace
+
+BENCHMARK(HedgedUpstreamLookups)
+{
+	// Each with a Tail of its own
+	std::vector<std::unique_ptr<StandInService>> services;
+	for (std::uint64_t seed = 1; seed <= 3; ++seed)
+	{
+		services.push_back(std::make_unique<StandInService>(CURRENCY_COUNT));
+		if (std::empty(services.back()->rootUrl()))
+			return;
+
+		InjectedDelay delay;
+		delay.typical		  = TYPICAL_DELAY;
+		delay.slow_fraction = SLOW_FRACTION;
+		delay.slow			  = SLOW_DELAY;
+		delay.seed			  = seed;
+		services.back()->setDelay(delay);
+	}
+
+	const auto budget	 = standInBudget();
+	const auto primary = UpstreamProvider::ForConverterAPI(
+		 "primary", hstring{services[0]->rootUrl()}, budget);
+	const auto backup = UpstreamProvider::ForRatesByBase(
+		 "backup", hstring{services[1]->rootUrl()}, budget);
+	const auto second_backup = UpstreamProvider::ForConverterAPI(
+		 "second_backup", hstring{services[2]->rootUrl()}, budget);
+
+	lookUpRates(reporter, "single", services, {primary});
+	lookUpRates(reporter, "hedged", services, {primary, backup});
+	lookUpRates(reporter, "hedged_two", services, {primary, backup, second_backup});
+}
@@ -0,0 +1,161 @@
+#include "pch.h"
+
+#include "Harness.hxx"
+
+#include "CurrencyConverter.hxx"
+#include "ReferenceRates.hxx"
+
+#include <TUESL/Utility/DelimiterScan.hxx>
+#include <TUESL/Utility/FileSystem.hxx>
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// Importing a Historical Reference Rate File as the ECB Publishes it, a Column per Currency
+//
+// scan/scalar and scan/vector find every Comma and Line End, in MB of File per Second
+// read is ReadReferenceRates alone, which Parses each Field the Scan finds
+// import is ImportReferenceRates into an In Memory Database, Rate and Inverse each a Row
+//
+// The File is Written a Day at a Time, as such only the Mapped Pages are ever Resident
+// Imports above 1M Rates are left out, 20M Rows would take about two Gigabytes of Memory
+
+namespace
+{
+	namespace Utility = TUESL::Utility;
+
+	using Currency::CurrencyConverter;
+	using Currency::DatabaseMode;
+	using Currency::StorageFolders;
+
+	using winrt::hstring;
+
+	using namespace std::string_literals;
+
+	// As many Currencies as eurofxref-hist.csv has
+	constexpr const std::size_t CURRENCY_COUNT	  = 41;
+	constexpr const std::size_t MAX_IMPORT_RATES = 1'000'000;
+
+	std::string label(const std::string_view p_operation, const std::size_t p_count)
+	{
+		return "import/"s + std::string{p_operation} + "/" + std::to_string(p_count);
+	}
+
+	// Days go Back from the End of 2023, newest first, as in the File of the ECB
+	std::string dayOf(const std::size_t p_day)
+	{
+		const auto year  = 2023 - static_cast<int>(p_day / 336);
+		const auto month = 12 - static_cast<int>(p_day / 28 % 12);
+		const auto day	  = 28 - static_cast<int>(p_day % 28);
+
+		char text[16];
+		std::snprintf(text, sizeof(text), "%04d-%02d-%02d", year, month, day);
+		return text;
+	}
+
+	// At least p_rates Rates, a Row of CURRENCY_COUNT per Day
+	// Returns the Size of the File
+	std::size_t writeRateFile(const std::wstring& p_file_name, const std::size_t p_rates)
+	{
+		std::string text = "Date";
+		for (std::size_t i = 0; i < CURRENCY_COUNT; ++i)
+		{
+			char code[8];
+			std::snprintf(code, sizeof(code), ",C%02zu", i);
+			text += code;
+		}
+		text += ",\r\n";
+
+		std::size_t size = 0;
+		for (std::size_t day = 0; day * CURRENCY_COUNT < p_rates; ++day)
+		{
+			text += dayOf(day);
+			// Every Tenth Currency has no Rate, as Currencies the ECB no longer Quotes
+			for (std::size_t i = 0; i < CURRENCY_COUNT; ++i)
+			{
+				if (i % 10 == 9)
+					text += ",N/A";
+				else
+					text += ","s + std::to_string(1 + i) + ".0" + std::to_string(day % 97);
+			}
+			text += ",\r\n";
+
+			if (std::size(text) >= (1 << 20))
+			{
+				Utility::FileSystem::appendToFile(p_file_name, std::data(text), std::size(text));
+				size += std::size(text);
+				text.clear();
+			}
+		}
+
+		Utility::FileSystem::appendToFile(p_file_name, std::data(text), std::size(text));
+		return size + std::size(text);
+	}
+
+	std::size_t countDelimiters(const std::string_view					 p_text,
+										 const Utility::Kernels::DelimiterMask p_kernel)
+	{
+		Utility::DelimiterScanner scanner{p_text, Utility::Delimiters{",\n"}, p_kernel};
+
+		std::size_t count = 0;
+		while (scanner.next() != std::string_view::npos)
+			++count;
+		return count;
+	}
+} // namespace
+
+BENCHMARK(ReferenceRateImport)
+{
+	for (const auto count : Benchmarks::rowScales())
+	{
+		const auto directory = Benchmarks::scratchDirectory(L"Import" + std::to_wstring(count));
+		const auto file_name = directory + L"\\eurofxref-hist.csv";
+		const auto bytes		= writeRateFile(file_name, count);
+
+		Utility::MemoryMappedFile file{file_name};
+		const std::string_view	  text{reinterpret_cast<const char*>(file.data()), file.size()};
+
+		for (const auto& [variant, kernel] :
+			  {std::pair{"scalar", Utility::Kernels::delimiterMaskScalar},
+				std::pair{"vector", Utility::Kernels::delimiterMaskVector}})
+		{
+			std::size_t delimiters = 0;
+			const auto	seconds =
+				 Benchmarks::secondsFor([&] { delimiters = countDelimiters(text, kernel); });
+			Benchmarks::doNotOptimize(delimiters);
+			reporter.report(
+				 label("scan/"s + variant, count), "mb_per_sec", bytes / seconds / 1'000'000.0);
+		}
+
+		Currency::ReferenceRateStatistics read;
+		const auto read_seconds = Benchmarks::secondsFor([&] {
+			read = Currency::ReadReferenceRates(text, [](const Currency::ReferenceRate& p_rate) {
+				Benchmarks::doNotOptimize(p_rate);
+			});
+		});
+		reporter.report(label("read", count), "rates_per_sec", read.rates / read_seconds);
+		reporter.report(label("read", count), "mb_per_sec", bytes / read_seconds / 1'000'000.0);
+
+		if (count > MAX_IMPORT_RATES)
+			continue;
+
+		const StorageFolders folders{hstring{directory}, hstring{directory}};
+		CurrencyConverter		converter{DatabaseMode::IN_MEMORY, folders};
+
+		std::optional<Currency::ImportStatistics> imported;
+		const auto import_seconds = Benchmarks::secondsFor(
+			 [&] { imported = converter.ImportReferenceRates(hstring{file_name}); });
+
+		if (!imported.has_value())
+			continue;
+
+		reporter.report(
+			 label("import", count), "rates_per_sec", imported->rates / import_seconds);
+		reporter.report(
+			 label("import", count), "rows_per_sec", imported->rows_inserted / import_seconds);
+		reporter.report(
+			 label("import", count), "transactions", static_cast<double>(imported->transactions));
+	}
+}
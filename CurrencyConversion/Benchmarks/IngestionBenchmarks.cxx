@@ -0,0 +1,215 @@
+#include "pch.h"
+
+#include "Allocations.hxx"
+#include "Harness.hxx"
+
+#include <TUESL/SQLite/Database.hxx>
+#include <TUESL/SQLite/PrepareStatement.hxx>
+#include <TUESL/Utility/Arena.hxx>
+
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+// Allocations per Refresh of the Currency List, before and after the Arena
+// A Refresh Inserts every Currency and then Reads the Rows back, as the Change Listener does
+//
+// previous mirrors the Code as it was
+//	The Statement is Prepared for every Row
+//	Every JSON Key is Converted to a new String per Lookup, as to_hstring did
+//	Rows are Read back as std::optional<std::string> Copies
+// arena is the Code as it is now
+//	The Statement is Prepared once and Restarted per Row
+//	Keys are Literals
+//	Rows are Read into an Arena which is Reset once per Refresh
+//
+// Strings stand in for hstring, which Allocates for every non Empty Value
+
+namespace
+{
+	namespace SQLite = TUESL::SQLite;
+
+	using TUESL::Utility::Arena;
+
+	using namespace std::string_literals;
+
+	// About as many as the Web Service Returns
+	constexpr const std::size_t CURRENCY_COUNT = 170;
+	constexpr const std::size_t REFRESH_COUNT	 = 200;
+
+	constexpr const auto KEY_ID	  = "id";
+	constexpr const auto KEY_NAME	  = "currencyName";
+	constexpr const auto KEY_SYMBOL = "currencySymbol";
+
+	struct Currency
+	{
+		std::string id;
+		std::string name;
+		std::string symbol;
+	};
+
+	std::vector<Currency> makeCurrencies()
+	{
+		std::vector<Currency> currencies;
+		for (std::size_t i = 0; i < CURRENCY_COUNT; ++i)
+		{
+			const auto number = std::to_string(i);
+			// Names are Longer than the Small String Buffer, as most Real ones are
+			currencies.push_back(
+				 Currency{"C" + number, "Currency Number " + number + " Dollar", "$" + number});
+		}
+		return currencies;
+	}
+
+	void createTable(SQLite::Database& p_db)
+	{
+		p_db.executeSQL("CREATE TABLE IF NOT EXISTS currencies(" + std::string{KEY_ID} +
+							 " TEXT PRIMARY KEY," + KEY_NAME + " TEXT," + KEY_SYMBOL + " TEXT);");
+	}
+
+	void previousRefresh(SQLite::Database& p_db, const std::vector<Currency>& p_currencies)
+	{
+		p_db.executeSQL("DELETE FROM currencies;");
+		p_db.transactionBegin();
+
+		const std::string sql = "INSERT OR IGNORE INTO currencies("s + KEY_ID + ","s + KEY_NAME +
+										","s + KEY_SYMBOL + ") VALUES(?,?,?);"s;
+
+		for (const auto& currency : p_currencies)
+		{
+			SQLite::PrepareStatement ps;
+			ps.prepare(p_db, sql);
+
+			// HasKey and GetNamedString each took a new Key
+			for (const auto key : {KEY_ID, KEY_ID, KEY_NAME, KEY_NAME, KEY_SYMBOL, KEY_SYMBOL})
+				Benchmarks::doNotOptimize(
+					 std::wstring{key, key + std::char_traits<char>::length(key)});
+
+			ps.bind(std::string_view{currency.id});
+			ps.bind(std::string_view{currency.name});
+			ps.bind(std::string_view{currency.symbol});
+			ps.execute();
+		}
+		p_db.transactionEnd();
+
+		const std::string select = "SELECT "s + KEY_ID + ","s + KEY_NAME + ","s + KEY_SYMBOL +
+											" FROM currencies ORDER BY "s + KEY_NAME;
+
+		SQLite::PrepareStatement ps;
+		ps.prepare(p_db, select);
+
+		std::vector<Currency> rows;
+		while (ps.hasNext())
+		{
+			Currency row;
+			row.id	  = ps.get<std::string>().value_or("");
+			row.name	  = ps.get<std::string>().value_or("");
+			row.symbol = ps.get<std::string>().value_or("");
+			rows.push_back(std::move(row));
+		}
+		Benchmarks::doNotOptimize(rows.back());
+	}
+
+	struct ArenaRow
+	{
+		std::pmr::string id;
+		std::pmr::string name;
+		std::pmr::string symbol;
+	};
+
+	void arenaRefresh(SQLite::Database&				p_db,
+							const std::vector<Currency>& p_currencies,
+							Arena&							  p_arena)
+	{
+		p_db.executeSQL("DELETE FROM currencies;");
+		p_db.transactionBegin();
+
+		static const std::string sql = "INSERT OR IGNORE INTO currencies("s + KEY_ID + ","s +
+												 KEY_NAME + ","s + KEY_SYMBOL + ") VALUES(?,?,?);"s;
+
+		SQLite::PrepareStatement insert;
+		insert.prepare(p_db, sql);
+
+		for (const auto& currency : p_currencies)
+		{
+			insert.restart();
+			insert.bind(std::string_view{currency.id});
+			insert.bind(std::string_view{currency.name});
+			insert.bind(std::string_view{currency.symbol});
+			insert.execute();
+		}
+		p_db.transactionEnd();
+
+		static const std::string select = "SELECT "s + KEY_ID + ","s + KEY_NAME + ","s +
+													 KEY_SYMBOL + " FROM currencies ORDER BY "s + KEY_NAME;
+
+		SQLite::PrepareStatement ps;
+		ps.prepare(p_db, select);
+
+		{
+			std::pmr::vector<ArenaRow> rows{&p_arena};
+			rows.reserve(std::size(p_currencies));
+
+			while (ps.hasNext())
+			{
+				// Moved, as a Copy would Allocate from the Default Resource
+				auto id		= ps.getString(0, &p_arena);
+				auto name	= ps.getString(1, &p_arena);
+				auto symbol = ps.getString(2, &p_arena);
+				const std::pmr::string empty{&p_arena};
+				rows.push_back(ArenaRow{std::move(id).value_or(empty),
+												std::move(name).value_or(empty),
+												std::move(symbol).value_or(empty)});
+			}
+			Benchmarks::doNotOptimize(rows.back());
+		}
+
+		// Everything the Refresh Allocated is Freed at once
+		p_arena.reset();
+	}
+
+	template <typename Refresh>
+	void measure(Benchmarks::Reporter&  p_reporter,
+					 const std::string_view p_variant,
+					 Refresh					p_refresh)
+	{
+		const auto currencies = makeCurrencies();
+
+		SQLite::Database db{""};
+		db.open(":memory:");
+		createTable(db);
+
+		// The first Refresh Warms Caches and lets the Arena Grow to fit
+		p_refresh(db, currencies);
+
+		const auto before	 = Benchmarks::allocationCount();
+		const auto seconds = Benchmarks::secondsFor([&] {
+			for (std::size_t refresh = 0; refresh < REFRESH_COUNT; ++refresh)
+				p_refresh(db, currencies);
+		});
+		const auto made = Benchmarks::allocationCount() - before;
+
+		const auto label = "refresh/"s + std::string{p_variant};
+		p_reporter.report(
+			 label, "heap_allocations_per_refresh", double(made.heap) / REFRESH_COUNT);
+		p_reporter.report(
+			 label, "sqlite_allocations_per_refresh", double(made.sqlite) / REFRESH_COUNT);
+		p_reporter.report(label, "refreshes_per_sec", REFRESH_COUNT / seconds);
+	}
+} // namespace
+
+BENCHMARK(RefreshAllocations)
+{
+	// Without it only the Heap is Counted
+	// Reported, as otherwise a Zero would look like a Result
+	reporter.report("refresh", "sqlite_counted", Benchmarks::countSQLiteAllocations() ? 1 : 0);
+
+	measure(reporter, "previous", &previousRefresh);
+
+	Arena arena;
+	measure(reporter,
+			  "arena",
+			  [&](SQLite::Database& p_db, const std::vector<Currency>& p_currencies) {
+				  arenaRefresh(p_db, p_currencies, arena);
+			  });
+}
@@ -0,0 +1,59 @@
+#include "pch.h"
+
+#include "Harness.hxx"
+#include "QueryPlanCheck.hxx"
+
+#include <iostream>
+#include <string>
+
+// Runs every Registered Benchmark
+// Or only those whose Name contains the first Argument
+// The second Argument Caps the Rows of Benchmarks that Scale
+//
+// --check-query-plans Checks the Plans of the Converter's Statements against a Baseline
+// instead, and Exits with 1 if any Regressed, see QueryPlanCheck.hxx
+// --record-query-plans Writes the Baseline
+// Either takes the Baseline File as the second Argument, QueryPlans.baseline by Default
+//
+// Example
+//	Benchmarks.exe TimeSeries > results.jsonl
+//	Benchmarks.exe SQLite 100000 > results.jsonl
+//	Benchmarks.exe --check-query-plans QueryPlans.baseline > plans.jsonl
+
+namespace
+{
+	constexpr const auto CHECK_QUERY_PLANS	= "--check-query-plans";
+	constexpr const auto RECORD_QUERY_PLANS = "--record-query-plans";
+	constexpr const auto DEFAULT_BASELINE	= "QueryPlans.baseline";
+} // namespace
+
+int main(int argc, char* argv[])
+{
+	const std::string filter = argc > 1 ? argv[1] : "";
+
+	// The Converter Waits on its Coroutines, which is not Allowed on a Single Threaded Apartment
+	winrt::init_apartment();
+
+	Benchmarks::Reporter reporter{std::cout};
+
+	if (filter == CHECK_QUERY_PLANS || filter == RECORD_QUERY_PLANS)
+	{
+		const std::string baseline_file = argc > 2 ? argv[2] : DEFAULT_BASELINE;
+		return Benchmarks::checkQueryPlans(
+			 reporter, baseline_file, filter == RECORD_QUERY_PLANS);
+	}
+
+	if (argc > 2)
+		Benchmarks::limitRowScales(std::stoull(argv[2]));
+
+	for (const auto& benchmark : Benchmarks::registry())
+	{
+		if (!std::empty(filter) && std::string{benchmark.name}.find(filter) == std::string::npos)
+			continue;
+
+		std::cerr << "Running " << benchmark.name << std::endl;
+		benchmark.function(reporter);
+	}
+
+	return 0;
+}
@@ -0,0 +1,160 @@
+#include "pch.h"
+
+#include "Harness.hxx"
+
+#include <TUESL/Numeric/HopBoundedPaths.hxx>
+#include <TUESL/Numeric/MinPlus.hxx>
+
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+// Cost of keeping the Best Routes between Currencies Current, as CurrencyConverter does
+// N = 200 is about every Currency the Service Quotes
+//
+// recompute runs whenever a Rate Falls or is Dropped
+// lower_weight runs whenever a Rate Rises or is New
+// Edges are Weighted -log(rate) of Random Rates
+// Sparse is a Cache Warmed by a few Conversions, Dense one where every Pair was Fetched
+
+namespace
+{
+	namespace Numeric = TUESL::Numeric;
+
+	using namespace std::string_literals;
+
+	constexpr const std::size_t CURRENCY_COUNT = 200;
+	// Up to 2 Intermediate Currencies, as with RateRoutes::MAX_INTERMEDIATE_CURRENCIES
+	constexpr const std::size_t MAX_EDGES = 3;
+
+	constexpr const std::size_t RECOMPUTES	  = 20;
+	constexpr const std::size_t PRODUCTS		  = 50;
+	constexpr const std::size_t WEIGHT_UPDATES = 2'000;
+
+	struct Density
+	{
+		const char* name;
+		double		edge_probability;
+	};
+	constexpr const Density DENSITIES[] = {{"sparse", 0.05}, {"dense", 1.0}};
+
+	float randomWeight(std::mt19937_64& p_engine)
+	{
+		std::uniform_real_distribution<double> rate{0.001, 500.0};
+		return static_cast<float>(-std::log(rate(p_engine)));
+	}
+
+	Numeric::HopBoundedPaths makePaths(const double p_edge_probability)
+	{
+		std::mt19937_64								engine{3};
+		std::bernoulli_distribution				has_edge{p_edge_probability};
+		Numeric::HopBoundedPaths					paths{CURRENCY_COUNT, MAX_EDGES};
+
+		for (std::size_t from = 0; from < CURRENCY_COUNT; ++from)
+			for (std::size_t to = 0; to < CURRENCY_COUNT; ++to)
+				if (from != to && has_edge(engine))
+					paths.setWeight(from, to, randomWeight(engine));
+
+		paths.recompute();
+		return paths;
+	}
+
+	// One Layer of a recompute, on a Single Kernel
+	template <typename Kernel>
+	void measureProduct(Benchmarks::Reporter&  p_reporter,
+							  const Density&			p_density,
+							  const std::string_view p_kernel_name,
+							  Kernel						p_kernel)
+	{
+		std::mt19937_64				 engine{5};
+		std::bernoulli_distribution has_edge{p_density.edge_probability};
+
+		const auto stride = Numeric::minPlusStride(CURRENCY_COUNT);
+
+		std::vector<float> weights(CURRENCY_COUNT * stride, Numeric::HopBoundedPaths::NO_EDGE);
+		for (std::size_t from = 0; from < CURRENCY_COUNT; ++from)
+			for (std::size_t to = 0; to < CURRENCY_COUNT; ++to)
+				if (from == to)
+					weights[from * stride + to] = 0.0f;
+				else if (has_edge(engine))
+					weights[from * stride + to] = randomWeight(engine);
+
+		std::vector<float> product = weights;
+		p_kernel(std::data(weights), std::data(weights), std::data(product), stride);
+
+		const auto seconds = Benchmarks::secondsFor([&] {
+			for (std::size_t i = 0; i < PRODUCTS; ++i)
+				p_kernel(std::data(weights), std::data(weights), std::data(product), stride);
+		});
+		Benchmarks::doNotOptimize(product.back());
+
+		const auto label = "min_plus/"s + p_density.name + "/" + std::string{p_kernel_name} +
+								 "/" + std::to_string(CURRENCY_COUNT);
+		p_reporter.report(label, "product_ms", seconds * 1'000 / PRODUCTS);
+	}
+} // namespace
+
+BENCHMARK(RatePathKernels)
+{
+	for (const auto& density : DENSITIES)
+	{
+		measureProduct(reporter,
+							density,
+							"scalar",
+							[](const float* p_a, const float* p_b, float* p_c, std::size_t p_stride) {
+								Numeric::Kernels::minPlusProductScalar(
+									 p_a, p_b, p_c, CURRENCY_COUNT, p_stride);
+							});
+
+		if (Numeric::detectInstructionSet() == Numeric::InstructionSet::AVX2)
+		{
+			measureProduct(
+				 reporter,
+				 density,
+				 "avx2",
+				 [](const float* p_a, const float* p_b, float* p_c, std::size_t p_stride) {
+					 Numeric::Kernels::minPlusProductAVX2(p_a, p_b, p_c, CURRENCY_COUNT, p_stride);
+				 });
+		}
+	}
+}
+
+BENCHMARK(RatePathUpdates)
+{
+	for (const auto& density : DENSITIES)
+	{
+		auto paths = makePaths(density.edge_probability);
+
+		const auto label = "rate_paths/"s + density.name + "/" + std::to_string(CURRENCY_COUNT);
+
+		const auto recompute_seconds = Benchmarks::secondsFor([&] {
+			for (std::size_t i = 0; i < RECOMPUTES; ++i)
+				paths.recompute();
+		});
+		reporter.report(label, "recompute_ms", recompute_seconds * 1'000 / RECOMPUTES);
+
+		// Each Update Lowers a Random Edge a little, as a Rising Rate would
+		std::mt19937_64									engine{9};
+		std::uniform_int_distribution<std::size_t> node{0, CURRENCY_COUNT - 1};
+
+		std::size_t updates			= 0;
+		const auto	update_seconds = Benchmarks::secondsFor([&] {
+			 while (updates < WEIGHT_UPDATES)
+			 {
+				 const auto from = node(engine);
+				 const auto to	  = node(engine);
+				 if (from == to)
+					 continue;
+
+				 const float weight = paths.weight(from, to);
+				 paths.lowerWeight(
+					  from, to, weight == Numeric::HopBoundedPaths::NO_EDGE ? 0.0f : weight - 0.001f);
+				 ++updates;
+			 }
+		});
+		Benchmarks::doNotOptimize(paths.distance(0, CURRENCY_COUNT - 1));
+
+		reporter.report(label, "lower_weight_us", update_seconds * 1'000'000 / WEIGHT_UPDATES);
+	}
+}
@@ -0,0 +1,153 @@
+#include "pch.h"
+
+#include "Harness.hxx"
+
+#include "CurrencyIngestion.hxx"
+
+#include <TUESL/SQLite/Database.hxx>
+#include <TUESL/SQLite/PrepareStatement.hxx>
+
+#include <winrt/Windows.Data.Json.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+// Loading a Currency List of the Service's Shape into SQLite
+//
+// serial is the Code as it was, Parse the whole Payload, then Insert every Entry
+// pipeline is IngestCurrencyIDs, at 1 Parse Worker and at as many as the Machine has
+//
+// Each Stage is also Reported on its own, Rows over the Time it was Busy
+// A Stage well above the others is Waiting on them, its Queue then Stays Full
+// queued is the most Chunks or Batches Waiting at once
+//
+// Lists far longer than the Service Returns stand in for Historical Dumps
+// 10M Entries would not fit in Memory as Text, as such the Largest List is 1M
+
+namespace
+{
+	namespace SQLite = TUESL::SQLite;
+
+	using Currency::CurrencyBatch;
+	using Currency::IngestionOptions;
+	using Currency::IngestionStatistics;
+
+	using namespace std::string_literals;
+
+	constexpr const std::size_t MAX_ENTRY_COUNT = 1'000'000;
+
+	constexpr const auto SQL_CREATE =
+		 "CREATE TABLE currencies (id BLOB NOT NULL,currencyName BLOB NOT NULL,"
+		 "currencySymbol BLOB NOT NULL);";
+	constexpr const auto SQL_INSERT = "INSERT INTO currencies VALUES(?,?,?);";
+
+	std::wstring makeCurrencyList(const std::size_t p_count)
+	{
+		std::wstring json = L"{\"results\":{";
+		for (std::size_t i = 0; i < p_count; ++i)
+		{
+			const auto id = L"C" + std::to_wstring(i);
+			if (i != 0)
+				json += L',';
+			json += L"\"" + id + L"\":{\"currencyName\":\"Currency Number " + std::to_wstring(i) +
+					  L" Dollar\",\"currencySymbol\":\"$\",\"id\":\"" + id + L"\"}";
+		}
+		json += L"}}";
+		return json;
+	}
+
+	std::string label(const std::string_view p_variant, const std::size_t p_count)
+	{
+		return "ingest/currencies/"s + std::string{p_variant} + "/" + std::to_string(p_count);
+	}
+
+	void insertBatches(SQLite::Database&						p_db,
+							 SQLite::PrepareStatement&				p_ps,
+							 const std::vector<CurrencyBatch>& p_batches)
+	{
+		p_db.transactionBegin();
+		for (const auto& batch : p_batches)
+		{
+			for (const auto& entry : batch)
+			{
+				p_ps.restart();
+				p_ps.bind(entry.id);
+				p_ps.bind(entry.name);
+				p_ps.bind(entry.symbol);
+				p_ps.execute();
+			}
+		}
+		p_db.transactionEnd();
+	}
+
+	void reportPipeline(Benchmarks::Reporter&		  p_reporter,
+							  const std::string&			  p_variant,
+							  const IngestionStatistics& p_statistics)
+	{
+		const auto rows = static_cast<double>(p_statistics.rows);
+		const auto per	 = [&](const double p_seconds) {
+			 return rows / (std::max)(p_seconds, 1e-9);
+		};
+
+		p_reporter.report(label(p_variant, p_statistics.rows), "rows_per_sec",
+								per(p_statistics.total_seconds));
+		p_reporter.report(label(p_variant + "/split", p_statistics.rows), "rows_per_busy_sec",
+								per(p_statistics.split_seconds));
+		p_reporter.report(label(p_variant + "/parse", p_statistics.rows), "rows_per_busy_sec",
+								per(p_statistics.parse_seconds));
+		p_reporter.report(label(p_variant + "/write", p_statistics.rows), "rows_per_busy_sec",
+								per(p_statistics.write_seconds));
+		p_reporter.report(label(p_variant + "/chunks", p_statistics.rows), "max_queued",
+								static_cast<double>(p_statistics.max_chunks_queued));
+		p_reporter.report(label(p_variant + "/batches", p_statistics.rows), "max_queued",
+								static_cast<double>(p_statistics.max_batches_queued));
+	}
+} // namespace
+
+BENCHMARK(IngestionPipeline)
+{
+	using winrt::Windows::Data::Json::JsonObject;
+
+	for (const auto scale : Benchmarks::rowScales())
+	{
+		const auto count = (std::min)(scale, MAX_ENTRY_COUNT);
+		const auto json	= makeCurrencyList(count);
+
+		{
+			SQLite::Database db{":memory:"};
+			db.executeSQL(SQL_CREATE);
+			SQLite::PrepareStatement ps{db, SQL_INSERT};
+
+			const auto seconds = Benchmarks::secondsFor([&] {
+				const auto results = JsonObject::Parse(json).GetNamedObject(L"results");
+
+				CurrencyBatch batch;
+				for (const auto& member : results)
+				{
+					const auto obj = member.Value().GetObject();
+					batch.push_back({obj.GetNamedString(L"id", L""),
+										  obj.GetNamedString(L"currencyName", L""),
+										  obj.GetNamedString(L"currencySymbol", L"")});
+				}
+				insertBatches(db, ps, {std::move(batch)});
+			});
+			reporter.report(label("serial", count), "rows_per_sec", count / seconds);
+		}
+
+		for (const std::size_t workers : {std::size_t{1}, std::size_t{0}})
+		{
+			SQLite::Database db{":memory:"};
+			db.executeSQL(SQL_CREATE);
+			SQLite::PrepareStatement ps{db, SQL_INSERT};
+
+			IngestionOptions options;
+			options.parse_workers = workers;
+
+			const auto statistics = Currency::IngestCurrencyIDs(
+				 json, options, [&](const auto& p_batches) { insertBatches(db, ps, p_batches); });
+
+			reportPipeline(reporter, workers == 1 ? "pipeline_1" : "pipeline_all", statistics);
+		}
+	}
+}
@@ -0,0 +1,152 @@
+#include "pch.h"
+
+#include "QueryPlanCheck.hxx"
+#include "StandInService.hxx"
+
+#include "CurrencyConverter.hxx"
+
+#include <TUESL/SQLite/Database.hxx>
+#include <TUESL/SQLite/PrepareStatement.hxx>
+#include <TUESL/SQLite/QueryPlan.hxx>
+
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <optional>
+
+namespace Benchmarks
+{
+	namespace
+	{
+		namespace SQLite = TUESL::SQLite;
+
+		using Currency::CurrencyConverter;
+		using Currency::DatabaseMode;
+		using Currency::StorageFolders;
+		using Currency::UpstreamService;
+
+		using SQLite::QueryPlanGuard;
+
+		using winrt::hstring;
+
+		using namespace std::string_literals;
+
+		// As many as the Service Lists
+		constexpr const std::size_t CHECK_CURRENCIES = 170;
+		constexpr const std::size_t CHECK_RATES		= 100'000;
+
+		constexpr const auto BASELINE_HEADER =
+			 "# Query Plans of the Statements CurrencyConverter Registers\n"
+			 "# Written by Benchmarks.exe --record-query-plans, Checked by --check-query-plans\n"
+			 "# Record again only where a new Scan or Temp B-Tree is Intended\n\n";
+
+		// Rates between the Listed Currencies, as Recent as those the Converter Inserts
+		void seedRates(SQLite::Database& p_db, const std::size_t p_count)
+		{
+			SQLite::PrepareStatement ps{p_db,
+												 "INSERT INTO "s +
+													  Currency::TableNames::TABLE_CURRENCY_VALUES +
+													  " VALUES(?,?,?,?);"};
+			const auto time = winrt::clock::now().time_since_epoch().count();
+
+			p_db.transactionBegin();
+			for (std::size_t i = 0; i < p_count; ++i)
+			{
+				const auto from = StandInService::currencyCode(i % CHECK_CURRENCIES);
+				const auto to =
+					 StandInService::currencyCode((i / CHECK_CURRENCIES + i + 1) % CHECK_CURRENCIES);
+
+				ps.restart();
+				ps.bind(std::string_view{from});
+				ps.bind(std::string_view{to});
+				ps.bind(static_cast<SQLite::DataTypes::Int64>(TUESL::Numeric::Rate::SCALE));
+				// A Tick apart, as a Pair holds one Rate per Time
+				ps.bind(static_cast<SQLite::DataTypes::Int64>(time - static_cast<std::int64_t>(i)));
+				ps.execute();
+			}
+			p_db.transactionEnd();
+		}
+
+		std::optional<std::string> readFile(const std::string& p_file_name)
+		{
+			std::ifstream file{p_file_name, std::ios::binary};
+			if (!file)
+				return std::nullopt;
+			return std::string{std::istreambuf_iterator<char>{file},
+									 std::istreambuf_iterator<char>{}};
+		}
+	} // namespace
+
+	int checkQueryPlans(Reporter&				 p_reporter,
+							  const std::string& p_baseline_file,
+							  const bool			 p_record)
+	{
+		StandInService service{CHECK_CURRENCIES};
+		if (std::empty(service.rootUrl()))
+		{
+			std::cerr << "The Stand in Service could not Listen" << std::endl;
+			return 1;
+		}
+
+		const auto directory = scratchDirectory(L"QueryPlans");
+		const StorageFolders folders{hstring{directory}, hstring{directory}};
+
+		// On Disk, as such the Tables it Builds are there for the Check to Open
+		{
+			auto upstream								 = UpstreamService::ForConverterAPI();
+			upstream.providers.front().root_url = hstring{service.rootUrl()};
+
+			CurrencyConverter converter{DatabaseMode::ON_DISK, folders, upstream};
+			converter.SetupTableCurrencyIDs().get();
+		}
+
+		SQLite::Database db{winrt::to_string(directory) + "\\" + Currency::DATABASE_NAME};
+		seedRates(db, CHECK_RATES);
+
+		QueryPlanGuard guard;
+		CurrencyConverter::RegisterStatements(guard);
+
+		const auto plans = guard.capture(db);
+
+		if (p_record)
+		{
+			std::ofstream file{p_baseline_file, std::ios::binary | std::ios::trunc};
+			file << BASELINE_HEADER << QueryPlanGuard::serialize(plans);
+			if (!file)
+			{
+				std::cerr << "Could not Write " << p_baseline_file << std::endl;
+				return 1;
+			}
+
+			std::cerr << "Recorded " << std::size(plans) << " Plans" << std::endl;
+			return 0;
+		}
+
+		const auto baseline = readFile(p_baseline_file);
+		if (!baseline.has_value())
+		{
+			std::cerr << "Could not Read " << p_baseline_file << std::endl;
+			return 1;
+		}
+
+		const auto regressions =
+			 QueryPlanGuard::compare(QueryPlanGuard::parse(baseline.value()), plans);
+		for (const auto& regression : regressions)
+			std::cerr << "Regressed " << regression.name << ": " << regression.step << std::endl;
+
+		for (const auto& counters : guard.measure(db))
+		{
+			const auto label = "query_plan/"s + counters.name;
+
+			p_reporter.report(label, "full_scan_steps", counters.full_scan_steps);
+			p_reporter.report(label, "sorts", counters.sorts);
+			p_reporter.report(label, "auto_index_rows", counters.auto_index_rows);
+			p_reporter.report(label, "vm_steps", counters.vm_steps);
+			p_reporter.report(label, "rows", static_cast<double>(counters.rows));
+		}
+
+		std::cerr << std::size(plans) << " Plans Checked, " << std::size(regressions)
+					 << " Regressed" << std::endl;
+		return std::empty(regressions) ? 0 : 1;
+	}
+} // namespace Benchmarks
@@ -0,0 +1,25 @@
+#pragma once
+
+// Guards the Plans SQLite Picks for every Statement CurrencyConverter Registers
+// Run by Main instead of the Benchmarks, see Main.cxx
+// and on every Build by the QueryPlansMatchBaseline Test, see Tests/QueryPlanTests.cxx
+//
+// The Tables are Built by the Converter itself, as such they have exactly its Indexes
+// They are then Filled to CHECK_RATES Rates, so that the Counters show what a Scan costs
+// A Plan which gains a Scan or a Temp B-Tree the Baseline does not have Fails the Check
+//
+// The Counters of every Read Only Statement are Reported as query_plan/{name}
+//	full_scan_steps, sorts, auto_index_rows, vm_steps and rows
+
+#include "Harness.hxx"
+
+#include <string>
+
+namespace Benchmarks
+{
+	// Compares the Plans with those p_baseline_file holds, or Writes them there with p_record
+	// Returns the Exit Code, 0 unless a Plan Regressed or the Baseline could not be Read
+	int checkQueryPlans(Reporter&				 p_reporter,
+							  const std::string& p_baseline_file,
+							  const bool			 p_record);
+} // namespace Benchmarks
@@ -0,0 +1,384 @@
+#include "pch.h"
+
+#include "Harness.hxx"
+
+#include <TUESL/SQLite/Database.hxx>
+#include <TUESL/SQLite/PrepareStatement.hxx>
+#include <TUESL/SQLite/Schema.hxx>
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// Cost of the TUESL Wrappers over the SQLite Calls they make
+// Each Operation is Timed through the Wrapper and again through sqlite3 directly
+// on the same Rows, so that the Difference is the Wrapper alone
+//
+// wrapper is PrepareStatement and Database as the Converter uses them
+// raw is the same Sequence of sqlite3 Calls with nothing in between
+// schema is PrepareStatement again, with Rows Bound and Read through Schema
+//
+// The Database lives in Memory, as such neither is Measuring the Disk
+
+namespace
+{
+	namespace SQLite = TUESL::SQLite;
+	namespace DataTypes = TUESL::SQLite::DataTypes;
+	namespace Schema = TUESL::SQLite::Schema;
+
+	using namespace std::string_literals;
+
+	// Prepare does not Depend on the Rows, as such it is Timed once
+	constexpr const std::size_t PREPARE_COUNT = 100'000;
+	// Codes Cycle through about as many Currencies as the Service has
+	constexpr const std::size_t CODE_COUNT = 170;
+
+	// Same Shape as TABLE_CURRENCY_VALUES
+	constexpr const auto SQL_CREATE =
+		 "CREATE TABLE TABLE_CURRENCY_VALUES (from_col BLOB NOT NULL,to_col BLOB NOT NULL,"
+		 "amt_col INTEGER NOT NULL,time_col REAL NOT NULL);";
+	constexpr const auto SQL_INSERT = "INSERT INTO TABLE_CURRENCY_VALUES VALUES(?,?,?,?);";
+	constexpr const auto SQL_SELECT =
+		 "SELECT from_col, amt_col, time_col FROM TABLE_CURRENCY_VALUES;";
+	// As LookupConversionRate Prepares it
+	constexpr const auto SQL_LOOKUP =
+		 "SELECT rowid, amt_col, time_col FROM TABLE_CURRENCY_VALUES "
+		 "WHERE from_col = ? AND to_col = ?;";
+
+	// Same Columns as SQL_CREATE, Mapped through Schema
+	struct ValueRow
+	{
+		std::string		  from_code;
+		std::string		  to_code;
+		DataTypes::Int64 units = 0;
+		double			  time  = 0.0;
+
+		static constexpr auto schema()
+		{
+			return Schema::table("TABLE_CURRENCY_VALUES",
+										Schema::column("from_col", &ValueRow::from_code),
+										Schema::column("to_col", &ValueRow::to_code),
+										Schema::column("amt_col", &ValueRow::units),
+										Schema::column("time_col", &ValueRow::time));
+		}
+	};
+
+	std::vector<std::string> makeCodes()
+	{
+		std::vector<std::string> codes;
+		for (std::size_t i = 0; i < CODE_COUNT; ++i)
+		{
+			char code[8];
+			std::snprintf(code, sizeof(code), "C%03zu", i);
+			codes.push_back(code);
+		}
+		return codes;
+	}
+
+	// Rows are Generated as they are Inserted, as 10M of them would not fit Twice
+	template <typename Function>
+	void forEachRow(const std::vector<std::string>& p_codes,
+						 const std::size_t					p_count,
+						 Function								p_function)
+	{
+		for (std::size_t i = 0; i < p_count; ++i)
+		{
+			const auto& from_code = p_codes[i % CODE_COUNT];
+			const auto& to_code	 = p_codes[(i / CODE_COUNT + i + 1) % CODE_COUNT];
+			p_function(from_code,
+						  to_code,
+						  static_cast<std::int64_t>(1'000'000'000 + i % 100'000),
+						  636'800'000'000'000'000.0 + static_cast<double>(i));
+		}
+	}
+
+	std::string label(const std::string_view p_operation,
+							const std::string_view p_variant,
+							const std::size_t		  p_count)
+	{
+		return "sqlite/"s + std::string{p_operation} + "/" + std::string{p_variant} + "/" +
+				 std::to_string(p_count);
+	}
+
+	void insertWrapper(SQLite::Database&					p_db,
+							 const std::vector<std::string>& p_codes,
+							 const std::size_t					p_count)
+	{
+		SQLite::PrepareStatement ps;
+		ps.prepare(p_db, SQL_INSERT);
+
+		p_db.transactionBegin();
+		forEachRow(p_codes,
+					  p_count,
+					  [&](const std::string&	p_from,
+							const std::string&	p_to,
+							const std::int64_t p_units,
+							const double		 p_time) {
+						  ps.restart();
+						  ps.bind(std::string_view{p_from});
+						  ps.bind(std::string_view{p_to});
+						  ps.bind(static_cast<DataTypes::Int64>(p_units));
+						  ps.bind(p_time);
+						  ps.execute();
+					  });
+		p_db.transactionEnd();
+	}
+
+	void insertSchema(SQLite::Database&					 p_db,
+							const std::vector<std::string>& p_codes,
+							const std::size_t					 p_count)
+	{
+		SQLite::PrepareStatement ps;
+		ps.prepare(p_db, Schema::insertSQL<ValueRow>());
+
+		p_db.transactionBegin();
+		forEachRow(p_codes,
+					  p_count,
+					  [&](const std::string&	p_from,
+							const std::string&	p_to,
+							const std::int64_t p_units,
+							const double		 p_time) {
+						  ps.restart();
+						  Schema::bindRow(ps, ValueRow{p_from, p_to, p_units, p_time});
+						  ps.execute();
+					  });
+		p_db.transactionEnd();
+	}
+
+	void insertRaw(SQLite::Database&					p_db,
+						const std::vector<std::string>& p_codes,
+						const std::size_t					p_count)
+	{
+		sqlite3* const handle = p_db.getDatabaseRAWHandle();
+		sqlite3_stmt*	stmt	 = nullptr;
+		sqlite3_prepare_v2(handle, SQL_INSERT, -1, &stmt, nullptr);
+
+		sqlite3_exec(handle, "BEGIN IMMEDIATE TRANSACTION;", nullptr, nullptr, nullptr);
+		forEachRow(p_codes,
+					  p_count,
+					  [&](const std::string&	p_from,
+							const std::string&	p_to,
+							const std::int64_t p_units,
+							const double		 p_time) {
+						  sqlite3_reset(stmt);
+						  sqlite3_clear_bindings(stmt);
+						  sqlite3_bind_text(
+								stmt, 1, p_from.c_str(), int(std::size(p_from)), SQLITE_STATIC);
+						  sqlite3_bind_text(
+								stmt, 2, p_to.c_str(), int(std::size(p_to)), SQLITE_STATIC);
+						  sqlite3_bind_int64(stmt, 3, p_units);
+						  sqlite3_bind_double(stmt, 4, p_time);
+						  sqlite3_step(stmt);
+					  });
+		sqlite3_exec(handle, "END TRANSACTION;", nullptr, nullptr, nullptr);
+		sqlite3_finalize(stmt);
+	}
+
+	// One Text Statement per Row, as executeSQL is used for Schema and Pragmas
+	std::string insertStatement(const std::string& p_from,
+										 const std::string& p_to,
+										 const std::int64_t p_units,
+										 const double		  p_time)
+	{
+		return "INSERT INTO TABLE_CURRENCY_VALUES VALUES('"s + p_from + "','" + p_to + "'," +
+				 std::to_string(p_units) + "," + std::to_string(p_time) + ");";
+	}
+
+	SQLite::Database freshDatabase()
+	{
+		SQLite::Database db{":memory:"};
+		db.executeSQL(SQL_CREATE);
+		return db;
+	}
+} // namespace
+
+BENCHMARK(SQLitePrepare)
+{
+	auto db = freshDatabase();
+
+	// A new Statement per Query, as the Converter Prepares them
+	const auto wrapper_seconds = Benchmarks::secondsFor([&] {
+		for (std::size_t i = 0; i < PREPARE_COUNT; ++i)
+		{
+			SQLite::PrepareStatement ps;
+			ps.prepare(db, SQL_LOOKUP);
+			Benchmarks::doNotOptimize(ps);
+		}
+	});
+
+	const auto raw_seconds = Benchmarks::secondsFor([&] {
+		for (std::size_t i = 0; i < PREPARE_COUNT; ++i)
+		{
+			sqlite3_stmt* stmt = nullptr;
+			sqlite3_prepare_v2(db.getDatabaseRAWHandle(), SQL_LOOKUP, -1, &stmt, nullptr);
+			Benchmarks::doNotOptimize(stmt);
+			sqlite3_finalize(stmt);
+		}
+	});
+
+	reporter.report(label("prepare", "wrapper", PREPARE_COUNT), "prepares_per_sec",
+						 PREPARE_COUNT / wrapper_seconds);
+	reporter.report(label("prepare", "raw", PREPARE_COUNT), "prepares_per_sec",
+						 PREPARE_COUNT / raw_seconds);
+}
+
+BENCHMARK(SQLiteBindStep)
+{
+	const auto codes = makeCodes();
+
+	for (const auto count : Benchmarks::rowScales())
+	{
+		// Each into its own Database, so that neither Inserts into a Larger Table
+		{
+			auto		  db		 = freshDatabase();
+			const auto seconds = Benchmarks::secondsFor([&] { insertWrapper(db, codes, count); });
+			reporter.report(label("insert", "wrapper", count), "rows_per_sec", count / seconds);
+		}
+		{
+			auto		  db		 = freshDatabase();
+			const auto seconds = Benchmarks::secondsFor([&] { insertSchema(db, codes, count); });
+			reporter.report(label("insert", "schema", count), "rows_per_sec", count / seconds);
+		}
+		{
+			auto		  db		 = freshDatabase();
+			const auto seconds = Benchmarks::secondsFor([&] { insertRaw(db, codes, count); });
+			reporter.report(label("insert", "raw", count), "rows_per_sec", count / seconds);
+		}
+	}
+}
+
+BENCHMARK(SQLiteGet)
+{
+	const auto codes = makeCodes();
+
+	for (const auto count : Benchmarks::rowScales())
+	{
+		auto db = freshDatabase();
+		insertRaw(db, codes, count);
+
+		// Every Accessor the Converter Reads Rows with
+		// string_view Refers to SQLite's own Buffer, string Copies it
+		const auto view_seconds = Benchmarks::secondsFor([&] {
+			SQLite::PrepareStatement ps{db, SQL_SELECT};
+			std::int64_t				 sum = 0;
+			while (ps.hasNext())
+			{
+				const auto from_code = ps.get<std::string_view>();
+				const auto units		= ps.get<DataTypes::Int64>();
+				const auto time		= ps.get<double>();
+				sum += std::size(from_code.value_or("")) + units.value_or(0) +
+						 static_cast<std::int64_t>(time.value_or(0.0));
+			}
+			Benchmarks::doNotOptimize(sum);
+		});
+		reporter.report(label("get", "wrapper_string_view", count), "rows_per_sec",
+							 count / view_seconds);
+
+		const auto string_seconds = Benchmarks::secondsFor([&] {
+			SQLite::PrepareStatement ps{db, SQL_SELECT};
+			std::int64_t				 sum = 0;
+			while (ps.hasNext())
+			{
+				const auto from_code = ps.get<std::string>();
+				const auto units		= ps.get<DataTypes::Int64>();
+				const auto time		= ps.get<double>();
+				sum += std::size(from_code.value_or("")) + units.value_or(0) +
+						 static_cast<std::int64_t>(time.value_or(0.0));
+			}
+			Benchmarks::doNotOptimize(sum);
+		});
+		reporter.report(label("get", "wrapper_string", count), "rows_per_sec",
+							 count / string_seconds);
+
+		const auto raw_seconds = Benchmarks::secondsFor([&] {
+			sqlite3_stmt* stmt = nullptr;
+			sqlite3_prepare_v2(db.getDatabaseRAWHandle(), SQL_SELECT, -1, &stmt, nullptr);
+			std::int64_t sum = 0;
+			while (sqlite3_step(stmt) == SQLITE_ROW)
+			{
+				sqlite3_column_text(stmt, 0);
+				sum += sqlite3_column_bytes(stmt, 0) + sqlite3_column_int64(stmt, 1) +
+						 static_cast<std::int64_t>(sqlite3_column_double(stmt, 2));
+			}
+			sqlite3_finalize(stmt);
+			Benchmarks::doNotOptimize(sum);
+		});
+		reporter.report(label("get", "raw", count), "rows_per_sec", count / raw_seconds);
+
+		// Whole Rows into Structs, as the Converter Reads them
+		// raw_row Copies the same Columns into the same Struct by hand
+		const auto schema_seconds = Benchmarks::secondsFor([&] {
+			SQLite::PrepareStatement ps{db, Schema::selectSQL<ValueRow>() + ";"};
+			std::int64_t				 sum = 0;
+			while (ps.hasNext())
+			{
+				const auto row = Schema::readRow<ValueRow>(ps);
+				sum += std::size(row.from_code) + std::size(row.to_code) + row.units +
+						 static_cast<std::int64_t>(row.time);
+			}
+			Benchmarks::doNotOptimize(sum);
+		});
+		reporter.report(label("get", "schema", count), "rows_per_sec", count / schema_seconds);
+
+		const auto raw_row_seconds = Benchmarks::secondsFor([&] {
+			const auto	  sql	 = Schema::selectSQL<ValueRow>() + ";";
+			sqlite3_stmt* stmt = nullptr;
+			sqlite3_prepare_v2(db.getDatabaseRAWHandle(), sql.c_str(), -1, &stmt, nullptr);
+			std::int64_t sum = 0;
+			while (sqlite3_step(stmt) == SQLITE_ROW)
+			{
+				ValueRow row;
+				row.from_code.assign(reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0)),
+											sqlite3_column_bytes(stmt, 0));
+				row.to_code.assign(reinterpret_cast<const char*>(sqlite3_column_text(stmt, 1)),
+										 sqlite3_column_bytes(stmt, 1));
+				row.units = sqlite3_column_int64(stmt, 2);
+				row.time	 = sqlite3_column_double(stmt, 3);
+				sum += std::size(row.from_code) + std::size(row.to_code) + row.units +
+						 static_cast<std::int64_t>(row.time);
+			}
+			sqlite3_finalize(stmt);
+			Benchmarks::doNotOptimize(sum);
+		});
+		reporter.report(label("get", "raw_row", count), "rows_per_sec", count / raw_row_seconds);
+	}
+}
+
+BENCHMARK(SQLiteExecuteSQL)
+{
+	const auto codes = makeCodes();
+
+	for (const auto count : Benchmarks::rowScales())
+	{
+		// The Text is Built outside the Timing, it is the same for both
+		std::vector<std::string> statements;
+		statements.reserve(count);
+		forEachRow(codes, count, [&](const auto&... p_values) {
+			statements.push_back(insertStatement(p_values...));
+		});
+
+		{
+			auto		  db		 = freshDatabase();
+			const auto seconds = Benchmarks::secondsFor([&] {
+				db.transactionBegin();
+				for (const auto& statement : statements)
+					db.executeSQL(statement);
+				db.transactionEnd();
+			});
+			reporter.report(label("execute_sql", "wrapper", count), "statements_per_sec",
+								 count / seconds);
+		}
+		{
+			auto		  db		 = freshDatabase();
+			sqlite3*	  handle	 = db.getDatabaseRAWHandle();
+			const auto seconds = Benchmarks::secondsFor([&] {
+				sqlite3_exec(handle, "BEGIN IMMEDIATE TRANSACTION;", nullptr, nullptr, nullptr);
+				for (const auto& statement : statements)
+					sqlite3_exec(handle, statement.c_str(), nullptr, nullptr, nullptr);
+				sqlite3_exec(handle, "END TRANSACTION;", nullptr, nullptr, nullptr);
+			});
+			reporter.report(label("execute_sql", "raw", count), "statements_per_sec",
+								 count / seconds);
+		}
+	}
+}
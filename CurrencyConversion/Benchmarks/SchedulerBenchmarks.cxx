@@ -0,0 +1,256 @@
+#include "pch.h"
+
+#include "Harness.hxx"
+
+#include <TUESL/Net/RequestScheduler.hxx>
+
+#include <algorithm>
+#include <chrono>
+#include <optional>
+#include <string>
+#include <vector>
+
+// An Hour of Traffic to the Converter Service, Simulated on a Stepped Clock
+// As such every Run gives the same Numbers, and an Hour takes Milliseconds
+//
+// A Batch Converting to every Currency Queues 200 Background Lookups at once
+// Meanwhile the User Converts a Pair every Minute
+//
+// The Stand in Server Answers after a Fixed Latency
+// It Enforces the same Quota as the Real one, Requests over it are Rejected
+//
+// unscheduled Fires every Request on Arrival, as WebClient did
+// scheduled goes through the RequestScheduler the Converter uses
+//
+// Reports Numbers only, its Priority and Fairness are Checked by Tests/SchedulerTests.cxx
+
+namespace
+{
+	using TUESL::Net::Priority;
+	using TUESL::Net::RequestScheduler;
+
+	using namespace std::string_literals;
+	using namespace std::chrono_literals;
+
+	using TimePoint = RequestScheduler::TimePoint;
+	using Duration	 = RequestScheduler::Clock::duration;
+
+	constexpr const double		REQUESTS_PER_HOUR = 100.0;
+	constexpr const double		BURST				 = 10.0;
+	constexpr const std::size_t MAX_IN_FLIGHT		 = 4;
+
+	constexpr const std::size_t BATCH_LOOKUPS			= 200;
+	constexpr const auto			 INTERACTIVE_PERIOD	= 60s;
+	constexpr const auto			 SERVER_LATENCY		= 150ms;
+	constexpr const auto			 SIMULATED_DURATION = 1h;
+
+	struct Outcome
+	{
+		std::size_t served	= 0;
+		std::size_t rejected = 0;
+		// From Arrival to Answer, of those Served
+		Duration total_latency{0};
+		Duration max_latency{0};
+
+		void record(const bool p_is_served, const Duration p_latency)
+		{
+			if (!p_is_served)
+			{
+				++rejected;
+				return;
+			}
+			++served;
+			total_latency += p_latency;
+			max_latency = (std::max)(max_latency, p_latency);
+		}
+	};
+
+	// Token Bucket of the Service itself
+	class StandInServer
+	{
+	 private:
+		double	 m_tokens = BURST;
+		TimePoint m_refilled{};
+
+	 public:
+		// Whether a Request Arriving at p_now is within the Quota
+		bool accept(const TimePoint p_now)
+		{
+			const std::chrono::duration<double> elapsed = p_now - m_refilled;
+			m_tokens	  = (std::min)(BURST, m_tokens + elapsed.count() * REQUESTS_PER_HOUR / 3600.0);
+			m_refilled = p_now;
+
+			if (m_tokens < 1.0)
+				return false;
+			m_tokens -= 1.0;
+			return true;
+		}
+	};
+
+	struct Arrival
+	{
+		TimePoint time;
+		Priority	 priority;
+	};
+
+	std::vector<Arrival> makeArrivals()
+	{
+		std::vector<Arrival> arrivals;
+		for (std::size_t i = 0; i < BATCH_LOOKUPS; ++i)
+			arrivals.push_back(Arrival{TimePoint{}, Priority::BACKGROUND});
+
+		for (auto time = TimePoint{} + INTERACTIVE_PERIOD; time < TimePoint{} + SIMULATED_DURATION;
+			  time += INTERACTIVE_PERIOD)
+			arrivals.push_back(Arrival{time, Priority::INTERACTIVE});
+
+		std::stable_sort(
+			 std::begin(arrivals), std::end(arrivals), [](const Arrival& p_lhs, const Arrival& p_rhs) {
+				 return p_lhs.time < p_rhs.time;
+			 });
+		return arrivals;
+	}
+
+	void report(Benchmarks::Reporter&  p_reporter,
+					const std::string_view p_variant,
+					const std::string_view p_lane,
+					const Outcome&			  p_outcome)
+	{
+		using std::chrono::duration;
+
+		const auto label = "upstream/"s + std::string{p_variant} + "/" + std::string{p_lane};
+
+		p_reporter.report(label, "served", double(p_outcome.served));
+		p_reporter.report(label, "rejected", double(p_outcome.rejected));
+		p_reporter.report(label,
+								"mean_latency_sec",
+								p_outcome.served == 0
+									 ? 0.0
+									 : duration<double>(p_outcome.total_latency).count() / p_outcome.served);
+		p_reporter.report(
+			 label, "max_latency_sec", duration<double>(p_outcome.max_latency).count());
+	}
+} // namespace
+
+BENCHMARK(UpstreamScheduling)
+{
+	const auto arrivals = makeArrivals();
+
+	// Every Request Reaches the Server the moment it Arrives
+	{
+		StandInServer server;
+		Outcome		  outcomes[2];
+
+		for (const auto& arrival : arrivals)
+			outcomes[arrival.priority == Priority::INTERACTIVE ? 0 : 1].record(
+				 server.accept(arrival.time), SERVER_LATENCY);
+
+		report(reporter, "unscheduled", "interactive", outcomes[0]);
+		report(reporter, "unscheduled", "background", outcomes[1]);
+	}
+
+	// Events are Processed in Time Order: Arrivals, Answers and Scheduler Wake Ups
+	{
+		TimePoint					 now{};
+		std::optional<TimePoint> wake_time;
+
+		RequestScheduler::Options options;
+		options.requests_per_second = REQUESTS_PER_HOUR / 3600.0;
+		options.burst					 = BURST;
+		options.max_in_flight		 = MAX_IN_FLIGHT;
+		options.interactive_tokens	 = 2.0;
+		options.interactive_slots	 = 1;
+
+		RequestScheduler scheduler{
+			 options, [&] { return now; }, [&](const TimePoint p_time) { wake_time = p_time; }};
+
+		struct InFlight
+		{
+			RequestScheduler::Permit permit;
+			TimePoint					 answer_time;
+			TimePoint					 arrival_time;
+			std::size_t					 lane;
+			bool							 is_served;
+		};
+		std::vector<InFlight> in_flight;
+
+		StandInServer server;
+		Outcome		  outcomes[2];
+
+		const auto submit = [&](const Arrival& p_arrival) {
+			const auto lane = p_arrival.priority == Priority::INTERACTIVE ? 0 : 1;
+			scheduler.submit(p_arrival.priority,
+								  [&, lane, arrival_time = p_arrival.time](RequestScheduler::Permit p_permit) {
+									  in_flight.push_back(InFlight{std::move(p_permit),
+																			 now + SERVER_LATENCY,
+																			 arrival_time,
+																			 std::size_t(lane),
+																			 server.accept(now)});
+								  });
+		};
+
+		std::size_t next_arrival = 0;
+		while (true)
+		{
+			std::optional<TimePoint> next_time;
+			const auto				 consider = [&](const TimePoint p_time) {
+				 if (!next_time.has_value() || p_time < next_time.value())
+					 next_time = p_time;
+			};
+
+			if (next_arrival < std::size(arrivals))
+				consider(arrivals[next_arrival].time);
+			if (wake_time.has_value())
+				consider(wake_time.value());
+			for (const auto& request : in_flight)
+				consider(request.answer_time);
+
+			if (!next_time.has_value() || next_time.value() >= TimePoint{} + SIMULATED_DURATION)
+				break;
+			now = next_time.value();
+
+			// Answers first, so that their Slots are Free for whatever comes next
+			const auto answered =
+				 std::partition(std::begin(in_flight), std::end(in_flight), [&](const InFlight& p_request) {
+					 return p_request.answer_time > now;
+				 });
+			std::vector<InFlight> done{std::make_move_iterator(answered),
+												std::make_move_iterator(std::end(in_flight))};
+			in_flight.erase(answered, std::end(in_flight));
+			for (auto& request : done)
+				outcomes[request.lane].record(request.is_served, now - request.arrival_time);
+			// Releasing may Grant more, which Appends to in_flight
+			done.clear();
+
+			while (next_arrival < std::size(arrivals) && arrivals[next_arrival].time == now)
+				submit(arrivals[next_arrival++]);
+
+			if (wake_time.has_value() && wake_time.value() <= now)
+			{
+				wake_time.reset();
+				scheduler.dispatch();
+			}
+		}
+
+		report(reporter, "scheduled", "interactive", outcomes[0]);
+		report(reporter, "scheduled", "background", outcomes[1]);
+
+		const auto metrics = scheduler.metrics();
+		reporter.report("upstream/scheduled/background",
+							 "max_queue_depth",
+							 double(metrics.background.max_queue_depth));
+		reporter.report("upstream/scheduled/background",
+							 "queue_depth_at_end",
+							 double(metrics.background.queue_depth));
+		reporter.report("upstream/scheduled/interactive",
+							 "max_wait_sec",
+							 std::chrono::duration<double>(metrics.interactive.max_wait).count());
+
+		// Permits must not outlive the Scheduler, and each Released may Grant another
+		while (!std::empty(in_flight))
+		{
+			auto answered = std::move(in_flight);
+			in_flight.clear();
+			answered.clear();
+		}
+	}
+}
@@ -0,0 +1,183 @@
+#include "pch.h"
+
+#include "Harness.hxx"
+
+#include <TUESL/Concurrency/RCUSnapshot.hxx>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Reader Throughput of the Rate Cache as Writers Publish more often
+// RCUSnapshot, as used by CurrencyConverter, against the Mutex it Replaced
+// Readers do what FindCachedRate does, a Binary Search for one Pair
+// reads_per_sec is Summed over every Reader Thread
+
+namespace
+{
+	namespace Concurrency = TUESL::Concurrency;
+
+	using namespace std::string_literals;
+
+	// Roughly every Pair of the Currencies a User Converts between
+	constexpr const std::size_t RATE_COUNT = 1'024;
+
+	// 0 for no Writer at all
+	constexpr const int WRITES_PER_SECOND[] = {0, 10, 100, 1'000, 10'000, 100'000};
+
+	constexpr const auto RUN_DURATION = std::chrono::milliseconds{500};
+
+	struct RateTable
+	{
+		// Sorted by Key
+		std::vector<std::uint32_t> keys;
+		std::vector<std::int64_t>	rates;
+		std::vector<std::int64_t>	times;
+	};
+
+	RateTable makeTable()
+	{
+		RateTable table;
+		for (std::uint32_t i = 0; i < RATE_COUNT; ++i)
+		{
+			table.keys.push_back(i * 7);
+			table.rates.push_back(1'000'000'000 + i);
+			table.times.push_back(i);
+		}
+		return table;
+	}
+
+	std::int64_t lookup(const RateTable& p_table, const std::uint32_t p_key)
+	{
+		const auto it = std::lower_bound(std::begin(p_table.keys), std::end(p_table.keys), p_key);
+		if (it == std::end(p_table.keys) || *it != p_key)
+			return 0;
+		return p_table.rates[static_cast<std::size_t>(it - std::begin(p_table.keys))];
+	}
+	void change(RateTable& p_table, const std::uint64_t p_write)
+	{
+		const auto index = static_cast<std::size_t>(p_write % RATE_COUNT);
+		p_table.rates[index] += 1;
+		p_table.times[index] = static_cast<std::int64_t>(p_write);
+	}
+
+	struct RCUCache
+	{
+		Concurrency::RCUSnapshot<RateTable> table{makeTable()};
+
+		std::int64_t read(const std::uint32_t p_key) const
+		{
+			return lookup(*table.read(), p_key);
+		}
+		void write(const std::uint64_t p_write)
+		{
+			table.update([&](RateTable& p_table) { change(p_table, p_write); });
+		}
+	};
+
+	struct MutexCache
+	{
+		mutable std::mutex mutex;
+		RateTable			 table = makeTable();
+
+		std::int64_t read(const std::uint32_t p_key) const
+		{
+			std::lock_guard<std::mutex> lock{mutex};
+			return lookup(table, p_key);
+		}
+		void write(const std::uint64_t p_write)
+		{
+			std::lock_guard<std::mutex> lock{mutex};
+			change(table, p_write);
+		}
+	};
+
+	unsigned readerCount()
+	{
+		// One Core is left to the Writer
+		const auto cores = std::thread::hardware_concurrency();
+		return cores > 2 ? cores - 1 : 2;
+	}
+
+	template <typename Cache>
+	void measure(Benchmarks::Reporter& p_reporter, const std::string_view p_cache_name)
+	{
+		using std::chrono::steady_clock;
+
+		const auto readers = readerCount();
+
+		for (const auto writes_per_second : WRITES_PER_SECOND)
+		{
+			Cache cache;
+
+			std::atomic<bool>				stop{false};
+			std::atomic<std::uint64_t> reads{0};
+
+			std::vector<std::thread> threads;
+			for (unsigned reader = 0; reader < readers; ++reader)
+			{
+				threads.emplace_back([&, reader] {
+					std::uint64_t count = 0;
+					std::int64_t  sum	  = 0;
+					std::uint32_t key	  = reader;
+
+					while (!stop.load(std::memory_order_relaxed))
+					{
+						sum += cache.read((key % RATE_COUNT) * 7);
+						key += 13;
+						++count;
+					}
+					Benchmarks::doNotOptimize(sum);
+					reads.fetch_add(count);
+				});
+			}
+
+			// Paced rather than Flat out, so that the Rate is that of the Label
+			std::uint64_t writes	  = 0;
+			const auto	  start	  = steady_clock::now();
+			const auto	  deadline = start + RUN_DURATION;
+
+			if (writes_per_second > 0)
+			{
+				const auto interval = std::chrono::nanoseconds{1'000'000'000 / writes_per_second};
+
+				for (auto next = start; next < deadline; next += interval)
+				{
+					while (steady_clock::now() < next)
+						std::this_thread::yield();
+
+					cache.write(writes++);
+				}
+			}
+			std::this_thread::sleep_until(deadline);
+
+			stop = true;
+			for (auto& thread : threads)
+				thread.join();
+
+			const auto seconds =
+				 std::chrono::duration<double>(steady_clock::now() - start).count();
+
+			const auto label = "rate_snapshot/"s + std::string{p_cache_name} + "/writes_" +
+									 std::to_string(writes_per_second);
+			p_reporter.report(label, "reads_per_sec", double(reads.load()) / seconds);
+			p_reporter.report(label, "writes_per_sec", double(writes) / seconds);
+			p_reporter.report(label, "readers", double(readers));
+		}
+	}
+} // namespace
+
+BENCHMARK(RateSnapshotRCU)
+{
+	measure<RCUCache>(reporter, "rcu");
+}
+
+BENCHMARK(RateSnapshotMutex)
+{
+	measure<MutexCache>(reporter, "mutex");
+}
@@ -0,0 +1,331 @@
+#include "pch.h"
+
+#include "StandInService.hxx"
+
+#include <ws2tcpip.h>
+
+#include <algorithm>
+#include <cstdio>
+
+namespace Benchmarks
+{
+	namespace
+	{
+		using TUESL::Net::Handler::Socket;
+
+		using namespace std::string_literals;
+
+		constexpr const std::string_view ROOT_PATH			= "/api/v6/";
+		constexpr const std::string_view PATH_CURRENCIES	= "currencies";
+		constexpr const std::string_view PATH_CONVERT		= "convert?";
+		constexpr const std::string_view PATH_LATEST			= "latest?";
+		constexpr const std::string_view QUERY_KEY			= "q";
+		constexpr const std::string_view BASE_KEY				= "base";
+		constexpr const std::string_view SYMBOLS_KEY			= "symbols";
+		constexpr const std::string_view DATE_KEY				= "date";
+		// YYYY-MM-DD, in Place of latest
+		constexpr const std::size_t DAY_LENGTH = 10;
+		constexpr const std::string_view HEADER_TERMINATOR = "\r\n\r\n";
+
+		// Requests carry no Body, as such their Headers alone must fit
+		constexpr const std::size_t MAX_REQUEST_SIZE = 16 * 1024;
+		constexpr const std::size_t RECEIVE_CHUNK_SIZE = 4 * 1024;
+
+		bool sendAll(const SOCKET p_socket, const std::string_view p_data) noexcept
+		{
+			std::size_t sent = 0;
+			while (sent < std::size(p_data))
+			{
+				const int result =
+					 ::send(p_socket, std::data(p_data) + sent, int(std::size(p_data) - sent), 0);
+				if (result == SOCKET_ERROR || result == 0)
+					return false;
+				sent += static_cast<std::size_t>(result);
+			}
+			return true;
+		}
+
+		std::string httpResponse(const std::string_view p_status, const std::string_view p_body)
+		{
+			// Not Cached, as such every Miss reaches the Service
+			return "HTTP/1.1 "s + std::string{p_status} +
+					 "\r\nContent-Type: application/json\r\nCache-Control: no-store"
+					 "\r\nContent-Length: " +
+					 std::to_string(std::size(p_body)) + "\r\n\r\n" + std::string{p_body};
+		}
+
+		// Value of p_key among the Parameters of p_query, Empty if it has none
+		std::string_view queryValue(const std::string_view p_query, const std::string_view p_key)
+		{
+			std::size_t begin = 0;
+			while (begin < std::size(p_query))
+			{
+				auto end = p_query.find('&', begin);
+				if (end == std::string_view::npos)
+					end = std::size(p_query);
+
+				const auto parameter = p_query.substr(begin, end - begin);
+				if (std::size(parameter) > std::size(p_key) &&
+					 parameter.substr(0, std::size(p_key)) == p_key &&
+					 parameter[std::size(p_key)] == '=')
+					return parameter.substr(std::size(p_key) + 1);
+
+				begin = end + 1;
+			}
+			return {};
+		}
+
+		std::string formatRate(const double p_rate)
+		{
+			char rate[32];
+			std::snprintf(rate, sizeof(rate), "%.6f", p_rate);
+			return rate;
+		}
+
+		// FNV-1a, Stable across Runs and Compilers unlike std::hash
+		std::uint64_t hashOf(const std::string_view p_text,
+									std::uint64_t			 p_hash = 14695981039346656037ull) noexcept
+		{
+			for (const char character : p_text)
+			{
+				p_hash ^= static_cast<unsigned char>(character);
+				p_hash *= 1099511628211ull;
+			}
+			return p_hash;
+		}
+	} // namespace
+
+	StandInService::StandInService(const std::size_t p_currency_count)
+	{
+		m_currencies_json = R"({"results":{)";
+		for (std::size_t i = 0; i < p_currency_count; ++i)
+		{
+			const auto code = currencyCode(i);
+			if (i != 0)
+				m_currencies_json += ",";
+			m_currencies_json += R"(")" + code + R"(":{"currencyName":"Currency )" + code +
+										R"(","currencySymbol":"$","id":")" + code + R"("})";
+		}
+		m_currencies_json += "}}";
+
+		if (!m_winsock.isStarted())
+			return;
+
+		m_listener.reset(::socket(AF_INET, SOCK_STREAM, IPPROTO_TCP));
+		if (m_listener.empty())
+			return;
+
+		// Loopback only, on whichever Port is Free
+		sockaddr_in address{};
+		address.sin_family		= AF_INET;
+		address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+		address.sin_port			= 0;
+
+		int		  address_size	 = sizeof(address);
+		auto* const address_bytes = reinterpret_cast<sockaddr*>(&address);
+		if (::bind(m_listener.get(), address_bytes, address_size) == SOCKET_ERROR ||
+			 ::listen(m_listener.get(), SOMAXCONN) == SOCKET_ERROR ||
+			 ::getsockname(m_listener.get(), address_bytes, &address_size) == SOCKET_ERROR)
+		{
+			m_listener.reset();
+			return;
+		}
+
+		m_port		= ntohs(address.sin_port);
+		m_acceptor = std::thread{[this] { acceptConnections(); }};
+	}
+	StandInService::~StandInService()
+	{
+		stop();
+	}
+
+	std::string StandInService::currencyCode(const std::size_t p_index)
+	{
+		char code[16];
+		std::snprintf(code, sizeof(code), "C%04zu", p_index);
+		return code;
+	}
+
+	double StandInService::rateFor(const std::string_view p_from_code,
+											 const std::string_view p_to_code,
+											 const std::string_view p_day) noexcept
+	{
+		// Between 0.5 and 2.0, to 6 Decimal Places as the Service Quotes them
+		// An Empty Day leaves the Hash as it is, as such the Latest Rate
+		const auto hash = hashOf(p_day, hashOf(p_to_code, hashOf(p_from_code)));
+		return 0.5 + static_cast<double>(hash % 1'500'001) / 1'000'000.0;
+	}
+
+	std::wstring StandInService::rootUrl() const
+	{
+		if (m_port == 0)
+			return {};
+		return L"http://127.0.0.1:" + std::to_wstring(m_port) +
+				 std::wstring(std::begin(ROOT_PATH), std::end(ROOT_PATH));
+	}
+
+	void StandInService::stop() noexcept
+	{
+		if (m_is_stopping.exchange(true))
+			return;
+
+		// Wakes the Acceptor, which is Blocked on the Listener
+		if (!m_listener.empty())
+			::shutdown(m_listener.get(), SD_BOTH);
+		if (m_acceptor.joinable())
+			m_acceptor.join();
+		m_listener.reset();
+
+		std::vector<std::thread> threads;
+		{
+			std::lock_guard<std::mutex> lock{m_connection_mutex};
+			// Wakes each Connection, which is Blocked Receiving
+			for (const auto connection : m_open_connections)
+				::shutdown(connection, SD_BOTH);
+			threads.swap(m_connection_threads);
+		}
+		for (auto& thread : threads)
+			thread.join();
+	}
+
+	void StandInService::acceptConnections()
+	{
+		while (!m_is_stopping.load())
+		{
+			Socket connection{::accept(m_listener.get(), nullptr, nullptr)};
+			if (connection.empty())
+				return;
+
+			std::lock_guard<std::mutex> lock{m_connection_mutex};
+			if (m_is_stopping.load())
+				return;
+
+			m_open_connections.push_back(connection.get());
+			m_connection_threads.emplace_back(
+				 [this](Socket p_connection) { serveConnection(std::move(p_connection)); },
+				 std::move(connection));
+		}
+	}
+
+	void StandInService::serveConnection(Socket p_connection)
+	{
+		std::string input;
+		char			chunk[RECEIVE_CHUNK_SIZE];
+
+		while (!m_is_stopping.load())
+		{
+			const auto header_end = input.find(HEADER_TERMINATOR);
+			if (header_end == std::string::npos)
+			{
+				if (std::size(input) > MAX_REQUEST_SIZE)
+					break;
+
+				const int received = ::recv(p_connection.get(), chunk, int(sizeof(chunk)), 0);
+				if (received == SOCKET_ERROR || received == 0)
+					break;
+				input.append(chunk, static_cast<std::size_t>(received));
+				continue;
+			}
+
+			// Request Line is METHOD SP TARGET SP VERSION
+			const std::string_view request{std::data(input), header_end};
+			const auto				  target_begin = request.find(' ');
+			const auto target_end = request.find(' ', target_begin == std::string_view::npos
+																		 ? std::string_view::npos
+																		 : target_begin + 1);
+
+			const auto response =
+				 target_begin == std::string_view::npos || target_end == std::string_view::npos
+					  ? httpResponse("400 Bad Request", "{}")
+					  : respondTo(request.substr(target_begin + 1, target_end - target_begin - 1));
+
+			input.erase(0, header_end + std::size(HEADER_TERMINATOR));
+			const auto request_number = m_requests.fetch_add(1, std::memory_order_relaxed);
+
+			// Only this Connection Waits, others are Answered meanwhile
+			const auto delay = delayFor(request_number);
+			if (delay.count() > 0)
+				std::this_thread::sleep_for(delay);
+
+			if (!sendAll(p_connection.get(), response))
+				break;
+		}
+
+		std::lock_guard<std::mutex> lock{m_connection_mutex};
+		m_open_connections.erase(std::remove(std::begin(m_open_connections),
+														 std::end(m_open_connections),
+														 p_connection.get()),
+										 std::end(m_open_connections));
+	}
+
+	std::string StandInService::respondTo(const std::string_view p_target) const
+	{
+		if (p_target.substr(0, std::size(ROOT_PATH)) != ROOT_PATH)
+			return httpResponse("404 Not Found", "{}");
+
+		const auto path = p_target.substr(std::size(ROOT_PATH));
+		if (path == PATH_CURRENCIES)
+			return httpResponse("200 OK", m_currencies_json);
+
+		// latest? or {day}?
+		const auto is_latest = path.substr(0, std::size(PATH_LATEST)) == PATH_LATEST;
+		const auto is_day	  = std::size(path) > DAY_LENGTH && path[4] == '-' && path[7] == '-' &&
+									 path[DAY_LENGTH] == '?';
+		if (is_latest || is_day)
+		{
+			// base={from}&symbols={to}, among other Parameters
+			const auto day		= is_day ? path.substr(0, DAY_LENGTH) : std::string_view{};
+			const auto query	= path.substr(is_day ? DAY_LENGTH + 1 : std::size(PATH_LATEST));
+			const auto base	= queryValue(query, BASE_KEY);
+			const auto symbol = queryValue(query, SYMBOLS_KEY);
+			if (std::empty(base) || std::empty(symbol))
+				return httpResponse("400 Bad Request", "{}");
+
+			const auto rate = formatRate(rateFor(base, symbol, day));
+
+			return httpResponse("200 OK",
+									  R"({"base":")" + std::string{base} + R"(","rates":{")" +
+										  std::string{symbol} + R"(":)" + rate + "}}");
+		}
+
+		if (path.substr(0, std::size(PATH_CONVERT)) != PATH_CONVERT)
+			return httpResponse("404 Not Found", "{}");
+
+		// q={from}_{to}, and date={day} for a past Day, among other Parameters
+		const auto query		 = path.substr(std::size(PATH_CONVERT));
+		const auto pair_codes = queryValue(query, QUERY_KEY);
+		const auto day			 = queryValue(query, DATE_KEY);
+		const auto separator	 = pair_codes.find('_');
+		if (separator == std::string_view::npos)
+			return httpResponse("400 Bad Request", "{}");
+
+		const auto rate = formatRate(
+			 rateFor(pair_codes.substr(0, separator), pair_codes.substr(separator + 1), day));
+
+		if (!std::empty(day))
+			return httpResponse("200 OK",
+									  R"({")" + std::string{pair_codes} + R"(":{")" + std::string{day} +
+										  R"(":)" + rate + "}}");
+
+		return httpResponse("200 OK", R"({")" + std::string{pair_codes} + R"(":)" + rate + "}");
+	}
+
+	void StandInService::setDelay(const InjectedDelay& p_delay)
+	{
+		std::lock_guard<std::mutex> lock{m_delay_mutex};
+		m_delay = p_delay;
+	}
+
+	std::chrono::milliseconds StandInService::delayFor(const std::uint64_t p_request) const
+	{
+		InjectedDelay delay;
+		{
+			std::lock_guard<std::mutex> lock{m_delay_mutex};
+			delay = m_delay;
+		}
+
+		const auto number = std::to_string(p_request);
+		const auto draw	= hashOf(number, hashOf(std::to_string(delay.seed))) % 1'000'000;
+		return draw < delay.slow_fraction * 1'000'000.0 ? delay.slow : delay.typical;
+	}
+} // namespace Benchmarks
@@ -0,0 +1,112 @@
+#pragma once
+
+// Stands in for the Converter Service on the Loopback Interface
+// So that Benchmarks Fetch through the real WebClient without Leaving the Machine
+//
+// Serves the Paths the Converter Requests, under rootUrl()
+//	currencies										Every Currency as the Service Lists them
+//	convert?compact=ultra&q={from}_{to}		A Rate Derived from the Codes
+//	latest?base={from}&symbols={to}			The same Rate, as Services of Reference Rates Quote it
+//	convert?...&date={day}, {day}?base=...	Rates of a past Day, a YYYY-MM-DD, in either Form
+//
+// Rates are the same for every Run, as such Results can be Compared
+// Connections are Kept Alive, each on its own Thread
+// Answers may be Delayed, so that several of them Stand in for Providers with a Tail
+//
+// Example
+//	StandInService service{170};
+//	UpstreamService upstream;
+//	upstream.providers.push_back(UpstreamProvider::ForConverterAPI("stand_in", root, budget));
+//	CurrencyConverter converter{mode, folders, upstream};
+
+// Winsock 2 must come before Windows.h, which otherwise brings in Winsock 1
+#include <TUESL/Net/LocalSocket.hxx>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace Benchmarks
+{
+	// Delay before each Answer
+	struct InjectedDelay
+	{
+		std::chrono::milliseconds typical{0};
+		// Fraction of Answers Delayed by slow instead
+		// Picked by the Order they are Answered in and the Seed, the same on every Run
+		double						  slow_fraction = 0.0;
+		std::chrono::milliseconds slow{0};
+		std::uint64_t				  seed = 0;
+	};
+
+	class StandInService
+	{
+	 private:
+		TUESL::Net::WinsockSession m_winsock;
+		TUESL::Net::Handler::Socket m_listener;
+		std::uint16_t					 m_port = 0;
+
+		// Built once, the List never Changes
+		std::string m_currencies_json;
+
+		std::atomic<std::uint64_t> m_requests{0};
+		std::atomic<bool>				m_is_stopping{false};
+
+		InjectedDelay		 m_delay;
+		mutable std::mutex m_delay_mutex;
+
+		std::thread m_acceptor;
+
+		std::mutex						m_connection_mutex;
+		std::vector<SOCKET>			m_open_connections;
+		std::vector<std::thread> m_connection_threads;
+
+	 private:
+		void acceptConnections();
+		void serveConnection(TUESL::Net::Handler::Socket p_connection);
+
+		// Body and Status Line for the Target of a Request
+		std::string respondTo(const std::string_view p_target) const;
+
+		// For the p_request th Answer
+		std::chrono::milliseconds delayFor(const std::uint64_t p_request) const;
+
+	 public:
+		// Lists p_currency_count Currencies, Coded C0000, C0001 and so on
+		explicit StandInService(const std::size_t p_currency_count);
+		~StandInService();
+
+		StandInService(const StandInService&) = delete;
+		StandInService& operator=(const StandInService&) = delete;
+
+		// Code of the p_index th Currency Listed
+		static std::string currencyCode(const std::size_t p_index);
+
+		// Rate Served for the Pair, the same on every Run
+		// Of p_day where it is not Empty, which differs from Day to Day
+		static double rateFor(const std::string_view p_from_code,
+									 const std::string_view p_to_code,
+									 const std::string_view p_day = {}) noexcept;
+
+		// Empty if the Service could not Listen
+		std::wstring rootUrl() const;
+
+		// Applies to Answers from then on, None by Default
+		void setDelay(const InjectedDelay& p_delay);
+
+		// Requests Answered so far, across all Connections
+		std::uint64_t requests() const noexcept
+		{
+			return m_requests.load(std::memory_order_relaxed);
+		}
+
+		// Drops every Connection, also done on Destruction
+		void stop() noexcept;
+	};
+} // namespace Benchmarks
@@ -0,0 +1,103 @@
+#include "pch.h"
+
+#include "Harness.hxx"
+#include "StandInService.hxx"
+
+#include "CurrencyConverter.hxx"
+
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <vector>
+
+// Time to First Conversion, as MainPage Measures it, without the Window
+// From Constructing the Converter to the Rate of the Pair the User Converts first
+//
+// cold	No Snapshot, as every Launch was before it
+//			Counts and Sorts the Currency Table, Fetched from the Stand in, and Fetches the Rate
+// warm	From the Snapshot the cold Run Saved on Suspend
+//			The List, the Rate and the Pair are in Memory before the first Keystroke
+//
+// Each is the Median of RUNS Launches, in Milliseconds
+// The App Records its own as currency_time_to_first_conversion_seconds{start}
+
+namespace
+{
+	using Benchmarks::StandInService;
+
+	using Currency::CurrencyConverter;
+	using Currency::DatabaseMode;
+	using Currency::StorageFolders;
+	using Currency::UpstreamService;
+
+	using winrt::hstring;
+
+	// About as many as the Converter Service Lists
+	constexpr const std::size_t CURRENCY_COUNT = 170;
+	constexpr const std::size_t RUNS			  = 5;
+
+	double medianMilliseconds(std::vector<double> p_seconds)
+	{
+		std::sort(std::begin(p_seconds), std::end(p_seconds));
+		return p_seconds[std::size(p_seconds) / 2] * 1'000.0;
+	}
+
+	// Launches as MainPage does, up to the first Conversion
+	// The Converter is Returned through p_converter, as such its Destruction is not Timed
+	double launch(std::optional<CurrencyConverter>& p_converter,
+					  const StorageFolders&					 p_folders,
+					  const UpstreamService&				 p_upstream,
+					  const hstring&							 p_from_code,
+					  const hstring&							 p_to_code)
+	{
+		return Benchmarks::secondsFor([&] {
+			p_converter.emplace(DatabaseMode::IN_MEMORY, p_folders, p_upstream);
+
+			if (!p_converter->IsWarm())
+				p_converter->SetupTableCurrencyIDs().get();
+			Benchmarks::doNotOptimize(p_converter->GetCurrencyNames());
+
+			const auto rate = p_converter->GetConversionRate(p_from_code, p_to_code).get();
+			Benchmarks::doNotOptimize(rate);
+		});
+	}
+} // namespace
+
+BENCHMARK(TimeToFirstConversion)
+{
+	StandInService service{CURRENCY_COUNT};
+	if (std::empty(service.rootUrl()))
+		return;
+
+	auto upstream								 = UpstreamService::ForConverterAPI();
+	upstream.providers.front().root_url = hstring{service.rootUrl()};
+
+	const auto from_code = winrt::to_hstring(StandInService::currencyCode(0));
+	const auto to_code	= winrt::to_hstring(StandInService::currencyCode(1));
+
+	std::vector<double> cold_seconds;
+	std::vector<double> warm_seconds;
+	for (std::size_t run = 0; run < RUNS; ++run)
+	{
+		// Emptied, as such every cold Run starts without a Snapshot or a Database
+		const auto			  directory = Benchmarks::scratchDirectory(L"Startup");
+		const StorageFolders folders{hstring{directory}, hstring{directory}};
+
+		std::optional<CurrencyConverter> converter;
+		cold_seconds.push_back(launch(converter, folders, upstream, from_code, to_code));
+
+		// As on Suspend
+		converter->SaveSnapshot();
+		converter->FlushHistory();
+		converter->FlushDatabase();
+		converter.reset();
+
+		warm_seconds.push_back(launch(converter, folders, upstream, from_code, to_code));
+		converter.reset();
+	}
+
+	reporter.report(
+		 "startup/cold", "time_to_first_conversion_ms", medianMilliseconds(cold_seconds));
+	reporter.report(
+		 "startup/warm", "time_to_first_conversion_ms", medianMilliseconds(warm_seconds));
+}
@@ -0,0 +1,174 @@
+#include "pch.h"
+
+#include "Harness.hxx"
+
+#include <TUESL/SQLite/Database.hxx>
+#include <TUESL/TimeSeries/TimeSeriesStore.hxx>
+
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+// Compares the Gorilla Compressed History against the
+// Row per Sample Layout of TABLE_CURRENCY_VALUES
+// Both are Fed the same Random Walk of Rates at a Fixed Interval
+
+namespace
+{
+	using TUESL::TimeSeries::Sample;
+	using TUESL::TimeSeries::TimeSeriesStore;
+
+	constexpr const std::size_t SAMPLE_COUNTS[] = {1'000, 100'000, 1'000'000};
+
+	// One Minute in DateTime Ticks
+	constexpr const std::int64_t INTERVAL = 60ll * 10'000'000ll;
+
+	// Rates as Returned by the Web Service
+	// Rounded to 6 Decimal Places
+	std::vector<Sample> randomWalk(const std::size_t p_count)
+	{
+		std::mt19937_64						 engine{42};
+		std::normal_distribution<double> step{0.0, 0.0005};
+
+		std::vector<Sample> samples;
+		samples.reserve(p_count);
+
+		double		 rate = 70.0;
+		std::int64_t time = 636'800'000'000'000'000ll;
+		for (std::size_t i = 0; i < p_count; ++i)
+		{
+			rate *= 1.0 + step(engine);
+			samples.push_back(Sample{time, std::round(rate * 1e6) / 1e6});
+			time += INTERVAL;
+		}
+		return samples;
+	}
+
+	std::string sizeLabel(const std::string_view p_prefix, const std::size_t p_count)
+	{
+		return std::string{p_prefix} + "/" + std::to_string(p_count);
+	}
+} // namespace
+
+BENCHMARK(TimeSeriesGorillaStore)
+{
+	for (const auto count : SAMPLE_COUNTS)
+	{
+		const auto samples	= randomWalk(count);
+		const auto directory = Benchmarks::scratchDirectory(L"TimeSeries");
+		const auto label		= sizeLabel("timeseries/gorilla", count);
+
+		std::uint64_t size_on_disk = 0;
+		{
+			TimeSeriesStore store{directory};
+
+			const auto ingest_seconds = Benchmarks::secondsFor([&] {
+				for (const auto& sample : samples)
+					store.append(L"USD_INR", sample);
+				store.flush();
+			});
+			size_on_disk = store.sizeOnDisk(L"USD_INR");
+
+			reporter.report(label, "ingest_samples_per_sec", count / ingest_seconds);
+			reporter.report(label, "bytes_per_sample", double(size_on_disk) / count);
+
+			const auto range_seconds = Benchmarks::secondsFor([&] {
+				const auto range = store.range(
+					 L"USD_INR", samples.front().time, samples.back().time + 1);
+				Benchmarks::doNotOptimize(range);
+			});
+			reporter.report(label, "range_samples_per_sec", count / range_seconds);
+		}
+
+		// Reopening Validates every Block
+		const auto recover_seconds = Benchmarks::secondsFor([&] {
+			TimeSeriesStore store{directory};
+			Benchmarks::doNotOptimize(store.sizeOnDisk(L"USD_INR"));
+		});
+		reporter.report(label, "recover_bytes_per_sec", size_on_disk / recover_seconds);
+	}
+}
+
+BENCHMARK(TimeSeriesSQLiteTable)
+{
+	for (const auto count : SAMPLE_COUNTS)
+	{
+		const auto samples	= randomWalk(count);
+		const auto directory = Benchmarks::scratchDirectory(L"TimeSeriesSQLite");
+		const auto label		= sizeLabel("timeseries/sqlite", count);
+
+		const std::wstring file_name{directory + L"\\History.db"};
+		TUESL::SQLite::Database db{winrt::to_string(file_name)};
+		sqlite3*					  handle = db.getDatabaseRAWHandle();
+
+		// Same Shape as the CURRENCY_VALUES Table including the Time Index
+		db.executeSQL("CREATE TABLE TABLE_CURRENCY_VALUES (from_col BLOB NOT NULL,"
+						  "to_col BLOB NOT NULL,amt_col REAL NOT NULL,time_col REAL NOT NULL);");
+		db.executeSQL("CREATE INDEX INDEX_CURRENCY_VALUES_TIME ON "
+						  "TABLE_CURRENCY_VALUES(time_col);");
+
+		// Best Case for SQLite
+		// One Transaction and a Reused Statement
+		const auto ingest_seconds = Benchmarks::secondsFor([&] {
+			sqlite3_stmt* stmt = nullptr;
+			sqlite3_prepare_v2(handle,
+									 "INSERT INTO TABLE_CURRENCY_VALUES VALUES(?,?,?,?);",
+									 -1,
+									 &stmt,
+									 nullptr);
+
+			db.transactionBegin();
+			for (const auto& sample : samples)
+			{
+				sqlite3_bind_text16(stmt, 1, L"USD", 6, SQLITE_STATIC);
+				sqlite3_bind_text16(stmt, 2, L"INR", 6, SQLITE_STATIC);
+				sqlite3_bind_double(stmt, 3, sample.value);
+				sqlite3_bind_double(stmt, 4, static_cast<double>(sample.time));
+				sqlite3_step(stmt);
+				sqlite3_reset(stmt);
+			}
+			db.transactionEnd();
+			sqlite3_finalize(stmt);
+		});
+
+		reporter.report(label, "ingest_samples_per_sec", count / ingest_seconds);
+
+		std::int64_t page_count = 0;
+		std::int64_t page_size	= 0;
+		{
+			sqlite3_stmt* stmt = nullptr;
+			sqlite3_prepare_v2(handle, "PRAGMA page_count;", -1, &stmt, nullptr);
+			if (sqlite3_step(stmt) == SQLITE_ROW)
+				page_count = sqlite3_column_int64(stmt, 0);
+			sqlite3_finalize(stmt);
+
+			sqlite3_prepare_v2(handle, "PRAGMA page_size;", -1, &stmt, nullptr);
+			if (sqlite3_step(stmt) == SQLITE_ROW)
+				page_size = sqlite3_column_int64(stmt, 0);
+			sqlite3_finalize(stmt);
+		}
+		reporter.report(label, "bytes_per_sample", double(page_count * page_size) / count);
+
+		const auto range_seconds = Benchmarks::secondsFor([&] {
+			sqlite3_stmt* stmt = nullptr;
+			sqlite3_prepare_v2(handle,
+									 "SELECT time_col, amt_col FROM TABLE_CURRENCY_VALUES "
+									 "WHERE time_col >= ? AND time_col < ? ORDER BY time_col;",
+									 -1,
+									 &stmt,
+									 nullptr);
+			sqlite3_bind_double(stmt, 1, static_cast<double>(samples.front().time));
+			sqlite3_bind_double(stmt, 2, static_cast<double>(samples.back().time + 1));
+
+			std::vector<Sample> range;
+			while (sqlite3_step(stmt) == SQLITE_ROW)
+				range.push_back(Sample{static_cast<std::int64_t>(sqlite3_column_double(stmt, 0)),
+											  sqlite3_column_double(stmt, 1)});
+			sqlite3_finalize(stmt);
+
+			Benchmarks::doNotOptimize(range);
+		});
+		reporter.report(label, "range_samples_per_sec", count / range_seconds);
+	}
+}
@@ -0,0 +1,211 @@
+#include "pch.h"
+
+#include "Harness.hxx"
+
+#include <TUESL/SQLite/Database.hxx>
+#include <TUESL/SQLite/PrepareStatement.hxx>
+#include <TUESL/Utility/Transcode.hxx>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+// Throughput of UTF-8 and UTF-16 Conversion, in GB of Source per Second
+//
+// scalar and vector are the Kernels of TUESL::Utility, into a Buffer of the Caller
+// win32 is MultiByteToWideChar and WideCharToMultiByte into the same Buffer
+// which winrt::to_hstring and winrt::to_string are built on
+//
+// ascii is Text as the Service Returns it, names is Currency Names with Accents
+// and Symbols, which leave the Vector Path every few Characters
+//
+// sqlite/text Reads every Name back as an hstring
+// text16 through sqlite3_column_text16 as PrepareStatement used to
+// utf8 through PrepareStatement, which now Transcodes the Stored UTF-8 itself
+
+namespace
+{
+	namespace Utility = TUESL::Utility;
+	namespace SQLite  = TUESL::SQLite;
+
+	using namespace std::string_literals;
+
+	// Large enough that the Source is not all in L1
+	constexpr const std::size_t TEXT_BYTES = 1 << 20;
+	constexpr const std::size_t PASSES	  = 200;
+
+	constexpr const std::size_t NAME_ROWS = 100'000;
+
+	// As the Service Returns them, in UTF-8
+	// Escaped, as such the Bytes do not Depend on the Code Page the Source is Read in
+	constexpr const char* NAMES[] = {
+		 "S\xC3\xA3o Tom\xC3\xA9 and Pr\xC3\xADncipe Dobra",
+		 "Icelandic Kr\xC3\xB3na",
+		 "Euro \xE2\x82\xAC",
+		 "Japanese Yen \xC2\xA5",
+		 "Polish Z\xC5\x82oty",
+		 "Vietnamese \xC4\x90\xE1\xBB\x93ng",
+		 "Turkish Lira \xE2\x82\xBA",
+		 "Bitcoin \xE2\x82\xBF \xF0\x9F\x92\xB0",
+		 "United States Dollar",
+		 "Indian Rupee \xE2\x82\xB9"};
+	constexpr const char* ASCII_TEXT =
+		 R"({"results":{"USD":{"currencyName":"United States Dollar","id":"USD"}},)";
+
+	std::string repeat(const std::string_view p_text)
+	{
+		std::string text;
+		text.reserve(TEXT_BYTES + std::size(p_text));
+		while (std::size(text) < TEXT_BYTES)
+			text += p_text;
+		return text;
+	}
+
+	std::string makeNames()
+	{
+		std::string names;
+		for (const auto name : NAMES)
+			names += std::string{name} + ", ";
+		return repeat(names);
+	}
+
+	std::string label(const std::string_view p_direction,
+							const std::string_view p_text,
+							const std::string_view p_kernel)
+	{
+		return "transcode/"s + std::string{p_direction} + "/" + std::string{p_text} + "/" +
+				 std::string{p_kernel};
+	}
+
+	template <typename Function>
+	void measure(Benchmarks::Reporter&  p_reporter,
+					 const std::string&		p_label,
+					 const std::size_t		p_source_bytes,
+					 Function					p_function)
+	{
+		// Touches the Destination before Timing
+		p_function();
+
+		const auto seconds = Benchmarks::secondsFor([&] {
+			for (std::size_t pass = 0; pass < PASSES; ++pass)
+				p_function();
+		});
+		p_reporter.report(p_label, "gb_per_sec", p_source_bytes * PASSES / seconds / 1e9);
+	}
+
+	void measureText(Benchmarks::Reporter&  p_reporter,
+						  const std::string_view p_text_name,
+						  const std::string&		 p_utf8)
+	{
+		const auto utf16 = Utility::toUTF16(p_utf8).value();
+
+		std::vector<wchar_t> wide(Utility::maxUTF16Length(std::size(p_utf8)));
+		std::vector<char>		narrow(Utility::maxUTF8Length(std::size(utf16)));
+
+		const auto utf8_bytes  = std::size(p_utf8);
+		const auto utf16_bytes = std::size(utf16) * sizeof(wchar_t);
+
+		measure(p_reporter, label("utf8_to_utf16", p_text_name, "scalar"), utf8_bytes, [&] {
+			Benchmarks::doNotOptimize(
+				 Utility::Kernels::utf8ToUTF16Scalar(p_utf8, std::data(wide), std::size(wide)));
+		});
+		measure(p_reporter, label("utf8_to_utf16", p_text_name, "vector"), utf8_bytes, [&] {
+			Benchmarks::doNotOptimize(
+				 Utility::Kernels::utf8ToUTF16Vector(p_utf8, std::data(wide), std::size(wide)));
+		});
+		measure(p_reporter, label("utf8_to_utf16", p_text_name, "win32"), utf8_bytes, [&] {
+			Benchmarks::doNotOptimize(MultiByteToWideChar(CP_UTF8,
+																		 MB_ERR_INVALID_CHARS,
+																		 std::data(p_utf8),
+																		 static_cast<int>(std::size(p_utf8)),
+																		 std::data(wide),
+																		 static_cast<int>(std::size(wide))));
+		});
+
+		measure(p_reporter, label("utf16_to_utf8", p_text_name, "scalar"), utf16_bytes, [&] {
+			Benchmarks::doNotOptimize(
+				 Utility::Kernels::utf16ToUTF8Scalar(utf16, std::data(narrow), std::size(narrow)));
+		});
+		measure(p_reporter, label("utf16_to_utf8", p_text_name, "vector"), utf16_bytes, [&] {
+			Benchmarks::doNotOptimize(
+				 Utility::Kernels::utf16ToUTF8Vector(utf16, std::data(narrow), std::size(narrow)));
+		});
+		measure(p_reporter, label("utf16_to_utf8", p_text_name, "win32"), utf16_bytes, [&] {
+			Benchmarks::doNotOptimize(WideCharToMultiByte(CP_UTF8,
+																		 WC_ERR_INVALID_CHARS,
+																		 std::data(utf16),
+																		 static_cast<int>(std::size(utf16)),
+																		 std::data(narrow),
+																		 static_cast<int>(std::size(narrow)),
+																		 nullptr,
+																		 nullptr));
+		});
+	}
+} // namespace
+
+BENCHMARK(Transcode)
+{
+	measureText(reporter, "ascii", repeat(ASCII_TEXT));
+	measureText(reporter, "names", makeNames());
+}
+
+BENCHMARK(TranscodeSQLite)
+{
+	SQLite::Database db{":memory:"};
+	db.executeSQL("CREATE TABLE names (name TEXT NOT NULL);");
+
+	std::size_t name_bytes = 0;
+	{
+		SQLite::PrepareStatement ps{db, "INSERT INTO names VALUES(?);"};
+
+		db.transactionBegin();
+		for (std::size_t i = 0; i < NAME_ROWS; ++i)
+		{
+			const std::string_view name{NAMES[i % std::size(NAMES)]};
+			name_bytes += std::size(name);
+
+			ps.restart();
+			ps.bind(name);
+			ps.execute();
+		}
+		db.transactionEnd();
+	}
+
+	constexpr const auto SQL_SELECT = "SELECT name FROM names;";
+
+	const auto report = [&](const std::string_view p_variant, const double p_seconds) {
+		const auto label =
+			 "sqlite/text/"s + std::string{p_variant} + "/" + std::to_string(NAME_ROWS);
+		reporter.report(label, "gb_per_sec", name_bytes / p_seconds / 1e9);
+	};
+
+	{
+		sqlite3_stmt* stmt = nullptr;
+		sqlite3_prepare_v2(db.getDatabaseRAWHandle(), SQL_SELECT, -1, &stmt, nullptr);
+
+		std::size_t length	= 0;
+		const auto	seconds = Benchmarks::secondsFor([&] {
+			 while (sqlite3_step(stmt) == SQLITE_ROW)
+			 {
+				 const auto* text = sqlite3_column_text16(stmt, 0);
+				 length += std::size(winrt::hstring{reinterpret_cast<const wchar_t*>(text)});
+			 }
+		 });
+		sqlite3_finalize(stmt);
+
+		Benchmarks::doNotOptimize(length);
+		report("text16", seconds);
+	}
+	{
+		SQLite::PrepareStatement ps{db, SQL_SELECT};
+
+		std::size_t length	= 0;
+		const auto	seconds = Benchmarks::secondsFor([&] {
+			 while (ps.hasNext())
+				 length += std::size(ps.get<winrt::hstring>().value_or(winrt::hstring{}));
+		 });
+
+		Benchmarks::doNotOptimize(length);
+		report("utf8", seconds);
+	}
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+
+// Winsock 2 must come before Windows.h
+#include <winsock2.h>
+
+#include <afunix.h>
+#include <Windows.h>
+
+#include <winrt/base.h>
+
+// Required by the Converter, which is Compiled in here rather than in the App
+#include <winrt/Windows.Data.Json.h>
+#include <winrt/Windows.Foundation.h>
+#include <winrt/Windows.Storage.h>
+#include <winrt/Windows.System.Threading.h>
+#include <winrt/Windows.Web.Http.h>
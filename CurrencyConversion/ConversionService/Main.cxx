@@ -0,0 +1,124 @@
+#include "pch.h"
+
+#include "Server.hxx"
+
+#include <TUESL/Metrics/Prometheus.hxx>
+#include <TUESL/Utility/FileSystem.hxx>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+// Serves Conversions to other Processes on the Machine, without a Window
+//
+// Example
+//	ConversionService.exe C:\Temp\conversion.sock C:\Temp\ConversionService
+//	ConversionService.exe C:\Temp\conversion.sock C:\Temp\ConversionService C:\Temp\cs.prom
+//
+// Keeps the Database, Snapshot and History in the Data Folder
+// Given a Metrics File, Rewrites it every Tick in the Prometheus Text Format
+// for the Node Exporter's Textfile Collector to Pick up
+// Ctrl+C Stops it, after which everything Held in Memory is Written out
+
+namespace
+{
+	using namespace std::chrono_literals;
+
+	// At most this much of the Database is Lost on a Crash
+	constexpr const auto TICK_PERIOD = 10s;
+	// Expiry is Bounded per Run, as such it can run every so many Ticks
+	constexpr const int TICKS_PER_EXPIRY = 90;
+	constexpr const auto RATE_LIFETIME = std::chrono::hours{12};
+
+	Service::ConversionServer* g_server = nullptr;
+
+	BOOL WINAPI onConsoleControl(const DWORD p_control_type)
+	{
+		if (p_control_type != CTRL_C_EVENT && p_control_type != CTRL_BREAK_EVENT &&
+			 p_control_type != CTRL_CLOSE_EVENT)
+			return FALSE;
+
+		if (g_server != nullptr)
+			g_server->stop();
+		return TRUE;
+	}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+	if (argc < 3)
+	{
+		std::cerr << "Usage: ConversionService <socket path> <data folder> [metrics file]"
+					 << std::endl;
+		return 1;
+	}
+
+	winrt::init_apartment();
+
+	TUESL::Net::WinsockSession winsock;
+	if (!winsock.isStarted())
+	{
+		std::cerr << "Winsock could not be Started" << std::endl;
+		return 1;
+	}
+
+	const auto data_folder	= winrt::to_hstring(argv[2]);
+	const auto metrics_file = argc > 3 ? winrt::to_hstring(argv[3]) : winrt::hstring{};
+	if (!TUESL::Utility::FileSystem::createDirectory(data_folder))
+	{
+		std::cerr << "Data Folder could not be Created" << std::endl;
+		return 1;
+	}
+
+	Currency::CurrencyConverter converter{Currency::DatabaseMode::IN_MEMORY,
+													  Currency::StorageFolders{data_folder, data_folder}};
+
+	// Codes are what Requests carry, as such the Table must be there before the First
+	if (!converter.IsWarm())
+		converter.SetupTableCurrencyIDs().get();
+	// A Warm Start may hold a List the Service has since Changed, only the Delta is Written
+	converter.SyncCurrencyIDs().get();
+
+	Service::ConversionServer server{converter};
+	if (!server.listen(argv[1]))
+	{
+		std::cerr << "Could not Listen on " << argv[1] << std::endl;
+		return 1;
+	}
+
+	g_server = &server;
+	SetConsoleCtrlHandler(onConsoleControl, TRUE);
+
+	std::cerr << "Serving on " << argv[1] << std::endl;
+
+	int ticks = 0;
+	server.run(TICK_PERIOD, [&] {
+		converter.BackupDatabase();
+
+		if (++ticks % TICKS_PER_EXPIRY == 0)
+		{
+			const auto now = winrt::clock::now().time_since_epoch();
+			converter.ExpireCurrencyValuesOlderThanTime(
+				 now - std::chrono::duration_cast<winrt::Windows::Foundation::TimeSpan>(RATE_LIFETIME));
+		}
+
+		// A Failed Write Leaves the last File in place, the next Tick Tries again
+		if (!std::empty(metrics_file))
+			TUESL::Metrics::writePrometheusFile(TUESL::Metrics::Registry::global(), metrics_file);
+	});
+
+	SetConsoleCtrlHandler(onConsoleControl, FALSE);
+	g_server = nullptr;
+
+	const auto& statistics = server.statistics();
+	std::cerr << "Served " << statistics.requests << " Requests, " << statistics.cache_hits
+				 << " from Memory, " << statistics.invalid << " Invalid, over "
+				 << statistics.connections << " Connections" << std::endl;
+
+	// As on Suspend in the App
+	converter.SaveSnapshot();
+	converter.FlushHistory();
+	converter.FlushDatabase();
+
+	return 0;
+}
@@ -0,0 +1,217 @@
+#include "pch.h"
+
+#include "Protocol.hxx"
+
+#include <algorithm>
+#include <type_traits>
+
+namespace Service::Protocol
+{
+	namespace
+	{
+		template <typename Integer>
+		void put(std::vector<std::uint8_t>& p_output, const Integer p_value)
+		{
+			using Unsigned = std::make_unsigned_t<Integer>;
+			const auto value = static_cast<Unsigned>(p_value);
+
+			for (std::size_t i = 0; i < sizeof(Integer); ++i)
+				p_output.push_back(static_cast<std::uint8_t>(value >> (8 * i)));
+		}
+
+		void putCode(std::vector<std::uint8_t>& p_output, const std::string& p_code)
+		{
+			// Longer Codes are Cut, the Receiver then Reports an Unknown Rate
+			const auto length = (std::min)(std::size(p_code), MAX_CODE_LENGTH);
+
+			p_output.push_back(static_cast<std::uint8_t>(length));
+			p_output.insert(std::end(p_output), std::begin(p_code), std::begin(p_code) + length);
+		}
+
+		// Reads from a Body, every Read past its End Fails
+		class BodyReader
+		{
+		 private:
+			const std::uint8_t* m_data;
+			std::size_t			  m_remaining;
+
+		 public:
+			BodyReader(const std::uint8_t* p_data, const std::size_t p_size) noexcept :
+				 m_data{p_data}, m_remaining{p_size}
+			{
+			}
+
+			template <typename Integer>
+			bool get(Integer& p_value) noexcept
+			{
+				if (m_remaining < sizeof(Integer))
+					return false;
+
+				std::make_unsigned_t<Integer> value = 0;
+				for (std::size_t i = 0; i < sizeof(Integer); ++i)
+					value |= static_cast<decltype(value)>(m_data[i]) << (8 * i);
+
+				p_value = static_cast<Integer>(value);
+				m_data += sizeof(Integer);
+				m_remaining -= sizeof(Integer);
+				return true;
+			}
+
+			bool getCode(std::string& p_code)
+			{
+				std::uint8_t length = 0;
+				if (!get(length) || length == 0 || length > MAX_CODE_LENGTH || m_remaining < length)
+					return false;
+
+				p_code.assign(reinterpret_cast<const char*>(m_data), length);
+				m_data += length;
+				m_remaining -= length;
+				return true;
+			}
+
+			bool isEmpty() const noexcept
+			{
+				return m_remaining == 0;
+			}
+		};
+
+		// Writes the Size once the Body behind it is Complete
+		class FrameWriter
+		{
+		 private:
+			std::vector<std::uint8_t>& m_output;
+			const std::size_t			m_start;
+
+		 public:
+			explicit FrameWriter(std::vector<std::uint8_t>& p_output) :
+				 m_output{p_output}, m_start{std::size(p_output)}
+			{
+				put(m_output, std::uint32_t{0});
+			}
+			~FrameWriter()
+			{
+				auto size =
+					 static_cast<std::uint32_t>(std::size(m_output) - m_start - SIZE_FIELD_LENGTH);
+				for (std::size_t i = 0; i < SIZE_FIELD_LENGTH; ++i, size >>= 8)
+					m_output[m_start + i] = static_cast<std::uint8_t>(size);
+			}
+		};
+
+		// Finds the Body of the Frame at the Start of p_data
+		DecodeStatus frameBody(const std::uint8_t*	 p_data,
+									  const std::size_t		 p_size,
+									  const std::size_t		 p_min_body_size,
+									  const std::uint8_t*& p_body,
+									  std::size_t&			 p_body_size)
+		{
+			BodyReader	  reader{p_data, p_size};
+			std::uint32_t size = 0;
+			if (!reader.get(size))
+				return DecodeStatus::INCOMPLETE;
+
+			if (size < p_min_body_size || size > MAX_BODY_SIZE)
+				return DecodeStatus::CORRUPT;
+			if (p_size - SIZE_FIELD_LENGTH < size)
+				return DecodeStatus::INCOMPLETE;
+
+			p_body		= p_data + SIZE_FIELD_LENGTH;
+			p_body_size = size;
+			return DecodeStatus::DECODED;
+		}
+	} // namespace
+
+	void encodeRequest(const Request& p_request, std::vector<std::uint8_t>& p_output)
+	{
+		FrameWriter frame{p_output};
+
+		put(p_output, p_request.id);
+		put(p_output, static_cast<std::uint8_t>(p_request.operation));
+
+		if (p_request.operation == Operation::PING)
+			return;
+
+		if (p_request.operation == Operation::CONVERT)
+			put(p_output, p_request.amount_units);
+
+		putCode(p_output, p_request.from_code);
+		putCode(p_output, p_request.to_code);
+	}
+
+	void encodeResponse(const Response& p_response, std::vector<std::uint8_t>& p_output)
+	{
+		FrameWriter frame{p_output};
+
+		put(p_output, p_response.id);
+		put(p_output, static_cast<std::uint8_t>(p_response.status));
+		put(p_output, p_response.rate_units);
+		put(p_output, p_response.amount_units);
+	}
+
+	DecodeStatus decodeRequest(const std::uint8_t* p_data,
+										const std::size_t	  p_size,
+										Request&				  p_request,
+										std::size_t&		  p_consumed)
+	{
+		const std::uint8_t* body;
+		std::size_t			  body_size;
+
+		// Without an id there is no one to Answer
+		const auto status = frameBody(p_data, p_size, sizeof(std::uint32_t), body, body_size);
+		if (status != DecodeStatus::DECODED)
+			return status;
+
+		p_consumed = SIZE_FIELD_LENGTH + body_size;
+
+		BodyReader reader{body, body_size};
+		reader.get(p_request.id);
+
+		std::uint8_t operation = 0;
+		if (!reader.get(operation))
+			return DecodeStatus::INVALID;
+		p_request.operation = static_cast<Operation>(operation);
+
+		switch (p_request.operation)
+		{
+			case Operation::PING:
+				break;
+			case Operation::CONVERT:
+				if (!reader.get(p_request.amount_units))
+					return DecodeStatus::INVALID;
+				[[fallthrough]];
+			case Operation::RATE:
+				if (!reader.getCode(p_request.from_code) || !reader.getCode(p_request.to_code))
+					return DecodeStatus::INVALID;
+				break;
+			default:
+				return DecodeStatus::INVALID;
+		}
+
+		return reader.isEmpty() ? DecodeStatus::DECODED : DecodeStatus::INVALID;
+	}
+
+	DecodeStatus decodeResponse(const std::uint8_t* p_data,
+										 const std::size_t	p_size,
+										 Response&				p_response,
+										 std::size_t&			p_consumed)
+	{
+		const std::uint8_t* body;
+		std::size_t			  body_size;
+
+		const auto status = frameBody(p_data, p_size, RESPONSE_BODY_SIZE, body, body_size);
+		if (status != DecodeStatus::DECODED)
+			return status;
+
+		p_consumed = SIZE_FIELD_LENGTH + body_size;
+
+		BodyReader	 reader{body, body_size};
+		std::uint8_t response_status = 0;
+
+		reader.get(p_response.id);
+		reader.get(response_status);
+		reader.get(p_response.rate_units);
+		reader.get(p_response.amount_units);
+		p_response.status = static_cast<Status>(response_status);
+
+		return reader.isEmpty() ? DecodeStatus::DECODED : DecodeStatus::INVALID;
+	}
+} // namespace Service::Protocol
@@ -0,0 +1,98 @@
+#pragma once
+
+// Binary Protocol of the Conversion Service
+//
+// Every Message is a Frame, its Size followed by its Body
+//	u32 size | body
+//
+// Request Body
+//	u32 id | u8 operation | [i64 amount_units, CONVERT only] | code from | code to
+//	code is u8 length | ASCII, at most MAX_CODE_LENGTH Characters
+//
+// Response Body
+//	u32 id | u8 status | i64 rate_units | i64 amount_units
+//	Units are those of Rate and Money, amount_units is 0 unless CONVERT
+//
+// Integers are Little Endian
+//
+// A Client may Send any Number of Requests without Waiting for their Responses
+// Responses carry the id of their Request and come in the Order they are Ready in
+// A Cached Rate is Answered before a Request ahead of it that Waits on the Network
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Service::Protocol
+{
+	constexpr const std::size_t SIZE_FIELD_LENGTH = sizeof(std::uint32_t);
+	constexpr const std::size_t MAX_CODE_LENGTH	  = 15;
+	// Largest Body either Side may Send, that of a CONVERT Request
+	constexpr const std::size_t MAX_BODY_SIZE = 4 + 1 + 8 + 2 * (1 + MAX_CODE_LENGTH);
+	constexpr const std::size_t RESPONSE_BODY_SIZE = 4 + 1 + 8 + 8;
+
+	enum class Operation : std::uint8_t
+	{
+		// Answered at once, for Checking the Service is Up
+		PING = 0,
+		RATE = 1,
+		CONVERT = 2
+	};
+
+	enum class Status : std::uint8_t
+	{
+		OK = 0,
+		// Neither Cached nor Obtainable from Upstream
+		UNKNOWN_RATE = 1,
+		INVALID_REQUEST = 2,
+		// The Converted Amount does not fit Money
+		OUT_OF_RANGE = 3
+	};
+
+	struct Request
+	{
+		std::uint32_t id = 0;
+		Operation	  operation = Operation::PING;
+		std::int64_t  amount_units = 0;
+		// Short enough to stay within the String itself
+		std::string from_code;
+		std::string to_code;
+	};
+
+	struct Response
+	{
+		std::uint32_t id = 0;
+		Status		  status = Status::OK;
+		std::int64_t  rate_units = 0;
+		std::int64_t  amount_units = 0;
+	};
+
+	enum class DecodeStatus
+	{
+		DECODED,
+		// The Frame has not fully Arrived yet
+		INCOMPLETE,
+		// The Frame is Whole but its Body is not a Request
+		// The id is Decoded where it is there, as such the Sender can be told
+		INVALID,
+		// The Size can not be Right, nothing after it can be Trusted
+		// The Connection must be Dropped
+		CORRUPT
+	};
+
+	// Appends the Frame to p_output
+	void encodeRequest(const Request& p_request, std::vector<std::uint8_t>& p_output);
+	void encodeResponse(const Response& p_response, std::vector<std::uint8_t>& p_output);
+
+	// Decodes the Frame at the Start of p_data
+	// p_consumed is the Size of the Frame, set when DECODED or INVALID
+	DecodeStatus decodeRequest(const std::uint8_t* p_data,
+										const std::size_t	  p_size,
+										Request&				  p_request,
+										std::size_t&		  p_consumed);
+	DecodeStatus decodeResponse(const std::uint8_t* p_data,
+										 const std::size_t	p_size,
+										 Response&				p_response,
+										 std::size_t&			p_consumed);
+} // namespace Service::Protocol
@@ -0,0 +1,429 @@
+#include "pch.h"
+
+#include "Server.hxx"
+
+#include <TUESL/Utility/Transcode.hxx>
+
+#include <algorithm>
+
+namespace Service
+{
+	namespace
+	{
+		using namespace winrt;
+
+		using Windows::Foundation::AsyncStatus;
+		using Windows::Foundation::IAsyncOperation;
+
+		using TUESL::Net::IOStatus;
+		using TUESL::Net::LocalSocket;
+
+		using TUESL::Numeric::Money;
+		using TUESL::Numeric::Rate;
+
+		using TUESL::Utility::toHString;
+
+		// Bytes Received per Call
+		constexpr const std::size_t RECEIVE_CHUNK_SIZE = 16 * 1024;
+		// Requests not yet Decoded per Connection
+		// Reading Stops here until they are
+		constexpr const std::size_t MAX_UNREAD_BYTES = 64 * 1024;
+
+		// Index of each Socket within the Poll Set, Connections follow
+		constexpr const std::size_t LISTENER_INDEX = 0;
+		constexpr const std::size_t WAKE_INDEX		 = 1;
+	} // namespace
+
+	ConversionServer::ConversionServer(Currency::CurrencyConverter& p_converter,
+												  const ServerOptions&			  p_options) :
+		 m_converter{p_converter}, m_options{p_options}
+	{
+	}
+
+	ConversionServer::~ConversionServer()
+	{
+		// Completion Handlers refer to the Server
+		std::unique_lock<std::mutex> lock{m_completion_mutex};
+		m_outstanding_done.wait(lock, [this] { return m_outstanding == 0; });
+	}
+
+	bool ConversionServer::listen(const std::string_view p_path)
+	{
+		auto listener = LocalSocket::listen(p_path);
+		if (!listener.has_value())
+			return false;
+
+		// Connecting Completes once Queued, as such the Blocking accept Returns at once
+		auto wake_writer = LocalSocket::connect(p_path);
+		if (!wake_writer.has_value())
+			return false;
+		auto wake_reader = listener->accept();
+		if (!wake_reader.has_value())
+			return false;
+
+		if (!listener->setNonBlocking() || !wake_reader->setNonBlocking() ||
+			 !wake_writer->setNonBlocking())
+			return false;
+
+		m_listener	  = std::move(listener.value());
+		m_wake_reader = std::move(wake_reader.value());
+		m_wake_writer = std::move(wake_writer.value());
+		return true;
+	}
+
+	void ConversionServer::wake() noexcept
+	{
+		// Should the Buffer be Full a Wake is Pending already
+		const std::uint8_t signal = 0;
+		m_wake_writer.send(&signal, sizeof(signal));
+	}
+
+	void ConversionServer::drainWake()
+	{
+		std::uint8_t signals[64];
+		while (m_wake_reader.receive(signals, sizeof(signals)).status == IOStatus::DONE)
+			continue;
+	}
+
+	void ConversionServer::stop() noexcept
+	{
+		m_is_stopping = true;
+		wake();
+	}
+
+	bool ConversionServer::canRead(const Connection& p_connection) const noexcept
+	{
+		return !p_connection.is_closing &&
+				 p_connection.pending < m_options.max_pending_per_connection &&
+				 std::size(p_connection.output) - p_connection.output_offset <
+					  m_options.max_unsent_bytes;
+	}
+
+	Protocol::Response ConversionServer::answer(const Protocol::Request&  p_request,
+															  const std::optional<Rate> p_rate)
+	{
+		Protocol::Response response;
+		response.id = p_request.id;
+
+		if (!p_rate.has_value())
+		{
+			response.status = Protocol::Status::UNKNOWN_RATE;
+			return response;
+		}
+
+		response.rate_units = p_rate->units;
+
+		if (p_request.operation == Protocol::Operation::CONVERT)
+		{
+			const auto amount =
+				 TUESL::Numeric::convert(Money{p_request.amount_units}, p_rate.value());
+			if (!amount.has_value())
+				response.status = Protocol::Status::OUT_OF_RANGE;
+			else
+				response.amount_units = amount->units;
+		}
+		return response;
+	}
+
+	void ConversionServer::acceptConnections()
+	{
+		while (std::size(m_connections) < m_options.max_connections)
+		{
+			auto client = m_listener.accept();
+			if (!client.has_value())
+				break;
+
+			if (!client->setNonBlocking())
+				continue;
+
+			Connection connection;
+			connection.socket = std::move(client.value());
+			m_connections.emplace(m_next_connection_id++, std::move(connection));
+			++m_statistics.connections;
+		}
+	}
+
+	void ConversionServer::readFrom(const std::uint64_t p_id, Connection& p_connection)
+	{
+		auto& input = p_connection.input;
+
+		while (canRead(p_connection) && std::size(input) < MAX_UNREAD_BYTES)
+		{
+			const auto offset = std::size(input);
+			input.resize(offset + RECEIVE_CHUNK_SIZE);
+
+			const auto result =
+				 p_connection.socket.receive(std::data(input) + offset, RECEIVE_CHUNK_SIZE);
+			input.resize(offset + result.bytes);
+
+			if (result.status == IOStatus::WOULD_BLOCK)
+				break;
+			if (result.status != IOStatus::DONE)
+			{
+				// Nothing more can be Sent either
+				p_connection.is_closing = true;
+				p_connection.output.clear();
+				p_connection.output_offset = 0;
+				break;
+			}
+
+			// Answer as we go, so that Backpressure sees the Responses
+			handleRequests(p_id, p_connection);
+		}
+	}
+
+	void ConversionServer::writeTo(Connection& p_connection)
+	{
+		auto& output = p_connection.output;
+
+		while (p_connection.output_offset < std::size(output))
+		{
+			const auto unsent = std::size(output) - p_connection.output_offset;
+			const auto result =
+				 p_connection.socket.send(std::data(output) + p_connection.output_offset, unsent);
+
+			if (result.status == IOStatus::WOULD_BLOCK)
+				break;
+			if (result.status != IOStatus::DONE)
+			{
+				p_connection.is_closing = true;
+				output.clear();
+				p_connection.output_offset = 0;
+				return;
+			}
+			p_connection.output_offset += result.bytes;
+		}
+
+		if (p_connection.output_offset == std::size(output))
+		{
+			output.clear();
+			p_connection.output_offset = 0;
+		}
+		// Keeps the Buffer from Growing while a Slow Reader Catches up
+		else if (p_connection.output_offset > std::size(output) / 2)
+		{
+			output.erase(std::begin(output), std::begin(output) + p_connection.output_offset);
+			p_connection.output_offset = 0;
+		}
+	}
+
+	void ConversionServer::handleRequests(const std::uint64_t p_id, Connection& p_connection)
+	{
+		auto&			input	 = p_connection.input;
+		std::size_t offset = 0;
+
+		Protocol::Request request;
+
+		while (canRead(p_connection))
+		{
+			std::size_t consumed = 0;
+			const auto	status	= Protocol::decodeRequest(
+				 std::data(input) + offset, std::size(input) - offset, request, consumed);
+
+			if (status == Protocol::DecodeStatus::INCOMPLETE)
+				break;
+
+			if (status == Protocol::DecodeStatus::CORRUPT)
+			{
+				// Frames can no longer be told apart, Responses so far are still Sent
+				++m_statistics.invalid;
+				p_connection.is_closing = true;
+				offset						= std::size(input);
+				break;
+			}
+
+			offset += consumed;
+			++m_statistics.requests;
+
+			if (status == Protocol::DecodeStatus::INVALID)
+			{
+				++m_statistics.invalid;
+
+				Protocol::Response response;
+				response.id		 = request.id;
+				response.status = Protocol::Status::INVALID_REQUEST;
+				Protocol::encodeResponse(response, p_connection.output);
+				continue;
+			}
+
+			handleRequest(p_id, p_connection, request);
+		}
+
+		input.erase(std::begin(input), std::begin(input) + offset);
+	}
+
+	void ConversionServer::handleRequest(const std::uint64_t		  p_id,
+													 Connection&				  p_connection,
+													 const Protocol::Request& p_request)
+	{
+		if (p_request.operation == Protocol::Operation::PING)
+		{
+			Protocol::Response response;
+			response.id = p_request.id;
+			Protocol::encodeResponse(response, p_connection.output);
+			return;
+		}
+
+		// Codes that are not Valid UTF-8 become Empty, which no Rate is Cached under
+		const auto from_code = toHString(p_request.from_code).value_or(hstring{});
+		const auto to_code	= toHString(p_request.to_code).value_or(hstring{});
+
+		if (const auto rate = m_converter.GetCachedConversionRate(from_code, to_code))
+		{
+			++m_statistics.cache_hits;
+			Protocol::encodeResponse(answer(p_request, rate), p_connection.output);
+			return;
+		}
+
+		++p_connection.pending;
+		lookUp(p_id, p_request);
+	}
+
+	void ConversionServer::lookUp(const std::uint64_t p_id, const Protocol::Request& p_request)
+	{
+		{
+			std::lock_guard<std::mutex> lock{m_completion_mutex};
+			++m_outstanding;
+		}
+
+		// May Complete before Completed is even Set, the Handler then runs on this Thread
+		auto operation =
+			 m_converter.GetConversionRate(toHString(p_request.from_code).value_or(hstring{}),
+													 toHString(p_request.to_code).value_or(hstring{}));
+
+		operation.Completed([this, p_id, p_request](const IAsyncOperation<std::int64_t>& p_operation,
+																  const AsyncStatus							 p_status) {
+			std::optional<Rate> rate;
+			if (p_status == AsyncStatus::Completed)
+			{
+				// 0 when the Rate could not be Obtained
+				const auto units = p_operation.GetResults();
+				if (units != 0)
+					rate = Rate{units};
+			}
+			const auto response = answer(p_request, rate);
+
+			// The Lock is Held throughout, as once it is Released the Server may be Destroyed
+			std::lock_guard<std::mutex> lock{m_completion_mutex};
+			m_completions.push_back(Completion{p_id, response});
+			--m_outstanding;
+			m_outstanding_done.notify_all();
+			wake();
+		});
+	}
+
+	void ConversionServer::takeCompletions()
+	{
+		std::vector<Completion> completions;
+		{
+			std::lock_guard<std::mutex> lock{m_completion_mutex};
+			completions.swap(m_completions);
+		}
+
+		for (const auto& completion : completions)
+		{
+			// The Connection may have Closed meanwhile
+			const auto found = m_connections.find(completion.connection_id);
+			if (found == std::end(m_connections))
+				continue;
+
+			auto& connection = found->second;
+			--connection.pending;
+			if (!connection.is_closing)
+				Protocol::encodeResponse(completion.response, connection.output);
+		}
+	}
+
+	void ConversionServer::run(const std::chrono::milliseconds p_tick_period, const Tick& p_on_tick)
+	{
+		using Clock = std::chrono::steady_clock;
+
+		std::vector<WSAPOLLFD>		 poll_set;
+		std::vector<std::uint64_t> polled_ids;
+
+		auto next_tick = Clock::now() + p_tick_period;
+
+		while (!m_is_stopping)
+		{
+			poll_set.clear();
+			polled_ids.clear();
+
+			// Sockets left out are Ignored by WSAPoll
+			const bool can_accept = std::size(m_connections) < m_options.max_connections;
+			poll_set.push_back(
+				 WSAPOLLFD{can_accept ? m_listener.get() : INVALID_SOCKET, POLLRDNORM, 0});
+			poll_set.push_back(WSAPOLLFD{m_wake_reader.get(), POLLRDNORM, 0});
+
+			for (const auto& [id, connection] : m_connections)
+			{
+				SHORT events = 0;
+				if (canRead(connection))
+					events |= POLLRDNORM;
+				if (connection.output_offset < std::size(connection.output))
+					events |= POLLWRNORM;
+
+				// Waiting on Lookups alone, a Completion Wakes the Loop
+				if (events == 0)
+					continue;
+
+				poll_set.push_back(WSAPOLLFD{connection.socket.get(), events, 0});
+				polled_ids.push_back(id);
+			}
+
+			const auto until_tick =
+				 std::chrono::duration_cast<std::chrono::milliseconds>(next_tick - Clock::now());
+			const auto timeout = static_cast<INT>((std::max)(until_tick.count(), std::int64_t{0}));
+
+			const auto ready =
+				 WSAPoll(std::data(poll_set), static_cast<ULONG>(std::size(poll_set)), timeout);
+			if (ready == SOCKET_ERROR)
+				break;
+
+			if (poll_set[WAKE_INDEX].revents != 0)
+				drainWake();
+			takeCompletions();
+
+			if (poll_set[LISTENER_INDEX].revents != 0)
+				acceptConnections();
+
+			for (std::size_t i = 0; i < std::size(polled_ids); ++i)
+			{
+				// Hang Ups and Errors are Read too, receive then Reports them
+				const auto& polled = poll_set[2 + i];
+				if ((polled.revents & (POLLRDNORM | POLLHUP | POLLERR)) == 0)
+					continue;
+
+				const auto found = m_connections.find(polled_ids[i]);
+				if (found != std::end(m_connections))
+					readFrom(found->first, found->second);
+			}
+
+			for (auto it = std::begin(m_connections); it != std::end(m_connections);)
+			{
+				auto& [id, connection] = *it;
+
+				// Requests Held back by Backpressure, which may since have Eased
+				if (!std::empty(connection.input))
+					handleRequests(id, connection);
+
+				// Sent at once rather than on the next Poll, most Sends do not Block
+				if (connection.output_offset < std::size(connection.output))
+					writeTo(connection);
+
+				const bool is_finished = connection.is_closing && connection.pending == 0 &&
+												 connection.output_offset == std::size(connection.output);
+				if (is_finished)
+					it = m_connections.erase(it);
+				else
+					++it;
+			}
+
+			if (Clock::now() >= next_tick)
+			{
+				if (p_on_tick)
+					p_on_tick();
+				next_tick = Clock::now() + p_tick_period;
+			}
+		}
+	}
+} // namespace Service
@@ -0,0 +1,151 @@
+#pragma once
+
+// Serves Conversions over a Unix Domain Socket
+//
+// A Single Thread runs a WSAPoll Loop over the Listener and every Connection
+// Requests whose Rate is Cached are Answered on that Thread without Waiting
+// The others go to CurrencyConverter::GetConversionRate
+// Its Completion is Queued and the Loop Woken to Send the Response
+//
+// Each Connection Reads as many Requests as have Arrived and Answers them in one Send
+// A Connection with too many Requests Outstanding or too much Unsent is not Read from
+// until it has Caught up, as such a Client that never Reads can not Exhaust Memory
+//
+// Example
+//	ConversionServer server{converter};
+//	if (server.listen("C:\\Temp\\conversion.sock"))
+//		server.run(10s, [&] { converter.BackupDatabase(); });
+//	From any Thread
+//	server.stop();
+
+#include <TUESL/Net/LocalSocket.hxx>
+
+#include "CurrencyConverter.hxx"
+#include "Protocol.hxx"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Service
+{
+	struct ServerOptions
+	{
+		std::size_t max_connections = 256;
+		// Requests Waiting on the Network per Connection
+		std::size_t max_pending_per_connection = 256;
+		// Responses not yet Sent per Connection
+		std::size_t max_unsent_bytes = 256 * 1024;
+	};
+
+	struct ServerStatistics
+	{
+		std::uint64_t requests		= 0;
+		std::uint64_t cache_hits	= 0;
+		std::uint64_t invalid		= 0;
+		std::uint64_t connections = 0;
+	};
+
+	class ConversionServer
+	{
+	 public:
+		using Tick = std::function<void()>;
+
+	 private:
+		struct Connection
+		{
+			TUESL::Net::LocalSocket socket;
+
+			std::vector<std::uint8_t> input;
+			std::vector<std::uint8_t> output;
+			// Bytes of output already Sent
+			std::size_t output_offset = 0;
+
+			// Requests Waiting on the Network
+			std::size_t pending = 0;
+			// Once Set, the Connection is Dropped as soon as nothing is Pending
+			bool is_closing = false;
+		};
+
+		// Response to a Request that Waited on the Network
+		struct Completion
+		{
+			std::uint64_t		  connection_id;
+			Protocol::Response response;
+		};
+
+		Currency::CurrencyConverter& m_converter;
+		const ServerOptions			  m_options;
+
+		TUESL::Net::LocalSocket m_listener;
+		// A Connection to the Listener itself, Written to from other Threads to Wake the Loop
+		TUESL::Net::LocalSocket m_wake_reader;
+		TUESL::Net::LocalSocket m_wake_writer;
+
+		std::unordered_map<std::uint64_t, Connection> m_connections;
+		std::uint64_t										 m_next_connection_id = 0;
+
+		std::mutex					m_completion_mutex;
+		std::vector<Completion> m_completions;
+		// Lookups which have not Completed, the Server must outlive them
+		std::size_t					m_outstanding = 0;
+		std::condition_variable m_outstanding_done;
+
+		std::atomic<bool> m_is_stopping{false};
+
+		ServerStatistics m_statistics;
+
+	 private:
+		void wake() noexcept;
+		void drainWake();
+		void takeCompletions();
+
+		void acceptConnections();
+		void readFrom(const std::uint64_t p_id, Connection& p_connection);
+		void writeTo(Connection& p_connection);
+
+		// Answers every Whole Request in p_connection.input
+		void handleRequests(const std::uint64_t p_id, Connection& p_connection);
+		void handleRequest(const std::uint64_t		 p_id,
+								 Connection&				 p_connection,
+								 const Protocol::Request& p_request);
+		void lookUp(const std::uint64_t p_id, const Protocol::Request& p_request);
+
+		bool canRead(const Connection& p_connection) const noexcept;
+
+		static Protocol::Response answer(const Protocol::Request&				 p_request,
+													const std::optional<TUESL::Numeric::Rate> p_rate);
+
+	 public:
+		explicit ConversionServer(Currency::CurrencyConverter& p_converter,
+										  const ServerOptions&			 p_options = {});
+		// Waits for Lookups still Outstanding
+		~ConversionServer();
+
+		ConversionServer(const ConversionServer&) = delete;
+		ConversionServer& operator=(const ConversionServer&) = delete;
+
+		// false if the Socket could not be Created
+		bool listen(const std::string_view p_path);
+
+		// Serves until stop, calling p_on_tick every p_tick_period on the Loop Thread
+		void run(const std::chrono::milliseconds p_tick_period, const Tick& p_on_tick);
+
+		// Thread Safe
+		void stop() noexcept;
+
+		// Only Consistent on the Loop Thread, or once run has Returned
+		const ServerStatistics& statistics() const noexcept
+		{
+			return m_statistics;
+		}
+	};
+} // namespace Service
@@ -4,197 +4,873 @@
 
 #include "CurrencyConverter.hxx"
 
+// Required to Read Reference Rate Files without Copying them
+#include <TUESL/Utility/MemoryMappedFile.hxx>
+
+#include <algorithm>
+#include <charconv>
+#include <limits>
+#include <map>
+#include <stdexcept>
+
 namespace Currency
 {
+	namespace
+	{
+		// Rows Reloaded per Statement
+		constexpr const std::size_t ROWIDS_PER_QUERY = 512;
+		// Sign, 19 Digits and the Comma
+		constexpr const std::size_t MAX_ROWID_CHARACTERS = 21;
+
+		// Calls p_function with p_sql_prefix followed by Comma Separated RowIDs
+		// of the Inserted and Updated Rows and a Closing Parenthesis
+		// RowIDs are Integers, as such Formatting them into the SQL is Safe
+		// The SQL is Built within p_arena
+		template <typename Function>
+		void ForEachRowIDChunk(const std::vector<ChangeEvent>& p_events,
+									  const std::string_view			p_sql_prefix,
+									  Arena&								p_arena,
+									  Function							p_function)
+		{
+			std::pmr::string sql{&p_arena};
+			sql.reserve(std::size(p_sql_prefix) + ROWIDS_PER_QUERY * MAX_ROWID_CHARACTERS + 2);
+			sql.assign(p_sql_prefix);
+
+			std::size_t count = 0;
+
+			for (const auto& event : p_events)
+			{
+				if (event.operation == ChangeOperation::DELETED)
+					continue;
+
+				if (count != 0)
+					sql += ',';
+
+				char		  digits[MAX_ROWID_CHARACTERS];
+				const auto result = std::to_chars(std::begin(digits), std::end(digits), event.rowid);
+				sql.append(std::begin(digits), result.ptr);
+
+				if (++count == ROWIDS_PER_QUERY)
+				{
+					sql += ");";
+					p_function(std::string_view{sql});
+					sql.resize(std::size(p_sql_prefix));
+					count = 0;
+				}
+			}
+
+			if (count != 0)
+			{
+				sql += ");";
+				p_function(std::string_view{sql});
+			}
+		}
+		std::size_t CountChangedRows(const std::vector<ChangeEvent>& p_events)
+		{
+			return static_cast<std::size_t>(
+				 std::count_if(std::begin(p_events), std::end(p_events), [](const ChangeEvent& p_event) {
+					 return p_event.operation != ChangeOperation::DELETED;
+				 }));
+		}
+
+		Counter& LookupCounter(const char* p_layer)
+		{
+			return TUESL::Metrics::Registry::global().counter(
+				 "currency_rate_lookups_total",
+				 "Rate Lookups by the Layer which Answered them",
+				 {{"layer", p_layer}});
+		}
+		Histogram& QueryHistogram(const char* p_query)
+		{
+			return TUESL::Metrics::Registry::global().histogram(
+				 "currency_database_query_seconds",
+				 "Time Spent in SQLite by Class of Query",
+				 {{"query", p_query}});
+		}
+		Counter& ExpiryCounter(const char* p_table)
+		{
+			return TUESL::Metrics::Registry::global().counter(
+				 "currency_expiry_rows_total",
+				 "Rows Deleted by Expiry Ticks",
+				 {{"table", p_table}});
+		}
+
+		// The Currency Table in Display Order, Resumed by Name
+		// rowid Breaks Ties, as such no Row is ever Skipped or Read twice
+		TUESL::SQLite::PagedQuery CurrencyIDPages(std::string p_columns)
+		{
+			TUESL::SQLite::PagedQuery query;
+			query.columns		= std::move(p_columns);
+			query.table			= TableNames::TABLE_CURRENCY_IDs;
+			query.key_columns = {ColumnNames::CurrencyIDs::COLUMN_NAME, "rowid"};
+			return query;
+		}
+		TUESL::SQLite::PagedQuery CurrencyNamePages()
+		{
+			return CurrencyIDPages(ColumnNames::CurrencyIDs::COLUMN_NAME);
+		}
+		TUESL::SQLite::PagedQuery CurrencyEntryPages()
+		{
+			return CurrencyIDPages(ColumnNames::CurrencyIDs::COLUMN_ID + ","s +
+										  ColumnNames::CurrencyIDs::COLUMN_NAME + ","s +
+										  ColumnNames::CurrencyIDs::COLUMN_SYMBOL);
+		}
+
+		// Every Statement Prepared on the Tables, each Built once on first use
+		// RegisterStatements Registers all of them, as such none can lose its Index unnoticed
+		namespace Statements
+		{
+			namespace IDs	  = ColumnNames::CurrencyIDs;
+			namespace Values = ColumnNames::CurrencyValues;
+
+			const std::string& InsertRate()
+			{
+				static const std::string sql =
+					 Schema::insertSQL<CurrencyValueRow>("INSERT OR IGNORE");
+				return sql;
+			}
+			// The Latest Rate of the Pair not yet Expired
+			// Imports Store Rates of past Days, which are never to be Served as Current
+			const std::string& SelectRate()
+			{
+				static const std::string sql =
+					 "SELECT rowid,"s + Values::COLUMN_AMT_CONVERSION + ","s + Values::COLUMN_TIME +
+					 " FROM "s + TableNames::TABLE_CURRENCY_VALUES + " WHERE "s +
+					 Values::COLUMN_FROM + "=? AND "s + Values::COLUMN_TO + "=? AND "s +
+					 Values::COLUMN_TIME + ">=? ORDER BY "s + Values::COLUMN_TIME +
+					 " DESC LIMIT 1;"s;
+				return sql;
+			}
+			// Note that DELETE ... LIMIT is only present when SQLite is compiled
+			// with SQLITE_ENABLE_UPDATE_DELETE_LIMIT
+			// As such we select a Bounded Set of RowIDs via the Time Index instead
+			const std::string& ExpireRates()
+			{
+				static const std::string sql =
+					 "DELETE FROM "s + TableNames::TABLE_CURRENCY_VALUES + " WHERE rowid IN ("s +
+					 "SELECT rowid FROM "s + TableNames::TABLE_CURRENCY_VALUES + " WHERE "s +
+					 Values::COLUMN_TIME + " < ? LIMIT ?);"s;
+				return sql;
+			}
+			// Query taken from https://stackoverflow.com/a/19268554
+			// See example Query
+			// select * from your_table where product_price = (SELECT max(product_price) FROM
+			// your_table)
+			const std::string& SelectLatestConversion()
+			{
+				static const std::string sql =
+					 Schema::selectSQL<CurrencyValueRow>() + " WHERE "s + Values::COLUMN_TIME +
+					 " =( SELECT MAX("s + Values::COLUMN_TIME + ") FROM "s +
+					 TableNames::TABLE_CURRENCY_VALUES + ");"s;
+				return sql;
+			}
+			// Followed by Comma Separated RowIDs and a Closing Parenthesis
+			const std::string& ReloadRates()
+			{
+				static const std::string sql = "SELECT rowid,"s +
+														 Schema::columnList<CurrencyValueRow>() + " FROM "s +
+														 TableNames::TABLE_CURRENCY_VALUES +
+														 " WHERE rowid IN ("s;
+				return sql;
+			}
+
+			const std::string& InsertCurrencyID()
+			{
+				static const std::string sql =
+					 "INSERT OR IGNORE INTO "s + TableNames::TABLE_CURRENCY_IDs + "("s +
+					 IDs::COLUMN_ID + ","s + IDs::COLUMN_NAME + ","s + IDs::COLUMN_SYMBOL + ","s +
+					 IDs::COLUMN_FINGERPRINT + ") VALUES(?,?,?,?);"s;
+				return sql;
+			}
+			// Currencies already Listed Keep their Name and Symbol
+			const std::string& ImportCurrencyID()
+			{
+				static const std::string sql =
+					 "INSERT INTO "s + TableNames::TABLE_CURRENCY_IDs + "("s + IDs::COLUMN_ID +
+					 ","s + IDs::COLUMN_NAME + ","s + IDs::COLUMN_SYMBOL + ") SELECT ?1,?1,?1"s +
+					 " WHERE NOT EXISTS (SELECT 1 FROM "s + TableNames::TABLE_CURRENCY_IDs +
+					 " WHERE "s + IDs::COLUMN_ID + " = ?1);"s;
+				return sql;
+			}
+			const std::string& AddCurrency()
+			{
+				static const std::string sql =
+					 "INSERT INTO "s + TableNames::TABLE_CURRENCY_IDs + "("s + IDs::COLUMN_ID +
+					 ","s + IDs::COLUMN_NAME + ","s + IDs::COLUMN_SYMBOL + ","s +
+					 IDs::COLUMN_FINGERPRINT + ") VALUES(?,?,?,?);"s;
+				return sql;
+			}
+			const std::string& UpdateCurrency()
+			{
+				static const std::string sql =
+					 "UPDATE "s + TableNames::TABLE_CURRENCY_IDs + " SET "s + IDs::COLUMN_NAME +
+					 " = ?,"s + IDs::COLUMN_SYMBOL + " = ?,"s + IDs::COLUMN_FINGERPRINT +
+					 " = ? WHERE "s + IDs::COLUMN_ID + " = ?;"s;
+				return sql;
+			}
+			const std::string& DeleteCurrency()
+			{
+				static const std::string sql = "DELETE FROM "s + TableNames::TABLE_CURRENCY_IDs +
+														 " WHERE "s + IDs::COLUMN_ID + " = ?;"s;
+				return sql;
+			}
+			const std::string& CountCurrencyIDs()
+			{
+				static const std::string sql =
+					 "SELECT COUNT(*) FROM "s + TableNames::TABLE_CURRENCY_IDs;
+				return sql;
+			}
+			const std::string& SelectCurrencies()
+			{
+				static const std::string sql =
+					 "SELECT "s + IDs::COLUMN_ID + ","s + IDs::COLUMN_NAME + ","s +
+					 IDs::COLUMN_SYMBOL + " FROM "s + TableNames::TABLE_CURRENCY_IDs +
+					 " ORDER BY "s + IDs::COLUMN_NAME;
+				return sql;
+			}
+			const std::string& SelectFingerprints()
+			{
+				static const std::string sql = "SELECT rowid,"s + IDs::COLUMN_ID + ","s +
+														 IDs::COLUMN_FINGERPRINT + " FROM "s +
+														 TableNames::TABLE_CURRENCY_IDs + ";"s;
+				return sql;
+			}
+			// Followed by Comma Separated RowIDs and a Closing Parenthesis
+			const std::string& ReloadCurrencyIDs()
+			{
+				static const std::string sql =
+					 "SELECT rowid,"s + IDs::COLUMN_ID + ","s + IDs::COLUMN_NAME + ","s +
+					 IDs::COLUMN_SYMBOL + ","s + IDs::COLUMN_FINGERPRINT + " FROM "s +
+					 TableNames::TABLE_CURRENCY_IDs + " WHERE rowid IN ("s;
+				return sql;
+			}
+			const std::string& SelectIDByName()
+			{
+				static const std::string sql = "SELECT "s + IDs::COLUMN_ID + " FROM "s +
+														 TableNames::TABLE_CURRENCY_IDs + " WHERE "s +
+														 IDs::COLUMN_NAME + "=?"s;
+				return sql;
+			}
+			const std::string& SelectSymbolByName()
+			{
+				static const std::string sql = "SELECT "s + IDs::COLUMN_SYMBOL + " FROM "s +
+														 TableNames::TABLE_CURRENCY_IDs + " WHERE "s +
+														 IDs::COLUMN_NAME + "=?"s;
+				return sql;
+			}
+			const std::string& SelectNameByID()
+			{
+				static const std::string sql = "SELECT "s + IDs::COLUMN_NAME + " FROM "s +
+														 TableNames::TABLE_CURRENCY_IDs + " WHERE "s +
+														 IDs::COLUMN_ID + "=?"s;
+				return sql;
+			}
+		} // namespace Statements
+	} // namespace
+
 	void CurrencyConverter::CreateTableCurrencyIDs()
 	{
 		const std::string sql =
 			 "CREATE TABLE IF NOT EXISTS "s + TableNames::TABLE_CURRENCY_IDs + " ("s +
 			 ColumnNames::CurrencyIDs::COLUMN_ID + " BLOB NOT NULL,"s +
 			 ColumnNames::CurrencyIDs::COLUMN_NAME + " BLOB NOT NULL, "s +
-			 ColumnNames::CurrencyIDs::COLUMN_SYMBOL + " BLOB NOT NULL"s + ");"s;
+			 ColumnNames::CurrencyIDs::COLUMN_SYMBOL + " BLOB NOT NULL, "s +
+			 ColumnNames::CurrencyIDs::COLUMN_FINGERPRINT + " INTEGER NOT NULL DEFAULT 0"s + ");"s;
 
 		// Create Table
 		m_db.executeSQL(sql);
+
+		CreateIndexCurrencyIDsName();
+		CreateIndexCurrencyIDsID();
+	}
+	void CurrencyConverter::CreateIndexCurrencyIDsName()
+	{
+		const std::string sql = "CREATE INDEX IF NOT EXISTS "s +
+										IndexNames::INDEX_CURRENCY_IDs_NAME + " ON "s +
+										TableNames::TABLE_CURRENCY_IDs + "("s +
+										ColumnNames::CurrencyIDs::COLUMN_NAME + ");"s;
+
+		// Create Index
+		m_db.executeSQL(sql);
 	}
-	void CurrencyConverter::CreateTableCurrencyValues()
+	void CurrencyConverter::CreateIndexCurrencyIDsID()
 	{
-		const std::string sql =
-			 "CREATE TABLE IF NOT EXISTS "s + TableNames::TABLE_CURRENCY_VALUES + " ("s +
-			 ColumnNames::CurrencyValues::COLUMN_FROM + " BLOB NOT NULL,"s +
-			 ColumnNames::CurrencyValues::COLUMN_TO + " BLOB NOT NULL,"s +
-			 ColumnNames::CurrencyValues::COLUMN_AMT_CONVERSION + " REAL NOT NULL,"s +
-			 ColumnNames::CurrencyValues::COLUMN_TIME + " REAL NOT NULL"s + ");"s;
+		const std::string sql = "CREATE INDEX IF NOT EXISTS "s +
+										IndexNames::INDEX_CURRENCY_IDs_ID + " ON "s +
+										TableNames::TABLE_CURRENCY_IDs + "("s +
+										ColumnNames::CurrencyIDs::COLUMN_ID + ");"s;
 
-		// Create Table
+		// Create Index
 		m_db.executeSQL(sql);
 	}
+	void CurrencyConverter::CreateTableCurrencyValues()
+	{
+		// Create Table
+		m_db.executeSQL(Schema::createTableSQL<CurrencyValueRow>());
+	}
 	void CurrencyConverter::InsertCurrencyValue(const hstring p_from_code,
 															  const hstring p_to_code,
-															  const double  p_converted_value)
+															  const Rate	 p_rate)
 	{
+		// Note that if 1 USD = 70 INR
+		// Then We Find 1 INR = 1/70 USD
+		// Computed in Integers so that both Directions are Reproducible
+		const auto inverse_rate = p_rate.inverse();
+
 		// Get the Current Time Value
-		const DateTime current_time = winrt::clock::now();
+		const auto time = winrt::clock::now().time_since_epoch().count();
 
 		PrepareStatement ps{};
 		// Ensure that the code is Present between a Begin And End Transaction
 		// Helps Raise Performance
+		std::unique_lock<std::mutex> write_lock{m_write_mutex};
 
-		m_db.transactionBegin();
-
-		const std::string sql =
-			 "INSERT OR IGNORE INTO "s + TableNames::TABLE_CURRENCY_VALUES + "(" +
-			 ColumnNames::CurrencyValues::COLUMN_FROM + ","s +
-			 ColumnNames::CurrencyValues::COLUMN_TO + ","s +
-			 ColumnNames::CurrencyValues::COLUMN_AMT_CONVERSION + ","s +
-			 ColumnNames::CurrencyValues::COLUMN_TIME + ") VALUES(?,?,?,?)"s;
-
-		ps.prepare(m_db, sql);
-		ps.bind(p_from_code);
-		ps.bind(p_to_code);
-		ps.bind(p_converted_value);
-		ps.bind(current_time);
-		ps.execute();
+		std::optional<ScopedTimer> query_timer{std::in_place, m_insert_query_time};
 
-		// Note that if 1 USD = 70 INR
-		// Then We Find 1 INR = 1/70 USD
+		m_db.transactionBegin();
+		try
+		{
+			ps.prepare(m_db, Statements::InsertRate());
+			Schema::bindRow(ps, CurrencyValueRow{p_from_code, p_to_code, p_rate.units, time});
+			ps.execute();
 
-		ps.prepare(m_db, sql);
-		ps.bind(p_to_code);
-		ps.bind(p_from_code);
-		ps.bind(1 / p_converted_value);
-		ps.bind(current_time);
-		ps.execute();
+			if (inverse_rate.has_value())
+			{
+				ps.restart();
+				Schema::bindRow(
+					 ps, CurrencyValueRow{p_to_code, p_from_code, inverse_rate->units, time});
+				ps.execute();
+			}
+		}
+		catch (...)
+		{
+			m_db.transactionRollback();
+			throw;
+		}
 
 		// End the Transaction
 		// Ensure changes are committed to database
+		// OnCurrencyValuesChanged has Cached both Rows once this Returns
 		m_db.transactionEnd();
+		query_timer.reset();
+		write_lock.unlock();
+
+		// Rows above are Expired after a while
+		// The History keeps every Rate for Reporting
+		// Codes which can not Name a Series are Kept without History, as the Rate is Stored
+		try
+		{
+			m_history.append(HistorySeriesName(p_from_code, p_to_code),
+								  Sample{time, p_rate.toDouble()});
+
+			if (inverse_rate.has_value())
+				m_history.append(HistorySeriesName(p_to_code, p_from_code),
+									  Sample{time, inverse_rate->toDouble()});
+		}
+		catch (const std::invalid_argument&)
+		{
+		}
+	}
+	std::optional<ImportStatistics>
+		 CurrencyConverter::ImportReferenceRates(const hstring&		p_file_path,
+															  const hstring&		p_base_code,
+															  const std::size_t p_rows_per_transaction)
+	{
+		if (p_rows_per_transaction == 0)
+			throw std::invalid_argument("A Transaction must hold at least one Row");
+
+		TUESL::Utility::MemoryMappedFile file;
+		if (!file.open(p_file_path))
+			return std::nullopt;
+
+		const std::string_view text{reinterpret_cast<const char*>(file.data()), file.size()};
+
+		// An Import may come before the List was ever Fetched
+		CreateTableCurrencyIDs();
+
+		ImportStatistics statistics;
+
+		// Prepared once and Restarted per Row
+		PrepareStatement values_ps;
+		PrepareStatement ids_ps;
+
+		// Codes seen so far, as such each Currency is Converted and Listed once
+		// There are only ever as many as there are Currencies
+		std::map<std::string, hstring, std::less<>> codes;
+
+		std::unique_lock<std::mutex> write_lock{m_write_mutex, std::defer_lock};
+		std::optional<ScopedTimer>	  query_timer;
+		std::size_t						  rows_in_transaction = 0;
+		bool								  is_prepared			 = false;
+
+		const auto listCurrency = [&](const hstring& p_code) {
+			ids_ps.restart();
+			ids_ps.bind(p_code);
+			ids_ps.execute();
+			statistics.currencies_added += static_cast<std::size_t>(m_db.noOfRowsModified());
+		};
+		const auto insertValue = [&](const CurrencyValueRow& p_row) {
+			values_ps.restart();
+			Schema::bindRow(values_ps, p_row);
+			values_ps.execute();
+			// 0 where the Unique Index Ignored it
+			statistics.rows_inserted += static_cast<std::size_t>(m_db.noOfRowsModified());
+			++rows_in_transaction;
+		};
+		const auto beginTransaction = [&] {
+			write_lock.lock();
+			query_timer.emplace(m_import_query_time);
+			m_db.transactionBegin();
+
+			if (!is_prepared)
+			{
+				values_ps.prepare(m_db, Statements::InsertRate());
+				ids_ps.prepare(m_db, Statements::ImportCurrencyID());
+				is_prepared = true;
+
+				listCurrency(p_base_code);
+			}
+		};
+		// OnCurrencyValuesChanged Caches the Rows of each Transaction once it Commits
+		const auto commitTransaction = [&] {
+			m_db.transactionEnd();
+			query_timer.reset();
+			write_lock.unlock();
+
+			++statistics.transactions;
+			rows_in_transaction = 0;
+		};
+
+		try
+		{
+			const auto read = ReadReferenceRates(text, [&](const ReferenceRate& p_rate) {
+				if (!write_lock.owns_lock())
+					beginTransaction();
+
+				auto code = codes.find(p_rate.currency);
+				if (code == std::end(codes))
+				{
+					const auto to_code = TUESL::Utility::toHString(p_rate.currency);
+					if (!to_code.has_value())
+						throw std::invalid_argument("Currency Codes must be Valid UTF-8");
+
+					code = codes.emplace(std::string{p_rate.currency}, to_code.value()).first;
+					listCurrency(code->second);
+				}
+
+				// The Base Currency in its own Terms says nothing
+				if (code->second == p_base_code)
+					return;
+
+				// Both Directions are Stored, as InsertCurrencyValue does
+				const auto& to_code = code->second;
+				insertValue(CurrencyValueRow{p_base_code, to_code, p_rate.rate.units, p_rate.time});
+				if (const auto inverse_rate = p_rate.rate.inverse(); inverse_rate.has_value())
+					insertValue(
+						 CurrencyValueRow{to_code, p_base_code, inverse_rate->units, p_rate.time});
+
+				if (rows_in_transaction >= p_rows_per_transaction)
+					commitTransaction();
+			});
+
+			if (write_lock.owns_lock())
+				commitTransaction();
+
+			statistics.rates	 = read.rates;
+			statistics.skipped = read.skipped;
+		}
+		catch (...)
+		{
+			if (write_lock.owns_lock())
+			{
+				m_db.transactionRollback();
+				write_lock.unlock();
+			}
+			throw;
+		}
+
+		return statistics;
+	}
+	IAsyncOperation<std::int64_t>
+		 CurrencyConverter::GetConversionRate(const hstring p_from_code, const hstring p_to_code)
+	{
+		RememberRecentPair(p_from_code, p_to_code);
+
+		co_return co_await LookupConversionRate(p_from_code, p_to_code);
+	}
+	IAsyncOperation<std::int64_t>
+		 CurrencyConverter::GetHistoricalConversionRate(const hstring  p_from_code,
+																	   const hstring  p_to_code,
+																	   const DateTime p_day)
+	{
+		if (p_from_code == p_to_code)
+			co_return Rate::SCALE;
+
+		const auto day	  = ReferenceDayOf(p_day.time_since_epoch().count());
+		const auto today = ReferenceDayOf(winrt::clock::now().time_since_epoch().count());
+		if (day >= today)
+			co_return co_await GetConversionRate(p_from_code, p_to_code);
+
+		if (const auto rate = m_historical_quotes->Find(p_from_code, p_to_code, day))
+			co_return rate->units;
+
+		const Rate rate{co_await m_upstream.FetchHistoricalRate(
+			 p_from_code, p_to_code, winrt::to_hstring(FormatReferenceDay(day)))};
+		if (rate.units == 0)
+			co_return 0;
+
+		m_historical_quotes->Store(p_from_code, p_to_code, day, rate);
+		co_return rate.units;
+	}
+	std::optional<Rate> CurrencyConverter::GetCachedConversionRate(const hstring& p_from_code,
+																						const hstring& p_to_code)
+	{
+		if (p_from_code == p_to_code)
+			return Rate{Rate::SCALE};
+		return FindRate(p_from_code, p_to_code);
 	}
 	IAsyncOperation<double>
 		 CurrencyConverter::GetConvertedCurrencyValue(const hstring p_from_code,
 																	 const hstring p_to_code)
 	{
-		// First check within SQLite Database If the Value has been already added
+		const Rate rate{co_await GetConversionRate(p_from_code, p_to_code)};
+		co_return rate.toDouble();
+	}
+	IAsyncOperation<std::int64_t>
+		 CurrencyConverter::LookupConversionRate(const hstring  p_from_code,
+															  const hstring  p_to_code,
+															  const Priority p_priority)
+	{
+		// First check in Memory, which is Warm from the Snapshot
+		// A Pair not Cached itself may still be Converted through Pairs that are
+		if (const auto cached_rate = FindRate(p_from_code, p_to_code); cached_rate.has_value())
+			co_return cached_rate->units;
+
+		// Then check within SQLite Database If the Value has been already added
 		// If Not, then fire a Json Query
 
 		{
-			const std::string sql =
-				 "SELECT "s + ColumnNames::CurrencyValues::COLUMN_AMT_CONVERSION + " FROM " +
-				 TableNames::TABLE_CURRENCY_VALUES + " WHERE " +
-				 ColumnNames::CurrencyValues::COLUMN_FROM + "=?"s + " AND " +
-				 ColumnNames::CurrencyValues::COLUMN_TO + "=?"s;
-			PrepareStatement ps{};
+			std::optional<Rate> rate;
+			DataTypes::Int64	  rowid = 0;
+			DataTypes::Int64	  time	= 0;
+			{
+				ScopedTimer query_timer{m_lookup_query_time};
 
-			ps.prepare(m_db, sql);
+				PrepareStatement ps{};
 
-			ps.bind(p_from_code);
-			ps.bind(p_to_code);
+				ps.prepare(m_db, Statements::SelectRate());
 
-			// if Currency Value present
-			if (ps.hasNext())
+				ps.bind(p_from_code);
+				ps.bind(p_to_code);
+				ps.bind(static_cast<DataTypes::Int64>(OldestValidTime()));
+
+				// if Currency Value present
+				if (ps.hasNext())
+				{
+					rowid					 = ps.get<DataTypes::Int64>().value_or(0);
+					const auto rate_units = ps.get<DataTypes::Int64>();
+					time					 = ps.get<DataTypes::Int64>().value_or(0);
+					if (rate_units.has_value())
+						rate = Rate{rate_units.value()};
+				}
+			}
+
+			if (rate.has_value())
 			{
-				const std::optional<double> convert_val = ps.get<double>();
-				if (convert_val.has_value())
-					co_return convert_val.value();
+				CacheRate(p_from_code, p_to_code, rate.value(), time, rowid);
+				m_database_hits.increment();
+				co_return rate->units;
 			}
 		}
 
 		// As it was not found in SQLite Database, firing Json Query
+		// To the Primary Provider, and to a Backup should the Primary be Slow
 		{
+			const Rate rate{co_await m_upstream.FetchRate(p_from_code, p_to_code, p_priority)};
+
+			if (rate.units == 0)
+			{
+				m_lookup_failures.increment();
+				co_return 0;
+			}
 
-			const hstring code_from_to_concatenated = p_from_code + L"_" + p_to_code;
+			// Add this currency value with time stamp
+			InsertCurrencyValue(p_from_code, p_to_code, rate);
+			m_network_hits.increment();
+			co_return rate.units;
+		}
+	}
+	ConversionMatrix CurrencyConverter::ConvertBatch(const std::vector<Money>&	p_amounts,
+																	 const hstring&					p_from_code,
+																	 const std::vector<hstring>& p_to_codes)
+	{
+		ConversionMatrix matrix;
+		matrix.to_codes	  = p_to_codes;
+		matrix.amount_count = std::size(p_amounts);
+		matrix.rates.resize(std::size(p_to_codes));
+		matrix.values.resize(std::size(p_to_codes) * std::size(p_amounts));
 
-			const hstring uri =
-				 CurrencyJsonAPIURLs::URL_CURRENCY_AMTs + code_from_to_concatenated;
+		// Targets may Repeat, as Ledgers often do
+		// Start every Distinct Lookup before Waiting on any
+		// Hits complete right away, Misses then have their Network Queries in Flight together
+		std::map<hstring, IAsyncOperation<std::int64_t>> lookups;
+		for (const auto& to_code : p_to_codes)
+		{
+			if (to_code != p_from_code && lookups.find(to_code) == std::end(lookups))
+				lookups.emplace(to_code,
+									 LookupConversionRate(p_from_code, to_code, Priority::BACKGROUND));
+		}
 
-			const hstring json = co_await m_web_client.ReadJsonFromUriAsync(uri);
+		std::map<hstring, Rate> rates;
+		for (const auto& [to_code, lookup] : lookups)
+			rates.emplace(to_code, Rate{lookup.get()});
 
-			if (std::empty(json))
-				co_return 0.0;
+		for (std::size_t i = 0; i < std::size(p_to_codes); ++i)
+			matrix.rates[i] =
+				 p_to_codes[i] == p_from_code ? Rate{Rate::SCALE} : rates[p_to_codes[i]];
 
-			// Convert Read Json String to Value Object
-			const auto json_obj = JsonObject::Parse(json);
+		matrix.overflow_count = TUESL::Numeric::convertOuter(std::data(p_amounts),
+																			  std::size(p_amounts),
+																			  std::data(matrix.rates),
+																			  std::size(matrix.rates),
+																			  std::data(matrix.values));
 
-			// Note that data is in the form
-			// {"USD_INR" : 45}
-			const double converted_amt =
-				 (json_obj.GetNamedNumber(code_from_to_concatenated));
+		return matrix;
+	}
+	void CurrencyConverter::CreateIndexCurrencyValuesTime()
+	{
+		const std::string sql = "CREATE INDEX IF NOT EXISTS "s +
+										IndexNames::INDEX_CURRENCY_VALUES_TIME + " ON "s +
+										TableNames::TABLE_CURRENCY_VALUES + "("s +
+										ColumnNames::CurrencyValues::COLUMN_TIME + ");"s;
 
-			// Add this currency value with time stamp
-			InsertCurrencyValue(p_from_code, p_to_code, converted_amt);
-			co_return converted_amt;
-		}
+		// Create Index
+		m_db.executeSQL(sql);
 	}
-	void CurrencyConverter::DeleteAllCurrencyValuesOlderThanTime(const TimeSpan& p_time)
+	void CurrencyConverter::CreateIndexCurrencyValuesPair()
 	{
-		const std::string sql = "DELETE FROM "s + TableNames::TABLE_CURRENCY_VALUES +
-										" WHERE "s + ColumnNames::CurrencyValues::COLUMN_TIME +
-										" < ?";
+		namespace Values = ColumnNames::CurrencyValues;
 
+		// A Database with the former Index may hold the same Rate more than once
+		// Those are Deleted, once, before the Unique Index can be Created
 		PrepareStatement ps;
+		ps.prepare(m_db, "SELECT 1 FROM sqlite_master WHERE type = 'index' AND name = ?;");
+		ps.bind(std::string_view{IndexNames::INDEX_CURRENCY_VALUES_PAIR});
+		const auto has_former_index = ps.hasNext();
+		ps.reset();
+
+		m_db.transactionBegin();
+		try
+		{
+			if (has_former_index)
+			{
+				m_db.executeSQL("DELETE FROM "s + TableNames::TABLE_CURRENCY_VALUES +
+									 " WHERE rowid NOT IN (SELECT MIN(rowid) FROM "s +
+									 TableNames::TABLE_CURRENCY_VALUES + " GROUP BY "s +
+									 Values::COLUMN_FROM + ","s + Values::COLUMN_TO + ","s +
+									 Values::COLUMN_TIME + ");"s);
+				m_db.executeSQL("DROP INDEX "s + IndexNames::INDEX_CURRENCY_VALUES_PAIR + ";"s);
+			}
 
-		ps.prepare(m_db, sql);
-		ps.bind(p_time);
-		ps.execute();
+			m_db.executeSQL("CREATE UNIQUE INDEX IF NOT EXISTS "s +
+								 IndexNames::INDEX_CURRENCY_VALUES_PAIR_TIME + " ON "s +
+								 TableNames::TABLE_CURRENCY_VALUES + "("s + Values::COLUMN_FROM +
+								 ","s + Values::COLUMN_TO + ","s + Values::COLUMN_TIME + ");"s);
+		}
+		catch (...)
+		{
+			m_db.transactionRollback();
+			throw;
+		}
+		m_db.transactionEnd();
 	}
-	void CurrencyConverter::InsertIntoCurrencyIDs(const JsonObject p_results)
+	std::int64_t CurrencyConverter::GetFreePageCount()
 	{
+		PrepareStatement ps;
+		ps.prepare(m_db, "PRAGMA freelist_count;");
 
-		// Ensure that the code is Present between a Begin And End Transaction
-		// Helps Raise Performance
+		if (ps.hasNext())
+			return ps.get<DataTypes::Int64>().value_or(0);
+		else
+			return 0;
+	}
+	std::int64_t CurrencyConverter::VacuumFreePages(const int p_max_pages)
+	{
+		// Incremental Vacuum only works when auto_vacuum is INCREMENTAL
+		// Otherwise this is a No-Op and the Free Page Count stays the same
+		const auto free_pages_before = GetFreePageCount();
 
-		m_db.transactionBegin();
+		const std::string sql =
+			 "PRAGMA incremental_vacuum("s + std::to_string(p_max_pages) + ");"s;
+		m_db.executeSQL(sql);
 
-		const std::string sql = "INSERT OR IGNORE INTO "s + TableNames::TABLE_CURRENCY_IDs +
-										"("s + ColumnNames::CurrencyIDs::COLUMN_ID + ","s +
-										ColumnNames::CurrencyIDs::COLUMN_NAME + ","s +
-										ColumnNames::CurrencyIDs::COLUMN_SYMBOL +
-										") VALUES(?,?,?);"s;
+		const auto free_pages_after = GetFreePageCount();
+		return free_pages_before - free_pages_after;
+	}
+	ExpiryStatistics
+		 CurrencyConverter::ExpireCurrencyValuesOlderThanTime(const TimeSpan& p_time,
+																				const int		  p_batch_size,
+																				const int		  p_max_batches)
+	{
+		using std::chrono::duration_cast;
+		using std::chrono::microseconds;
+		using std::chrono::steady_clock;
 
-		PrepareStatement ps{};
-		for (const auto it = p_results.First(); it.HasCurrent(); it.MoveNext())
-		{
-			// This is a PrepareStatement
-			// Creates the Statement to be executed
-			ps.prepare(m_db, sql);
+		ExpiryStatistics statistics{};
 
-			const auto obj = it.Current().Value().GetObject();
-			if (obj.HasKey(to_hstring(ColumnNames::CurrencyIDs::COLUMN_ID)))
-			{
-				const auto id =
-					 obj.GetNamedString(to_hstring(ColumnNames::CurrencyIDs::COLUMN_ID));
-				ps.bind(id);
-			}
-			else
+		// Once, see SetupDatabase
+		// A Tick it Fails on Leaves it to the next
+		{
+			std::lock_guard<std::mutex> write_lock{m_write_mutex};
+			if (m_needs_full_vacuum)
 			{
-				ps.bind("");
+				const auto vacuum_start = steady_clock::now();
+
+				m_db.executeSQL("PRAGMA auto_vacuum = INCREMENTAL;");
+				m_db.executeSQL("VACUUM;");
+				m_needs_full_vacuum = false;
+
+				const auto pause = duration_cast<microseconds>(steady_clock::now() - vacuum_start);
+				statistics.total_pause += pause;
+				statistics.max_pause = (std::max)(statistics.max_pause, pause);
 			}
+		}
+
+		PrepareStatement ps;
+		for (int batch = 0; batch < p_max_batches; ++batch)
+		{
+			// Every Batch is its own Short Transaction
+			// This way Readers and the Insert Path only ever wait for one batch
+			std::lock_guard<std::mutex> write_lock{m_write_mutex};
 
-			if (obj.HasKey(to_hstring(ColumnNames::CurrencyIDs::COLUMN_NAME)))
+			// The Pause is what this Batch holds the Lock for, not the Wait for it
+			const auto	batch_start = steady_clock::now();
+			ScopedTimer query_timer{m_expire_query_time};
+
+			int rows_deleted = 0;
+			m_db.transactionBegin();
+			try
 			{
-				const auto name =
-					 obj.GetNamedString(to_hstring(ColumnNames::CurrencyIDs::COLUMN_NAME));
-				ps.bind(name);
+				ps.prepare(m_db, Statements::ExpireRates());
+				ps.bind(p_time);
+				ps.bind(static_cast<std::int32_t>(p_batch_size));
+				ps.execute();
+
+				rows_deleted = m_db.noOfRowsModified();
 			}
-			else
+			catch (...)
 			{
-				ps.bind("");
+				m_db.transactionRollback();
+				throw;
 			}
 
-			if (obj.HasKey(to_hstring(ColumnNames::CurrencyIDs::COLUMN_SYMBOL)))
-			{
-				const auto symbol =
-					 obj.GetNamedString(to_hstring(ColumnNames::CurrencyIDs::COLUMN_SYMBOL));
-				ps.bind(symbol);
-			}
-			else
+			m_db.transactionEnd();
+
+			const auto pause = duration_cast<microseconds>(steady_clock::now() - batch_start);
+
+			statistics.rows_reclaimed += rows_deleted;
+			statistics.batches += 1;
+			statistics.total_pause += pause;
+			statistics.max_pause = (std::max)(statistics.max_pause, pause);
+
+			// If the Batch was not Full, there are no more old Rows left
+			if (rows_deleted < p_batch_size)
+				break;
+
+			statistics.has_remaining = (batch + 1 == p_max_batches);
+		}
+
+		// The Archive is Bounded by Count rather than Age
+		// Under IN_MEMORY it would otherwise Grow with every Response
+		{
+			const auto archive_start = steady_clock::now();
+
+			statistics.responses_expired =
+				 static_cast<std::int64_t>(m_response_archive->ExpireResponses());
+
+			const auto pause = duration_cast<microseconds>(steady_clock::now() - archive_start);
+			statistics.total_pause += pause;
+			statistics.max_pause = (std::max)(statistics.max_pause, pause);
+		}
+
+		// Return the Pages Freed by Deletion to the File System
+		// So that the Database File actually shrinks
+		if (statistics.rows_reclaimed != 0 || statistics.responses_expired != 0)
+		{
+			std::lock_guard<std::mutex> write_lock{m_write_mutex};
+			const auto						 vacuum_start = steady_clock::now();
+
+			statistics.pages_vacuumed = VacuumFreePages(Expiry::VACUUM_PAGES_PER_TICK);
+
+			const auto pause = duration_cast<microseconds>(steady_clock::now() - vacuum_start);
+			statistics.total_pause += pause;
+			statistics.max_pause = (std::max)(statistics.max_pause, pause);
+		}
+
+		m_expired_rates.increment(static_cast<std::uint64_t>(statistics.rows_reclaimed));
+		m_expired_responses.increment(static_cast<std::uint64_t>(statistics.responses_expired));
+		m_expiry_batches.increment(static_cast<std::uint64_t>(statistics.batches));
+		m_vacuumed_pages.increment(static_cast<std::uint64_t>(statistics.pages_vacuumed));
+		m_expiry_max_pause.record(statistics.max_pause);
+
+		return statistics;
+	}
+	ExpiryStatistics
+		 CurrencyConverter::DeleteAllCurrencyValuesOlderThanTime(const TimeSpan& p_time)
+	{
+		ExpiryStatistics statistics{};
+
+		// Keep running Bounded Ticks till no old Rows remain
+		// Every Batch still commits separately
+		do
+		{
+			const auto tick = ExpireCurrencyValuesOlderThanTime(p_time);
+
+			statistics.rows_reclaimed += tick.rows_reclaimed;
+			statistics.batches += tick.batches;
+			statistics.total_pause += tick.total_pause;
+			statistics.max_pause = (std::max)(statistics.max_pause, tick.max_pause);
+			statistics.pages_vacuumed += tick.pages_vacuumed;
+			statistics.responses_expired += tick.responses_expired;
+			statistics.has_remaining = tick.has_remaining;
+		} while (statistics.has_remaining);
+
+		return statistics;
+	}
+	void CurrencyConverter::InsertIntoCurrencyIDs(const std::vector<CurrencyBatch>& p_batches)
+	{
+		// Ensure that the code is Present between a Begin And End Transaction
+		// Helps Raise Performance
+		std::lock_guard<std::mutex> write_lock{m_write_mutex};
+
+		m_db.transactionBegin();
+		try
+		{
+			// Prepared once and Restarted per Row
+			PrepareStatement ps{};
+			ps.prepare(m_db, Statements::InsertCurrencyID());
+
+			for (const auto& batch : p_batches)
 			{
-				ps.bind("");
-			}
+				for (const auto& entry : batch)
+				{
+					ps.restart();
 
-			// Runs an Update
-			// This Edits the Database
-			ps.execute();
+					ps.bind(entry.id);
+					ps.bind(entry.name);
+					ps.bind(entry.symbol);
+					ps.bind(static_cast<DataTypes::Int64>(FingerprintOf(entry)));
+
+					// Runs an Update
+					// This Edits the Database
+					ps.execute();
+				}
+			}
+		}
+		catch (...)
+		{
+			m_db.transactionRollback();
+			throw;
 		}
 
 		// End the Transaction
@@ -203,10 +879,8 @@ namespace Currency
 	}
 	int CurrencyConverter::GetCountOfCurrencyIDs()
 	{
-		const std::string sql = "SELECT COUNT(*) FROM "s + TableNames::TABLE_CURRENCY_IDs;
-
 		PrepareStatement ps;
-		ps.prepare(m_db, sql);
+		ps.prepare(m_db, Statements::CountCurrencyIDs());
 		if (ps.hasNext())
 		{
 			const auto count = ps.get<int>().value_or(0);
@@ -230,74 +904,683 @@ namespace Currency
 		// Setup Table if it doesn't exist
 		CreateTableCurrencyIDs();
 
+		// If the Table was Restored from the Snapshot
+		// There is no need to Count or Sort anything
+		if (IsWarm())
+			co_return;
+
 		const auto has_values = HasCurrencyValuesPresent();
 
-		// If Values are Present, No Need to do anything
+		// If Values are Present, No Need to Download
+		// They only have to be Loaded into Memory, without Blocking the Caller
 		if (has_values)
+		{
+			co_await LoadCurrencyTableAsync();
 			co_return;
+		}
 
 		// Read Json
-		const hstring json = co_await m_web_client.ReadJsonFromUriAsync(
-			 CurrencyJsonAPIURLs::URL_CURRENCY_IDs);
+		const hstring json = co_await m_upstream.FetchCurrencyList();
 
 		if (std::empty(json))
 			co_return;
 
-		// Convert it Into a JSON Object
-		const auto json_object = JsonObject::Parse(json);
-
-		// Note that data format contains object in form "result"
-		const auto results = json_object.GetNamedObject(L"results");
+		// Parsed by Workers and Written by a Thread of its own, the Caller only Waits
+		co_await winrt::resume_background();
 
-		InsertIntoCurrencyIDs(results);
+		// OnCurrencyIDsChanged Loads the new Rows into Memory after each Transaction
+		IngestCurrencyIDs(json, IngestionOptions{}, [this](const auto& p_batches) {
+			InsertIntoCurrencyIDs(p_batches);
+		});
+		m_has_fresh_currency_ids = true;
 	}
-	inline void CurrencyConverter::SetupWebClient()
+	IAsyncOperation<bool> CurrencyConverter::SyncCurrencyIDs()
 	{
-		// Set User Agent to Microsoft Edge
-		m_web_client.setUserAgent(
-			 L"Mozilla/5.0 (Windows NT 10.0; WOW64) AppleWebKit/537.36 (KHTML, like "
-			 L"Gecko) "
-			 L"Chrome/39.0.2171.71 "
-			 L"Safari/537.36 Edge/12.0");
+		if (m_has_fresh_currency_ids.exchange(false))
+			co_return false;
+
+		CreateTableCurrencyIDs();
+
+		const hstring json = co_await m_upstream.FetchCurrencyList();
+
+		if (std::empty(json))
+			co_return false;
+
+		co_await winrt::resume_background();
+
+		// The List is Short, as such it is Gathered whole before it is Diffed
+		std::vector<CurrencyEntry> upstream;
+		try
+		{
+			IngestCurrencyIDs(json, IngestionOptions{}, [&](const auto& p_batches) {
+				for (const auto& batch : p_batches)
+					upstream.insert(std::end(upstream), std::begin(batch), std::end(batch));
+			});
+		}
+		catch (const std::invalid_argument&)
+		{
+			co_return false;
+		}
+
+		co_return ApplyCurrencyList(upstream).hasChanges();
+	}
+	CurrencySyncStatistics
+		 CurrencyConverter::ApplyCurrencyList(const std::vector<CurrencyEntry>& p_upstream)
+	{
+		CurrencySyncStatistics statistics;
+		if (std::empty(p_upstream))
+			return statistics;
+
+		// No other Writer may Change the Table between the Diff and the Commit
+		std::lock_guard<std::mutex> write_lock{m_write_mutex};
+
+		CurrencyDelta delta;
+		{
+			std::lock_guard<std::mutex> fingerprint_lock{m_fingerprint_mutex};
+
+			LoadCurrencyFingerprints();
+			delta = DiffCurrencies(p_upstream, m_currency_fingerprints);
+
+			statistics.inserted	 = std::size(delta.inserted);
+			statistics.updated	 = std::size(delta.updated);
+			statistics.deleted	 = std::size(delta.deleted);
+			statistics.unchanged = std::size(m_currency_fingerprints) - statistics.updated -
+										  statistics.deleted;
+		}
+
+		if (delta.empty())
+			return statistics;
+
+		const auto fingerprintOf = [](const CurrencyEntry& p_entry) {
+			return static_cast<DataTypes::Int64>(FingerprintOf(p_entry));
+		};
+
+		ScopedTimer query_timer{m_insert_query_time};
+
+		m_db.transactionBegin();
+		try
+		{
+			// Each Statement is Prepared once, and only if there is a Row for it
+			PrepareStatement ps;
+
+			for (std::size_t i = 0; i < std::size(delta.inserted); ++i)
+			{
+				const auto& entry = delta.inserted[i];
+				if (i == 0)
+					ps.prepare(m_db, Statements::AddCurrency());
+
+				ps.restart();
+				ps.bind(entry.id);
+				ps.bind(entry.name);
+				ps.bind(entry.symbol);
+				ps.bind(fingerprintOf(entry));
+				ps.execute();
+			}
+			for (std::size_t i = 0; i < std::size(delta.updated); ++i)
+			{
+				const auto& entry = delta.updated[i];
+				if (i == 0)
+					ps.prepare(m_db, Statements::UpdateCurrency());
+
+				ps.restart();
+				ps.bind(entry.name);
+				ps.bind(entry.symbol);
+				ps.bind(fingerprintOf(entry));
+				ps.bind(entry.id);
+				ps.execute();
+			}
+			for (std::size_t i = 0; i < std::size(delta.deleted); ++i)
+			{
+				if (i == 0)
+					ps.prepare(m_db, Statements::DeleteCurrency());
+
+				ps.restart();
+				ps.bind(delta.deleted[i]);
+				ps.execute();
+			}
+		}
+		catch (...)
+		{
+			m_db.transactionRollback();
+			throw;
+		}
+
+		// OnCurrencyIDsChanged Publishes the Delta to Memory and to the Fingerprints
+		m_db.transactionEnd();
+
+		return statistics;
+	}
+	void CurrencyConverter::LoadCurrencyFingerprints()
+	{
+		if (m_has_fingerprints)
+			return;
+
+		CurrencyFingerprints fingerprints;
+		{
+			ScopedTimer query_timer{m_load_currencies_query_time};
+
+			PrepareStatement ps;
+			ps.prepare(m_db, Statements::SelectFingerprints());
+
+			while (ps.hasNext())
+			{
+				const auto rowid		 = ps.get<DataTypes::Int64>().value_or(0);
+				auto		  id			 = ps.get<hstring>().value_or(L"");
+				const auto fingerprint = ps.get<DataTypes::Int64>().value_or(0);
+
+				fingerprints.insert_or_assign(
+					 std::move(id),
+					 CurrencyFingerprint{static_cast<std::uint64_t>(fingerprint), rowid});
+			}
+		}
+
+		m_currency_fingerprints = std::move(fingerprints);
+		m_has_fingerprints		= true;
+	}
+	UpstreamService UpstreamService::ForConverterAPI()
+	{
+		RequestScheduler::Options budget;
+		budget.requests_per_second = UpstreamBudget::REQUESTS_PER_HOUR / 3600.0;
+		budget.burst					= UpstreamBudget::BURST;
+		budget.max_in_flight			= UpstreamBudget::MAX_IN_FLIGHT;
+		budget.interactive_tokens	= UpstreamBudget::INTERACTIVE_TOKENS;
+		budget.interactive_slots	= UpstreamBudget::INTERACTIVE_SLOTS;
+
+		UpstreamService service;
+		service.providers.push_back(UpstreamProvider::ForConverterAPI(
+			 "currencyconverterapi", CurrencyJsonAPIURLs::URL_SERVICE_ROOT, budget));
+		return service;
+	}
+	inline void CurrencyConverter::SetupWebClient()
+	{
+		// Set User Agent to Microsoft Edge
+		m_upstream.SetUserAgent(
+			 L"Mozilla/5.0 (Windows NT 10.0; WOW64) AppleWebKit/537.36 (KHTML, like "
+			 L"Gecko) "
+			 L"Chrome/39.0.2171.71 "
+			 L"Safari/537.36 Edge/12.0");
 
 		// Set the Header to only provide Json Values
-		m_web_client.addHeader(L"accept", L"application/json");
+		m_upstream.AddHeader(L"accept", L"application/json");
 	}
 	void CurrencyConverter::SetupDatabase()
 	{
 		// Add Path to Cache Directory
-		const hstring cache_folder_path =
-			 Windows::Storage::ApplicationData::Current().LocalCacheFolder().Path();
-
 		const std::string database_path =
-			 to_string(cache_folder_path) + "\\" + DATABASE_NAME;
+			 toUTF8(m_folders.cache_folder).value_or("") + "\\" + DATABASE_NAME;
 
 		// Open the Database
-		m_db.open(database_path);
+		if (m_database_mode == DatabaseMode::IN_MEMORY)
+		{
+			m_disk_db.open(database_path);
+			m_db.open(IN_MEMORY_DATABASE_NAME);
+			RestoreDatabase();
+		}
+		else
+		{
+			m_db.open(database_path);
+		}
+
+		// Expiry relies on Incremental Vacuum to shrink the File
+		// On a Database still Empty, before even the Schema Version is Written, this Switches it
+		m_db.executeSQL("PRAGMA auto_vacuum = INCREMENTAL;");
+
+		MigrateSchema();
+		RegisterSQLFunctions();
+
+		// On an existing Database only a Full VACUUM can, which Rewrites the whole File
+		// As such it is left to the first Expiry Tick
+		// rather than Delaying the Window, which is Constructed with the Converter
+		m_needs_full_vacuum = GetAutoVacuumMode() != AutoVacuumMode::INCREMENTAL;
 	}
-	generator<hstring> CurrencyConverter::GetAllCurrencyNamesAsync()
+	void CurrencyConverter::RestoreDatabase()
 	{
-		const std::string sql = "SELECT "s + ColumnNames::CurrencyIDs::COLUMN_NAME +
-										" FROM "s + TableNames::TABLE_CURRENCY_IDs + " ORDER BY " +
-										ColumnNames::CurrencyIDs::COLUMN_NAME;
+		try
+		{
+			// An In Memory Destination must have the Page Size of its Source
+			// It can only be Changed while the Database is still Empty
+			m_db.executeSQL("PRAGMA page_size = "s + std::to_string(GetPageSize(m_disk_db)) +
+								 ";"s);
 
+			Backup restore{m_db, m_disk_db};
+			restore.step(Backup::ALL_PAGES);
+		}
+		catch (const TUESL::SQLite::SQLiteException&)
+		{
+			// A Corrupt or Locked File only means a Cold Cache
+			// Start over from an Empty Database, which the next Backup Overwrites
+			m_db.open(IN_MEMORY_DATABASE_NAME);
+		}
+	}
+	int CurrencyConverter::GetPageSize(Database& p_db)
+	{
 		PrepareStatement ps;
-		ps.prepare(m_db, sql);
+		ps.prepare(p_db, "PRAGMA page_size;");
 
-		while (ps.hasNext())
+		if (ps.hasNext())
+			return ps.get<int>().value_or(0);
+		else
+			return 0;
+	}
+	bool CurrencyConverter::BackupDatabase(const int p_max_steps)
+	{
+		if (m_database_mode != DatabaseMode::IN_MEMORY)
+			return true;
+
+		// The Timer and Suspension may both be Backing up
+		std::lock_guard<std::mutex> backup_lock{m_backup_mutex};
+
+		try
+		{
+			for (int step = 0; step < p_max_steps; ++step)
+			{
+				// Steps never run within a Write Transaction
+				// Otherwise Uncommitted Pages could reach the Disk
+				std::lock_guard<std::mutex> write_lock{m_write_mutex};
+
+				if (!m_backup.has_value())
+				{
+					// Nothing Written since the last Backup
+					if (m_db.noOfTotalRowsModified() == m_backed_up_changes)
+						return true;
+
+					m_backup.emplace(m_disk_db, m_db);
+				}
+
+				if (m_backup->step(DatabaseBackup::PAGES_PER_STEP))
+				{
+					// Writes between Steps Restart the Copy
+					// As such it holds every Row Written up to now
+					m_backed_up_changes = m_db.noOfTotalRowsModified();
+					m_backup.reset();
+					return true;
+				}
+			}
+		}
+		catch (const TUESL::SQLite::SQLiteException&)
+		{
+			// The File on Disk keeps its last Complete Copy
+			// The next Tick Starts over
+			m_backup.reset();
+		}
+		return false;
+	}
+	bool CurrencyConverter::FlushDatabase()
+	{
+		return BackupDatabase((std::numeric_limits<int>::max)());
+	}
+	void CurrencyConverter::MigrateSchema()
+	{
+		const auto schema_version = GetSchemaVersion();
+		if (schema_version >= SCHEMA_VERSION)
+			return;
+
+		// Version 1 stores Rates as Integers in Units of Rate::SCALE
+		// Older Tables hold REAL Rates, but are only a Cache of the Web Service
+		// As such they are Dropped rather than Converted
+		if (schema_version < 1)
+			m_db.executeSQL("DROP TABLE IF EXISTS "s + TableNames::TABLE_CURRENCY_VALUES + ";"s);
+
+		// Version 2 Fingerprints every Currency
+		// Rows which already Exist hold 0, which no Entry Matches, as such the next Sync
+		// Rewrites them once
+		PrepareStatement ps;
+		if (schema_version < 2 && ps.checkTableExistence(m_db, TableNames::TABLE_CURRENCY_IDs))
+		{
+			ps.reset();
+			m_db.executeSQL("ALTER TABLE "s + TableNames::TABLE_CURRENCY_IDs + " ADD COLUMN "s +
+								 ColumnNames::CurrencyIDs::COLUMN_FINGERPRINT +
+								 " INTEGER NOT NULL DEFAULT 0;"s);
+		}
+
+		m_db.executeSQL("PRAGMA user_version = "s + std::to_string(SCHEMA_VERSION) + ";"s);
+	}
+	int CurrencyConverter::GetSchemaVersion()
+	{
+		PrepareStatement ps;
+		ps.prepare(m_db, "PRAGMA user_version;");
+
+		if (ps.hasNext())
+			return ps.get<int>().value_or(0);
+		else
+			return 0;
+	}
+	void CurrencyConverter::SubscribeToChanges()
+	{
+		m_db.subscribe(TableNames::TABLE_CURRENCY_IDs,
+							[this](const std::vector<ChangeEvent>& p_events) {
+								OnCurrencyIDsChanged(p_events);
+							});
+		m_db.subscribe(TableNames::TABLE_CURRENCY_VALUES,
+							[this](const std::vector<ChangeEvent>& p_events) {
+								OnCurrencyValuesChanged(p_events);
+							});
+	}
+	void CurrencyConverter::OnCurrencyIDsChanged(const std::vector<ChangeEvent>& p_events)
+	{
+		try
+		{
+			// Everything but the Entries themselves is Freed on Return
+			alignas(std::max_align_t) std::byte buffer[TransientMemory::LISTENER_ARENA_SIZE];
+			Arena arena{buffer, sizeof(buffer)};
+
+			std::pmr::vector<CurrencyEntry> entries{&arena};
+			entries.reserve(CountChangedRows(p_events));
+
+			// Deleted Rows can no longer be Read, as such they are Matched by their Row
+			std::pmr::vector<hstring> deleted_ids{&arena};
+			bool							  has_unmatched_deletions = false;
+
+			std::unique_lock<std::mutex> fingerprint_lock{m_fingerprint_mutex};
+
+			for (const auto& event : p_events)
+			{
+				if (event.operation != ChangeOperation::DELETED)
+					continue;
+
+				const auto it = std::find_if(std::begin(m_currency_fingerprints),
+													  std::end(m_currency_fingerprints),
+													  [&](const auto& p_stored) {
+														  return p_stored.second.rowid == event.rowid;
+													  });
+				if (it == std::end(m_currency_fingerprints))
+				{
+					has_unmatched_deletions = true;
+					continue;
+				}
+
+				deleted_ids.push_back(it->first);
+				m_currency_fingerprints.erase(it);
+			}
+
+			const auto& sql_prefix = Statements::ReloadCurrencyIDs();
+			ForEachRowIDChunk(p_events, sql_prefix, arena, [&](const std::string_view p_sql) {
+				ScopedTimer query_timer{m_reload_query_time};
+
+				PrepareStatement ps;
+				ps.prepare(m_db, p_sql);
+
+				while (ps.hasNext())
+				{
+					const auto	  rowid = ps.get<DataTypes::Int64>().value_or(0);
+					CurrencyEntry entry;
+					entry.id		 = ps.get<hstring>().value_or(L"");
+					entry.name	 = ps.get<hstring>().value_or(L"");
+					entry.symbol = ps.get<hstring>().value_or(L"");
+
+					const auto fingerprint = ps.get<DataTypes::Int64>().value_or(0);
+					if (m_has_fingerprints)
+						m_currency_fingerprints.insert_or_assign(
+							 entry.id,
+							 CurrencyFingerprint{static_cast<std::uint64_t>(fingerprint), rowid});
+
+					if (!std::empty(entry.name))
+						entries.push_back(std::move(entry));
+				}
+			});
+
+			fingerprint_lock.unlock();
+
+			// Rows are only Known once the Fingerprints are Loaded, which a Sync does first
+			// Any other Deletion Reloads the whole Table
+			if (has_unmatched_deletions)
+			{
+				LoadCurrencyTable();
+				return;
+			}
+
+			m_cache.update([&](CurrencySnapshot& p_cache) {
+				auto& currencies = p_cache.currencies;
+
+				if (!std::empty(deleted_ids))
+				{
+					const auto is_deleted = [&](const CurrencyEntry& p_entry) {
+						const auto it =
+							 std::find(std::begin(deleted_ids), std::end(deleted_ids), p_entry.id);
+						return it != std::end(deleted_ids);
+					};
+					currencies.erase(
+						 std::remove_if(std::begin(currencies), std::end(currencies), is_deleted),
+						 std::end(currencies));
+				}
+
+				for (auto& entry : entries)
+				{
+					const auto it = std::find_if(std::begin(currencies),
+														  std::end(currencies),
+														  [&](const CurrencyEntry& p_entry) {
+															  return p_entry.id == entry.id;
+														  });
+
+					if (it != std::end(currencies))
+						*it = std::move(entry);
+					else
+						currencies.push_back(std::move(entry));
+				}
+
+				// Kept in Display Order
+				std::sort(std::begin(currencies),
+							 std::end(currencies),
+							 [](const CurrencyEntry& p_lhs, const CurrencyEntry& p_rhs) {
+								 return p_lhs.name < p_rhs.name;
+							 });
+			});
+		}
+		catch (const TUESL::SQLite::SQLiteException&)
 		{
-			const auto currency_name = ps.get<hstring>().value_or(L"");
-			// Return All Currency Names found
-			co_yield currency_name;
+			// Leave the Entries as they are
+			// They are Reloaded on the next Cold Start
 		}
 	}
+	void CurrencyConverter::OnCurrencyValuesChanged(const std::vector<ChangeEvent>& p_events)
+	{
+		// Everything here is Freed on Return
+		alignas(std::max_align_t) std::byte buffer[TransientMemory::LISTENER_ARENA_SIZE];
+		Arena arena{buffer, sizeof(buffer)};
+
+		// Sorted, so that Deleted Rows can be Found by Binary Search
+		std::pmr::vector<DataTypes::Int64> deleted_rowids{&arena};
+		for (const auto& event : p_events)
+		{
+			if (event.operation == ChangeOperation::DELETED)
+				deleted_rowids.push_back(event.rowid);
+		}
+		std::sort(std::begin(deleted_rowids), std::end(deleted_rowids));
+
+		// Every Change of the Commit is Published as one Snapshot
+		std::pmr::vector<std::pair<CurrencyPair, CachedRate>> changed_rates{&arena};
+		changed_rates.reserve(CountChangedRows(p_events));
+
+		try
+		{
+			const auto& sql_prefix = Statements::ReloadRates();
+			ForEachRowIDChunk(p_events, sql_prefix, arena, [&](const std::string_view p_sql) {
+				ScopedTimer query_timer{m_reload_query_time};
+
+				PrepareStatement ps;
+				ps.prepare(m_db, p_sql);
+
+				while (ps.hasNext())
+				{
+					const auto rowid = ps.get<DataTypes::Int64>().value_or(0);
+					auto		  row	  = Schema::readRow<CurrencyValueRow>(ps, 1);
+
+					changed_rates.emplace_back(
+						 CurrencyPair{std::move(row.from_code), std::move(row.to_code)},
+						 CachedRate{Rate{row.rate_units}, row.time, rowid});
+				}
+			});
+		}
+		catch (const TUESL::SQLite::SQLiteException&)
+		{
+			// Rates which may be Stale are Dropped rather than Served
+			m_cache.update([](CurrencySnapshot& p_cache) { p_cache.rates.clear(); });
+			RebuildRateGraph();
+			return;
+		}
+
+		if (std::empty(deleted_rowids) && std::empty(changed_rates))
+			return;
+
+		bool has_dropped_rates = false;
+		m_cache.update([&](CurrencySnapshot& p_cache) {
+			// A Rate Cached from a newer Row of the same Pair is Kept
+			auto& rates = p_cache.rates;
+			for (auto it = std::begin(rates); it != std::end(rates);)
+			{
+				if (std::binary_search(
+						  std::begin(deleted_rowids), std::end(deleted_rowids), it->second.rowid))
+				{
+					it						= rates.erase(it);
+					has_dropped_rates = true;
+				}
+				else
+					++it;
+			}
+
+			// Imported Days come in any Order, as such an older Row does not Replace a newer one
+			for (const auto& [pair, cached_rate] : changed_rates)
+			{
+				const auto [it, is_inserted] = rates.try_emplace(pair, cached_rate);
+				if (!is_inserted && it->second.time <= cached_rate.time)
+					it->second = cached_rate;
+			}
+		});
+
+		// Any Route may have gone through a Dropped Rate
+		if (has_dropped_rates)
+		{
+			RebuildRateGraph();
+			return;
+		}
+
+		std::vector<CurrencyPair> changed_pairs;
+		changed_pairs.reserve(std::size(changed_rates));
+		for (const auto& [pair, cached_rate] : changed_rates)
+			changed_pairs.push_back(pair);
+
+		UpdateRateGraph(changed_pairs);
+	}
+	void CurrencyConverter::RegisterSQLFunctions()
+	{
+		// Not Deterministic, as Rates change and Expire
+		m_db.createFunction(
+			 FunctionNames::FUNCTION_CONVERT,
+			 3,
+			 [this](FunctionContext& p_context) { ConvertSQLFunction(p_context); },
+			 SQLITE_UTF8);
+
+		m_db.createEponymousTable(VirtualTableNames::TABLE_RATE_MATRIX,
+										  VirtualTableNames::COLUMNS_RATE_MATRIX,
+										  [this] { return GetRateMatrixRows(); });
+	}
+	void CurrencyConverter::ConvertSQLFunction(FunctionContext& p_context)
+	{
+		// NULL in, NULL out, as with the Built in Functions
+		if (p_context.isNull(0) || p_context.isNull(1) || p_context.isNull(2))
+		{
+			p_context.setNull();
+			return;
+		}
+
+		// TEXT Amounts are Parsed Exactly and Converted back to TEXT
+		// Numeric Amounts give a REAL
+		const bool is_text = p_context.getType(0) == SQLITE_TEXT;
+
+		const auto amount = is_text ? Money::parse(p_context.getString(0).value_or(""))
+											 : Money::fromDouble(p_context.getDouble(0).value_or(0.0));
+		if (!amount.has_value())
+		{
+			p_context.setError("convert() Amount is not a valid Number");
+			return;
+		}
+
+		const hstring from_code{p_context.getWString(1).value_or(L"")};
+		const hstring to_code{p_context.getWString(2).value_or(L"")};
+
+		const auto rate =
+			 from_code == to_code ? Rate{Rate::SCALE} : FindRate(from_code, to_code);
+
+		// Unknown Rates are NULL rather than an Error
+		// So that one Missing Pair does not Fail a whole Report
+		if (!rate.has_value())
+		{
+			p_context.setNull();
+			return;
+		}
+
+		const auto converted = TUESL::Numeric::convert(amount.value(), rate.value());
+		if (!converted.has_value())
+		{
+			p_context.setError("convert() Result does not fit");
+			return;
+		}
+
+		if (is_text)
+			p_context.setResult(converted->toString());
+		else
+			p_context.setResult(converted->toDouble());
+	}
+	std::vector<Row> CurrencyConverter::GetRateMatrixRows()
+	{
+		const auto oldest_valid_time = OldestValidTime();
+
+		const auto cache = m_cache.read();
+
+		std::vector<Row> rows;
+		rows.reserve(std::size(cache->rates));
+
+		for (const auto& [pair, cached_rate] : cache->rates)
+		{
+			// Expired Rates are no longer Served by convert() either
+			if (cached_rate.time < oldest_valid_time)
+				continue;
+
+			rows.push_back(Row{toUTF8(pair.from_code).value_or(""),
+									 toUTF8(pair.to_code).value_or(""),
+									 cached_rate.rate.toDouble(),
+									 static_cast<DataTypes::Int64>(cached_rate.rate.units),
+									 static_cast<DataTypes::Int64>(cached_rate.time)});
+		}
+		return rows;
+	}
+	int CurrencyConverter::GetAutoVacuumMode()
+	{
+		PrepareStatement ps;
+		ps.prepare(m_db, "PRAGMA auto_vacuum;");
+
+		if (ps.hasNext())
+			return ps.get<int>().value_or(AutoVacuumMode::NONE);
+		else
+			return AutoVacuumMode::NONE;
+	}
+	PagedCursor<hstring> CurrencyConverter::OpenCurrencyNameCursor()
+	{
+		return PagedCursor<hstring>{m_db,
+											 CurrencyNamePages(),
+											 [](PrepareStatement& p_ps) {
+												 return p_ps.get<hstring>().value_or(L"");
+											 }};
+	}
 	hstring CurrencyConverter::GetCurrencyIDFromName(const hstring p_currency_name)
 	{
-		const std::string sql = "SELECT "s + ColumnNames::CurrencyIDs::COLUMN_ID +
-										" FROM "s + TableNames::TABLE_CURRENCY_IDs + " WHERE "s +
-										ColumnNames::CurrencyIDs::COLUMN_NAME + "=?"s;
+		{
+			const auto cache = m_cache.read();
+
+			// The Table is Sorted by Name
+			const auto it = std::lower_bound(
+				 std::begin(cache->currencies),
+				 std::end(cache->currencies),
+				 p_currency_name,
+				 [](const CurrencyEntry& p_entry, const hstring& p_name) {
+					 return p_entry.name < p_name;
+				 });
+			if (it != std::end(cache->currencies) && it->name == p_currency_name)
+				return it->id;
+		}
+
 		PrepareStatement ps;
-		ps.prepare(m_db, sql);
+		ps.prepare(m_db, Statements::SelectIDByName());
 		ps.bind(p_currency_name);
 
 		if (ps.hasNext())
@@ -307,11 +1590,23 @@ namespace Currency
 	}
 	hstring CurrencyConverter::GetCurrencySymbolFromName(const hstring p_currency_name)
 	{
-		const std::string sql = "SELECT "s + ColumnNames::CurrencyIDs::COLUMN_SYMBOL +
-										" FROM "s + TableNames::TABLE_CURRENCY_IDs + " WHERE "s +
-										ColumnNames::CurrencyIDs::COLUMN_NAME + "=?"s;
+		{
+			const auto cache = m_cache.read();
+
+			// The Table is Sorted by Name
+			const auto it = std::lower_bound(
+				 std::begin(cache->currencies),
+				 std::end(cache->currencies),
+				 p_currency_name,
+				 [](const CurrencyEntry& p_entry, const hstring& p_name) {
+					 return p_entry.name < p_name;
+				 });
+			if (it != std::end(cache->currencies) && it->name == p_currency_name)
+				return it->symbol;
+		}
+
 		PrepareStatement ps;
-		ps.prepare(m_db, sql);
+		ps.prepare(m_db, Statements::SelectSymbolByName());
 		ps.bind(p_currency_name);
 
 		if (ps.hasNext())
@@ -322,27 +1617,13 @@ namespace Currency
 
 	std::pair<hstring, hstring> CurrencyConverter::GetLatestConversionOperation()
 	{
-		// Query taken from https://stackoverflow.com/a/19268554
-		// See example Query
-		// select * from your_table where product_price = (SELECT max(product_price) FROM
-		// your_table)
-		const std::string sql = "SELECT "s + ColumnNames::CurrencyValues::COLUMN_FROM +
-										","s + ColumnNames::CurrencyValues::COLUMN_TO + " FROM "s +
-										TableNames::TABLE_CURRENCY_VALUES + " WHERE "s +
-										ColumnNames::CurrencyValues::COLUMN_TIME + " =("s +
-										" SELECT "s + "MAX(" +
-										ColumnNames::CurrencyValues::COLUMN_TIME + ") FROM " +
-										TableNames::TABLE_CURRENCY_VALUES + ");"s;
-
 		PrepareStatement ps;
-		ps.prepare(m_db, sql);
+		ps.prepare(m_db, Statements::SelectLatestConversion());
 
 		if (ps.hasNext())
 		{
-			const auto from_code = ps.get<hstring>().value_or(L"");
-			const auto to_code	= ps.get<hstring>().value_or(L"");
-
-			return std::make_pair(from_code, to_code);
+			auto row = Schema::readRow<CurrencyValueRow>(ps);
+			return std::make_pair(std::move(row.from_code), std::move(row.to_code));
 		}
 		else
 		{
@@ -352,11 +1633,21 @@ namespace Currency
 
 	hstring CurrencyConverter::GetCurrencyNameFromID(const hstring p_currency_id)
 	{
-		const std::string sql = "SELECT "s + ColumnNames::CurrencyIDs::COLUMN_NAME +
-										" FROM "s + TableNames::TABLE_CURRENCY_IDs + " WHERE "s +
-										ColumnNames::CurrencyIDs::COLUMN_ID + "=?"s;
+		{
+			const auto cache = m_cache.read();
+
+			// Few Hundred Entries at Most, a Linear Search is Fine
+			const auto it = std::find_if(std::begin(cache->currencies),
+												  std::end(cache->currencies),
+												  [&](const CurrencyEntry& p_entry) {
+													  return p_entry.id == p_currency_id;
+												  });
+			if (it != std::end(cache->currencies))
+				return it->name;
+		}
+
 		PrepareStatement ps;
-		ps.prepare(m_db, sql);
+		ps.prepare(m_db, Statements::SelectNameByID());
 		ps.bind(p_currency_id);
 
 		if (ps.hasNext())
@@ -365,7 +1656,368 @@ namespace Currency
 			return L"";
 	}
 
-	CurrencyConverter::CurrencyConverter()
+	void CurrencyConverter::SetupSnapshot()
+	{
+		// The Snapshot lives besides the Database
+		m_snapshot_path = m_folders.cache_folder + L"\\" + SNAPSHOT_NAME;
+
+		// A Missing or Corrupt Snapshot simply means a Cold Start
+		auto snapshot = CurrencySnapshot::Load(m_snapshot_path, OldestValidTime());
+		if (!snapshot.has_value())
+			return;
+
+		m_cache.publish(std::move(snapshot.value()));
+		RebuildRateGraph();
+	}
+	void CurrencyConverter::SetupResponseArchive()
+	{
+		m_response_archive.emplace(m_db, m_write_mutex);
+
+		// A Response that can not be Archived is still Served, only its Audit Copy is Lost
+		m_upstream.SetResponseObserver(
+			 [this](const std::wstring_view p_uri, const std::string_view p_body) {
+				 const auto now = winrt::clock::now().time_since_epoch().count();
+				 m_response_archive->Archive(p_uri, p_body, now);
+			 });
+	}
+	void CurrencyConverter::SetupHistoricalQuotes(const HistoricalQuoteOptions& p_options)
+	{
+		m_historical_quotes.emplace(m_db, m_write_mutex, p_options);
+	}
+	void CurrencyConverter::LoadCurrencyTable()
+	{
+		// Single Pass over the Table in Display Order
+		// Called only on a Cold Start
+		std::vector<CurrencyEntry> currencies;
+		{
+			ScopedTimer query_timer{m_load_currencies_query_time};
+
+			PrepareStatement ps;
+			ps.prepare(m_db, Statements::SelectCurrencies());
+
+			while (ps.hasNext())
+			{
+				CurrencyEntry entry;
+				entry.id		 = ps.get<hstring>().value_or(L"");
+				entry.name	 = ps.get<hstring>().value_or(L"");
+				entry.symbol = ps.get<hstring>().value_or(L"");
+
+				if (!std::empty(entry.name))
+					currencies.push_back(std::move(entry));
+			}
+		}
+
+		m_cache.update(
+			 [&](CurrencySnapshot& p_cache) { p_cache.currencies = std::move(currencies); });
+	}
+	IAsyncAction CurrencyConverter::LoadCurrencyTableAsync()
+	{
+		PagedCursor<CurrencyEntry> cursor{
+			 m_db,
+			 CurrencyEntryPages(),
+			 [](PrepareStatement& p_ps) {
+				 CurrencyEntry entry;
+				 entry.id		= p_ps.get<hstring>().value_or(L"");
+				 entry.name	= p_ps.get<hstring>().value_or(L"");
+				 entry.symbol = p_ps.get<hstring>().value_or(L"");
+				 return entry;
+			 }};
+
+		std::vector<CurrencyEntry> currencies;
+		{
+			// Includes the Time Spent Waiting on each Page, as the Caller does
+			ScopedTimer query_timer{m_load_currencies_query_time};
+
+			while (co_await cursor.nextPage())
+			{
+				for (const auto& entry : cursor.page())
+				{
+					if (!std::empty(entry.name))
+						currencies.push_back(entry);
+				}
+			}
+		}
+
+		// Published only once Complete, as such Readers never See Part of the Table
+		m_cache.update(
+			 [&](CurrencySnapshot& p_cache) { p_cache.currencies = std::move(currencies); });
+	}
+	std::int64_t CurrencyConverter::OldestValidTime() const
+	{
+		using std::chrono::duration_cast;
+
+		const auto current_time = winrt::clock::now().time_since_epoch();
+		return (current_time - duration_cast<TimeSpan>(RATE_LIFETIME)).count();
+	}
+	std::optional<Rate> CurrencyConverter::FindCachedRate(const hstring& p_from_code,
+																			const hstring& p_to_code)
+	{
+		const auto oldest_valid_time = OldestValidTime();
+
+		const auto cache = m_cache.read();
+
+		const auto it = cache->rates.find(CurrencyPair{p_from_code, p_to_code});
+		if (it == std::end(cache->rates))
+			return std::nullopt;
+
+		// Expired Rates are Left in place, as Readers do not Write
+		// They are Replaced once Fetched again and are not Loaded from the Snapshot
+		if (it->second.time < oldest_valid_time)
+			return std::nullopt;
+		return it->second.rate;
+	}
+	void CurrencyConverter::CacheRate(const hstring&	  p_from_code,
+												 const hstring&	  p_to_code,
+												 const Rate			  p_rate,
+												 const std::int64_t p_time,
+												 const std::int64_t p_rowid)
+	{
+		m_cache.update([&](CurrencySnapshot& p_cache) {
+			p_cache.rates.insert_or_assign(CurrencyPair{p_from_code, p_to_code},
+													 CachedRate{p_rate, p_time, p_rowid});
+		});
+
+		UpdateRateGraph({CurrencyPair{p_from_code, p_to_code}});
+	}
+	std::optional<Rate> CurrencyConverter::FindRoutedRate(const hstring& p_from_code,
+																			const hstring& p_to_code)
+	{
+		const auto route = m_rate_graph.read()->Route(p_from_code, p_to_code);
+		if (std::size(route) < 2)
+			return std::nullopt;
+
+		// The Graph only Picked the Route
+		// Each Rate along it is Checked again, as it may have Expired since
+		// and is then Chained Exactly rather than through the Logarithms
+		const auto oldest_valid_time = OldestValidTime();
+
+		const auto cache = m_cache.read();
+
+		Rate rate{Rate::SCALE};
+		for (std::size_t i = 0; i + 1 < std::size(route); ++i)
+		{
+			const auto it = cache->rates.find(CurrencyPair{route[i], route[i + 1]});
+			if (it == std::end(cache->rates) || it->second.time < oldest_valid_time)
+				return std::nullopt;
+
+			const auto chained = TUESL::Numeric::chain(rate, it->second.rate);
+			if (!chained.has_value() || chained->units == 0)
+				return std::nullopt;
+			rate = chained.value();
+		}
+		return rate;
+	}
+	std::optional<Rate> CurrencyConverter::FindRate(const hstring& p_from_code,
+																	const hstring& p_to_code)
+	{
+		if (const auto cached_rate = FindCachedRate(p_from_code, p_to_code);
+			 cached_rate.has_value())
+		{
+			m_memory_hits.increment();
+			return cached_rate;
+		}
+
+		const auto routed_rate = FindRoutedRate(p_from_code, p_to_code);
+		if (routed_rate.has_value())
+			m_route_hits.increment();
+		return routed_rate;
+	}
+	void CurrencyConverter::UpdateRateGraph(const std::vector<CurrencyPair>& p_changed_pairs)
+	{
+		// m_cache is Read under the Graph's own Writer Lock
+		// As such Concurrent Updates apply in the Order they Read the Rates
+		m_rate_graph.update([&](RateGraph& p_graph) {
+			const auto cache = m_cache.read();
+			if (!p_graph.Update(cache->rates, p_changed_pairs))
+				p_graph = RateGraph::Build(*cache,
+													OldestValidTime(),
+													RateRoutes::MAX_INTERMEDIATE_CURRENCIES + 1);
+		});
+	}
+	void CurrencyConverter::RebuildRateGraph()
+	{
+		m_rate_graph.update([&](RateGraph& p_graph) {
+			p_graph = RateGraph::Build(
+				 *m_cache.read(), OldestValidTime(), RateRoutes::MAX_INTERMEDIATE_CURRENCIES + 1);
+		});
+	}
+	void CurrencyConverter::RememberRecentPair(const hstring& p_from_code,
+															 const hstring& p_to_code)
+	{
+		const CurrencyPair pair{p_from_code, p_to_code};
+
+		// Repeated Conversions of the same Pair are the Common Case
+		// They need not Publish a new Snapshot
+		{
+			const auto cache = m_cache.read();
+			if (!std::empty(cache->recent_pairs) && cache->recent_pairs.front() == pair)
+				return;
+		}
+
+		m_cache.update([&](CurrencySnapshot& p_cache) {
+			auto& recent_pairs = p_cache.recent_pairs;
+
+			// Move the Pair to the Front
+			recent_pairs.erase(
+				 std::remove(std::begin(recent_pairs), std::end(recent_pairs), pair),
+				 std::end(recent_pairs));
+			recent_pairs.insert(std::begin(recent_pairs), pair);
+
+			if (std::size(recent_pairs) > MAX_RECENT_PAIRS)
+				recent_pairs.resize(MAX_RECENT_PAIRS);
+		});
+	}
+	bool CurrencyConverter::IsWarm()
+	{
+		return !std::empty(m_cache.read()->currencies);
+	}
+	std::vector<hstring> CurrencyConverter::GetCurrencyNames()
+	{
+		const auto cache = m_cache.read();
+
+		std::vector<hstring> names;
+		names.reserve(std::size(cache->currencies));
+		for (const auto& currency : cache->currencies)
+			names.push_back(currency.name);
+		return names;
+	}
+	std::optional<CurrencyPair> CurrencyConverter::GetMostRecentPair()
+	{
+		const auto cache = m_cache.read();
+
+		if (std::empty(cache->recent_pairs))
+			return std::nullopt;
+		return cache->recent_pairs.front();
+	}
+	bool CurrencyConverter::SaveSnapshot()
+	{
+		const auto cache = m_cache.read();
+
+		// Nothing Worth Saving
+		if (std::empty(cache->currencies))
+			return false;
+
+		return cache->Save(m_snapshot_path);
+	}
+
+	StorageFolders StorageFolders::ForPackage()
+	{
+		const auto application_data = Windows::Storage::ApplicationData::Current();
+
+		return StorageFolders{application_data.LocalCacheFolder().Path(),
+									 application_data.LocalFolder().Path()};
+	}
+	hstring CurrencyConverter::HistoryDirectory(const StorageFolders& p_folders)
+	{
+		return p_folders.local_folder + L"\\" + HISTORY_FOLDER_NAME;
+	}
+	hstring CurrencyConverter::HistorySeriesName(const hstring& p_from_code,
+																const hstring& p_to_code)
+	{
+		return p_from_code + L"_" + p_to_code;
+	}
+	std::vector<Sample> CurrencyConverter::GetRateHistory(const hstring&	p_from_code,
+																			const hstring&	p_to_code,
+																			const DateTime& p_begin,
+																			const DateTime& p_end)
+	{
+		return m_history.range(HistorySeriesName(p_from_code, p_to_code),
+									  p_begin.time_since_epoch().count(),
+									  p_end.time_since_epoch().count());
+	}
+	std::vector<OHLC> CurrencyConverter::GetRateHistoryOHLC(const hstring&	 p_from_code,
+																			  const hstring&	 p_to_code,
+																			  const DateTime& p_begin,
+																			  const DateTime& p_end,
+																			  const TimeSpan& p_interval)
+	{
+		return m_history.downsample(HistorySeriesName(p_from_code, p_to_code),
+											 p_begin.time_since_epoch().count(),
+											 p_end.time_since_epoch().count(),
+											 p_interval.count());
+	}
+	void CurrencyConverter::FlushHistory()
+	{
+		m_history.flush();
+	}
+	RequestScheduler::Metrics CurrencyConverter::GetUpstreamMetrics() const
+	{
+		return m_upstream.SchedulerMetrics(0);
+	}
+	void CurrencyConverter::RegisterStatements(QueryPlanGuard& p_guard)
+	{
+		// Rowids of a Chunk the Listeners Reload
+		constexpr const auto ROWIDS = "1,2);";
+
+		p_guard.registerStatement("insert_rate", Statements::InsertRate());
+		p_guard.registerStatement("select_rate", Statements::SelectRate());
+		p_guard.registerStatement("expire_rates", Statements::ExpireRates());
+		p_guard.registerStatement("select_latest_conversion",
+										  Statements::SelectLatestConversion());
+		p_guard.registerStatement("reload_rates", Statements::ReloadRates() + ROWIDS);
+
+		p_guard.registerStatement("insert_currency_id", Statements::InsertCurrencyID());
+		p_guard.registerStatement("import_currency_id", Statements::ImportCurrencyID());
+		p_guard.registerStatement("add_currency", Statements::AddCurrency());
+		p_guard.registerStatement("update_currency", Statements::UpdateCurrency());
+		p_guard.registerStatement("delete_currency", Statements::DeleteCurrency());
+		p_guard.registerStatement("count_currency_ids", Statements::CountCurrencyIDs());
+		p_guard.registerStatement("select_currencies", Statements::SelectCurrencies());
+		p_guard.registerStatement("select_fingerprints", Statements::SelectFingerprints());
+		p_guard.registerStatement("reload_currency_ids", Statements::ReloadCurrencyIDs() + ROWIDS);
+		p_guard.registerStatement("select_id_by_name", Statements::SelectIDByName());
+		p_guard.registerStatement("select_symbol_by_name", Statements::SelectSymbolByName());
+		p_guard.registerStatement("select_name_by_id", Statements::SelectNameByID());
+
+		p_guard.registerStatement("currency_names_first_page",
+										  TUESL::SQLite::pageSQL(CurrencyNamePages(), true));
+		p_guard.registerStatement("currency_names_next_page",
+										  TUESL::SQLite::pageSQL(CurrencyNamePages(), false));
+		p_guard.registerStatement("currency_entries_first_page",
+										  TUESL::SQLite::pageSQL(CurrencyEntryPages(), true));
+		p_guard.registerStatement("currency_entries_next_page",
+										  TUESL::SQLite::pageSQL(CurrencyEntryPages(), false));
+
+		HistoricalQuoteCache::RegisterStatements(p_guard);
+	}
+	ResponseArchive& CurrencyConverter::GetResponseArchive() noexcept
+	{
+		return *m_response_archive;
+	}
+	HistoricalQuoteStatistics CurrencyConverter::GetHistoricalQuoteStatistics()
+	{
+		return m_historical_quotes->Statistics();
+	}
+
+	CurrencyConverter::CurrencyConverter(const DatabaseMode				 p_database_mode,
+													 const StorageFolders&			 p_folders,
+													 const UpstreamService&			 p_upstream,
+													 const HistoricalQuoteOptions& p_historical_quotes) :
+		 m_database_mode{p_database_mode},
+		 m_folders{p_folders},
+		 m_memory_hits{LookupCounter("memory")},
+		 m_route_hits{LookupCounter("route")},
+		 m_database_hits{LookupCounter("database")},
+		 m_network_hits{LookupCounter("network")},
+		 m_lookup_failures{LookupCounter("failed")},
+		 m_lookup_query_time{QueryHistogram("lookup")},
+		 m_insert_query_time{QueryHistogram("insert")},
+		 m_expire_query_time{QueryHistogram("expire")},
+		 m_reload_query_time{QueryHistogram("reload")},
+		 m_load_currencies_query_time{QueryHistogram("load_currencies")},
+		 m_import_query_time{QueryHistogram("import")},
+		 m_expired_rates{ExpiryCounter("currency_values")},
+		 m_expired_responses{ExpiryCounter("response_archive")},
+		 m_expiry_batches{TUESL::Metrics::Registry::global().counter(
+			  "currency_expiry_batches_total", "Write Transactions run by Expiry Ticks")},
+		 m_vacuumed_pages{TUESL::Metrics::Registry::global().counter(
+			  "currency_expiry_vacuumed_pages_total",
+			  "Pages Returned to the File System by Expiry Ticks")},
+		 m_expiry_max_pause{TUESL::Metrics::Registry::global().histogram(
+			  "currency_expiry_max_pause_seconds",
+			  "Longest any Writer could have Waited on an Expiry Tick")},
+		 m_upstream{p_upstream.providers, p_upstream.hedging},
+		 m_history{HistoryDirectory(p_folders)}
 	{
 		// Verify if threading is enabled within database
 		// Throw Exception if Not
@@ -373,7 +2025,14 @@ namespace Currency
 
 		SetupWebClient();
 		SetupDatabase();
+		SetupSnapshot();
+		SetupResponseArchive();
+		SetupHistoricalQuotes(p_historical_quotes);
 
 		CreateTableCurrencyValues();
+		CreateIndexCurrencyValuesTime();
+		CreateIndexCurrencyValuesPair();
+
+		SubscribeToChanges();
 	}
 } // namespace Currency
\ No newline at end of file
@@ -1,23 +1,70 @@
 #pragma once
 
 // Required for Manipulating SQLite
+#include <TUESL/SQLite/Backup.hxx>
 #include <TUESL/SQLite/Database.hxx>
 #include <TUESL/SQLite/PrepareStatement.hxx>
+#include <TUESL/SQLite/QueryPlan.hxx>
+#include <TUESL/SQLite/Schema.hxx>
+
+// Required to Read Tables a Page at a Time, off the Calling Thread
+#include <TUESL/SQLite/PagedCursor.hxx>
 
 // Required for Accessing Internet via the web
 #include <TUESL/Net/WebClient.hxx>
 
+// Required to Keep the History of Rates
+#include <TUESL/TimeSeries/TimeSeriesStore.hxx>
+
+// Required for Exact Money and Rates
+#include <TUESL/Numeric/FixedPoint.hxx>
+
+// Required for Transient Allocations of Refreshes and Queries
+#include <TUESL/Utility/Arena.hxx>
+
+// Required to Share the Cache with Concurrent Readers
+#include <TUESL/Concurrency/RCUSnapshot.hxx>
+
+// Required to Count Hits per Layer and Time Queries
+#include <TUESL/Metrics/Registry.hxx>
+
+// Required to Convert Text where it Leaves the Database
+#include <TUESL/Utility/Transcode.hxx>
+
 // Required to Manipulate JSON
 #include <winrt/Windows.Data.Json.h>
 
 // Required to deal with CoRoutines
 #include <winrt/Windows.Foundation.h>
-// Also Required to Deal with CoRoutines that Yield
-#include <experimental/generator>
 
 // Required to Access Local Folder
 #include <winrt/Windows.Storage.h>
 
+// Required to Measure Pauses caused by Expiry
+#include <chrono>
+#include <cstdint>
+
+// Required to Warm up from the Snapshot
+#include "CurrencySnapshot.hxx"
+// Required to Load the Currency List in Parallel
+#include "CurrencyIngestion.hxx"
+// Required to Import Reference Rate Files
+#include "ReferenceRates.hxx"
+// Required to Sync only what Changed in the Currency List
+#include "CurrencyDelta.hxx"
+// Required to Keep every Response for Audit
+#include "ResponseArchive.hxx"
+// Required to Convert through other Currencies
+#include "RateGraph.hxx"
+// Required to Hedge Lookups across Rate Providers
+#include "HedgedUpstream.hxx"
+// Required to Cache Quotes of past Days
+#include "HistoricalQuotes.hxx"
+#include <atomic>
+#include <mutex>
+#include <optional>
+#include <vector>
+
 namespace Currency
 {
 	namespace
@@ -33,17 +80,38 @@ namespace Currency
 		using Windows::Data::Json::JsonObject;
 		using Windows::Data::Json::JsonValue;
 
-		using Windows::UI::Core::CoreDispatcher;
-		using Windows::UI::Core::CoreWindow;
-
 		using namespace std::string_literals;
 
-		using TUESL::Net::WebClient;
+		using TUESL::Net::Priority;
+		using TUESL::Net::RequestScheduler;
+
+		using TUESL::Concurrency::RCUSnapshot;
+
+		using TUESL::Metrics::Counter;
+		using TUESL::Metrics::Histogram;
+		using TUESL::Metrics::ScopedTimer;
 
+		using TUESL::Utility::Arena;
+		using TUESL::Utility::toUTF8;
+
+		using TUESL::SQLite::Backup;
+		using TUESL::SQLite::ChangeEvent;
+		using TUESL::SQLite::ChangeOperation;
 		using TUESL::SQLite::Database;
+		using TUESL::SQLite::FunctionContext;
+		using TUESL::SQLite::PagedCursor;
 		using TUESL::SQLite::PrepareStatement;
+		using TUESL::SQLite::QueryPlanGuard;
+		using TUESL::SQLite::Row;
+		namespace DataTypes = TUESL::SQLite::DataTypes;
+		namespace Schema	  = TUESL::SQLite::Schema;
+
+		using TUESL::TimeSeries::OHLC;
+		using TUESL::TimeSeries::Sample;
+		using TUESL::TimeSeries::TimeSeriesStore;
 
-		using std::experimental::generator;
+		using TUESL::Numeric::Money;
+		using TUESL::Numeric::Rate;
 	} // namespace
 
 	// Unnamed namespace kept to ensure that access is limited to
@@ -51,15 +119,25 @@ namespace Currency
 	namespace
 	{
 		constexpr const auto DATABASE_NAME = "Database.db";
+		constexpr const auto IN_MEMORY_DATABASE_NAME = ":memory:";
+		// Stored as PRAGMA user_version
+		// Bumped whenever a Table changes Shape
+		constexpr const int SCHEMA_VERSION = 2;
+		constexpr const auto SNAPSHOT_NAME = L"Snapshot.bin";
+		// Rate History is kept in the Local Folder rather than the Cache
+		// As unlike the Cache it can not be Re-Derived from Upstream
+		constexpr const auto HISTORY_FOLDER_NAME = L"History";
+
+		// Number of Most Recently Used Pairs Remembered across Runs
+		constexpr const std::size_t MAX_RECENT_PAIRS = 16;
+
+		// Rates older than this are Expired from the Database
+		// As such they must not be Served from Memory either
+		constexpr const auto RATE_LIFETIME = std::chrono::hours{12};
 		namespace CurrencyJsonAPIURLs
 		{
-			constexpr const auto URL_CURRENCY_IDs =
-				 L"https://free.currencyconverterapi.com/api/v6/currencies";
-
-			// Example URI For Conversion
-			// https://free.currencyconverterapi.com/api/v6/convert?q={from}_{to}&compact=ultra
-			constexpr const auto URL_CURRENCY_AMTs =
-				 L"https://free.currencyconverterapi.com/api/v6/convert?compact=ultra&q=";
+			// Paths under it are Built by UpstreamProvider::ForConverterAPI
+			constexpr const auto URL_SERVICE_ROOT = L"https://free.currencyconverterapi.com/api/v6/";
 		} // namespace CurrencyJsonAPIURLs
 		namespace TableNames
 		{
@@ -73,6 +151,9 @@ namespace Currency
 				constexpr const auto COLUMN_ID	  = "id";
 				constexpr const auto COLUMN_NAME	= "currencyName";
 				constexpr const auto COLUMN_SYMBOL = "currencySymbol";
+				// FingerprintOf the Row
+				// 0 where it is not Known, as for Rows Written before Version 2 or Imported
+				constexpr const auto COLUMN_FINGERPRINT = "fingerprint";
 			} // namespace CurrencyIDs
 			namespace CurrencyValues
 			{
@@ -82,34 +163,452 @@ namespace Currency
 				constexpr const auto COLUMN_TIME				 = "time_col";
 			} // namespace CurrencyValues
 		}	 // namespace ColumnNames
+		namespace JsonKeys
+		{
+			// Same as the Columns they are Stored in
+			// Wide, as such Lookups Reference the Literal rather than Allocating an hstring
+			namespace CurrencyIDs
+			{
+				constexpr const auto KEY_ID	  = L"id";
+				constexpr const auto KEY_NAME	  = L"currencyName";
+				constexpr const auto KEY_SYMBOL = L"currencySymbol";
+			} // namespace CurrencyIDs
+		}	 // namespace JsonKeys
+		namespace FunctionNames
+		{
+			// convert(amount, from, to)
+			constexpr const auto FUNCTION_CONVERT = "convert";
+		} // namespace FunctionNames
+		namespace VirtualTableNames
+		{
+			// Every Cached Rate as (from_code, to_code, rate, rate_units, time)
+			constexpr const auto TABLE_RATE_MATRIX = "rate_matrix";
+			constexpr const auto COLUMNS_RATE_MATRIX =
+				 "from_code TEXT, to_code TEXT, rate REAL, rate_units INTEGER, time INTEGER";
+		} // namespace VirtualTableNames
+		namespace IndexNames
+		{
+			// Allows Expiry to find old rows without scanning the whole table
+			constexpr const auto INDEX_CURRENCY_VALUES_TIME = "INDEX_CURRENCY_VALUES_TIME";
+			// Lets every Page of Names Seek to where the last one Ended
+			constexpr const auto INDEX_CURRENCY_IDs_NAME = "INDEX_CURRENCY_IDs_NAME";
+			// Lets Syncs and Imports Find a Currency by its Code
+			constexpr const auto INDEX_CURRENCY_IDs_ID = "INDEX_CURRENCY_IDs_ID";
+			// Lets a Lookup Seek the Latest Rate of a Pair without scanning the whole table
+			// Unique, as such an Import of a File already Imported Stores nothing twice
+			constexpr const auto INDEX_CURRENCY_VALUES_PAIR_TIME =
+				 "INDEX_CURRENCY_VALUES_PAIR_TIME";
+			// What it Replaced, on Databases Created before
+			constexpr const auto INDEX_CURRENCY_VALUES_PAIR = "INDEX_CURRENCY_VALUES_PAIR";
+		} // namespace IndexNames
+		namespace Expiry
+		{
+			// Number of Rows deleted within a Single Write Transaction
+			// Kept small so that the Database is never locked for long
+			constexpr const auto BATCH_SIZE = 256;
+			// Upper bound on Batches run per Tick
+			// Remaining Rows are picked up in the next Tick
+			constexpr const auto MAX_BATCHES_PER_TICK = 64;
+			// Number of Free Pages returned to the File System per Tick
+			constexpr const auto VACUUM_PAGES_PER_TICK = 128;
+		} // namespace Expiry
+		namespace DatabaseBackup
+		{
+			// Pages Copied to Disk per Step
+			// Writers only ever wait for one Step
+			constexpr const int PAGES_PER_STEP = 16;
+			// Upper bound on Steps per Tick
+			// Remaining Pages are Copied on the next Tick
+			constexpr const int MAX_STEPS_PER_TICK = 64;
+		} // namespace DatabaseBackup
+		namespace UpstreamBudget
+		{
+			// Quota of the Free Converter Service
+			constexpr const double REQUESTS_PER_HOUR = 100.0;
+			// Enough for a Cold Start to Load the Currency List and a few Rates at once
+			constexpr const double BURST = 10.0;
+			constexpr const std::size_t MAX_IN_FLIGHT = 4;
+
+			// Batches never take the last of these, as such a Lookup the User Waits on
+			// always has a Token and a Slot left
+			constexpr const double		INTERACTIVE_TOKENS = 2.0;
+			constexpr const std::size_t INTERACTIVE_SLOTS  = 1;
+		} // namespace UpstreamBudget
+		namespace RateRoutes
+		{
+			// Currencies a Conversion may go through when its own Rate is not Cached
+			// Each one adds a Rounding and a Spread, as such Routes are kept Short
+			constexpr const std::size_t MAX_INTERMEDIATE_CURRENCIES = 2;
+		} // namespace RateRoutes
+		namespace ReferenceRateImport
+		{
+			// Rates of the ECB are Quoted per Euro
+			constexpr const auto BASE_CURRENCY = L"EUR";
+			// Rows Written per Transaction
+			// Other Writers Wait for at most one, and the Rows Changed by it are Reloaded at once
+			constexpr const std::size_t ROWS_PER_TRANSACTION = 4096;
+		} // namespace ReferenceRateImport
+		namespace TransientMemory
+		{
+			// Stack Buffer of the Arena each Change Listener runs in
+			// Fits a Full Chunk of RowIDs and the Rows Read back for it
+			// Larger Commits spill to the Heap
+			constexpr const std::size_t LISTENER_ARENA_SIZE = 16 * 1024;
+		} // namespace TransientMemory
+		// A Row of TABLE_CURRENCY_VALUES
+		struct CurrencyValueRow
+		{
+			hstring from_code;
+			hstring to_code;
+			// Units of Rate::SCALE
+			DataTypes::Int64 rate_units = 0;
+			// Ticks since the Epoch
+			DataTypes::Int64 time = 0;
+
+			// Declared as the Table always was, as such Databases which already have it Match
+			static constexpr auto schema()
+			{
+				namespace Columns = ColumnNames::CurrencyValues;
+				using Self			= CurrencyValueRow;
+
+				return Schema::table(
+					 TableNames::TABLE_CURRENCY_VALUES,
+					 Schema::column(Columns::COLUMN_FROM, &Self::from_code, "BLOB NOT NULL"),
+					 Schema::column(Columns::COLUMN_TO, &Self::to_code, "BLOB NOT NULL"),
+					 Schema::column(Columns::COLUMN_AMT_CONVERSION, &Self::rate_units),
+					 Schema::column(Columns::COLUMN_TIME, &Self::time, "REAL NOT NULL"));
+			}
+		};
+		namespace AutoVacuumMode
+		{
+			// Values returned by PRAGMA auto_vacuum
+			constexpr const int NONE		  = 0;
+			constexpr const int FULL		  = 1;
+			constexpr const int INCREMENTAL = 2;
+		} // namespace AutoVacuumMode
 
 	} // namespace
 
+	// Folders the Converter keeps its Files in
+	struct StorageFolders
+	{
+		// Database and Snapshot, both can be Fetched again
+		hstring cache_folder;
+		// Rate History, which can not
+		hstring local_folder;
+
+		// Folders of the App Package
+		// Only a Packaged Process has them, a Headless Host Passes its own
+		static StorageFolders ForPackage();
+	};
+
+	// Services Rates and Currencies are Fetched from
+	struct UpstreamService
+	{
+		// The first is the Primary, the rest are Hedged to in this Order
+		// Currencies are Listed by the first which Lists them
+		std::vector<UpstreamProvider> providers;
+		HedgeOptions					  hedging;
+
+		// The Free Converter Service alone, within its Quota
+		static UpstreamService ForConverterAPI();
+	};
+
+	// Where the Primary Copy of the Cache Database lives
+	enum class DatabaseMode
+	{
+		// Every Write pays for the Journal and a Sync
+		ON_DISK,
+		// Writes stay in Memory
+		// The File on Disk is only a Backup, Restored at Startup and Copied to by BackupDatabase
+		// Whatever was Written since the last Backup is Lost on a Crash
+		// That is Fine as all of it can be Fetched again
+		IN_MEMORY
+	};
+
+	// Summary of a Single Expiry Run
+	struct ExpiryStatistics
+	{
+		// Total Number of Rows Deleted across all Batches
+		std::int64_t rows_reclaimed = 0;
+		// Number of Batches, and thereby Write Transactions, executed
+		std::int64_t batches = 0;
+		// Longest time the Database was held by a Single Batch
+		// This is the pause any other writer could have observed
+		std::chrono::microseconds max_pause{0};
+		// Time Spent across all Batches and the Vacuum
+		std::chrono::microseconds total_pause{0};
+		// Pages returned to the File System by Incremental Vacuum
+		std::int64_t pages_vacuumed = 0;
+		// Archived Responses Deleted beyond ArchiveOptions::max_responses
+		std::int64_t responses_expired = 0;
+		// Set when the Tick ran out of Batches before all old Rows were removed
+		bool has_remaining = false;
+	};
+
+	// Summary of a Single Import of a Reference Rate File
+	struct ImportStatistics
+	{
+		// Rates Read from the File
+		std::size_t rates = 0;
+		// Rates which could not be Read, see ReferenceRateStatistics
+		std::size_t skipped = 0;
+		// Rows Written to TABLE_CURRENCY_VALUES, a Rate and its Inverse each
+		// Rates Stored by an earlier Import of the Day are not Written again
+		std::size_t rows_inserted = 0;
+		// Currencies Added to TABLE_CURRENCY_IDs
+		std::size_t currencies_added = 0;
+		std::size_t transactions		= 0;
+	};
+
+	// Summary of a Single Sync of the Currency List
+	struct CurrencySyncStatistics
+	{
+		std::size_t inserted	= 0;
+		std::size_t updated	= 0;
+		std::size_t deleted	= 0;
+		std::size_t unchanged = 0;
+
+		bool hasChanges() const noexcept
+		{
+			return inserted + updated + deleted != 0;
+		}
+	};
+
+	// Result of Converting many Amounts to many Currencies
+	// Row Major, One Row per Target Currency
+	struct ConversionMatrix
+	{
+		std::vector<hstring> to_codes;
+		// Rate used for every Row
+		// 0 where the Rate could not be Obtained, as with GetConversionRate
+		std::vector<Rate> rates;
+
+		std::size_t			amount_count = 0;
+		std::vector<Money> values;
+
+		// Values which did not fit are Money::INVALID_UNITS
+		std::size_t overflow_count = 0;
+
+		Money at(const std::size_t p_to_index, const std::size_t p_amount_index) const
+		{
+			return values[p_to_index * amount_count + p_amount_index];
+		}
+		const Money* row(const std::size_t p_to_index) const
+		{
+			return std::data(values) + p_to_index * amount_count;
+		}
+	};
+
 	struct CurrencyConverter
 	{
 	 private:
-		Database  m_db{""};
-		WebClient m_web_client;
+		DatabaseMode	 m_database_mode;
+		StorageFolders m_folders;
+
+		// Lookups Answered by each Layer, in the Order they are Tried
+		// Registered with Metrics::Registry::global() as currency_rate_lookups_total
+		Counter& m_memory_hits;
+		Counter& m_route_hits;
+		Counter& m_database_hits;
+		Counter& m_network_hits;
+		// Lookups which Returned the 0 Sentinel
+		Counter& m_lookup_failures;
+
+		// Time Spent in SQLite per Class of Query, as currency_database_query_seconds
+		// Writes include the Reload of the Rows they Changed, which is also Timed apart
+		Histogram& m_lookup_query_time;
+		Histogram& m_insert_query_time;
+		Histogram& m_expire_query_time;
+		Histogram& m_reload_query_time;
+		Histogram& m_load_currencies_query_time;
+		Histogram& m_import_query_time;
+
+		// What every Expiry Tick Reclaimed, and the Longest it Held the Database
+		//	currency_expiry_rows_total{table="currency_values"|"response_archive"}
+		//	currency_expiry_batches_total
+		//	currency_expiry_vacuumed_pages_total
+		//	currency_expiry_max_pause_seconds
+		Counter&	  m_expired_rates;
+		Counter&	  m_expired_responses;
+		Counter&	  m_expiry_batches;
+		Counter&	  m_vacuumed_pages;
+		Histogram& m_expiry_max_pause;
+
+		Database			m_db{""};
+		HedgedUpstream m_upstream;
+
+		// Backup Target of the In Memory Database
+		// Declared after m_db as the Backup refers to both
+		Database					m_disk_db{""};
+		std::optional<Backup> m_backup;
+		std::mutex				m_backup_mutex;
+		// noOfTotalRowsModified as of the last Completed Backup
+		// -1 so that the first Backup also Captures the Schema
+		int m_backed_up_changes = -1;
+
+		// The Connection is Shared by Concurrent Conversions
+		// SQLite does not allow Nested Transactions, as such Writers take Turns
+		std::mutex m_write_mutex;
+
+		// Set at Startup where auto_vacuum is not yet INCREMENTAL
+		// The Full VACUUM Switching it is left to the first Expiry Tick, Guarded by m_write_mutex
+		bool m_needs_full_vacuum = false;
+
+		// Every Response Body the Upstream Returned, Compressed into m_db
+		// Created once m_db is Open, and Writes under m_write_mutex
+		std::optional<ResponseArchive> m_response_archive;
+
+		// Rates of past Days, in Memory and in m_db
+		// Created once m_db is Open, and Writes under m_write_mutex
+		std::optional<HistoricalQuoteCache> m_historical_quotes;
+
+		// One Append Only File per Currency Pair
+		// Unlike TABLE_CURRENCY_VALUES it is never Expired
+		TimeSeriesStore m_history;
+
+		// In Memory Copy of the Currency Table, Rates and Recent Pairs
+		// Restored from the Snapshot at Startup and Saved back on Suspend
+		// Read from UI Coroutines, Pool Threads and Timers at once
+		// Readers never Lock, every Change Publishes a new Immutable Copy
+		RCUSnapshot<CurrencySnapshot> m_cache;
+		hstring							m_snapshot_path;
+
+		// Best Routes between every Pair of Cached Currencies
+		// Kept in step with m_cache by every Writer of its Rates
+		RCUSnapshot<RateGraph> m_rate_graph;
+
+		// Fingerprint of every Stored Currency, Read once before the first Sync
+		// From then on Kept in step by OnCurrencyIDsChanged, whoever Wrote the Rows
+		CurrencyFingerprints m_currency_fingerprints;
+		bool					m_has_fingerprints = false;
+		std::mutex			m_fingerprint_mutex;
+
+		// Set when SetupTableCurrencyIDs has just Downloaded the List
+		// The next Sync has nothing to Compare it to but itself, and is Skipped
+		std::atomic<bool> m_has_fresh_currency_ids{false};
 
 	 private:
 		void SetupWebClient();
 		void SetupDatabase();
+		void RestoreDatabase();
+		static int GetPageSize(Database& p_db);
+		void MigrateSchema();
+		int  GetSchemaVersion();
+		int  GetAutoVacuumMode();
+
+		// Lets Reports Convert within a Single Statement
+		//	SELECT SUM(convert(amount, currency, 'USD')) FROM ledger;
+		//	SELECT * FROM ledger JOIN rate_matrix ON from_code = currency AND to_code = 'EUR';
+		// Both only Read the Cached Rates, a Statement never waits on the Network
+		void RegisterSQLFunctions();
+
+		// Keeps the In Memory Copy in step with every Commit to the Tables
+		// Only the Rows Changed are Reloaded or Dropped
+		void SubscribeToChanges();
+		void OnCurrencyIDsChanged(const std::vector<ChangeEvent>& p_events);
+		void OnCurrencyValuesChanged(const std::vector<ChangeEvent>& p_events);
+		void ConvertSQLFunction(FunctionContext& p_context);
+		std::vector<Row> GetRateMatrixRows();
+
+		void SetupSnapshot();
+		// Archives what every Provider Returns from then on
+		void SetupResponseArchive();
+		void SetupHistoricalQuotes(const HistoricalQuoteOptions& p_options);
+		void LoadCurrencyTable();
+		// Same as LoadCurrencyTable, with every Page Read off the Calling Thread
+		IAsyncAction LoadCurrencyTableAsync();
+		// Unless already Loaded, the Caller holds m_fingerprint_mutex
+		void LoadCurrencyFingerprints();
+
+		std::optional<Rate> FindCachedRate(const hstring& p_from_code,
+													  const hstring& p_to_code);
+		// Rate Chained along the Best Route through other Currencies
+		// nullopt if any Rate along it is Missing or Expired
+		std::optional<Rate> FindRoutedRate(const hstring& p_from_code,
+													  const hstring& p_to_code);
+		// The Cached Rate, else the Routed one
+		std::optional<Rate> FindRate(const hstring& p_from_code, const hstring& p_to_code);
+		void					  CacheRate(const hstring&		p_from_code,
+												const hstring&		p_to_code,
+												const Rate			p_rate,
+												const std::int64_t p_time,
+												const std::int64_t p_rowid);
+		void					  RememberRecentPair(const hstring& p_from_code,
+															const hstring& p_to_code);
+
+		// Incremental where it can be, otherwise Rebuilt from m_cache
+		void UpdateRateGraph(const std::vector<CurrencyPair>& p_changed_pairs);
+		void RebuildRateGraph();
+
+		std::int64_t OldestValidTime() const;
+
+		static hstring HistoryDirectory(const StorageFolders& p_folders);
+		static hstring HistorySeriesName(const hstring& p_from_code, const hstring& p_to_code);
 
 		void CreateTableCurrencyIDs();
-		void InsertIntoCurrencyIDs(JsonObject p_results);
+		void CreateIndexCurrencyIDsName();
+		void CreateIndexCurrencyIDsID();
+		// Every Row of the Batches in one Transaction
+		void InsertIntoCurrencyIDs(const std::vector<CurrencyBatch>& p_batches);
 
 		int  GetCountOfCurrencyIDs();
 		bool HasCurrencyValuesPresent();
 
 		void CreateTableCurrencyValues();
-		void InsertCurrencyValue(const hstring p_from_code,
-										 const hstring p_to_code,
-										 const double  p_converted_value);
+		void CreateIndexCurrencyValuesTime();
+		void CreateIndexCurrencyValuesPair();
+
+		std::int64_t GetFreePageCount();
+		// m_write_mutex must be Held
+		// As such the Vacuum never runs within another Writer's Transaction
+		std::int64_t VacuumFreePages(const int p_max_pages);
+
+		// Memory, then a Route through Memory, then SQLite, then the Network
+		// Network Queries wait in p_priority's Lane of the Upstream Budget
+		// Unlike GetConversionRate the Pair is not Remembered as Recent
+		IAsyncOperation<std::int64_t> LookupConversionRate(
+			 const hstring	p_from_code,
+			 const hstring	p_to_code,
+			 const Priority p_priority = Priority::INTERACTIVE);
 
 	 public:
 		IAsyncAction SetupTableCurrencyIDs();
 
-		generator<hstring> GetAllCurrencyNamesAsync();
+		// Fetches the Currency List again and Applies it through ApplyCurrencyList
+		// Unlike SetupTableCurrencyIDs this also Runs once the Table has Rows
+		// Returns true if any Currency was Inserted, Updated or Deleted
+		// false as well if the List could not be Fetched, in which case nothing is Changed
+		// Right after SetupTableCurrencyIDs Downloaded it, the List is not Fetched again
+		IAsyncOperation<bool> SyncCurrencyIDs();
+
+		// Writes only the Currencies which Differ from those Stored, in one Transaction
+		// Stored Currencies p_upstream does not List are Deleted
+		// An Unchanged List costs a Fingerprint per Entry, and Writes nothing
+		// An Empty List is taken as a Failed Fetch, as such nothing is Deleted
+		// Memory is Updated by the Listener of the Table once the Transaction Commits
+		CurrencySyncStatistics ApplyCurrencyList(const std::vector<CurrencyEntry>& p_upstream);
+
+		// True when the Currency Table was Restored from the Snapshot
+		// or has already been Loaded once
+		bool IsWarm();
+
+		// Names in Display Order, Served from Memory
+		std::vector<hstring> GetCurrencyNames();
+
+		std::optional<CurrencyPair> GetMostRecentPair();
+
+		// Persists the Warm State so that the next Start is Warm
+		bool SaveSnapshot();
+
+		// Names in Display Order, Read from SQLite a Page at a Time
+		// Each Page is Read on a Background Thread while the one before is Consumed
+		//	auto names = converter.OpenCurrencyNameCursor();
+		//	while (co_await names.nextPage())
+		//		for (const auto& name : names.page())
+		//			...
+		// The Converter must outlive the Cursor
+		PagedCursor<hstring> OpenCurrencyNameCursor();
 
 		hstring GetCurrencyIDFromName(const hstring p_currency_name);
 		hstring GetCurrencySymbolFromName(const hstring p_currency_name);
@@ -118,12 +617,121 @@ namespace Currency
 
 		hstring GetCurrencyNameFromID(const hstring p_currency_name);
 
+		// Rate in Units of Rate::SCALE, wrap it as Rate{units}
+		// 0 if the Rate could not be Obtained
+		IAsyncOperation<std::int64_t> GetConversionRate(const hstring p_from_code,
+																		const hstring p_to_code);
+
+		// Rate as Quoted on the Day p_day falls on, in UTC, as GetConversionRate
+		// From the Historical Quotes, else Hedged among the Providers which Quote past Days
+		// A Day not yet Over is Converted at the Latest Rate, as its Quote may still Change
+		IAsyncOperation<std::int64_t> GetHistoricalConversionRate(const hstring  p_from_code,
+																					 const hstring  p_to_code,
+																					 const DateTime p_day);
+
+		// From Memory alone, directly or through other Currencies
+		// Never Waits, as such a Host Serving many Requests tries it before GetConversionRate
+		// nullopt if not Cached
+		std::optional<Rate> GetCachedConversionRate(const hstring& p_from_code,
+																  const hstring& p_to_code);
+
+		// Stores a Rate and its Inverse as if just Fetched
+		// Both are Cached and Appended to the History once this Returns
+		void InsertCurrencyValue(const hstring p_from_code,
+										 const hstring p_to_code,
+										 const Rate	  p_rate);
+
+		// Stores every Rate of a Reference Rate File, and its Inverse, as if Fetched on its Day
+		// Meant for Machines without Network Access, see ReferenceRates.hxx for the Layouts
+		// Currencies not yet Listed are Added, with their Code as Name and Symbol
+		//
+		// The File is Memory Mapped and Read in one Pass, through one Statement per Table
+		// Every p_rows_per_transaction Rows are Committed, other Writers run in between
+		// As such Memory stays Flat however long the File is
+		//
+		// Rows older than RATE_LIFETIME are Expired as any other, and never Served until then
+		// The History is not Written, as its Series only go Forward in Time
+		// while Files such as eurofxref-hist.csv go Back
+		//
+		// nullopt if the File does not exist or is Empty
+		// Throws std::invalid_argument if it is Malformed
+		// Transactions Committed by then are not Undone
+		std::optional<ImportStatistics> ImportReferenceRates(
+			 const hstring&	  p_file_path,
+			 const hstring&	  p_base_code = ReferenceRateImport::BASE_CURRENCY,
+			 const std::size_t p_rows_per_transaction = ReferenceRateImport::ROWS_PER_TRANSACTION);
+
+		// Approximate, for Display only
+		// Arithmetic on Money should use GetConversionRate
 		IAsyncOperation<double> GetConvertedCurrencyValue(const hstring p_from_code,
 																		  const hstring p_to_code);
 
-		void DeleteAllCurrencyValuesOlderThanTime(const TimeSpan& p_time);
+		// Converts every Amount to every Target Currency
+		// Each Distinct Rate is Resolved once, all Lookups running Concurrently
+		// Network Queries go in the Background Lane, behind any the User Waits on
+		// The Matrix is then filled Exactly by Fixed Point Kernels
+		// Blocks until all Rates are Obtained, as such must not be called on the UI Thread
+		ConversionMatrix ConvertBatch(const std::vector<Money>&	p_amounts,
+												const hstring&					 p_from_code,
+												const std::vector<hstring>& p_to_codes);
+
+		// Deletes old Rows in Bounded Batches
+		// Each Batch runs in its own Short Transaction
+		// Rows left over once p_max_batches is hit are removed on the next call
+		// Archived Responses beyond those Kept are Deleted on the same Tick
+		// The first Tick may also Rewrite the whole File, see SetupDatabase
+		// as such it must not be called on the UI Thread
+		// Every Tick is also Published to Metrics::Registry::global(), as currency_expiry_*
+		ExpiryStatistics ExpireCurrencyValuesOlderThanTime(
+			 const TimeSpan& p_time,
+			 const int		  p_batch_size  = Expiry::BATCH_SIZE,
+			 const int		  p_max_batches = Expiry::MAX_BATCHES_PER_TICK);
+
+		ExpiryStatistics DeleteAllCurrencyValuesOlderThanTime(const TimeSpan& p_time);
+
+		// Every Rate ever Obtained for the Pair within [p_begin, p_end)
+		std::vector<Sample> GetRateHistory(const hstring&	p_from_code,
+													  const hstring&	p_to_code,
+													  const DateTime& p_begin,
+													  const DateTime& p_end);
+
+		// Open, High, Low and Close per p_interval within [p_begin, p_end)
+		std::vector<OHLC> GetRateHistoryOHLC(const hstring&	 p_from_code,
+														 const hstring&	 p_to_code,
+														 const DateTime& p_begin,
+														 const DateTime& p_end,
+														 const TimeSpan& p_interval);
+
+		// Writes out Samples Buffered in Memory
+		void FlushHistory();
+
+		// Queue Depths and Waits of Requests to the Primary Provider
+		RequestScheduler::Metrics GetUpstreamMetrics() const;
+
+		// Responses are Read back from it a Block at a time
+		ResponseArchive& GetResponseArchive() noexcept;
+
+		// Hit Ratios of GetHistoricalConversionRate, and what each Tier holds
+		HistoricalQuoteStatistics GetHistoricalQuoteStatistics();
+
+		// Registers every Statement the Converter Prepares on its Tables, by Name
+		// Benchmarks Checks the Plans SQLite Picks for them against a Baseline
+		static void RegisterStatements(QueryPlanGuard& p_guard);
+
+		// Copies the In Memory Database to Disk, p_max_steps Steps of a few Pages each
+		// Other Writers run in between Steps
+		// Returns true once the Disk Copy is Current, always so when ON_DISK
+		bool BackupDatabase(const int p_max_steps = DatabaseBackup::MAX_STEPS_PER_TICK);
+
+		// Completes the Backup regardless of its Size
+		// Meant for Suspension, after which the App may be Terminated
+		bool FlushDatabase();
 
 	 public:
-		CurrencyConverter();
+		explicit CurrencyConverter(
+			 const DatabaseMode	   p_database_mode = DatabaseMode::IN_MEMORY,
+			 const StorageFolders&  p_folders		   = StorageFolders::ForPackage(),
+			 const UpstreamService& p_upstream		   = UpstreamService::ForConverterAPI(),
+			 const HistoricalQuoteOptions& p_historical_quotes = HistoricalQuoteOptions{});
 	};
 } // namespace Currency
\ No newline at end of file
@@ -0,0 +1,69 @@
+// Includes the pch file
+// This is known to boost compilation speeds
+#include "pch.h"
+
+#include "CurrencyDelta.hxx"
+
+#include <TUESL/Utility/Hash.hxx>
+
+#include <string_view>
+#include <unordered_map>
+
+namespace Currency
+{
+	namespace
+	{
+		namespace Hash = TUESL::Utility::Hash;
+
+		// Each Field is Prefixed by its Length, as such no two Lists of Fields Hash alike
+		// merely by moving Characters from one Field to the next
+		std::uint64_t hashField(const hstring& p_field, const std::uint64_t p_seed) noexcept
+		{
+			const std::uint64_t length = std::size(p_field);
+
+			const auto hash = Hash::fnv1a64(&length, sizeof(length), p_seed);
+			return Hash::fnv1a64(std::wstring_view{p_field}, hash);
+		}
+	} // namespace
+
+	std::uint64_t FingerprintOf(const CurrencyEntry& p_entry) noexcept
+	{
+		auto fingerprint = Hash::FNV_OFFSET_BASIS;
+		fingerprint		  = hashField(p_entry.id, fingerprint);
+		fingerprint		  = hashField(p_entry.name, fingerprint);
+		fingerprint		  = hashField(p_entry.symbol, fingerprint);
+
+		return fingerprint == 0 ? 1 : fingerprint;
+	}
+
+	CurrencyDelta DiffCurrencies(const std::vector<CurrencyEntry>& p_upstream,
+										  const CurrencyFingerprints&		 p_stored)
+	{
+		// Position of the last Entry of each id
+		std::unordered_map<std::wstring_view, std::size_t> upstream;
+		upstream.reserve(std::size(p_upstream));
+		for (std::size_t i = 0; i < std::size(p_upstream); ++i)
+			upstream[std::wstring_view{p_upstream[i].id}] = i;
+
+		CurrencyDelta delta;
+
+		for (const auto& [id, index] : upstream)
+		{
+			const auto& entry	= p_upstream[index];
+			const auto	stored = p_stored.find(entry.id);
+
+			if (stored == std::end(p_stored))
+				delta.inserted.push_back(entry);
+			else if (stored->second.fingerprint != FingerprintOf(entry))
+				delta.updated.push_back(entry);
+		}
+
+		for (const auto& [id, stored] : p_stored)
+		{
+			if (upstream.find(std::wstring_view{id}) == std::end(upstream))
+				delta.deleted.push_back(id);
+		}
+
+		return delta;
+	}
+} // namespace Currency
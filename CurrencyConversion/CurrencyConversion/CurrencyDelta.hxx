@@ -0,0 +1,51 @@
+#pragma once
+
+// Finds what Changed between the Currency List the Service Returns and the one Stored
+//
+// Every Stored Currency is Remembered by its Fingerprint, a Hash of its id, Name and Symbol
+// As such the Upstream List is Diffed by Hashing each of its Entries once
+// and Comparing it to the Fingerprint of the same id, without Reading the Table
+// An Unchanged List gives an Empty Delta, and nothing is Written
+
+#include <winrt/Windows.Foundation.h>
+
+#include "CurrencySnapshot.hxx"
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+namespace Currency
+{
+	struct CurrencyFingerprint
+	{
+		std::uint64_t fingerprint = 0;
+		// Row of TABLE_CURRENCY_IDs the Currency is Held in
+		// Lets Deletions, which only carry the Row, be Matched to their Currency
+		std::int64_t rowid = 0;
+	};
+
+	// By id
+	using CurrencyFingerprints = std::map<hstring, CurrencyFingerprint>;
+
+	struct CurrencyDelta
+	{
+		std::vector<CurrencyEntry> inserted;
+		std::vector<CurrencyEntry> updated;
+		// ids of Stored Currencies the Service no longer Lists
+		std::vector<hstring> deleted;
+
+		bool empty() const noexcept
+		{
+			return std::empty(inserted) && std::empty(updated) && std::empty(deleted);
+		}
+	};
+
+	// Stable across Runs and Machines, as it is Stored
+	// Never 0, which Rows Written before there were Fingerprints hold
+	std::uint64_t FingerprintOf(const CurrencyEntry& p_entry) noexcept;
+
+	// Where an id is Listed more than once Upstream, the last Entry is Kept
+	CurrencyDelta DiffCurrencies(const std::vector<CurrencyEntry>& p_upstream,
+										  const CurrencyFingerprints&		 p_stored);
+} // namespace Currency
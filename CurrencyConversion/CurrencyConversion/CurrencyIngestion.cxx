@@ -0,0 +1,472 @@
+// Includes the pch file
+// This is known to boost compilation speeds
+#include "pch.h"
+
+#include "CurrencyIngestion.hxx"
+
+// Required for the Keys of each Currency
+#include "CurrencyConverter.hxx"
+
+#include <TUESL/Concurrency/BoundedQueue.hxx>
+#include <TUESL/Metrics/Registry.hxx>
+
+#include <winrt/Windows.Data.Json.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+namespace Currency
+{
+	namespace
+	{
+		using TUESL::Concurrency::BoundedQueue;
+
+		using TUESL::Metrics::Counter;
+		using TUESL::Metrics::Gauge;
+		using TUESL::Metrics::Histogram;
+
+		using Clock = std::chrono::steady_clock;
+
+		constexpr const std::wstring_view RESULTS_KEY = L"results";
+
+		// Members of the results Object, as Text, in the Order they came
+		using Chunk = std::wstring_view;
+
+		// Scans just enough JSON to find where each Value Ends
+		// The Values themselves are Checked once a Worker Parses them
+		class MemberScanner
+		{
+		 private:
+			std::wstring_view m_json;
+			std::size_t			m_index = 0;
+
+			[[noreturn]] static void malformed()
+			{
+				throw std::invalid_argument("Currency List is not a JSON Object with results");
+			}
+
+			wchar_t peek() const
+			{
+				if (m_index >= std::size(m_json))
+					malformed();
+				return m_json[m_index];
+			}
+			void expect(const wchar_t p_character)
+			{
+				if (peek() != p_character)
+					malformed();
+				++m_index;
+			}
+
+			// Returns the Text between the Quotes, Escapes are left as they are
+			std::wstring_view skipString()
+			{
+				expect(L'"');
+				const auto begin = m_index;
+				for (;;)
+				{
+					const auto character = peek();
+					++m_index;
+					if (character == L'\\')
+						++m_index;
+					else if (character == L'"')
+						return m_json.substr(begin, m_index - begin - 1);
+				}
+			}
+
+			void skipValue()
+			{
+				const auto character = peek();
+				if (character == L'"')
+				{
+					skipString();
+					return;
+				}
+				if (character != L'{' && character != L'[')
+				{
+					// Numbers, true, false and null run up to the next Delimiter
+					while (m_index < std::size(m_json) && m_json[m_index] != L',' &&
+							 m_json[m_index] != L'}' && m_json[m_index] != L']')
+						++m_index;
+					return;
+				}
+
+				std::size_t depth = 0;
+				do
+				{
+					const auto next = peek();
+					if (next == L'"')
+						skipString();
+					else
+					{
+						if (next == L'{' || next == L'[')
+							++depth;
+						else if (next == L'}' || next == L']')
+							--depth;
+						++m_index;
+					}
+				} while (depth != 0);
+			}
+
+		 public:
+			explicit MemberScanner(const std::wstring_view p_json) : m_json{p_json} {}
+
+			void skipWhitespace() noexcept
+			{
+				while (m_index < std::size(m_json) &&
+						 (m_json[m_index] == L' ' || m_json[m_index] == L'\t' ||
+						  m_json[m_index] == L'\n' || m_json[m_index] == L'\r'))
+					++m_index;
+			}
+
+			// Leaves the Scanner on the Opening Brace of the results Object
+			void findResults()
+			{
+				skipWhitespace();
+				expect(L'{');
+				for (;;)
+				{
+					skipWhitespace();
+					const auto key = skipString();
+					skipWhitespace();
+					expect(L':');
+					skipWhitespace();
+
+					if (key == RESULTS_KEY && peek() == L'{')
+						return;
+
+					skipValue();
+					skipWhitespace();
+					expect(L',');
+				}
+			}
+
+			// Calls p_chunk with up to p_members_per_chunk Members at a Time
+			// Stops early once p_chunk Returns false
+			template <typename Function>
+			void forEachChunk(const std::size_t p_members_per_chunk, Function p_chunk)
+			{
+				expect(L'{');
+				skipWhitespace();
+				if (peek() == L'}')
+					return;
+
+				auto		chunk_begin = m_index;
+				std::size_t members		= 0;
+				for (;;)
+				{
+					skipWhitespace();
+					skipString();
+					skipWhitespace();
+					expect(L':');
+					skipWhitespace();
+					skipValue();
+
+					const auto member_end = m_index;
+					skipWhitespace();
+
+					const auto is_last = peek() == L'}';
+					if (!is_last)
+						expect(L',');
+
+					if (++members == p_members_per_chunk || is_last)
+					{
+						if (!p_chunk(m_json.substr(chunk_begin, member_end - chunk_begin)))
+							return;
+						chunk_begin = m_index;
+						members		= 0;
+					}
+					if (is_last)
+						return;
+				}
+			}
+		};
+
+		CurrencyBatch ParseChunk(const Chunk p_chunk)
+		{
+			using winrt::Windows::Data::Json::JsonObject;
+
+			std::wstring text;
+			text.reserve(std::size(p_chunk) + 2);
+			text += L'{';
+			text += p_chunk;
+			text += L'}';
+
+			const auto members = JsonObject::Parse(text);
+
+			CurrencyBatch batch;
+			batch.reserve(members.Size());
+			for (const auto& member : members)
+			{
+				// Missing Keys give the Default, as such every Key is Looked up once
+				const auto obj = member.Value().GetObject();
+
+				CurrencyEntry entry;
+				entry.id		 = obj.GetNamedString(JsonKeys::CurrencyIDs::KEY_ID, L"");
+				entry.name	 = obj.GetNamedString(JsonKeys::CurrencyIDs::KEY_NAME, L"");
+				entry.symbol = obj.GetNamedString(JsonKeys::CurrencyIDs::KEY_SYMBOL, L"");
+				batch.push_back(std::move(entry));
+			}
+			return batch;
+		}
+
+		std::size_t WorkerCount(const IngestionOptions& p_options)
+		{
+			if (p_options.parse_workers != 0)
+				return p_options.parse_workers;
+
+			// One Thread Splits and another Writes
+			const std::size_t hardware_threads = std::thread::hardware_concurrency();
+			return hardware_threads > 3 ? hardware_threads - 2 : 1;
+		}
+
+		struct StageMetrics
+		{
+			Counter&	  items;
+			Histogram& seconds;
+		};
+		StageMetrics Stage(const char* p_stage)
+		{
+			auto& registry = TUESL::Metrics::Registry::global();
+			return {registry.counter("currency_ingest_items_total",
+											 "Chunks Split, Rows Parsed and Rows Written",
+											 {{"stage", p_stage}}),
+					  registry.histogram("currency_ingest_stage_seconds",
+											   "Time per Chunk, Batch or Transaction of a Stage",
+											   {{"stage", p_stage}})};
+		}
+		Gauge& QueueDepth(const char* p_queue)
+		{
+			return TUESL::Metrics::Registry::global().gauge("currency_ingest_queue_depth",
+																			"Values Waiting between Stages",
+																			{{"queue", p_queue}});
+		}
+
+		// Time of one Item of a Stage, into its Histogram and the Busy Time of the Stage
+		class StageTimer
+		{
+		 private:
+			Histogram&						 m_histogram;
+			std::atomic<std::uint64_t>& m_busy_nanoseconds;
+			const Clock::time_point		 m_start = Clock::now();
+
+		 public:
+			StageTimer(Histogram& p_histogram, std::atomic<std::uint64_t>& p_busy_nanoseconds) :
+				 m_histogram{p_histogram}, m_busy_nanoseconds{p_busy_nanoseconds}
+			{
+			}
+			~StageTimer()
+			{
+				const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+					 Clock::now() - m_start);
+				m_histogram.record(elapsed);
+				m_busy_nanoseconds.fetch_add(elapsed.count(), std::memory_order_relaxed);
+			}
+
+			StageTimer(const StageTimer&) = delete;
+			StageTimer& operator=(const StageTimer&) = delete;
+		};
+
+		template <typename T>
+		void RecordDepth(const BoundedQueue<T>&	  p_queue,
+							  Gauge&						  p_gauge,
+							  std::atomic<std::size_t>& p_max_depth)
+		{
+			const auto depth = p_queue.size();
+			p_gauge.set(static_cast<std::int64_t>(depth));
+
+			auto max_depth = p_max_depth.load(std::memory_order_relaxed);
+			while (depth > max_depth &&
+					 !p_max_depth.compare_exchange_weak(max_depth, depth, std::memory_order_relaxed))
+			{
+			}
+		}
+
+		double Seconds(const std::atomic<std::uint64_t>& p_nanoseconds)
+		{
+			return p_nanoseconds.load() / 1e9;
+		}
+	} // namespace
+
+	IngestionStatistics IngestCurrencyIDs(const std::wstring_view p_json,
+													  const IngestionOptions& p_options,
+													  const CommitBatches&	  p_commit)
+	{
+		if (p_options.members_per_chunk == 0 || p_options.rows_per_transaction == 0)
+			throw std::invalid_argument("Chunks and Transactions must hold at least one Row");
+
+		static const auto split = Stage("split");
+		static const auto parse = Stage("parse");
+		static const auto write = Stage("write");
+		static auto&		chunk_depth = QueueDepth("chunks");
+		static auto&		batch_depth = QueueDepth("batches");
+
+		BoundedQueue<Chunk>			 chunks{p_options.queue_capacity};
+		BoundedQueue<CurrencyBatch> batches{p_options.queue_capacity};
+
+		std::atomic<std::uint64_t> split_nanoseconds{0};
+		std::atomic<std::uint64_t> parse_nanoseconds{0};
+		std::atomic<std::uint64_t> write_nanoseconds{0};
+		std::atomic<std::size_t>	max_chunks_queued{0};
+		std::atomic<std::size_t>	max_batches_queued{0};
+
+		// The first Error Stops every Stage, the rest are Consequences of it
+		std::mutex			 error_mutex;
+		std::exception_ptr error;
+		std::atomic<bool>	 has_failed{false};
+		const auto			 fail = [&](std::exception_ptr p_error) {
+			 {
+				 std::lock_guard<std::mutex> lock{error_mutex};
+				 if (!error)
+					 error = std::move(p_error);
+			 }
+			 has_failed.store(true);
+			 chunks.close();
+			 batches.close();
+		};
+
+		IngestionStatistics statistics;
+		const auto			  start = Clock::now();
+
+		// Threads call into WinRT, as such each Joins the Multi Threaded Apartment
+		const auto start_thread = [](auto p_function) {
+			return std::thread{[p_function]() {
+				winrt::init_apartment();
+				p_function();
+				winrt::uninit_apartment();
+			}};
+		};
+
+		std::thread writer = start_thread([&] {
+			try
+			{
+				std::vector<CurrencyBatch> transaction;
+				std::size_t					rows = 0;
+
+				const auto commit = [&] {
+					StageTimer timer{write.seconds, write_nanoseconds};
+					p_commit(transaction);
+
+					write.items.increment(rows);
+					statistics.rows += rows;
+					++statistics.transactions;
+
+					transaction.clear();
+					rows = 0;
+				};
+
+				while (auto batch = batches.pop())
+				{
+					RecordDepth(batches, batch_depth, max_batches_queued);
+
+					rows += std::size(batch.value());
+					transaction.push_back(std::move(batch.value()));
+					if (rows >= p_options.rows_per_transaction)
+						commit();
+				}
+
+				// Nothing more is Written once any Stage has Failed
+				if (!has_failed.load() && !std::empty(transaction))
+					commit();
+			}
+			catch (...)
+			{
+				fail(std::current_exception());
+			}
+		});
+
+		// The last Worker to Finish tells the Writer there is nothing more
+		const auto					worker_count = WorkerCount(p_options);
+		std::atomic<std::size_t> running_workers{worker_count};
+
+		std::vector<std::thread> workers;
+		for (std::size_t i = 0; i < worker_count; ++i)
+		{
+			workers.push_back(start_thread([&] {
+				try
+				{
+					while (auto chunk = chunks.pop())
+					{
+						RecordDepth(chunks, chunk_depth, max_chunks_queued);
+						if (has_failed.load())
+							break;
+
+						CurrencyBatch batch;
+						{
+							StageTimer timer{parse.seconds, parse_nanoseconds};
+							batch = ParseChunk(chunk.value());
+						}
+						parse.items.increment(std::size(batch));
+
+						if (!batches.push(std::move(batch)))
+							break;
+						RecordDepth(batches, batch_depth, max_batches_queued);
+					}
+				}
+				catch (...)
+				{
+					fail(std::current_exception());
+				}
+
+				if (running_workers.fetch_sub(1) == 1)
+					batches.close();
+			}));
+		}
+
+		try
+		{
+			MemberScanner scanner{p_json};
+			scanner.findResults();
+
+			// Each Chunk is Timed from the End of the one before
+			// as such the Time Waiting on a Full Queue is not Counted
+			auto chunk_start = Clock::now();
+			scanner.forEachChunk(p_options.members_per_chunk, [&](const Chunk p_chunk) {
+				const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+					 Clock::now() - chunk_start);
+				split.seconds.record(elapsed);
+				split_nanoseconds.fetch_add(elapsed.count(), std::memory_order_relaxed);
+				split.items.increment();
+				++statistics.chunks;
+
+				if (!chunks.push(p_chunk))
+					return false;
+				RecordDepth(chunks, chunk_depth, max_chunks_queued);
+
+				chunk_start = Clock::now();
+				return true;
+			});
+		}
+		catch (...)
+		{
+			fail(std::current_exception());
+		}
+		chunks.close();
+
+		for (auto& worker : workers)
+			worker.join();
+		writer.join();
+
+		chunk_depth.set(0);
+		batch_depth.set(0);
+
+		if (error)
+			std::rethrow_exception(error);
+
+		statistics.split_seconds		= Seconds(split_nanoseconds);
+		statistics.parse_seconds		= Seconds(parse_nanoseconds);
+		statistics.write_seconds		= Seconds(write_nanoseconds);
+		statistics.total_seconds =
+			 std::chrono::duration<double>(Clock::now() - start).count();
+		statistics.max_chunks_queued	= max_chunks_queued.load();
+		statistics.max_batches_queued = max_batches_queued.load();
+		return statistics;
+	}
+} // namespace Currency
@@ -0,0 +1,71 @@
+#pragma once
+
+// Loads the Currency List the Service Returns in Stages which run at once
+//
+//	split	The results Object is Cut into Chunks of Members, on the Calling Thread
+//	parse	Each Chunk is Parsed by one of a Pool of Workers into a Batch of Entries
+//	write	One Writer Thread Hands the Batches on, many to a Transaction
+//
+// Stages Hand over through Bounded Queues
+// A Stage which Falls behind makes those before it Wait, as such Memory stays Bounded
+// however large the Payload, and SQLite is only ever Written from one Thread
+//
+// Every Stage Counts what it has Done and how long it took, and each Queue how full it is
+//	currency_ingest_items_total{stage}
+//	currency_ingest_stage_seconds{stage}
+//	currency_ingest_queue_depth{queue}
+
+#include <winrt/Windows.Foundation.h>
+
+#include "CurrencySnapshot.hxx"
+
+#include <cstddef>
+#include <functional>
+#include <string_view>
+#include <vector>
+
+namespace Currency
+{
+	struct IngestionOptions
+	{
+		// 0 is every Hardware Thread less the ones Splitting and Writing, at least one
+		std::size_t parse_workers = 0;
+		// Members of the results Object Parsed at once
+		std::size_t members_per_chunk = 64;
+		// Chunks and Batches each Queue holds before its Producers Wait
+		std::size_t queue_capacity = 16;
+		// Rows Handed to the Writer at once, as one Transaction
+		std::size_t rows_per_transaction = 4096;
+	};
+
+	struct IngestionStatistics
+	{
+		std::size_t chunks		 = 0;
+		std::size_t rows			 = 0;
+		std::size_t transactions = 0;
+
+		// Time each Stage was Busy, Summed over its Threads
+		double split_seconds = 0.0;
+		double parse_seconds = 0.0;
+		double write_seconds = 0.0;
+		// From the first Chunk to the last Commit
+		double total_seconds = 0.0;
+
+		// Most Values Queued at once
+		std::size_t max_chunks_queued  = 0;
+		std::size_t max_batches_queued = 0;
+	};
+
+	using CurrencyBatch = std::vector<CurrencyEntry>;
+
+	// Called on the Writer Thread, with every Batch of one Transaction
+	using CommitBatches = std::function<void(const std::vector<CurrencyBatch>&)>;
+
+	// p_json as the Service Returns it, {"results":{"USD":{"id":"USD",...},...}}
+	// Throws std::invalid_argument if it has no results Object or is Malformed
+	// Anything p_commit or the Parser Throws is Rethrown once every Thread has Stopped
+	// Transactions Committed by then are not Undone
+	IngestionStatistics IngestCurrencyIDs(const std::wstring_view p_json,
+													  const IngestionOptions& p_options,
+													  const CommitBatches&	  p_commit);
+} // namespace Currency
@@ -0,0 +1,307 @@
+// Includes the pch file
+// This is known to boost compilation speeds
+#include "pch.h"
+
+#include "CurrencySnapshot.hxx"
+
+#include <TUESL/Utility/Hash.hxx>
+#include <TUESL/Utility/MemoryMappedFile.hxx>
+
+#include <cstring>
+#include <fstream>
+#include <string>
+
+namespace Currency
+{
+	namespace
+	{
+		using TUESL::Utility::MemoryMappedFile;
+
+		// On Disk Layout
+		// Header | CurrencyRecord[] | RateRecord[] | PairRecord[] | UTF-16 String Pool
+		// Every Section is a Multiple of 8 Bytes, except the Pool which comes last
+		namespace Format
+		{
+			constexpr const char			 MAGIC[8] = {'C', 'C', 'S', 'N', 'A', 'P', '\0', '\0'};
+			// Version 2 stores Rates as Integer Units of Rate::SCALE
+			constexpr const std::uint32_t VERSION  = 2;
+
+			// Guards against Absurd Counts in a Corrupt Header
+			constexpr const std::uint32_t MAX_RECORDS = 1u << 20;
+
+			struct Header
+			{
+				char			  magic[8];
+				std::uint32_t version;
+				std::uint32_t currency_count;
+				std::uint32_t rate_count;
+				std::uint32_t recent_count;
+				// Number of UTF-16 Code Units within the Pool
+				std::uint64_t string_units;
+				// FNV-1a of everything following the Header
+				std::uint64_t checksum;
+			};
+			struct CurrencyRecord
+			{
+				std::uint32_t id_offset;
+				std::uint32_t id_length;
+				std::uint32_t name_offset;
+				std::uint32_t name_length;
+				std::uint32_t symbol_offset;
+				std::uint32_t symbol_length;
+			};
+			struct RateRecord
+			{
+				std::uint32_t from_index;
+				std::uint32_t to_index;
+				std::int64_t  rate_units;
+				std::int64_t  time;
+			};
+			struct PairRecord
+			{
+				std::uint32_t from_index;
+				std::uint32_t to_index;
+			};
+
+			static_assert(sizeof(Header) % 8 == 0, "Header must keep Records Aligned");
+			static_assert(sizeof(CurrencyRecord) % 8 == 0, "Records must stay Aligned");
+			static_assert(sizeof(RateRecord) % 8 == 0, "Records must stay Aligned");
+			static_assert(sizeof(PairRecord) % 8 == 0, "Records must stay Aligned");
+		} // namespace Format
+
+		template <typename Record>
+		Record readRecord(const std::byte* p_position) noexcept
+		{
+			// memcpy rather than reinterpret_cast
+			// As the View is Untrusted Data
+			Record record;
+			std::memcpy(&record, p_position, sizeof(Record));
+			return record;
+		}
+
+		template <typename Record>
+		void appendRecord(std::vector<std::byte>& p_buffer, const Record& p_record)
+		{
+			const auto* bytes = reinterpret_cast<const std::byte*>(&p_record);
+			p_buffer.insert(std::end(p_buffer), bytes, bytes + sizeof(Record));
+		}
+	} // namespace
+
+	std::optional<CurrencySnapshot>
+		 CurrencySnapshot::Load(const std::wstring_view p_file_name,
+									  const std::int64_t		 p_oldest_time)
+	{
+		MemoryMappedFile file;
+		if (!file.open(p_file_name))
+			return std::nullopt;
+
+		const std::byte*	base = file.data();
+		const std::size_t size = file.size();
+
+		if (size < sizeof(Format::Header))
+			return std::nullopt;
+
+		const auto header = readRecord<Format::Header>(base);
+
+		if (std::memcmp(header.magic, Format::MAGIC, sizeof(Format::MAGIC)) != 0 ||
+			 header.version != Format::VERSION)
+			return std::nullopt;
+
+		if (header.currency_count > Format::MAX_RECORDS ||
+			 header.rate_count > Format::MAX_RECORDS ||
+			 header.recent_count > Format::MAX_RECORDS ||
+			 header.string_units > Format::MAX_RECORDS * 64ull)
+			return std::nullopt;
+
+		const std::size_t currencies_at = sizeof(Format::Header);
+		const std::size_t rates_at =
+			 currencies_at + header.currency_count * sizeof(Format::CurrencyRecord);
+		const std::size_t recent_at =
+			 rates_at + header.rate_count * sizeof(Format::RateRecord);
+		const std::size_t pool_at =
+			 recent_at + header.recent_count * sizeof(Format::PairRecord);
+		const std::size_t expected_size =
+			 pool_at + static_cast<std::size_t>(header.string_units) * sizeof(char16_t);
+
+		// Truncated or Padded Files are both Rejected
+		if (size != expected_size)
+			return std::nullopt;
+
+		const auto checksum = TUESL::Utility::Hash::fnv1a64(
+			 base + sizeof(Format::Header), size - sizeof(Format::Header));
+		if (checksum != header.checksum)
+			return std::nullopt;
+
+		const auto* pool = reinterpret_cast<const wchar_t*>(base + pool_at);
+
+		const auto read_string = [&](const std::uint32_t p_offset,
+											  const std::uint32_t p_length) -> std::optional<hstring> {
+			if (static_cast<std::uint64_t>(p_offset) + p_length > header.string_units)
+				return std::nullopt;
+			return hstring{std::wstring_view{pool + p_offset, p_length}};
+		};
+
+		CurrencySnapshot snapshot;
+		snapshot.currencies.reserve(header.currency_count);
+
+		for (std::uint32_t i = 0; i < header.currency_count; ++i)
+		{
+			const auto record = readRecord<Format::CurrencyRecord>(
+				 base + currencies_at + i * sizeof(Format::CurrencyRecord));
+
+			auto id		= read_string(record.id_offset, record.id_length);
+			auto name	= read_string(record.name_offset, record.name_length);
+			auto symbol = read_string(record.symbol_offset, record.symbol_length);
+
+			if (!id.has_value() || !name.has_value() || !symbol.has_value())
+				return std::nullopt;
+
+			snapshot.currencies.push_back(
+				 CurrencyEntry{std::move(*id), std::move(*name), std::move(*symbol)});
+		}
+
+		const auto is_valid_pair = [&](const std::uint32_t p_from_index,
+												 const std::uint32_t p_to_index) {
+			return p_from_index < header.currency_count && p_to_index < header.currency_count;
+		};
+
+		for (std::uint32_t i = 0; i < header.rate_count; ++i)
+		{
+			const auto record =
+				 readRecord<Format::RateRecord>(base + rates_at + i * sizeof(Format::RateRecord));
+
+			if (!is_valid_pair(record.from_index, record.to_index) || record.rate_units < 0)
+				return std::nullopt;
+
+			// Do not bring back Rates which Expiry would have Deleted
+			if (record.time < p_oldest_time)
+				continue;
+
+			snapshot.rates.emplace(
+				 CurrencyPair{snapshot.currencies[record.from_index].id,
+								  snapshot.currencies[record.to_index].id},
+				 CachedRate{Rate{record.rate_units}, record.time});
+		}
+
+		snapshot.recent_pairs.reserve(header.recent_count);
+		for (std::uint32_t i = 0; i < header.recent_count; ++i)
+		{
+			const auto record =
+				 readRecord<Format::PairRecord>(base + recent_at + i * sizeof(Format::PairRecord));
+
+			if (!is_valid_pair(record.from_index, record.to_index))
+				return std::nullopt;
+
+			snapshot.recent_pairs.push_back(
+				 CurrencyPair{snapshot.currencies[record.from_index].id,
+								  snapshot.currencies[record.to_index].id});
+		}
+
+		return snapshot;
+	}
+
+	bool CurrencySnapshot::Save(const std::wstring_view p_file_name) const
+	{
+		// Rates and Pairs refer to Currencies by their Index within the Table
+		std::map<hstring, std::uint32_t> index_of_id;
+		for (std::uint32_t i = 0; i < static_cast<std::uint32_t>(std::size(currencies)); ++i)
+			index_of_id.emplace(currencies[i].id, i);
+
+		const auto find_pair =
+			 [&](const CurrencyPair& p_pair) -> std::optional<Format::PairRecord> {
+			const auto from = index_of_id.find(p_pair.from_code);
+			const auto to	 = index_of_id.find(p_pair.to_code);
+
+			if (from == std::end(index_of_id) || to == std::end(index_of_id))
+				return std::nullopt;
+			return Format::PairRecord{from->second, to->second};
+		};
+
+		std::vector<wchar_t> pool;
+		const auto			 add_string = [&](const hstring& p_text) {
+			 const auto offset = static_cast<std::uint32_t>(std::size(pool));
+			 pool.insert(std::end(pool), std::begin(p_text), std::end(p_text));
+			 return std::make_pair(offset, static_cast<std::uint32_t>(std::size(p_text)));
+		};
+
+		std::vector<Format::CurrencyRecord> currency_records;
+		currency_records.reserve(std::size(currencies));
+		for (const auto& currency : currencies)
+		{
+			const auto [id_offset, id_length]			= add_string(currency.id);
+			const auto [name_offset, name_length]		= add_string(currency.name);
+			const auto [symbol_offset, symbol_length] = add_string(currency.symbol);
+
+			currency_records.push_back(Format::CurrencyRecord{
+				 id_offset, id_length, name_offset, name_length, symbol_offset, symbol_length});
+		}
+
+		std::vector<Format::RateRecord> rate_records;
+		rate_records.reserve(std::size(rates));
+		for (const auto& [pair, cached_rate] : rates)
+		{
+			// Rates for Currencies no longer in the Table are Dropped
+			if (const auto record = find_pair(pair); record.has_value())
+				rate_records.push_back(Format::RateRecord{record->from_index,
+																		record->to_index,
+																		cached_rate.rate.units,
+																		cached_rate.time});
+		}
+
+		std::vector<Format::PairRecord> pair_records;
+		pair_records.reserve(std::size(recent_pairs));
+		for (const auto& pair : recent_pairs)
+		{
+			if (const auto record = find_pair(pair); record.has_value())
+				pair_records.push_back(*record);
+		}
+
+		std::vector<std::byte> payload;
+		payload.reserve(std::size(currency_records) * sizeof(Format::CurrencyRecord) +
+							 std::size(rate_records) * sizeof(Format::RateRecord) +
+							 std::size(pair_records) * sizeof(Format::PairRecord) +
+							 std::size(pool) * sizeof(wchar_t));
+
+		for (const auto& record : currency_records)
+			appendRecord(payload, record);
+		for (const auto& record : rate_records)
+			appendRecord(payload, record);
+		for (const auto& record : pair_records)
+			appendRecord(payload, record);
+
+		const auto* pool_bytes = reinterpret_cast<const std::byte*>(std::data(pool));
+		payload.insert(
+			 std::end(payload), pool_bytes, pool_bytes + std::size(pool) * sizeof(wchar_t));
+
+		Format::Header header{};
+		std::memcpy(header.magic, Format::MAGIC, sizeof(Format::MAGIC));
+		header.version			= Format::VERSION;
+		header.currency_count = static_cast<std::uint32_t>(std::size(currency_records));
+		header.rate_count		= static_cast<std::uint32_t>(std::size(rate_records));
+		header.recent_count	= static_cast<std::uint32_t>(std::size(pair_records));
+		header.string_units	= std::size(pool);
+		header.checksum =
+			 TUESL::Utility::Hash::fnv1a64(std::data(payload), std::size(payload));
+
+		const std::wstring file_name{p_file_name};
+		const std::wstring temp_file_name = file_name + L".tmp";
+
+		{
+			std::ofstream stream{temp_file_name, std::ios::binary | std::ios::trunc};
+			if (!stream)
+				return false;
+
+			stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+			stream.write(reinterpret_cast<const char*>(std::data(payload)),
+							 static_cast<std::streamsize>(std::size(payload)));
+
+			if (!stream)
+				return false;
+		}
+
+		// Replace the old Snapshot only once the new one is Complete
+		return MoveFileExW(temp_file_name.c_str(),
+								 file_name.c_str(),
+								 MOVEFILE_REPLACE_EXISTING) != FALSE;
+	}
+} // namespace Currency
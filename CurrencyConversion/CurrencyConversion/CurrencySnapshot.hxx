@@ -0,0 +1,83 @@
+#pragma once
+
+// Compact Binary Snapshot of the Warm State of the CurrencyConverter
+// Written when the App Suspends and Memory Mapped back at Startup
+// This allows the App to be Warm before the first Keystroke
+// Without a COUNT(*), an ORDER BY or a Network Query
+
+#include <winrt/Windows.Foundation.h>
+
+#include <TUESL/Numeric/FixedPoint.hxx>
+
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace Currency
+{
+	namespace
+	{
+		using winrt::hstring;
+
+		using TUESL::Numeric::Rate;
+	} // namespace
+
+	struct CurrencyEntry
+	{
+		hstring id;
+		hstring name;
+		hstring symbol;
+	};
+
+	struct CurrencyPair
+	{
+		hstring from_code;
+		hstring to_code;
+
+		bool operator<(const CurrencyPair& p_other) const noexcept
+		{
+			if (from_code != p_other.from_code)
+				return from_code < p_other.from_code;
+			return to_code < p_other.to_code;
+		}
+		bool operator==(const CurrencyPair& p_other) const noexcept
+		{
+			return from_code == p_other.from_code && to_code == p_other.to_code;
+		}
+	};
+
+	struct CachedRate
+	{
+		Rate rate{};
+		// Stored in the same Units as the Time Column
+		// Ticks since the Epoch
+		std::int64_t time = 0;
+		// Row of TABLE_CURRENCY_VALUES the Rate is Held in
+		// Lets Deletions be Matched to the Rate, 0 if not Known
+		// Not Saved, as the Snapshot may outlive the Rows
+		std::int64_t rowid = 0;
+	};
+
+	struct CurrencySnapshot
+	{
+		// Sorted By Name
+		// This is the order in which they are Displayed
+		std::vector<CurrencyEntry> currencies;
+
+		std::map<CurrencyPair, CachedRate> rates;
+
+		// Most Recently Used First
+		std::vector<CurrencyPair> recent_pairs;
+
+		// Returns nullopt if the Snapshot is Absent, Truncated or Corrupt
+		// Rates older than p_oldest_time are Dropped on Load
+		static std::optional<CurrencySnapshot> Load(const std::wstring_view p_file_name,
+																  const std::int64_t		 p_oldest_time);
+
+		// Writes to a Temporary File first and then Replaces the old Snapshot
+		// This way a Crash during Write never leaves a Half Written Snapshot
+		bool Save(const std::wstring_view p_file_name) const;
+	};
+} // namespace Currency
@@ -0,0 +1,557 @@
+// Includes the pch file
+// This is known to boost compilation speeds
+#include "pch.h"
+
+#include "HedgedUpstream.hxx"
+
+#include <winrt/Windows.Data.Json.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+namespace Currency
+{
+	namespace
+	{
+		using winrt::Windows::Data::Json::JsonObject;
+		using winrt::Windows::Data::Json::JsonValueType;
+		using winrt::Windows::Foundation::AsyncStatus;
+		using winrt::Windows::Foundation::TimeSpan;
+		using winrt::Windows::System::Threading::ThreadPoolTimer;
+
+		using TUESL::Net::RequestCancellation;
+		using TUESL::Numeric::Rate;
+
+		namespace ConverterAPI
+		{
+			constexpr const auto PATH_CURRENCY_IDs = L"currencies";
+
+			// Example URI For Conversion
+			// https://free.currencyconverterapi.com/api/v6/convert?q={from}_{to}&compact=ultra
+			constexpr const auto PATH_CURRENCY_AMTs = L"convert?compact=ultra&q=";
+			// Of a past Day, Appended to the above
+			constexpr const auto QUERY_DATE = L"&date=";
+		} // namespace ConverterAPI
+		namespace RatesByBaseAPI
+		{
+			// Example URI For Conversion
+			// https://api.frankfurter.app/latest?base={from}&symbols={to}
+			constexpr const auto PATH_LATEST	 = L"latest?base=";
+			constexpr const auto QUERY_SYMBOLS = L"&symbols=";
+			// Of a past Day, the Day takes the Place of latest
+			constexpr const auto QUERY_BASE = L"?base=";
+		} // namespace RatesByBaseAPI
+
+		// 0 is the Error Value of a Rate, as such no Valid Answer
+		std::optional<Rate> validRate(const double p_value) noexcept
+		{
+			const auto rate = Rate::fromDouble(p_value);
+			if (!rate.has_value() || rate->units == 0)
+				return std::nullopt;
+			return rate;
+		}
+
+		std::optional<Rate> parseConverterAPIRate(const hstring& p_json,
+																const hstring& p_from_code,
+																const hstring& p_to_code)
+		{
+			// Note that data is in the form
+			// {"USD_INR" : 45}
+			JsonObject json_obj{nullptr};
+			if (!JsonObject::TryParse(p_json, json_obj))
+				return std::nullopt;
+
+			const hstring code_from_to_concatenated = p_from_code + L"_" + p_to_code;
+			if (!json_obj.HasKey(code_from_to_concatenated))
+				return std::nullopt;
+
+			const auto value = json_obj.GetNamedValue(code_from_to_concatenated);
+			if (value.ValueType() != JsonValueType::Number)
+				return std::nullopt;
+
+			// The Service Quotes at most 6 Decimals, as such Rounding to 9 is Exact
+			return validRate(value.GetNumber());
+		}
+
+		std::optional<Rate> parseConverterAPIHistoricalRate(const hstring& p_json,
+																			 const hstring& p_from_code,
+																			 const hstring& p_to_code,
+																			 const hstring& p_day)
+		{
+			// Note that data is in the form
+			// {"USD_INR" : {"2024-01-05" : 45}}
+			JsonObject json_obj{nullptr};
+			if (!JsonObject::TryParse(p_json, json_obj))
+				return std::nullopt;
+
+			const hstring code_from_to_concatenated = p_from_code + L"_" + p_to_code;
+			if (!json_obj.HasKey(code_from_to_concatenated))
+				return std::nullopt;
+
+			const auto value = json_obj.GetNamedValue(code_from_to_concatenated);
+			if (value.ValueType() != JsonValueType::Object)
+				return std::nullopt;
+
+			const auto days = value.GetObject();
+			if (!days.HasKey(p_day) ||
+				 days.GetNamedValue(p_day).ValueType() != JsonValueType::Number)
+				return std::nullopt;
+
+			return validRate(days.GetNamedNumber(p_day));
+		}
+
+		std::optional<Rate> parseRatesByBase(const hstring& p_json,
+														 const hstring& p_from_code,
+														 const hstring& p_to_code)
+		{
+			// {"base" : "USD", "rates" : {"INR" : 45}}
+			JsonObject json_obj{nullptr};
+			if (!JsonObject::TryParse(p_json, json_obj))
+				return std::nullopt;
+
+			// A Quote against another Base is not the Rate asked for
+			if (!json_obj.HasKey(L"base") || !json_obj.HasKey(L"rates") ||
+				 json_obj.GetNamedValue(L"base").ValueType() != JsonValueType::String ||
+				 json_obj.GetNamedString(L"base") != p_from_code ||
+				 json_obj.GetNamedValue(L"rates").ValueType() != JsonValueType::Object)
+				return std::nullopt;
+
+			const auto rates = json_obj.GetNamedObject(L"rates");
+			if (!rates.HasKey(p_to_code) ||
+				 rates.GetNamedValue(p_to_code).ValueType() != JsonValueType::Number)
+				return std::nullopt;
+
+			return validRate(rates.GetNamedNumber(p_to_code));
+		}
+	} // namespace
+
+	struct HedgedUpstream::Race
+	{
+		struct Attempt
+		{
+			std::shared_ptr<RequestCancellation> cancellation;
+			std::chrono::steady_clock::time_point asked_at;
+			bool											  is_open = false;
+		};
+
+		hstring	from_code;
+		hstring	to_code;
+		Priority priority = Priority::INTERACTIVE;
+		// A YYYY-MM-DD for a past Day, otherwise the Latest Rate
+		std::optional<hstring> day;
+		// Indices of m_providers, in the Order they are Asked
+		std::vector<std::size_t> providers;
+
+		std::mutex mutex;
+		// One per Provider of the Race
+		std::vector<Attempt> attempts;
+		std::size_t				next			= 0;
+		bool						is_settled	= false;
+		std::int64_t			units			= 0;
+		ThreadPoolTimer		hedge_timer = nullptr;
+		// The Lookup, once it Waits on the Race
+		std::experimental::coroutine_handle<> waiter;
+	};
+
+	// Suspends the Lookup until the Race is Settled
+	// It is Resumed on the Thread that Settled it
+	struct HedgedUpstream::SettledAwaiter
+	{
+		std::shared_ptr<Race> race;
+
+		bool await_ready() const noexcept
+		{
+			return false;
+		}
+		bool await_suspend(std::experimental::coroutine_handle<> p_handle)
+		{
+			// May have been Settled before the Lookup came to Wait, if every Provider Failed
+			std::lock_guard<std::mutex> lock{race->mutex};
+			if (race->is_settled)
+				return false;
+
+			race->waiter = p_handle;
+			return true;
+		}
+		std::int64_t await_resume() const
+		{
+			std::lock_guard<std::mutex> lock{race->mutex};
+			return race->units;
+		}
+	};
+
+	UpstreamProvider UpstreamProvider::ForConverterAPI(std::string							 p_name,
+																		hstring								 p_root_url,
+																		const RequestScheduler::Options& p_budget)
+	{
+		UpstreamProvider provider;
+		provider.name				  = std::move(p_name);
+		provider.root_url			  = std::move(p_root_url);
+		provider.currencies_path  = ConverterAPI::PATH_CURRENCY_IDs;
+		provider.budget			  = p_budget;
+		provider.rate_url =
+			 [](const hstring& p_root_url, const hstring& p_from_code, const hstring& p_to_code) {
+				 return p_root_url + ConverterAPI::PATH_CURRENCY_AMTs + p_from_code + L"_" +
+						  p_to_code;
+			 };
+		provider.parse_rate = parseConverterAPIRate;
+		provider.historical_rate_url = [](const hstring& p_root_url,
+													 const hstring& p_from_code,
+													 const hstring& p_to_code,
+													 const hstring& p_day) {
+			return p_root_url + ConverterAPI::PATH_CURRENCY_AMTs + p_from_code + L"_" + p_to_code +
+					 ConverterAPI::QUERY_DATE + p_day;
+		};
+		provider.parse_historical_rate = parseConverterAPIHistoricalRate;
+		return provider;
+	}
+	UpstreamProvider UpstreamProvider::ForRatesByBase(std::string							p_name,
+																	  hstring								p_root_url,
+																	  const RequestScheduler::Options& p_budget)
+	{
+		UpstreamProvider provider;
+		provider.name		 = std::move(p_name);
+		provider.root_url	 = std::move(p_root_url);
+		provider.budget	 = p_budget;
+		provider.rate_url =
+			 [](const hstring& p_root_url, const hstring& p_from_code, const hstring& p_to_code) {
+				 return p_root_url + RatesByBaseAPI::PATH_LATEST + p_from_code +
+						  RatesByBaseAPI::QUERY_SYMBOLS + p_to_code;
+			 };
+		provider.parse_rate = parseRatesByBase;
+		provider.historical_rate_url = [](const hstring& p_root_url,
+													 const hstring& p_from_code,
+													 const hstring& p_to_code,
+													 const hstring& p_day) {
+			return p_root_url + p_day + RatesByBaseAPI::QUERY_BASE + p_from_code +
+					 RatesByBaseAPI::QUERY_SYMBOLS + p_to_code;
+		};
+		// Days without Rates, such as Weekends, are Answered with the Day before
+		// As such the Day Quoted is not Checked, it is the Rate in Force on p_day
+		provider.parse_historical_rate = [](const hstring& p_json,
+														 const hstring& p_from_code,
+														 const hstring& p_to_code,
+														 const hstring&) {
+			return parseRatesByBase(p_json, p_from_code, p_to_code);
+		};
+		return provider;
+	}
+
+	HedgedUpstream::Provider::Provider(UpstreamProvider			  p_config,
+												  const std::size_t			  p_window,
+												  TUESL::Metrics::Registry& p_metrics) :
+		 config{std::move(p_config)},
+		 client{config.budget, p_metrics},
+		 latency{p_window},
+		 won{p_metrics.counter("currency_upstream_answers_total",
+									  "Answers of each Rate Provider",
+									  {{"provider", config.name}, {"outcome", "won"}})},
+		 cancelled{p_metrics.counter("currency_upstream_answers_total",
+											  "Answers of each Rate Provider",
+											  {{"provider", config.name}, {"outcome", "cancelled"}})},
+		 invalid{p_metrics.counter("currency_upstream_answers_total",
+											"Answers of each Rate Provider",
+											{{"provider", config.name}, {"outcome", "invalid"}})},
+		 failed{p_metrics.counter("currency_upstream_answers_total",
+										  "Answers of each Rate Provider",
+										  {{"provider", config.name}, {"outcome", "failed"}})},
+		 hedges{p_metrics.counter("currency_upstream_hedges_total",
+										  "Requests Fired to a Rate Provider as a Hedge",
+										  {{"provider", config.name}})}
+	{
+	}
+
+	HedgedUpstream::HedgedUpstream(std::vector<UpstreamProvider> p_providers,
+											 const HedgeOptions&				 p_options,
+											 TUESL::Metrics::Registry&		 p_metrics) :
+		 m_options{p_options}
+	{
+		if (std::empty(p_providers))
+			throw std::invalid_argument("Rates need at least one Provider");
+
+		for (auto& provider : p_providers)
+		{
+			if (!provider.rate_url || !provider.parse_rate)
+				throw std::invalid_argument("Provider " + provider.name + " is missing an Adapter");
+
+			m_providers.push_back(
+				 std::make_unique<Provider>(std::move(provider), m_options.window, p_metrics));
+		}
+	}
+
+	HedgedUpstream::~HedgedUpstream()
+	{
+		std::unique_lock<std::mutex> lock{m_open_callbacks_mutex};
+		m_open_callbacks_done.wait(lock, [this] { return m_open_callbacks == 0; });
+	}
+	void HedgedUpstream::Retain()
+	{
+		std::lock_guard<std::mutex> lock{m_open_callbacks_mutex};
+		++m_open_callbacks;
+	}
+	void HedgedUpstream::Release()
+	{
+		// Notified under the Lock, as the Destructor may Return as soon as it is Released
+		std::lock_guard<std::mutex> lock{m_open_callbacks_mutex};
+		if (--m_open_callbacks == 0)
+			m_open_callbacks_done.notify_all();
+	}
+
+	void HedgedUpstream::SetUserAgent(const std::wstring_view p_user_agent)
+	{
+		for (auto& provider : m_providers)
+			provider->client.setUserAgent(p_user_agent);
+	}
+	void HedgedUpstream::AddHeader(const std::wstring_view p_key,
+											 const std::wstring_view p_value)
+	{
+		for (auto& provider : m_providers)
+			provider->client.addHeader(p_key, p_value);
+	}
+	void HedgedUpstream::SetResponseObserver(
+		 const TUESL::Net::WebClient::ResponseObserver& p_observer)
+	{
+		for (auto& provider : m_providers)
+			provider->client.setResponseObserver(p_observer);
+	}
+
+	std::chrono::steady_clock::duration HedgedUpstream::HedgeDelay(const std::size_t p_index) const
+	{
+		const std::chrono::steady_clock::duration delay =
+			 m_providers[p_index]
+				  ->latency.percentile(m_options.percentile, m_options.min_samples)
+				  .value_or(m_options.initial_delay);
+
+		return std::clamp<std::chrono::steady_clock::duration>(
+			 delay, m_options.min_delay, m_options.max_delay);
+	}
+
+	RequestScheduler::Metrics HedgedUpstream::SchedulerMetrics(const std::size_t p_index) const
+	{
+		return m_providers[p_index]->client.schedulerMetrics();
+	}
+
+	IAsyncOperation<std::int64_t> HedgedUpstream::FetchRate(const hstring  p_from_code,
+																			  const hstring  p_to_code,
+																			  const Priority p_priority)
+	{
+		auto race		 = std::make_shared<Race>();
+		race->from_code = p_from_code;
+		race->to_code	 = p_to_code;
+		race->priority	 = p_priority;
+		for (std::size_t i = 0; i < std::size(m_providers); ++i)
+			race->providers.push_back(i);
+
+		return Run(std::move(race));
+	}
+
+	IAsyncOperation<std::int64_t> HedgedUpstream::FetchHistoricalRate(const hstring  p_from_code,
+																							 const hstring  p_to_code,
+																							 const hstring  p_day,
+																							 const Priority p_priority)
+	{
+		auto race		 = std::make_shared<Race>();
+		race->from_code = p_from_code;
+		race->to_code	 = p_to_code;
+		race->day		 = p_day;
+		race->priority	 = p_priority;
+		for (std::size_t i = 0; i < std::size(m_providers); ++i)
+		{
+			const auto& config = m_providers[i]->config;
+			if (config.historical_rate_url && config.parse_historical_rate)
+				race->providers.push_back(i);
+		}
+
+		return Run(std::move(race));
+	}
+
+	IAsyncOperation<std::int64_t> HedgedUpstream::Run(std::shared_ptr<Race> p_race)
+	{
+		if (std::size(p_race->providers) > m_options.max_backups + 1)
+			p_race->providers.resize(m_options.max_backups + 1);
+		if (std::empty(p_race->providers))
+			co_return 0;
+
+		p_race->attempts.resize(std::size(p_race->providers));
+		Ask(p_race, 0, false);
+
+		co_return co_await SettledAwaiter{p_race};
+	}
+
+	IAsyncOperation<hstring> HedgedUpstream::FetchCurrencyList(const Priority p_priority)
+	{
+		for (const auto& provider : m_providers)
+		{
+			if (std::empty(provider->config.currencies_path))
+				continue;
+
+			co_return co_await provider->client.ReadJsonFromUriAsync(
+				 provider->config.root_url + provider->config.currencies_path, p_priority);
+		}
+		co_return L"";
+	}
+
+	void HedgedUpstream::Ask(const std::shared_ptr<Race>& p_race,
+									 const std::size_t				p_index,
+									 const bool							p_is_hedge)
+	{
+		auto& provider		= *m_providers[p_race->providers[p_index]];
+		auto	cancellation = std::make_shared<RequestCancellation>();
+		{
+			std::lock_guard<std::mutex> lock{p_race->mutex};
+			if (p_race->is_settled || p_race->next != p_index)
+				return;
+
+			p_race->attempts[p_index] = {cancellation, std::chrono::steady_clock::now(), true};
+			++p_race->next;
+		}
+
+		if (p_is_hedge)
+			provider.hedges.increment();
+
+		const auto& config = provider.config;
+		const auto	uri =
+			 p_race->day.has_value()
+				  ? config.historical_rate_url(
+						  config.root_url, p_race->from_code, p_race->to_code, *p_race->day)
+				  : config.rate_url(config.root_url, p_race->from_code, p_race->to_code);
+
+		// Completed may be called right away, if the Request Failed before it Suspended
+		Retain();
+		provider.client.ReadJsonFromUriAsync(uri, p_race->priority, std::move(cancellation))
+			 .Completed([this, race = p_race, p_index](const IAsyncOperation<hstring>& p_operation,
+																	 const AsyncStatus p_status) {
+				 OnAnswer(race,
+							 p_index,
+							 p_status == AsyncStatus::Completed ? p_operation.GetResults() : hstring{});
+				 Release();
+			 });
+
+		if (p_index + 1 >= std::size(p_race->attempts))
+			return;
+
+		// The next Provider is Asked if this one has not Answered in time
+		// Destroyed once it has Fired or been Cancelled, and no Callback is Running
+		Retain();
+		auto timer = ThreadPoolTimer::CreateTimer(
+			 [this, race = p_race, p_index](const ThreadPoolTimer&) {
+				 Ask(race, p_index + 1, true);
+			 },
+			 std::chrono::duration_cast<TimeSpan>(HedgeDelay(p_race->providers[p_index])),
+			 [this](const ThreadPoolTimer&) { Release(); });
+
+		// A Failure Answered meanwhile may have Asked the next Provider, and Armed its Timer
+		{
+			std::lock_guard<std::mutex> lock{p_race->mutex};
+			if (!p_race->is_settled && p_race->next == p_index + 1)
+				std::swap(timer, p_race->hedge_timer);
+		}
+
+		// Either Moot, or the Timer of an earlier Provider, which now is
+		if (timer)
+			timer.Cancel();
+	}
+
+	void HedgedUpstream::OnAnswer(const std::shared_ptr<Race>& p_race,
+											const std::size_t				 p_index,
+											const hstring&					 p_json)
+	{
+		auto& provider = *m_providers[p_race->providers[p_index]];
+
+		std::chrono::steady_clock::time_point asked_at;
+		std::shared_ptr<RequestCancellation>  cancellation;
+		{
+			std::lock_guard<std::mutex> lock{p_race->mutex};
+			auto&								 attempt = p_race->attempts[p_index];
+			attempt.is_open								 = false;
+			asked_at											 = attempt.asked_at;
+			cancellation									 = attempt.cancellation;
+		}
+		const auto latency = std::chrono::steady_clock::now() - asked_at;
+
+		// The Loser had Waited at least this long, had it not been Cancelled
+		if (cancellation->isCancelled())
+		{
+			provider.cancelled.increment();
+			provider.latency.record(latency);
+			return;
+		}
+
+		std::optional<Rate> rate;
+		if (!std::empty(p_json) && p_race->day.has_value())
+			rate = provider.config.parse_historical_rate(
+				 p_json, p_race->from_code, p_race->to_code, *p_race->day);
+		else if (!std::empty(p_json))
+			rate = provider.config.parse_rate(p_json, p_race->from_code, p_race->to_code);
+
+		if (rate.has_value())
+		{
+			provider.latency.record(latency);
+
+			// A Valid Answer just after the Winner's Loses all the same
+			if (Settle(p_race, rate->units, p_index))
+				provider.won.increment();
+			else
+				provider.cancelled.increment();
+			return;
+		}
+
+		if (std::empty(p_json))
+			provider.failed.increment();
+		else
+			provider.invalid.increment();
+
+		// Asks the next Provider at once, rather than Waiting out the Delay
+		// Without one, the Race is Lost once no other Request is Open
+		std::size_t next	  = 0;
+		bool			is_open = false;
+		{
+			std::lock_guard<std::mutex> lock{p_race->mutex};
+			next = p_race->next;
+			for (const auto& attempt : p_race->attempts)
+				is_open = is_open || attempt.is_open;
+		}
+
+		if (next < std::size(p_race->attempts))
+			Ask(p_race, next, false);
+		else if (!is_open)
+			Settle(p_race, 0, p_index);
+	}
+
+	bool HedgedUpstream::Settle(const std::shared_ptr<Race>& p_race,
+										 const std::int64_t			  p_units,
+										 const std::size_t				  p_winner)
+	{
+		ThreadPoolTimer										 timer{nullptr};
+		std::experimental::coroutine_handle<>			 waiter;
+		std::vector<std::shared_ptr<RequestCancellation>> losers;
+		{
+			std::lock_guard<std::mutex> lock{p_race->mutex};
+			if (p_race->is_settled)
+				return false;
+
+			p_race->is_settled = true;
+			p_race->units		 = p_units;
+
+			timer	 = std::exchange(p_race->hedge_timer, nullptr);
+			waiter = std::exchange(p_race->waiter, nullptr);
+
+			for (std::size_t i = 0; i < std::size(p_race->attempts); ++i)
+			{
+				if (i != p_winner && p_race->attempts[i].is_open)
+					losers.push_back(p_race->attempts[i].cancellation);
+			}
+		}
+
+		// Outside the Lock, as Cancelling may Complete a Loser on this Thread
+		if (timer)
+			timer.Cancel();
+		for (const auto& loser : losers)
+			loser->cancel();
+
+		if (waiter)
+			waiter.resume();
+		return true;
+	}
+} // namespace Currency
@@ -0,0 +1,223 @@
+#pragma once
+
+// Fetches Rates from several Providers, Hedging the Tail Latency of each
+//
+// A Provider is a Service with its own Address, Budget and Response Schema
+// Its URL Adapter Builds the Address of a Pair's Rate, and its Schema Adapter Reads the
+// Rate back out of the Body, as such Services which Quote differently are Interchangeable
+//
+// A Lookup Asks the Primary first
+// If it has not Answered within its observed p95, the next Provider is Asked as well
+// The first Valid Answer is Taken and the other Request is Cancelled
+// A Failed or Invalid Answer Asks the next Provider at once, rather than after the Delay
+// A Lookup of a past Day Skips the Providers which do not Quote past Days
+//
+// Each Provider keeps a Window of its Recent Latencies, from Asking to a Valid Answer
+// As such only about 1 Lookup in 20 is Hedged, however Fast or Slow the Primary is
+// A Request Cancelled as the Loser is Recorded as the Time it had Waited, a Lower Bound
+// Otherwise a Provider which is often Beaten would look Faster than it is
+//
+// Counts per Provider
+//	currency_upstream_answers_total{provider, outcome="won"|"cancelled"|"invalid"|"failed"}
+//	currency_upstream_hedges_total{provider}, Requests Fired to it as a Hedge
+
+#include <winrt/Windows.Foundation.h>
+#include <winrt/Windows.System.Threading.h>
+
+#include <TUESL/Metrics/Registry.hxx>
+#include <TUESL/Net/LatencyWindow.hxx>
+#include <TUESL/Net/WebClient.hxx>
+#include <TUESL/Numeric/FixedPoint.hxx>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace Currency
+{
+	namespace
+	{
+		using winrt::hstring;
+
+		using winrt::Windows::Foundation::IAsyncOperation;
+
+		using TUESL::Net::Priority;
+		using TUESL::Net::RequestScheduler;
+	} // namespace
+
+	struct UpstreamProvider
+	{
+		// Address of the Rate of p_from_code in p_to_code, under p_root_url
+		using RateURL = std::function<hstring(
+			 const hstring& p_root_url, const hstring& p_from_code, const hstring& p_to_code)>;
+		// Rate a Response Body Quotes for the Pair, nullopt if it does not hold one
+		using ParseRate = std::function<std::optional<TUESL::Numeric::Rate>(
+			 const hstring& p_json, const hstring& p_from_code, const hstring& p_to_code)>;
+		// As above, for the Rate of p_day, a YYYY-MM-DD
+		using HistoricalRateURL = std::function<hstring(const hstring& p_root_url,
+																		const hstring& p_from_code,
+																		const hstring& p_to_code,
+																		const hstring& p_day)>;
+		using ParseHistoricalRate = std::function<std::optional<TUESL::Numeric::Rate>(
+			 const hstring& p_json,
+			 const hstring& p_from_code,
+			 const hstring& p_to_code,
+			 const hstring& p_day)>;
+
+		// Labels the Provider's Metrics
+		std::string name;
+		// Paths of the Service are Appended to it, as such it ends with a Slash
+		hstring root_url;
+		// Path of the Currency List in the Converter's Schema
+		// Empty where the Service does not List Currencies that way
+		hstring						  currencies_path;
+		RequestScheduler::Options budget;
+
+		RateURL	 rate_url;
+		ParseRate parse_rate;
+		// Empty where the Service does not Quote past Days, it is then never Asked for them
+		HistoricalRateURL	  historical_rate_url;
+		ParseHistoricalRate parse_historical_rate;
+
+		// convert?compact=ultra&q={from}_{to}, Answered as {"USD_INR":45.1}
+		// Past Days add &date={day}, Answered as {"USD_INR":{"2024-01-05":45.1}}
+		// Also Lists the Currencies under currencies
+		static UpstreamProvider ForConverterAPI(std::string							p_name,
+															 hstring								p_root_url,
+															 const RequestScheduler::Options& p_budget);
+
+		// latest?base={from}&symbols={to}, Answered as {"base":"USD","rates":{"INR":45.1}}
+		// Past Days are {day}?base={from}&symbols={to}, Answered alike
+		// As Services of Reference Rates such as Frankfurter Quote them
+		static UpstreamProvider ForRatesByBase(std::string							p_name,
+															hstring								p_root_url,
+															const RequestScheduler::Options& p_budget);
+	};
+
+	struct HedgeOptions
+	{
+		// Providers Asked besides the Primary per Lookup, 0 never Hedges
+		std::size_t max_backups = 1;
+		// Of the Latency of the Provider Asked last
+		double percentile = 95.0;
+		// Recent Latencies Kept per Provider
+		std::size_t window = 128;
+		// Until a Provider has Answered this often, initial_delay is used for it instead
+		std::size_t					  min_samples = 16;
+		std::chrono::milliseconds initial_delay{1000};
+		// So that a Window of Quick Answers does not Hedge nearly every Lookup
+		std::chrono::milliseconds min_delay{5};
+		// So that a Provider which has gone Slow is not Waited on for long
+		std::chrono::milliseconds max_delay{5000};
+	};
+
+	class HedgedUpstream
+	{
+	 private:
+		struct Provider
+		{
+			UpstreamProvider			  config;
+			TUESL::Net::WebClient	  client;
+			TUESL::Net::LatencyWindow latency;
+
+			TUESL::Metrics::Counter& won;
+			TUESL::Metrics::Counter& cancelled;
+			TUESL::Metrics::Counter& invalid;
+			TUESL::Metrics::Counter& failed;
+			TUESL::Metrics::Counter& hedges;
+
+			Provider(UpstreamProvider			p_config,
+						const std::size_t			p_window,
+						TUESL::Metrics::Registry& p_metrics);
+		};
+
+		// State of one Lookup, Shared by its Requests and Hedge Timer
+		struct Race;
+		struct SettledAwaiter;
+
+		HedgeOptions									 m_options;
+		std::vector<std::unique_ptr<Provider>> m_providers;
+
+		// Requests and Hedge Timers which may still call back, Waited on by the Destructor
+		// Losers are Cancelled as soon as a Race is Settled, as such they End quickly
+		std::size_t					m_open_callbacks = 0;
+		std::mutex					m_open_callbacks_mutex;
+		std::condition_variable m_open_callbacks_done;
+
+	 private:
+		void Retain();
+		void Release();
+
+		// Asks the first of the Race's Providers, and Waits until the Race is Settled
+		IAsyncOperation<std::int64_t> Run(std::shared_ptr<Race> p_race);
+
+		// p_index is of the Race's Providers, not of m_providers
+		// Does nothing if the Race is Settled, or p_index is not the next Provider to Ask
+		// As such a Timer and a Failure may both Ask for the same Hedge
+		void Ask(const std::shared_ptr<Race>& p_race,
+					const std::size_t				p_index,
+					const bool						p_is_hedge);
+		void OnAnswer(const std::shared_ptr<Race>& p_race,
+						  const std::size_t				 p_index,
+						  const hstring&					 p_json);
+		// Ends the Race with p_units, 0 if no Provider Answered
+		// Cancels every Request still Open besides p_winner, and Resumes the Lookup
+		// false if it had already Ended
+		bool Settle(const std::shared_ptr<Race>& p_race,
+						const std::int64_t			 p_units,
+						const std::size_t				 p_winner);
+
+	 public:
+		// Throws std::invalid_argument without a Provider, or with one missing an Adapter
+		explicit HedgedUpstream(
+			 std::vector<UpstreamProvider> p_providers,
+			 const HedgeOptions&				 p_options = HedgeOptions{},
+			 TUESL::Metrics::Registry&		 p_metrics = TUESL::Metrics::Registry::global());
+
+		~HedgedUpstream();
+
+		// The Requests in Flight refer back to it
+		HedgedUpstream(const HedgedUpstream&) = delete;
+		HedgedUpstream& operator=(const HedgedUpstream&) = delete;
+
+		std::size_t size() const noexcept
+		{
+			return std::size(m_providers);
+		}
+
+		void SetUserAgent(const std::wstring_view p_user_agent);
+		void AddHeader(const std::wstring_view p_key, const std::wstring_view p_value);
+		// Observes the Responses of every Provider, Set before the first Request
+		void SetResponseObserver(const TUESL::Net::WebClient::ResponseObserver& p_observer);
+
+		// Rate of the Pair in Units of Rate::SCALE, 0 if no Provider Answered with one
+		IAsyncOperation<std::int64_t> FetchRate(const hstring	p_from_code,
+															 const hstring	p_to_code,
+															 const Priority p_priority = Priority::INTERACTIVE);
+
+		// Rate of the Pair on p_day, a YYYY-MM-DD, Hedged among the Providers which Quote past Days
+		// 0 if none does, or none Answered with one
+		IAsyncOperation<std::int64_t> FetchHistoricalRate(
+			 const hstring	 p_from_code,
+			 const hstring	 p_to_code,
+			 const hstring	 p_day,
+			 const Priority p_priority = Priority::INTERACTIVE);
+
+		// From the first Provider which Lists Currencies, Empty on any Failure
+		// Never Hedged, as the Lists of other Providers need not Match
+		IAsyncOperation<hstring> FetchCurrencyList(
+			 const Priority p_priority = Priority::INTERACTIVE);
+
+		// Time the Provider at p_index is given before the next one is Asked
+		std::chrono::steady_clock::duration HedgeDelay(const std::size_t p_index) const;
+
+		RequestScheduler::Metrics SchedulerMetrics(const std::size_t p_index) const;
+	};
+} // namespace Currency
@@ -0,0 +1,404 @@
+// Includes the pch file
+// This is known to boost compilation speeds
+#include "pch.h"
+
+#include "HistoricalQuotes.hxx"
+
+#include <TUESL/SQLite/PrepareStatement.hxx>
+#include <TUESL/SQLite/SQLiteException.hxx>
+#include <TUESL/Utility/Hash.hxx>
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+namespace Currency
+{
+	namespace
+	{
+		using namespace std::string_literals;
+
+		using TUESL::SQLite::Database;
+		using TUESL::SQLite::PrepareStatement;
+		using TUESL::SQLite::QueryPlanGuard;
+		using TUESL::SQLite::SQLiteException;
+		namespace DataTypes = TUESL::SQLite::DataTypes;
+
+		namespace TableNames
+		{
+			constexpr const auto TABLE_HISTORICAL_QUOTES = "TABLE_HISTORICAL_QUOTES";
+		} // namespace TableNames
+		namespace ColumnNames
+		{
+			constexpr const auto COLUMN_FROM = "from_code";
+			constexpr const auto COLUMN_TO	= "to_code";
+			// Midnight UTC of the Day, in Ticks of winrt::clock
+			constexpr const auto COLUMN_DAY	= "day";
+			constexpr const auto COLUMN_RATE = "rate";
+			// Ticks of winrt::clock when it was last Read, or Stored
+			constexpr const auto COLUMN_ACCESSED = "accessed";
+		} // namespace ColumnNames
+		namespace IndexNames
+		{
+			// One Quote per Pair and Day, and the Lookup by them
+			constexpr const auto INDEX_HISTORICAL_QUOTES_KEY = "INDEX_HISTORICAL_QUOTES_KEY";
+			// Prunes the Least Recently Read without Sorting the Table
+			constexpr const auto INDEX_HISTORICAL_QUOTES_ACCESSED =
+				 "INDEX_HISTORICAL_QUOTES_ACCESSED";
+		} // namespace IndexNames
+
+		// Rows Deleted at most per Prune, as such no single Store Waits long
+		constexpr const std::size_t PRUNE_BATCH_SIZE = 1'000;
+		// Reads from the Database Noted before their Access Times are Written
+		// A Store Writes them sooner
+		constexpr const std::size_t TOUCH_BATCH_SIZE = 64;
+
+		// Flags, Length, Reference Count and Terminator of an hstring's Buffer, about
+		constexpr const std::size_t HSTRING_OVERHEAD = 24;
+
+		// Sizes the Frequency Sketch by Quotes of the usual three Letter Codes
+		std::size_t expectedQuotes(const std::size_t p_memory_budget)
+		{
+			const HistoricalQuoteKey usual{L"USD", L"EUR", 0};
+			return p_memory_budget / HistoricalQuoteCache::Weigh(usual, Rate{});
+		}
+
+		std::int64_t now()
+		{
+			return winrt::clock::now().time_since_epoch().count();
+		}
+
+		namespace Statements
+		{
+			namespace Columns = ColumnNames;
+
+			const std::string& SelectQuote()
+			{
+				static const std::string sql =
+					 "SELECT "s + Columns::COLUMN_RATE + " FROM "s +
+					 TableNames::TABLE_HISTORICAL_QUOTES + " WHERE "s + Columns::COLUMN_FROM +
+					 "=? AND "s + Columns::COLUMN_TO + "=? AND "s + Columns::COLUMN_DAY + "=?;"s;
+				return sql;
+			}
+			const std::string& TouchQuote()
+			{
+				static const std::string sql =
+					 "UPDATE "s + TableNames::TABLE_HISTORICAL_QUOTES + " SET "s +
+					 Columns::COLUMN_ACCESSED + "=? WHERE "s + Columns::COLUMN_FROM + "=? AND "s +
+					 Columns::COLUMN_TO + "=? AND "s + Columns::COLUMN_DAY + "=?;"s;
+				return sql;
+			}
+			const std::string& InsertQuote()
+			{
+				static const std::string sql =
+					 "INSERT OR IGNORE INTO "s + TableNames::TABLE_HISTORICAL_QUOTES + "("s +
+					 Columns::COLUMN_FROM + ","s + Columns::COLUMN_TO + ","s + Columns::COLUMN_DAY +
+					 ","s + Columns::COLUMN_RATE + ","s + Columns::COLUMN_ACCESSED +
+					 ") VALUES (?,?,?,?,?);"s;
+				return sql;
+			}
+			const std::string& PruneQuotes()
+			{
+				static const std::string sql =
+					 "DELETE FROM "s + TableNames::TABLE_HISTORICAL_QUOTES + " WHERE rowid IN ("s +
+					 "SELECT rowid FROM "s + TableNames::TABLE_HISTORICAL_QUOTES + " ORDER BY "s +
+					 Columns::COLUMN_ACCESSED + " LIMIT ?);"s;
+				return sql;
+			}
+			const std::string& CountQuotes()
+			{
+				static const std::string sql =
+					 "SELECT COUNT(*) FROM "s + TableNames::TABLE_HISTORICAL_QUOTES + ";"s;
+				return sql;
+			}
+		} // namespace Statements
+
+		TUESL::Metrics::Counter& FindCounter(TUESL::Metrics::Registry& p_metrics,
+														 const char*					p_tier)
+		{
+			return p_metrics.counter(
+				 "currency_historical_quotes_total",
+				 "Historical Quote Finds by the Tier which Answered them",
+				 {{"tier", p_tier}});
+		}
+	} // namespace
+
+	std::size_t HistoricalQuoteKeyHash::operator()(const HistoricalQuoteKey& p_key) const noexcept
+	{
+		using TUESL::Utility::Hash::fnv1a64;
+
+		auto hash = fnv1a64(std::wstring_view{p_key.from_code});
+		hash		 = fnv1a64(std::wstring_view{p_key.to_code}, hash);
+		hash		 = fnv1a64(&p_key.day, sizeof(p_key.day), hash);
+		return static_cast<std::size_t>(hash);
+	}
+
+	HistoricalQuoteCache::HistoricalQuoteCache(Database&							p_db,
+															 std::mutex&						p_write_mutex,
+															 const HistoricalQuoteOptions& p_options,
+															 TUESL::Metrics::Registry&		p_metrics) :
+		 m_db{p_db},
+		 m_write_mutex{p_write_mutex},
+		 m_options{p_options},
+		 m_memory{{p_options.memory_budget, expectedQuotes(p_options.memory_budget)}, Weigh},
+		 m_memory_hits{FindCounter(p_metrics, "memory")},
+		 m_database_hits{FindCounter(p_metrics, "database")},
+		 m_misses{FindCounter(p_metrics, "missed")},
+		 m_memory_bytes{p_metrics.gauge(
+			  "currency_historical_quote_memory_bytes",
+			  "Bytes the Memory Tier of Historical Quotes holds")}
+	{
+		if (expectedQuotes(p_options.memory_budget) == 0)
+			throw std::invalid_argument("The Memory Budget can not hold a single Quote");
+
+		std::lock_guard<std::mutex> write_lock{m_write_mutex};
+
+		CreateTables();
+		CountStoredQuotes();
+	}
+	void HistoricalQuoteCache::CreateTables()
+	{
+		m_db.executeSQL("CREATE TABLE IF NOT EXISTS "s + TableNames::TABLE_HISTORICAL_QUOTES +
+							 " ("s + ColumnNames::COLUMN_FROM + " TEXT NOT NULL, "s +
+							 ColumnNames::COLUMN_TO + " TEXT NOT NULL, "s + ColumnNames::COLUMN_DAY +
+							 " INTEGER NOT NULL, "s + ColumnNames::COLUMN_RATE +
+							 " INTEGER NOT NULL, "s + ColumnNames::COLUMN_ACCESSED +
+							 " INTEGER NOT NULL);"s);
+
+		m_db.executeSQL("CREATE UNIQUE INDEX IF NOT EXISTS "s +
+							 IndexNames::INDEX_HISTORICAL_QUOTES_KEY + " ON "s +
+							 TableNames::TABLE_HISTORICAL_QUOTES + "("s + ColumnNames::COLUMN_FROM +
+							 ", "s + ColumnNames::COLUMN_TO + ", "s + ColumnNames::COLUMN_DAY + ");"s);
+
+		m_db.executeSQL("CREATE INDEX IF NOT EXISTS "s +
+							 IndexNames::INDEX_HISTORICAL_QUOTES_ACCESSED + " ON "s +
+							 TableNames::TABLE_HISTORICAL_QUOTES + "("s +
+							 ColumnNames::COLUMN_ACCESSED + ");"s);
+	}
+	void HistoricalQuoteCache::CountStoredQuotes()
+	{
+		PrepareStatement ps;
+		ps.prepare(m_db, Statements::CountQuotes());
+		if (ps.hasNext())
+			m_stored_quotes = static_cast<std::size_t>(ps.get<DataTypes::Int64>().value_or(0));
+	}
+
+	void HistoricalQuoteCache::Remember(const HistoricalQuoteKey& p_key, const Rate p_rate)
+	{
+		std::lock_guard<std::mutex> memory_lock{m_memory_mutex};
+
+		m_memory.put(p_key, p_rate);
+		m_memory_bytes.set(static_cast<std::int64_t>(m_memory.weight()));
+	}
+	std::optional<Rate> HistoricalQuoteCache::FindStored(const HistoricalQuoteKey& p_key)
+	{
+		std::optional<Rate> rate;
+		{
+			PrepareStatement ps;
+			ps.prepare(m_db, Statements::SelectQuote());
+			ps.bind(p_key.from_code);
+			ps.bind(p_key.to_code);
+			ps.bind(static_cast<DataTypes::Int64>(p_key.day));
+
+			if (ps.hasNext())
+			{
+				if (const auto units = ps.get<DataTypes::Int64>(); units.has_value())
+					rate = Rate{units.value()};
+			}
+		}
+		if (!rate.has_value())
+			return std::nullopt;
+
+		bool is_flush_due = false;
+		{
+			std::lock_guard<std::mutex> touch_lock{m_touch_mutex};
+			m_pending_touches.push_back(p_key);
+			is_flush_due = std::size(m_pending_touches) >= TOUCH_BATCH_SIZE;
+		}
+
+		// Only Delays its Pruning, as such a Failed Write is of no Consequence
+		if (is_flush_due)
+		{
+			try
+			{
+				std::lock_guard<std::mutex> write_lock{m_write_mutex};
+
+				m_db.transactionBegin();
+				try
+				{
+					FlushTouches();
+				}
+				catch (...)
+				{
+					m_db.transactionRollback();
+					throw;
+				}
+				m_db.transactionEnd();
+			}
+			catch (const SQLiteException&)
+			{
+			}
+		}
+		return rate;
+	}
+	void HistoricalQuoteCache::FlushTouches()
+	{
+		std::vector<HistoricalQuoteKey> touches;
+		{
+			std::lock_guard<std::mutex> touch_lock{m_touch_mutex};
+			touches.swap(m_pending_touches);
+		}
+		if (std::empty(touches))
+			return;
+
+		// The Time of the Batch, close enough to tell the Least Recently Read apart
+		const auto time = static_cast<DataTypes::Int64>(now());
+
+		PrepareStatement ps;
+		ps.prepare(m_db, Statements::TouchQuote());
+		for (const auto& key : touches)
+		{
+			ps.restart();
+			ps.bind(time);
+			ps.bind(key.from_code);
+			ps.bind(key.to_code);
+			ps.bind(static_cast<DataTypes::Int64>(key.day));
+			ps.execute();
+		}
+	}
+	void HistoricalQuoteCache::Prune()
+	{
+		const auto low_water = m_options.max_stored_quotes - m_options.max_stored_quotes / 10;
+		if (m_stored_quotes <= m_options.max_stored_quotes)
+			return;
+
+		PrepareStatement ps;
+		ps.prepare(m_db, Statements::PruneQuotes());
+		ps.bind(static_cast<DataTypes::Int64>((std::min)(m_stored_quotes - low_water,
+																		 PRUNE_BATCH_SIZE)));
+		ps.execute();
+
+		const auto rows_deleted = static_cast<std::size_t>(m_db.noOfRowsModified());
+		m_stored_quotes -= (std::min)(rows_deleted, m_stored_quotes);
+	}
+
+	std::optional<Rate> HistoricalQuoteCache::Find(const hstring&		p_from_code,
+																  const hstring&		p_to_code,
+																  const std::int64_t p_day)
+	{
+		const HistoricalQuoteKey key{p_from_code, p_to_code, p_day};
+		{
+			std::lock_guard<std::mutex> memory_lock{m_memory_mutex};
+			if (const auto rate = m_memory.get(key); rate.has_value())
+			{
+				m_memory_hits.increment();
+				return rate;
+			}
+		}
+
+		std::optional<Rate> rate;
+		try
+		{
+			rate = FindStored(key);
+		}
+		catch (const SQLiteException&)
+		{
+		}
+
+		if (!rate.has_value())
+		{
+			m_misses.increment();
+			return std::nullopt;
+		}
+
+		// Counted by the Sketch on its Miss above, as such it is Admitted once it is Popular
+		Remember(key, rate.value());
+		m_database_hits.increment();
+		return rate;
+	}
+
+	void HistoricalQuoteCache::Store(const hstring&		p_from_code,
+												const hstring&		p_to_code,
+												const std::int64_t p_day,
+												const Rate			p_rate)
+	{
+		Remember(HistoricalQuoteKey{p_from_code, p_to_code, p_day}, p_rate);
+
+		try
+		{
+			std::lock_guard<std::mutex> write_lock{m_write_mutex};
+
+			m_db.transactionBegin();
+			try
+			{
+				PrepareStatement ps;
+				ps.prepare(m_db, Statements::InsertQuote());
+				ps.bind(p_from_code);
+				ps.bind(p_to_code);
+				ps.bind(static_cast<DataTypes::Int64>(p_day));
+				ps.bind(static_cast<DataTypes::Int64>(p_rate.units));
+				ps.bind(static_cast<DataTypes::Int64>(now()));
+				ps.execute();
+
+				// 0 where another Lookup of the same Quote Stored it first
+				m_stored_quotes += static_cast<std::size_t>(m_db.noOfRowsModified());
+
+				// As such the Quotes Read since are not Pruned as if they were not
+				FlushTouches();
+				Prune();
+
+				m_db.transactionEnd();
+			}
+			catch (...)
+			{
+				m_db.transactionRollback();
+				CountStoredQuotes();
+				throw;
+			}
+		}
+		catch (const SQLiteException&)
+		{
+		}
+	}
+
+	HistoricalQuoteStatistics HistoricalQuoteCache::Statistics()
+	{
+		HistoricalQuoteStatistics statistics;
+		{
+			std::lock_guard<std::mutex> memory_lock{m_memory_mutex};
+
+			const auto& memory		  = m_memory.statistics();
+			statistics.admissions	  = memory.admissions;
+			statistics.rejections	  = memory.rejections;
+			statistics.evictions		  = memory.evictions;
+			statistics.memory_quotes  = m_memory.size();
+			statistics.memory_bytes	  = m_memory.weight();
+		}
+
+		// Of the Registry, as such of every Cache Sharing it
+		statistics.memory_hits	 = m_memory_hits.value();
+		statistics.database_hits = m_database_hits.value();
+		statistics.misses			 = m_misses.value();
+		{
+			std::lock_guard<std::mutex> write_lock{m_write_mutex};
+			statistics.stored_quotes = m_stored_quotes;
+		}
+		return statistics;
+	}
+
+	std::size_t HistoricalQuoteCache::Weigh(const HistoricalQuoteKey& p_key, const Rate&)
+	{
+		return sizeof(HistoricalQuoteKey) + sizeof(Rate) + MemoryTier::ENTRY_OVERHEAD +
+				 2 * HSTRING_OVERHEAD +
+				 (std::size(p_key.from_code) + std::size(p_key.to_code)) * sizeof(wchar_t);
+	}
+
+	void HistoricalQuoteCache::RegisterStatements(QueryPlanGuard& p_guard)
+	{
+		p_guard.registerStatement("select_historical_quote", Statements::SelectQuote());
+		p_guard.registerStatement("touch_historical_quote", Statements::TouchQuote());
+		p_guard.registerStatement("insert_historical_quote", Statements::InsertQuote());
+		p_guard.registerStatement("prune_historical_quotes", Statements::PruneQuotes());
+		p_guard.registerStatement("count_historical_quotes", Statements::CountQuotes());
+	}
+} // namespace Currency
@@ -0,0 +1,178 @@
+#pragma once
+
+// Rates of past Days, as Asked for by Converting at a Date
+//
+// Pairs times Days is far too Sparse for the Snapshot's Matrix, and a Quote of a past Day
+// never Changes, as such Expiring them with TABLE_CURRENCY_VALUES would only Fetch them again
+// They are Kept in two Tiers instead, each Bounded
+//
+//	Memory		A WTinyLFUCache within memory_budget Bytes
+//				A Scan across many Days, such as a Chart, does not Displace the Quotes
+//				Asked for again and again, as it would from an LRU
+//	Database	TABLE_HISTORICAL_QUOTES, Pruned of the Least Recently Read Quotes
+//				once it holds more than max_stored_quotes
+//				Reads are Noted in Memory, and their Times Written a Batch at a time
+//
+// Quotes are Written Through to both, as such one the Memory Tier does not Admit or later
+// Evicts is still Found in the Database, and Promoted back on the next Read
+//
+// Counts every Find by the Tier which Answered it, and what the Memory Tier holds
+//	currency_historical_quotes_total{tier="memory"|"database"|"missed"}
+//	currency_historical_quote_memory_bytes
+
+#include <winrt/Windows.Foundation.h>
+
+#include <TUESL/Cache/WTinyLFUCache.hxx>
+#include <TUESL/Metrics/Registry.hxx>
+#include <TUESL/Numeric/FixedPoint.hxx>
+#include <TUESL/SQLite/Database.hxx>
+#include <TUESL/SQLite/QueryPlan.hxx>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace Currency
+{
+	namespace
+	{
+		using winrt::hstring;
+
+		using TUESL::Numeric::Rate;
+	} // namespace
+
+	struct HistoricalQuoteKey
+	{
+		hstring from_code;
+		hstring to_code;
+		// Midnight UTC of the Day, see ReferenceDayOf
+		std::int64_t day = 0;
+
+		bool operator==(const HistoricalQuoteKey& p_other) const noexcept
+		{
+			return day == p_other.day && from_code == p_other.from_code &&
+					 to_code == p_other.to_code;
+		}
+	};
+
+	struct HistoricalQuoteKeyHash
+	{
+		std::size_t operator()(const HistoricalQuoteKey& p_key) const noexcept;
+	};
+
+	struct HistoricalQuoteOptions
+	{
+		// Bytes the Memory Tier may hold, its Keys and Bookkeeping included
+		std::size_t memory_budget = 4 * 1024 * 1024;
+		// Quotes Kept in TABLE_HISTORICAL_QUOTES
+		// A Row takes about 100 Bytes with its Indexes, and under DatabaseMode::IN_MEMORY
+		// the Table is in Memory as well, as such this is about 5 MB
+		std::size_t max_stored_quotes = 50'000;
+	};
+
+	struct HistoricalQuoteStatistics
+	{
+		std::uint64_t memory_hits	 = 0;
+		std::uint64_t database_hits = 0;
+		std::uint64_t misses			 = 0;
+
+		// Of the Memory Tier, see WTinyLFUCache::Statistics
+		std::uint64_t admissions = 0;
+		std::uint64_t rejections = 0;
+		std::uint64_t evictions	 = 0;
+
+		std::size_t memory_quotes = 0;
+		std::size_t memory_bytes  = 0;
+		std::size_t stored_quotes = 0;
+
+		double memoryHitRatio() const noexcept
+		{
+			const auto finds = memory_hits + database_hits + misses;
+			return finds == 0 ? 0.0 : static_cast<double>(memory_hits) / finds;
+		}
+		// Finds Answered without the Network
+		double hitRatio() const noexcept
+		{
+			const auto finds = memory_hits + database_hits + misses;
+			return finds == 0 ? 0.0 : static_cast<double>(memory_hits + database_hits) / finds;
+		}
+	};
+
+	class HistoricalQuoteCache
+	{
+	 public:
+		using MemoryTier =
+			 TUESL::Cache::WTinyLFUCache<HistoricalQuoteKey, Rate, HistoricalQuoteKeyHash>;
+
+	 private:
+		TUESL::SQLite::Database& m_db;
+		// Shared with every other Writer of the Connection
+		std::mutex& m_write_mutex;
+
+		HistoricalQuoteOptions m_options;
+
+		MemoryTier m_memory;
+		std::mutex m_memory_mutex;
+
+		// Rows of TABLE_HISTORICAL_QUOTES, Counted once at Startup and Kept in step since
+		// Guarded by m_write_mutex
+		std::size_t m_stored_quotes = 0;
+
+		// Read from the Database since their Access Times were last Written
+		std::vector<HistoricalQuoteKey> m_pending_touches;
+		std::mutex							  m_touch_mutex;
+
+		TUESL::Metrics::Counter& m_memory_hits;
+		TUESL::Metrics::Counter& m_database_hits;
+		TUESL::Metrics::Counter& m_misses;
+		TUESL::Metrics::Gauge&	 m_memory_bytes;
+
+	 private:
+		void CreateTables();
+		void CountStoredQuotes();
+
+		// Into the Memory Tier, which may not Admit it
+		void Remember(const HistoricalQuoteKey& p_key, const Rate p_rate);
+		std::optional<Rate> FindStored(const HistoricalQuoteKey& p_key);
+		// Writes the Access Time of every Pending Touch in one Statement Restarted per Row
+		// m_write_mutex must be Held, and a Transaction Open
+		void FlushTouches();
+		// Deletes the Least Recently Read Rows past max_stored_quotes, m_write_mutex must be Held
+		void Prune();
+
+	 public:
+		// Creates the Table on p_db where it does not Exist yet
+		// Throws std::invalid_argument if memory_budget can not hold a single Quote
+		HistoricalQuoteCache(
+			 TUESL::SQLite::Database&		p_db,
+			 std::mutex&						p_write_mutex,
+			 const HistoricalQuoteOptions& p_options = HistoricalQuoteOptions{},
+			 TUESL::Metrics::Registry&		p_metrics = TUESL::Metrics::Registry::global());
+
+		HistoricalQuoteCache(const HistoricalQuoteCache&) = delete;
+		HistoricalQuoteCache& operator=(const HistoricalQuoteCache&) = delete;
+
+		// From Memory, else from the Database, nullopt if neither holds it
+		// Never Waits on the Network
+		std::optional<Rate> Find(const hstring&		p_from_code,
+										 const hstring&		p_to_code,
+										 const std::int64_t p_day);
+
+		// Writes p_rate Through to both Tiers
+		// A Quote that can not be Written is still Kept in Memory
+		void Store(const hstring&		p_from_code,
+					  const hstring&		p_to_code,
+					  const std::int64_t p_day,
+					  const Rate			p_rate);
+
+		HistoricalQuoteStatistics Statistics();
+
+		// Bytes a Quote takes in the Memory Tier, about, as Weighed against memory_budget
+		static std::size_t Weigh(const HistoricalQuoteKey& p_key, const Rate& p_rate);
+
+		// Registers every Statement it Prepares on its Table, see CurrencyConverter
+		static void RegisterStatements(TUESL::SQLite::QueryPlanGuard& p_guard);
+	};
+} // namespace Currency
@@ -10,16 +10,26 @@ namespace winrt::CurrencyConversion::implementation
 	}
 	fire_and_forget MainPage::AddValuesToCurrencyIDList()
 	{
-		MessageInfo().Text(L"Obtaining List of Currencies");
-		
-		co_await m_currency_converter.SetupTableCurrencyIDs();
-		
-		CurrencyNameList().Clear();
+		// When Restored from the Snapshot the List is already in Memory
+		// Only a Cold Start has to Query the Database or the Network
+		if (!m_currency_converter.IsWarm())
+		{
+			MessageInfo().Text(L"Obtaining List of Currencies");
+
+			co_await m_currency_converter.SetupTableCurrencyIDs();
+		}
+
 		// This will Update Both Drop Down Lists with Currency Names
-		auto currency_names_list = m_currency_converter.GetAllCurrencyNamesAsync();
-		for (const hstring& currency_name : currency_names_list)
-			if (!std::empty(currency_name))
-				CurrencyNameList().Append(box_value(currency_name));
+		// Replaced in a Single Call rather than one Append per Name
+		const auto show_currency_names = [this] {
+			std::vector<IInspectable> currency_names;
+			for (const hstring& currency_name : m_currency_converter.GetCurrencyNames())
+				currency_names.push_back(box_value(currency_name));
+			CurrencyNameList().ReplaceAll(currency_names);
+
+			SelectMostRecentPair();
+		};
+		show_currency_names();
 
 		// Check if No Currency Name Element was Loaded
 		// If true, Display Error Message and Exit
@@ -37,6 +47,54 @@ namespace winrt::CurrencyConversion::implementation
 		{
 			MessageInfo().Text(L"");
 		}
+
+		// The Stored List may be Older than the Service's
+		// Only what Changed is Written, and the Lists are only Replaced if anything did
+		if (co_await m_currency_converter.SyncCurrencyIDs())
+			show_currency_names();
+	}
+
+	void MainPage::SelectMostRecentPair()
+	{
+		const auto recent_pair = m_currency_converter.GetMostRecentPair();
+		if (!recent_pair.has_value())
+			return;
+
+		const auto from_name =
+			 m_currency_converter.GetCurrencyNameFromID(recent_pair->from_code);
+		const auto to_name = m_currency_converter.GetCurrencyNameFromID(recent_pair->to_code);
+
+		// Note that IndexOf compares Boxed Values by Identity
+		// As such the Names are Searched for directly
+		const auto currency_names = m_currency_converter.GetCurrencyNames();
+
+		const auto from_it =
+			 std::find(std::begin(currency_names), std::end(currency_names), from_name);
+		const auto to_it =
+			 std::find(std::begin(currency_names), std::end(currency_names), to_name);
+
+		if (from_it != std::end(currency_names) && to_it != std::end(currency_names))
+		{
+			FromCurrencyList().SelectedIndex(
+				 static_cast<int32_t>(std::distance(std::begin(currency_names), from_it)));
+			ToCurrencyList().SelectedIndex(
+				 static_cast<int32_t>(std::distance(std::begin(currency_names), to_it)));
+		}
+	}
+
+	void MainPage::ReportTimeToFirstConversion()
+	{
+		if (m_first_conversion_reported)
+			return;
+		m_first_conversion_reported = true;
+
+		// Once per Launch, as such the Warm and Cold Counts are of Launches
+		// StartupBenchmarks Measures both without the Window
+		TUESL::Metrics::Registry::global()
+			 .histogram("currency_time_to_first_conversion_seconds",
+							"Time from Launch to the first Conversion Shown",
+							{{"start", m_started_warm ? "warm" : "cold"}})
+			 .record(std::chrono::steady_clock::now() - m_started_at);
 	}
 
 	void MainPage::CleanupDatabaseOfOldCurrencyConversionsInFixTimePeriod()
@@ -62,26 +120,69 @@ namespace winrt::CurrencyConversion::implementation
 			// duration to delete
 			const auto delete_prior = current_time - offset;
 
-			m_currency_converter.DeleteAllCurrencyValuesOlderThanTime(delete_prior);
+			// Only a Bounded Number of Rows are Deleted per Tick
+			// Whatever remains is picked up by the next Tick
+			// What it Reclaimed is Published as currency_expiry_* Metrics
+			m_currency_converter.ExpireCurrencyValuesOlderThanTime(delete_prior);
 		};
 
-		// Let us set it to Reset Every 2 Hours
+		// As every Tick is Bounded, Ticks can run more often
+		// Let us set it to Reset Every 15 Minutes
 		constexpr const auto reset_duration =
-			 duration_cast<TimeSpan>(std::chrono::hours{2});
+			 duration_cast<TimeSpan>(std::chrono::minutes{15});
 
 		// Create the ThreadPoolTimer here
-		// This timer will only run every 2 hours
+		// This timer will only run every 15 minutes
 		auto periodic_cleanup_old_currency_timer =
 			 ThreadPoolTimer::CreatePeriodicTimer(cleanup_currency, reset_duration);
 
 		// Run CleanUp Currency
-		// Ensure it is called at least once
-		cleanup_currency(nullptr /*The Passed argument is ignored*/);
+		// Ensure it is called at least once, on the Pool as the first Tick may Vacuum the File
+		ThreadPoolTimer::CreateTimer(cleanup_currency, TimeSpan{0});
+	}
+
+	void MainPage::BackupDatabaseInFixTimePeriod()
+	{
+		// The Database lives in Memory
+		// Every Tick Copies a Bounded Number of Pages to the File on Disk
+		// A Tick that does not Complete is Continued by the next one
+		const auto backup_database = [this](const auto&) {
+			m_currency_converter.BackupDatabase();
+		};
+
+		// At most this much is Lost on a Crash
+		constexpr const auto backup_duration =
+			 std::chrono::duration_cast<TimeSpan>(std::chrono::seconds{10});
+
+		m_backup_timer = ThreadPoolTimer::CreatePeriodicTimer(backup_database, backup_duration);
+	}
+
+	fire_and_forget MainPage::FlushOnSuspend(SuspendingDeferral p_deferral)
+	{
+		// Suspension Waits on the Deferral, not on the UI Thread
+		co_await resume_background();
+
+		// Whatever could not be Saved, Suspension must still Complete
+		try
+		{
+			m_currency_converter.SaveSnapshot();
+			m_currency_converter.FlushHistory();
+			m_currency_converter.FlushDatabase();
+		}
+		catch (...)
+		{
+		}
+
+		p_deferral.Complete();
 	}
 
 	IAsyncAction MainPage::UpdateReadingsAsync()
 	{
-		const auto src_amt_str = winrt::to_string(FromAmt().Text());
+		// Started on every Keystroke and Selection, without Waiting for those before it
+		// Each Converts the Amount once, by a Rate from Memory or from the Upstream
+		const auto update = ++m_reading_update;
+
+		const auto src_amt_str = TUESL::Utility::toUTF8(FromAmt().Text()).value_or("");
 
 		// If the Source Amount String is empty
 		// Do nothing
@@ -119,9 +220,15 @@ namespace winrt::CurrencyConversion::implementation
 		const auto to_code =
 			 m_currency_converter.GetCurrencyIDFromName(to_selected_cur_name);
 
-		const double src_amt = std::stod(src_amt_str);
+		// Parsed Exactly, unlike std::stod
+		const auto src_amt = TUESL::Numeric::Money::parse(src_amt_str);
 
-		if (src_amt == 0.0)
+		if (!src_amt.has_value())
+		{
+			MessageInfo().Text(L"Amount is not a valid Number");
+			co_return;
+		}
+		if (src_amt->units == 0)
 		{
 			// In case the Amount Provided is Zero
 			// Then we can safely assume that the response
@@ -148,23 +255,32 @@ namespace winrt::CurrencyConversion::implementation
 			// https://stackoverflow.com/questions/49640092/how-to-call-a-method-on-the-gui-thread-in-c-winrt
 			co_await resume_background();
 
-			const double converted_amt_unit_1 =
+			const TUESL::Numeric::Rate converted_amt_unit_1{
 				 // This function returns the monetary converted value for only 1 Unit
-				 co_await m_currency_converter.GetConvertedCurrencyValue(from_code, to_code);
+				 co_await m_currency_converter.GetConversionRate(from_code, to_code)};
 
-			const double converted_amt = converted_amt_unit_1 * src_amt;
+			// Exact, Rounded Half Away from Zero to Money::DECIMALS
+			const auto converted_amt =
+				 TUESL::Numeric::convert(src_amt.value(), converted_amt_unit_1);
 
 			// As it can be assumed the memory intensive calculations are over
 			// We can now re-enable the GUI thread
 			co_await winrt::resume_foreground(Dispatcher());
 
-			// Change Reading Only if Value is Not 0
+			// A later Keystroke has Started an Update of its own
+			// Which Displays the Amount as it now is
+			if (update != m_reading_update)
+				co_return;
+
+			// Change Reading Only if Rate is Not 0
 			// 0 is used here as an Error Value
-			if (converted_amt != 0.0)
+			if (converted_amt_unit_1.units != 0 && converted_amt.has_value())
 			{
 				// Set the To Screen to this value
-				ToAmt().Text(winrt::to_hstring(converted_amt));
+				ToAmt().Text(winrt::to_hstring(converted_amt->toString()));
 				MessageInfo().Text(L"");
+
+				ReportTimeToFirstConversion();
 			}
 			else
 			{
@@ -182,7 +298,7 @@ namespace winrt::CurrencyConversion::implementation
 		std::smatch matches;
 
 		// Read the Reading from the Text Box
-		const std::string amount_val = to_string(FromAmt().Text());
+		const std::string amount_val = TUESL::Utility::toUTF8(FromAmt().Text()).value_or("");
 
 		// Note that this regex runs and checks
 		// If the given input is not a Numeric Value
@@ -212,8 +328,28 @@ namespace winrt::CurrencyConversion::implementation
 	{
 		InitializeComponent();
 
+		m_started_warm = m_currency_converter.IsWarm();
+
+		// The App may be Terminated at any point after Suspension
+		// As such the Snapshot is Saved here rather than on Exit
+		// The Deferral holds Suspension back until it is
+		m_suspending_token = Application::Current().Suspending(
+			 [this](const IInspectable&, const SuspendingEventArgs& p_args) {
+				 FlushOnSuspend(p_args.SuspendingOperation().GetDeferral());
+			 });
+
 		AddValuesToCurrencyIDList();
 
 		CleanupDatabaseOfOldCurrencyConversionsInFixTimePeriod();
+
+		BackupDatabaseInFixTimePeriod();
+	}
+
+	MainPage::~MainPage()
+	{
+		Application::Current().Suspending(m_suspending_token);
+
+		if (m_backup_timer)
+			m_backup_timer.Cancel();
 	}
 } // namespace winrt::CurrencyConversion::implementation
\ No newline at end of file
@@ -15,6 +15,8 @@
 #include <winrt/Windows.UI.Xaml.Controls.h>
 #include <winrt/Windows.UI.Xaml.Markup.h>
 
+#include <chrono>
+#include <cstdint>
 #include <regex>
 
 namespace winrt::CurrencyConversion::implementation
@@ -29,22 +31,49 @@ namespace winrt::CurrencyConversion::implementation
 		using namespace Windows::UI::Core;
 		using namespace Windows::UI::ViewManagement;
 
+		using Windows::ApplicationModel::SuspendingDeferral;
+		using Windows::ApplicationModel::SuspendingEventArgs;
 		using Windows::System::Threading::ThreadPoolTimer;
 	} // namespace
 
 	struct MainPage : MainPageT<MainPage>
 	{
 	 private:
+		// Used to Measure Time to First Conversion
+		// Declared First so that it also Covers Loading the Snapshot
+		const std::chrono::steady_clock::time_point m_started_at =
+			 std::chrono::steady_clock::now();
+		bool m_started_warm					= false;
+		bool m_first_conversion_reported = false;
+
 		Currency::CurrencyConverter m_currency_converter;
 		IVector<IInspectable>		 m_currency_list;
 
+		// Counts Updates Started, only Touched on the UI Thread
+		// An Update Displays its Result only if no later one has Started
+		std::uint64_t m_reading_update = 0;
+
+		event_token m_suspending_token;
+
+		// Fires on the Pool until Cancelled, which the Destructor does
+		ThreadPoolTimer m_backup_timer{nullptr};
+
 	 public:
 		IVector<IInspectable> CurrencyNameList() const;
 
 		fire_and_forget AddValuesToCurrencyIDList();
 
+		void SelectMostRecentPair();
+
+		void ReportTimeToFirstConversion();
+
 		void CleanupDatabaseOfOldCurrencyConversionsInFixTimePeriod();
 
+		void BackupDatabaseInFixTimePeriod();
+
+		// Saves everything Held in Memory off the UI Thread, then Completes p_deferral
+		fire_and_forget FlushOnSuspend(SuspendingDeferral p_deferral);
+
 		IAsyncAction UpdateReadingsAsync();
 
 		fire_and_forget Amt_Changed(const IInspectable&, const TextChangedEventArgs&);
@@ -54,6 +83,7 @@ namespace winrt::CurrencyConversion::implementation
 
 
 		MainPage();
+		~MainPage();
 	};
 } // namespace winrt::CurrencyConversion::implementation
 
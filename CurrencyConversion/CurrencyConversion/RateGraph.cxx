@@ -0,0 +1,122 @@
+// Includes the pch file
+// This is known to boost compilation speeds
+#include "pch.h"
+
+#include "RateGraph.hxx"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Currency
+{
+	namespace
+	{
+		// Added to every Edge, so that a Route must Beat one with fewer Hops by more than this
+		// Above the Rounding of -log(rate) in a Float
+		// As such Rounding alone never makes a Cycle look Profitable
+		constexpr const float HOP_PENALTY = 1e-5f;
+
+		float EdgeWeight(const Rate p_rate)
+		{
+			// 0 is the Error Rate, it is no Edge at all
+			if (p_rate.units <= 0)
+				return HopBoundedPaths::NO_EDGE;
+			return static_cast<float>(-std::log(p_rate.toDouble())) + HOP_PENALTY;
+		}
+
+		// Node of p_code, or std::size(p_codes) if it is not one
+		std::size_t FindNode(const std::vector<hstring>& p_codes, const hstring& p_code)
+		{
+			const auto it = std::lower_bound(std::begin(p_codes), std::end(p_codes), p_code);
+			if (it == std::end(p_codes) || *it != p_code)
+				return std::size(p_codes);
+			return static_cast<std::size_t>(it - std::begin(p_codes));
+		}
+	} // namespace
+
+	RateGraph RateGraph::Build(const CurrencySnapshot& p_cache,
+										const std::int64_t		p_oldest_time,
+										const std::size_t		p_max_edges)
+	{
+		RateGraph graph;
+
+		for (const auto& currency : p_cache.currencies)
+			graph.codes.push_back(currency.id);
+		for (const auto& [pair, cached_rate] : p_cache.rates)
+		{
+			graph.codes.push_back(pair.from_code);
+			graph.codes.push_back(pair.to_code);
+		}
+		std::sort(std::begin(graph.codes), std::end(graph.codes));
+		graph.codes.erase(std::unique(std::begin(graph.codes), std::end(graph.codes)),
+								std::end(graph.codes));
+
+		graph.paths = HopBoundedPaths{std::size(graph.codes), p_max_edges};
+
+		for (const auto& [pair, cached_rate] : p_cache.rates)
+		{
+			if (cached_rate.time < p_oldest_time)
+				continue;
+
+			graph.paths.setWeight(FindNode(graph.codes, pair.from_code),
+										 FindNode(graph.codes, pair.to_code),
+										 EdgeWeight(cached_rate.rate));
+		}
+		graph.paths.recompute();
+
+		return graph;
+	}
+
+	bool RateGraph::Update(const std::map<CurrencyPair, CachedRate>& p_rates,
+								  const std::vector<CurrencyPair>&			 p_changed_pairs)
+	{
+		struct Edge
+		{
+			std::size_t from;
+			std::size_t to;
+			float			weight;
+		};
+
+		// Every Change is Checked before any is Applied
+		std::vector<Edge> edges;
+		edges.reserve(std::size(p_changed_pairs));
+
+		for (const auto& pair : p_changed_pairs)
+		{
+			const auto it = p_rates.find(pair);
+			if (it == std::end(p_rates))
+				return false;
+
+			const Edge edge{FindNode(codes, pair.from_code),
+								 FindNode(codes, pair.to_code),
+								 EdgeWeight(it->second.rate)};
+
+			if (edge.from == std::size(codes) || edge.to == std::size(codes))
+				return false;
+
+			// A Rate that Fell may have been on any Route
+			if (edge.weight > paths.weight(edge.from, edge.to))
+				return false;
+
+			edges.push_back(edge);
+		}
+
+		for (const auto& edge : edges)
+			paths.lowerWeight(edge.from, edge.to, edge.weight);
+		return true;
+	}
+
+	std::vector<hstring> RateGraph::Route(const hstring& p_from_code,
+													  const hstring& p_to_code) const
+	{
+		const auto from = FindNode(codes, p_from_code);
+		const auto to	 = FindNode(codes, p_to_code);
+		if (from == std::size(codes) || to == std::size(codes))
+			return {};
+
+		std::vector<hstring> route;
+		for (const auto node : paths.path(from, to))
+			route.push_back(codes[node]);
+		return route;
+	}
+} // namespace Currency
@@ -0,0 +1,54 @@
+#pragma once
+
+// Cached Rates as a Graph of Currencies
+// Lets a Pair without a Fresh Rate of its own be Converted through other Currencies
+//
+// Each Rate is an Edge of Weight -log(rate), the Cheapest Path is thereby the Best Rate
+// Every Pair is Solved Ahead of Time, as such a Route is a Lookup and never Waits
+// The Solver only Picks the Route, the Rate along it is Chained Exactly by the Caller
+
+#include <winrt/Windows.Foundation.h>
+
+#include <TUESL/Numeric/HopBoundedPaths.hxx>
+
+#include "CurrencySnapshot.hxx"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+namespace Currency
+{
+	namespace
+	{
+		using winrt::hstring;
+
+		using TUESL::Numeric::HopBoundedPaths;
+	} // namespace
+
+	struct RateGraph
+	{
+		// Sorted, the Node of a Currency is its Index
+		std::vector<hstring> codes;
+
+		HopBoundedPaths paths;
+
+		// Nodes are every Currency of the Table and every Currency a Rate refers to
+		// Rates older than p_oldest_time are Left out
+		static RateGraph Build(const CurrencySnapshot& p_cache,
+									  const std::int64_t		p_oldest_time,
+									  const std::size_t		p_max_edges);
+
+		// Folds in the Rates of p_changed_pairs from p_rates Incrementally
+		// Only possible if each one is between Known Currencies and did not Fall
+		// Returns false, Changing nothing, if any other Change is among them
+		// Build is then Needed
+		bool Update(const std::map<CurrencyPair, CachedRate>& p_rates,
+						const std::vector<CurrencyPair>&			p_changed_pairs);
+
+		// Currencies from p_from_code to p_to_code, both Included
+		// Empty if either is Unknown or there is no Route
+		std::vector<hstring> Route(const hstring& p_from_code, const hstring& p_to_code) const;
+	};
+} // namespace Currency
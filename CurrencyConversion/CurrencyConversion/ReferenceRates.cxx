@@ -0,0 +1,366 @@
+// Includes the pch file
+// This is known to boost compilation speeds
+#include "pch.h"
+
+#include "ReferenceRates.hxx"
+
+#include <TUESL/Utility/DelimiterScan.hxx>
+
+#include <array>
+#include <charconv>
+#include <cstdio>
+#include <stdexcept>
+#include <vector>
+
+namespace Currency
+{
+	namespace
+	{
+		using TUESL::Utility::Delimiters;
+		using TUESL::Utility::DelimiterScanner;
+
+		constexpr const auto NPOS = std::string_view::npos;
+
+		constexpr const std::string_view UTF8_BOM = "\xEF\xBB\xBF";
+
+		// Tag Rates and Days are Held in, and its Attributes
+		constexpr const std::string_view TAG_CUBE			  = "Cube";
+		constexpr const std::string_view ATTRIBUTE_TIME		  = "time";
+		constexpr const std::string_view ATTRIBUTE_CURRENCY = "currency";
+		constexpr const std::string_view ATTRIBUTE_RATE		  = "rate";
+
+		constexpr const std::array<std::string_view, 12> MONTH_NAMES = {
+			 "January", "February", "March",	  "April",	"May",		"June",
+			 "July",		"August",	"September", "October", "November", "December"};
+
+		// Ticks of winrt::clock, 100 Nanoseconds each, since 1601-01-01
+		constexpr const std::int64_t TICKS_PER_DAY = 864'000'000'000;
+		// Days from 1601-01-01 to 1970-01-01
+		constexpr const std::int64_t EPOCH_DAYS_BEFORE_1970 = 134'774;
+
+		bool isBlank(const char p_char) noexcept
+		{
+			return p_char == ' ' || p_char == '\t' || p_char == '\r' || p_char == '\n';
+		}
+
+		// Without the Blanks around it, which includes the Carriage Return of a Line
+		std::string_view trim(std::string_view p_text) noexcept
+		{
+			while (!std::empty(p_text) && isBlank(p_text.front()))
+				p_text.remove_prefix(1);
+			while (!std::empty(p_text) && isBlank(p_text.back()))
+				p_text.remove_suffix(1);
+			return p_text;
+		}
+
+		std::optional<int> parseNumber(const std::string_view p_text) noexcept
+		{
+			int			number = 0;
+			const auto end		= std::data(p_text) + std::size(p_text);
+			const auto result = std::from_chars(std::data(p_text), end, number);
+			if (std::empty(p_text) || result.ec != std::errc{} || result.ptr != end)
+				return std::nullopt;
+			return number;
+		}
+
+		bool isLeapYear(const int p_year) noexcept
+		{
+			return (p_year % 4 == 0 && p_year % 100 != 0) || p_year % 400 == 0;
+		}
+		int daysInMonth(const int p_year, const int p_month) noexcept
+		{
+			constexpr const int days[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+			return p_month == 2 && isLeapYear(p_year) ? 29 : days[p_month - 1];
+		}
+
+		// Days since 1970-01-01 of a Day of the Proleptic Gregorian Calendar
+		// See Howard Hinnant's days_from_civil
+		std::int64_t daysFromCivil(int p_year, const int p_month, const int p_day) noexcept
+		{
+			p_year -= p_month <= 2 ? 1 : 0;
+
+			const std::int64_t era			  = (p_year >= 0 ? p_year : p_year - 399) / 400;
+			const std::int64_t year_of_era  = p_year - era * 400;
+			const std::int64_t day_of_year  = (153 * (p_month + (p_month > 2 ? -3 : 9)) + 2) / 5 +
+														 p_day - 1;
+			const std::int64_t day_of_era =
+				 year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+
+			return era * 146'097 + day_of_era - 719'468;
+		}
+
+		struct CivilDay
+		{
+			int year;
+			int month;
+			int day;
+		};
+
+		// Day of the Proleptic Gregorian Calendar p_days after 1970-01-01
+		// See Howard Hinnant's civil_from_days
+		CivilDay civilFromDays(std::int64_t p_days) noexcept
+		{
+			p_days += 719'468;
+
+			const std::int64_t era			 = (p_days >= 0 ? p_days : p_days - 146'096) / 146'097;
+			const std::int64_t day_of_era	 = p_days - era * 146'097;
+			const std::int64_t year_of_era = (day_of_era - day_of_era / 1'460 + day_of_era / 36'524 -
+														 day_of_era / 146'096) /
+														365;
+			const std::int64_t day_of_year =
+				 day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+			const std::int64_t month_index = (5 * day_of_year + 2) / 153;
+
+			const int day	 = static_cast<int>(day_of_year - (153 * month_index + 2) / 5 + 1);
+			const int month = static_cast<int>(month_index < 10 ? month_index + 3 : month_index - 9);
+			const int year	 = static_cast<int>(year_of_era + era * 400 + (month <= 2 ? 1 : 0));
+			return {year, month, day};
+		}
+
+		std::optional<std::int64_t> dayToTicks(const std::optional<int> p_year,
+															const std::optional<int> p_month,
+															const std::optional<int> p_day) noexcept
+		{
+			if (!p_year.has_value() || !p_month.has_value() || !p_day.has_value())
+				return std::nullopt;
+			// Ticks before 1601 would be Negative
+			if (*p_year < 1601 || *p_year > 9999 || *p_month < 1 || *p_month > 12)
+				return std::nullopt;
+			if (*p_day < 1 || *p_day > daysInMonth(*p_year, *p_month))
+				return std::nullopt;
+
+			return (daysFromCivil(*p_year, *p_month, *p_day) + EPOCH_DAYS_BEFORE_1970) *
+					 TICKS_PER_DAY;
+		}
+
+		// Rates of 0 or below are the Error Value, as such they are Skipped as well
+		std::optional<Rate> parseRate(const std::string_view p_text) noexcept
+		{
+			const auto rate = Rate::parse(p_text);
+			if (!rate.has_value() || rate->units <= 0)
+				return std::nullopt;
+			return rate;
+		}
+
+		// Date,USD,JPY,...
+		// 2024-01-05,1.0921,158.42,...
+		// Columns of the Header which are Empty, such as after a Trailing Comma, are Skipped
+		ReferenceRateStatistics readCSV(const std::string_view		 p_text,
+												  const ReferenceRateVisitor& p_visitor)
+		{
+			ReferenceRateStatistics statistics;
+
+			// As many as there are Currencies, the first Column is the Day
+			std::vector<std::string_view> currencies;
+
+			DelimiterScanner scanner{p_text, Delimiters{",\n"}};
+
+			bool								  is_header = true;
+			std::size_t						  column		= 0;
+			std::size_t						  field_begin = 0;
+			std::optional<std::int64_t> time;
+
+			for (;;)
+			{
+				const auto delimiter = scanner.next();
+				const auto field_end = delimiter == NPOS ? std::size(p_text) : delimiter;
+				const auto field = trim(p_text.substr(field_begin, field_end - field_begin));
+
+				if (is_header)
+				{
+					if (column != 0)
+						currencies.push_back(field);
+				}
+				else if (column == 0)
+					time = std::empty(field) ? std::nullopt : ParseReferenceDay(field);
+				else if (!std::empty(field))
+				{
+					const auto rate = parseRate(field);
+
+					if (column > std::size(currencies) || std::empty(currencies[column - 1]) ||
+						 !time.has_value() || !rate.has_value())
+						++statistics.skipped;
+					else
+					{
+						p_visitor(ReferenceRate{currencies[column - 1], rate.value(), time.value()});
+						++statistics.rates;
+					}
+				}
+
+				if (delimiter == NPOS)
+					break;
+
+				if (p_text[delimiter] == '\n')
+				{
+					if (is_header && std::empty(currencies))
+						throw std::invalid_argument("The CSV Header has no Currencies");
+
+					is_header = false;
+					column	 = 0;
+				}
+				else
+					++column;
+
+				field_begin = delimiter + 1;
+			}
+
+			if (is_header && std::empty(currencies))
+				throw std::invalid_argument("The CSV Header has no Currencies");
+
+			return statistics;
+		}
+
+		// Calls p_function with the Name and Value of every name='value' within p_tag
+		// Stops at the first which is Malformed
+		template <typename Function>
+		void forEachAttribute(const std::string_view p_tag, Function p_function)
+		{
+			std::size_t i = 0;
+			const auto	skipBlanks = [&] {
+				 while (i < std::size(p_tag) && (isBlank(p_tag[i]) || p_tag[i] == '/'))
+					 ++i;
+			};
+
+			for (;;)
+			{
+				skipBlanks();
+				const auto name_begin = i;
+				while (i < std::size(p_tag) && p_tag[i] != '=' && !isBlank(p_tag[i]))
+					++i;
+				const auto name = p_tag.substr(name_begin, i - name_begin);
+
+				skipBlanks();
+				if (i >= std::size(p_tag) || p_tag[i] != '=')
+					return;
+				++i;
+				skipBlanks();
+				if (i >= std::size(p_tag) || (p_tag[i] != '\'' && p_tag[i] != '"'))
+					return;
+
+				const auto value_end = p_tag.find(p_tag[i], i + 1);
+				if (value_end == NPOS)
+					return;
+
+				p_function(name, p_tag.substr(i + 1, value_end - i - 1));
+				i = value_end + 1;
+			}
+		}
+
+		// <Cube time='2024-01-05'>
+		//		<Cube currency='USD' rate='1.0921'/>
+		// Every other Tag is Skipped, as are Comments and Declarations
+		ReferenceRateStatistics readXML(const std::string_view		 p_text,
+												  const ReferenceRateVisitor& p_visitor)
+		{
+			ReferenceRateStatistics statistics;
+
+			DelimiterScanner scanner{p_text, Delimiters{"<>"}};
+
+			std::size_t						  tag_begin = NPOS;
+			std::optional<std::int64_t> time;
+
+			for (auto delimiter = scanner.next(); delimiter != NPOS; delimiter = scanner.next())
+			{
+				if (p_text[delimiter] == '<')
+				{
+					tag_begin = delimiter + 1;
+					continue;
+				}
+				if (tag_begin == NPOS)
+					continue;
+
+				const auto tag = p_text.substr(tag_begin, delimiter - tag_begin);
+				tag_begin		= NPOS;
+
+				if (tag.substr(0, std::size(TAG_CUBE)) != TAG_CUBE ||
+					 (std::size(tag) > std::size(TAG_CUBE) && !isBlank(tag[std::size(TAG_CUBE)]) &&
+					  tag[std::size(TAG_CUBE)] != '/'))
+					continue;
+
+				std::string_view currency;
+				std::string_view rate_text;
+				const auto readAttribute = [&](const std::string_view p_name,
+														 const std::string_view p_value) {
+					if (p_name == ATTRIBUTE_TIME)
+						time = ParseReferenceDay(trim(p_value));
+					else if (p_name == ATTRIBUTE_CURRENCY)
+						currency = trim(p_value);
+					else if (p_name == ATTRIBUTE_RATE)
+						rate_text = trim(p_value);
+				};
+				forEachAttribute(tag.substr(std::size(TAG_CUBE)), readAttribute);
+
+				// The Day or the Cube which only Encloses the others
+				if (std::empty(currency) && std::empty(rate_text))
+					continue;
+
+				const auto rate = parseRate(rate_text);
+				if (std::empty(currency) || !time.has_value() || !rate.has_value())
+				{
+					++statistics.skipped;
+					continue;
+				}
+
+				p_visitor(ReferenceRate{currency, rate.value(), time.value()});
+				++statistics.rates;
+			}
+
+			return statistics;
+		}
+	} // namespace
+
+	ReferenceRateStatistics ReadReferenceRates(const std::string_view		 p_text,
+															 const ReferenceRateVisitor& p_visitor)
+	{
+		auto text = p_text;
+		if (text.substr(0, std::size(UTF8_BOM)) == UTF8_BOM)
+			text.remove_prefix(std::size(UTF8_BOM));
+
+		const auto first = trim(text);
+		if (!std::empty(first) && first.front() == '<')
+			return readXML(text, p_visitor);
+		return readCSV(text, p_visitor);
+	}
+
+	std::optional<std::int64_t> ParseReferenceDay(const std::string_view p_text) noexcept
+	{
+		// 2024-01-05
+		if (std::size(p_text) == 10 && p_text[4] == '-' && p_text[7] == '-')
+			return dayToTicks(parseNumber(p_text.substr(0, 4)),
+									parseNumber(p_text.substr(5, 2)),
+									parseNumber(p_text.substr(8, 2)));
+
+		// 05 January 2024
+		const auto first_space = p_text.find(' ');
+		const auto last_space  = p_text.rfind(' ');
+		if (first_space == NPOS || first_space == last_space)
+			return std::nullopt;
+
+		const auto month_name = p_text.substr(first_space + 1, last_space - first_space - 1);
+
+		std::optional<int> month;
+		for (std::size_t i = 0; i < std::size(MONTH_NAMES); ++i)
+		{
+			if (month_name == MONTH_NAMES[i])
+				month = static_cast<int>(i) + 1;
+		}
+
+		return dayToTicks(parseNumber(p_text.substr(last_space + 1)),
+								month,
+								parseNumber(p_text.substr(0, first_space)));
+	}
+
+	std::int64_t ReferenceDayOf(const std::int64_t p_ticks) noexcept
+	{
+		return p_ticks - p_ticks % TICKS_PER_DAY;
+	}
+
+	std::string FormatReferenceDay(const std::int64_t p_ticks)
+	{
+		const auto day = civilFromDays(p_ticks / TICKS_PER_DAY - EPOCH_DAYS_BEFORE_1970);
+
+		char text[16];
+		std::snprintf(text, sizeof(text), "%04d-%02d-%02d", day.year, day.month, day.day);
+		return text;
+	}
+} // namespace Currency
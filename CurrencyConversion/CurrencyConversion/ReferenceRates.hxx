@@ -0,0 +1,71 @@
+#pragma once
+
+// Reads the Reference Rate Files Central Banks Publish, such as those of the ECB
+// Machines without Network Access are Handed these in place of the Service
+//
+// Two Layouts are Read, told apart by their first Byte
+//
+//	CSV, a Column per Currency and a Row per Day, as eurofxref-hist.csv
+//		Date,USD,JPY,...
+//		2024-01-05,1.0921,158.42,...
+//
+//	XML, as eurofxref-daily.xml and eurofxref-hist.xml
+//		<Cube time='2024-01-05'>
+//			<Cube currency='USD' rate='1.0921'/>
+//
+// Every Rate is the Price of one Unit of the Base Currency of the File, the Euro for the ECB
+// Dates are YYYY-MM-DD or, as the Daily CSV has them, 05 January 2024
+//
+// Fields and Tags are Found by a Vector Delimiter Scan and Handed out as Views of the Text
+// As such nothing is Allocated per Rate, and a Memory Mapped File is never Copied
+
+#include <TUESL/Numeric/FixedPoint.hxx>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace Currency
+{
+	namespace
+	{
+		using TUESL::Numeric::Rate;
+	} // namespace
+
+	struct ReferenceRate
+	{
+		// Code as the File has it, Viewing the Text
+		std::string_view currency;
+		Rate				  rate;
+		// Midnight UTC of the Day, in Ticks since the Epoch as the Time Column
+		std::int64_t time = 0;
+	};
+
+	struct ReferenceRateStatistics
+	{
+		std::size_t rates = 0;
+		// Rates which could not be Read, such as N/A, or whose Day could not be
+		std::size_t skipped = 0;
+	};
+
+	using ReferenceRateVisitor = std::function<void(const ReferenceRate&)>;
+
+	// Calls p_visitor with every Rate, in the Order of the File
+	// Throws std::invalid_argument if a CSV File has no Currency in its Header
+	// Anything p_visitor Throws Stops the Reading and is Rethrown
+	ReferenceRateStatistics ReadReferenceRates(const std::string_view		 p_text,
+															 const ReferenceRateVisitor& p_visitor);
+
+	// Midnight UTC of the Day, in Ticks since the Epoch
+	// nullopt if p_text is neither of the Layouts above, or not a Day of the Calendar
+	std::optional<std::int64_t> ParseReferenceDay(const std::string_view p_text) noexcept;
+
+	// Midnight UTC of the Day p_ticks falls on, as ParseReferenceDay would Return it
+	std::int64_t ReferenceDayOf(const std::int64_t p_ticks) noexcept;
+
+	// YYYY-MM-DD of the Day p_ticks falls on, in UTC, as ParseReferenceDay Reads it
+	std::string FormatReferenceDay(const std::int64_t p_ticks);
+} // namespace Currency
@@ -0,0 +1,633 @@
+// Includes the pch file
+// This is known to boost compilation speeds
+#include "pch.h"
+
+#include "ResponseArchive.hxx"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace Currency
+{
+	namespace
+	{
+		using namespace std::string_literals;
+
+		using TUESL::Compression::Dictionary;
+		using TUESL::Compression::DictionaryDecoder;
+		using TUESL::Compression::DictionaryEncoder;
+		using TUESL::Compression::MAX_BLOCK_SIZE;
+
+		using TUESL::Metrics::ScopedTimer;
+
+		using TUESL::SQLite::Blob;
+		using TUESL::SQLite::Database;
+		using TUESL::SQLite::PrepareStatement;
+		using TUESL::SQLite::SQLiteException;
+		namespace DataTypes = TUESL::SQLite::DataTypes;
+
+		namespace TableNames
+		{
+			constexpr const auto TABLE_RESPONSE_ARCHIVE		 = "TABLE_RESPONSE_ARCHIVE";
+			constexpr const auto TABLE_RESPONSE_BLOCKS		 = "TABLE_RESPONSE_BLOCKS";
+			constexpr const auto TABLE_RESPONSE_DICTIONARIES = "TABLE_RESPONSE_DICTIONARIES";
+		} // namespace TableNames
+		namespace ColumnNames
+		{
+			namespace Archive
+			{
+				constexpr const auto COLUMN_ID	= "id";
+				constexpr const auto COLUMN_URI	= "uri";
+				constexpr const auto COLUMN_TIME = "time";
+				// Bytes of the Body as it was Returned
+				constexpr const auto COLUMN_SIZE = "size";
+				// id of the Dictionary, 0 for none
+				constexpr const auto COLUMN_DICTIONARY = "dictionary";
+			} // namespace Archive
+			namespace Blocks
+			{
+				constexpr const auto COLUMN_RESPONSE = "response";
+				constexpr const auto COLUMN_SEQUENCE = "sequence";
+				constexpr const auto COLUMN_DATA		 = "data";
+			} // namespace Blocks
+			namespace Dictionaries
+			{
+				constexpr const auto COLUMN_ID	= "id";
+				constexpr const auto COLUMN_DATA = "data";
+			} // namespace Dictionaries
+		}	 // namespace ColumnNames
+		namespace IndexNames
+		{
+			// Reads the Blocks of a Response in Order without Sorting them
+			constexpr const auto INDEX_RESPONSE_BLOCKS = "INDEX_RESPONSE_BLOCKS";
+		} // namespace IndexNames
+		std::optional<Dictionary> ReadDictionary(Database& p_db, const std::int64_t p_id)
+		{
+			try
+			{
+				Blob blob{p_db,
+							 TableNames::TABLE_RESPONSE_DICTIONARIES,
+							 ColumnNames::Dictionaries::COLUMN_DATA,
+							 p_id};
+
+				std::string bytes(blob.size(), '\0');
+				blob.read(0, std::data(bytes), std::size(bytes));
+				return Dictionary{std::move(bytes)};
+			}
+			catch (const SQLiteException&)
+			{
+				return std::nullopt;
+			}
+			catch (const std::invalid_argument&)
+			{
+				return std::nullopt;
+			}
+		}
+	} // namespace
+
+	ArchivedResponseReader::ArchivedResponseReader(
+		 Database&										  p_db,
+		 ArchivedResponse								  p_response,
+		 std::shared_ptr<const DictionaryDecoder> p_decoder) :
+		 m_response{std::move(p_response)},
+		 m_db{&p_db},
+		 m_decoder{std::move(p_decoder)},
+		 m_remaining{m_response.size}
+	{
+		static const std::string sql =
+			 "SELECT rowid FROM "s + TableNames::TABLE_RESPONSE_BLOCKS + " WHERE "s +
+			 ColumnNames::Blocks::COLUMN_RESPONSE + " = ? ORDER BY "s +
+			 ColumnNames::Blocks::COLUMN_SEQUENCE + ";"s;
+
+		m_blocks.prepare(p_db, sql);
+		m_blocks.bind(static_cast<DataTypes::Int64>(m_response.id));
+	}
+	bool ArchivedResponseReader::readBlock()
+	{
+		if (!m_blocks.hasNext())
+			return false;
+
+		const auto rowid = m_blocks.get<DataTypes::Int64>();
+		if (!rowid.has_value())
+			return false;
+
+		// Reopened for every later Block, rather than Opened anew
+		if (!m_blob.has_value())
+			m_blob.emplace(*m_db,
+								TableNames::TABLE_RESPONSE_BLOCKS,
+								ColumnNames::Blocks::COLUMN_DATA,
+								rowid.value());
+		else
+			m_blob->reopen(rowid.value());
+
+		m_encoded.resize(m_blob->size());
+		m_blob->read(0, std::data(m_encoded), std::size(m_encoded));
+
+		m_block.clear();
+		m_block_position = 0;
+		return m_decoder->decode(std::data(m_encoded), std::size(m_encoded), m_block);
+	}
+	std::size_t ArchivedResponseReader::read(char* p_buffer, const std::size_t p_size)
+	{
+		std::size_t copied = 0;
+		try
+		{
+			while (copied < p_size && !m_is_corrupt)
+			{
+				if (m_block_position == std::size(m_block))
+				{
+					if (m_remaining == 0)
+						break;
+
+					// A Missing, Empty or Overlong Block
+					if (!readBlock() || std::empty(m_block) || std::size(m_block) > m_remaining)
+					{
+						m_is_corrupt = true;
+						break;
+					}
+				}
+
+				const auto length =
+					 (std::min)(p_size - copied, std::size(m_block) - m_block_position);
+				std::memcpy(p_buffer + copied, std::data(m_block) + m_block_position, length);
+
+				copied += length;
+				m_block_position += length;
+				m_remaining -= length;
+			}
+		}
+		catch (const SQLiteException&)
+		{
+			m_is_corrupt = true;
+		}
+		return copied;
+	}
+
+	ResponseArchive::ResponseArchive(Database&				 p_db,
+												std::mutex&				 p_write_mutex,
+												const ArchiveOptions& p_options) :
+		 m_db{p_db},
+		 m_write_mutex{p_write_mutex},
+		 m_options{p_options},
+		 m_responses_archived{TUESL::Metrics::Registry::global().counter(
+			  "currency_archive_responses_total", "Upstream Responses Archived")},
+		 m_raw_bytes{TUESL::Metrics::Registry::global().counter(
+			  "currency_archive_bytes_total", "Bytes of Responses Archived", {{"form", "raw"}})},
+		 m_stored_bytes{TUESL::Metrics::Registry::global().counter(
+			  "currency_archive_bytes_total", "Bytes of Responses Archived", {{"form", "stored"}})},
+		 m_write_time{TUESL::Metrics::Registry::global().histogram(
+			  "currency_archive_write_seconds", "Time to Compress and Write a Response")}
+	{
+		std::lock_guard<std::mutex> write_lock{m_write_mutex};
+
+		CreateTables();
+		LoadDictionary();
+	}
+	ResponseArchive::~ResponseArchive()
+	{
+		std::unique_lock<std::mutex> training_lock{m_training_mutex};
+		m_training_done.wait(training_lock, [this] { return !m_is_training; });
+	}
+	void ResponseArchive::CreateTables()
+	{
+		m_db.executeSQL("CREATE TABLE IF NOT EXISTS "s + TableNames::TABLE_RESPONSE_ARCHIVE +
+							 " ("s + ColumnNames::Archive::COLUMN_ID + " INTEGER PRIMARY KEY, "s +
+							 ColumnNames::Archive::COLUMN_URI + " TEXT NOT NULL, "s +
+							 ColumnNames::Archive::COLUMN_TIME + " INTEGER NOT NULL, "s +
+							 ColumnNames::Archive::COLUMN_SIZE + " INTEGER NOT NULL, "s +
+							 ColumnNames::Archive::COLUMN_DICTIONARY + " INTEGER NOT NULL);"s);
+
+		m_db.executeSQL("CREATE TABLE IF NOT EXISTS "s + TableNames::TABLE_RESPONSE_BLOCKS +
+							 " ("s + ColumnNames::Blocks::COLUMN_RESPONSE + " INTEGER NOT NULL, "s +
+							 ColumnNames::Blocks::COLUMN_SEQUENCE + " INTEGER NOT NULL, "s +
+							 ColumnNames::Blocks::COLUMN_DATA + " BLOB NOT NULL);"s);
+
+		m_db.executeSQL("CREATE UNIQUE INDEX IF NOT EXISTS "s +
+							 IndexNames::INDEX_RESPONSE_BLOCKS + " ON "s +
+							 TableNames::TABLE_RESPONSE_BLOCKS + "("s +
+							 ColumnNames::Blocks::COLUMN_RESPONSE + ", "s +
+							 ColumnNames::Blocks::COLUMN_SEQUENCE + ");"s);
+
+		m_db.executeSQL("CREATE TABLE IF NOT EXISTS "s +
+							 TableNames::TABLE_RESPONSE_DICTIONARIES + " ("s +
+							 ColumnNames::Dictionaries::COLUMN_ID + " INTEGER PRIMARY KEY, "s +
+							 ColumnNames::Dictionaries::COLUMN_DATA + " BLOB NOT NULL);"s);
+	}
+	void ResponseArchive::LoadDictionary()
+	{
+		PrepareStatement ps;
+		ps.prepare(m_db,
+					  "SELECT MAX("s + ColumnNames::Dictionaries::COLUMN_ID + ") FROM "s +
+						  TableNames::TABLE_RESPONSE_DICTIONARIES + ";"s);
+
+		// NULL, and as such 0, while there is none
+		const auto latest = ps.hasNext() ? ps.get<DataTypes::Int64>().value_or(0) : 0;
+		ps.reset();
+
+		// One that can not be Read back only means Training anew
+		if (latest != 0)
+		{
+			if (const auto dictionary = ReadDictionary(m_db, latest))
+			{
+				m_dictionary_id = latest;
+				m_encoder		 = DictionaryEncoder{dictionary.value()};
+				return;
+			}
+		}
+
+		ps.prepare(m_db,
+					  "SELECT COUNT(*) FROM "s + TableNames::TABLE_RESPONSE_ARCHIVE + " WHERE "s +
+						  ColumnNames::Archive::COLUMN_DICTIONARY + " = 0;"s);
+		if (ps.hasNext())
+			m_responses_without_dictionary =
+				 static_cast<std::size_t>(ps.get<DataTypes::Int64>().value_or(0));
+	}
+	std::shared_ptr<const DictionaryDecoder> ResponseArchive::DecoderFor(
+		 const std::int64_t p_dictionary_id)
+	{
+		std::lock_guard<std::mutex> decoder_lock{m_decoder_mutex};
+
+		const auto decoder = m_decoders.find(p_dictionary_id);
+		if (decoder != std::end(m_decoders))
+			return decoder->second;
+
+		std::optional<Dictionary> dictionary = Dictionary{};
+		if (p_dictionary_id != 0)
+			dictionary = ReadDictionary(m_db, p_dictionary_id);
+		if (!dictionary.has_value())
+			return nullptr;
+
+		auto loaded = std::make_shared<const DictionaryDecoder>(dictionary.value());
+		m_decoders.emplace(p_dictionary_id, loaded);
+		return loaded;
+	}
+	void ResponseArchive::UseDictionary(const Dictionary& p_dictionary)
+	{
+		static const std::string sql =
+			 "INSERT INTO "s + TableNames::TABLE_RESPONSE_DICTIONARIES + "("s +
+			 ColumnNames::Dictionaries::COLUMN_DATA + ") VALUES (zeroblob(?));"s;
+
+		const auto bytes = p_dictionary.bytes();
+
+		m_db.transactionBegin();
+		try
+		{
+			PrepareStatement ps;
+			ps.prepare(m_db, sql);
+			ps.bind(static_cast<DataTypes::Int64>(std::size(bytes)));
+			ps.execute();
+			ps.reset();
+
+			const auto id = m_db.lastInsertRowID();
+			Blob{m_db,
+				  TableNames::TABLE_RESPONSE_DICTIONARIES,
+				  ColumnNames::Dictionaries::COLUMN_DATA,
+				  id,
+				  Blob::Mode::READ_WRITE}
+				 .write(0, std::data(bytes), std::size(bytes));
+
+			m_db.transactionEnd();
+
+			m_dictionary_id					  = id;
+			m_encoder							  = DictionaryEncoder{p_dictionary};
+			m_responses_without_dictionary = 0;
+		}
+		catch (...)
+		{
+			m_db.transactionRollback();
+			throw;
+		}
+	}
+	Dictionary ResponseArchive::TrainOnRecent(const std::size_t p_responses)
+	{
+		std::vector<std::string> bodies;
+		std::size_t					 sample_bytes = 0;
+		for (const auto& response : RecentResponses(p_responses))
+		{
+			if (sample_bytes + response.size > m_options.max_training_bytes)
+				continue;
+
+			auto body = ReadAll(response.id);
+			if (!body.has_value())
+				continue;
+
+			sample_bytes += std::size(body.value());
+			bodies.push_back(std::move(body.value()));
+		}
+
+		const std::vector<std::string_view> samples(std::begin(bodies), std::end(bodies));
+		return Dictionary::train(samples);
+	}
+	winrt::fire_and_forget ResponseArchive::TrainInBackground()
+	{
+		co_await winrt::resume_background();
+
+		bool is_trained = false;
+		try
+		{
+			const auto dictionary = TrainOnRecent(m_options.training_responses);
+			if (!dictionary.empty())
+			{
+				std::lock_guard<std::mutex> write_lock{m_write_mutex};
+				UseDictionary(dictionary);
+				is_trained = true;
+			}
+		}
+		catch (...)
+		{
+		}
+
+		// Where they had too little in Common, it is Tried again as many Responses later
+		if (!is_trained)
+		{
+			std::lock_guard<std::mutex> write_lock{m_write_mutex};
+			m_responses_without_dictionary = 0;
+		}
+
+		// Notified under the Lock, as the Destructor may Return as soon as it is Released
+		std::lock_guard<std::mutex> training_lock{m_training_mutex};
+		m_is_training = false;
+		m_training_done.notify_all();
+	}
+	std::optional<std::int64_t> ResponseArchive::TrainDictionary(const std::size_t p_responses)
+	{
+		try
+		{
+			const auto dictionary = TrainOnRecent(p_responses);
+			if (dictionary.empty())
+				return std::nullopt;
+
+			std::lock_guard<std::mutex> write_lock{m_write_mutex};
+			UseDictionary(dictionary);
+			return m_dictionary_id;
+		}
+		catch (const SQLiteException&)
+		{
+			return std::nullopt;
+		}
+	}
+	std::size_t ResponseArchive::ExpireResponses()
+	{
+		// The id of the Newest Response past those Kept
+		static const std::string cutoff_sql =
+			 "SELECT "s + ColumnNames::Archive::COLUMN_ID + " FROM "s +
+			 TableNames::TABLE_RESPONSE_ARCHIVE + " ORDER BY "s + ColumnNames::Archive::COLUMN_ID +
+			 " DESC LIMIT 1 OFFSET ?;"s;
+		static const std::string blocks_sql =
+			 "DELETE FROM "s + TableNames::TABLE_RESPONSE_BLOCKS + " WHERE "s +
+			 ColumnNames::Blocks::COLUMN_RESPONSE + " <= ?;"s;
+		static const std::string responses_sql =
+			 "DELETE FROM "s + TableNames::TABLE_RESPONSE_ARCHIVE + " WHERE "s +
+			 ColumnNames::Archive::COLUMN_ID + " <= ?;"s;
+
+		if (m_options.max_responses == 0)
+			return 0;
+
+		std::lock_guard<std::mutex> write_lock{m_write_mutex};
+
+		PrepareStatement ps;
+		ps.prepare(m_db, cutoff_sql);
+		ps.bind(static_cast<DataTypes::Int64>(m_options.max_responses));
+
+		// No more than are Kept
+		if (!ps.hasNext())
+			return 0;
+		const auto cutoff = ps.get<DataTypes::Int64>().value_or(0);
+		ps.reset();
+
+		int responses_deleted = 0;
+		m_db.transactionBegin();
+		try
+		{
+			ps.prepare(m_db, blocks_sql);
+			ps.bind(cutoff);
+			ps.execute();
+			ps.reset();
+
+			ps.prepare(m_db, responses_sql);
+			ps.bind(cutoff);
+			ps.execute();
+			ps.reset();
+
+			responses_deleted = m_db.noOfRowsModified();
+		}
+		catch (...)
+		{
+			m_db.transactionRollback();
+			throw;
+		}
+		m_db.transactionEnd();
+
+		return static_cast<std::size_t>(responses_deleted);
+	}
+	std::optional<std::int64_t> ResponseArchive::Archive(const std::wstring_view p_uri,
+																		  const std::string_view	p_body,
+																		  const std::int64_t		p_time)
+	{
+		static const std::string response_sql =
+			 "INSERT INTO "s + TableNames::TABLE_RESPONSE_ARCHIVE + "("s +
+			 ColumnNames::Archive::COLUMN_URI + ","s + ColumnNames::Archive::COLUMN_TIME + ","s +
+			 ColumnNames::Archive::COLUMN_SIZE + ","s + ColumnNames::Archive::COLUMN_DICTIONARY +
+			 ") VALUES (?,?,?,?);"s;
+		static const std::string block_sql =
+			 "INSERT INTO "s + TableNames::TABLE_RESPONSE_BLOCKS + "("s +
+			 ColumnNames::Blocks::COLUMN_RESPONSE + ","s + ColumnNames::Blocks::COLUMN_SEQUENCE +
+			 ","s + ColumnNames::Blocks::COLUMN_DATA + ") VALUES (?,?,zeroblob(?));"s;
+
+		std::lock_guard<std::mutex> write_lock{m_write_mutex};
+
+		std::size_t stored_bytes = 0;
+		std::int64_t id			 = 0;
+		try
+		{
+			const ScopedTimer write_timer{m_write_time};
+
+			m_db.transactionBegin();
+			try
+			{
+				PrepareStatement response_ps;
+				response_ps.prepare(m_db, response_sql);
+				response_ps.bind(p_uri);
+				response_ps.bind(static_cast<DataTypes::Int64>(p_time));
+				response_ps.bind(static_cast<DataTypes::Int64>(std::size(p_body)));
+				response_ps.bind(static_cast<DataTypes::Int64>(m_dictionary_id));
+				response_ps.execute();
+				response_ps.reset();
+
+				id = m_db.lastInsertRowID();
+
+				PrepareStatement block_ps;
+				block_ps.prepare(m_db, block_sql);
+
+				// Opened on the first Block, and Moved on to each later one
+				std::optional<Blob> blob;
+
+				DataTypes::Int64 sequence = 0;
+				for (std::size_t offset = 0; offset < std::size(p_body); offset += MAX_BLOCK_SIZE)
+				{
+					m_encoded.clear();
+					m_encoder.encode(p_body.substr(offset, MAX_BLOCK_SIZE), m_encoded);
+
+					block_ps.restart();
+					block_ps.bind(static_cast<DataTypes::Int64>(id));
+					block_ps.bind(sequence++);
+					block_ps.bind(static_cast<DataTypes::Int64>(std::size(m_encoded)));
+					block_ps.execute();
+
+					const auto rowid = m_db.lastInsertRowID();
+					if (!blob.has_value())
+						blob.emplace(m_db,
+										 TableNames::TABLE_RESPONSE_BLOCKS,
+										 ColumnNames::Blocks::COLUMN_DATA,
+										 rowid,
+										 Blob::Mode::READ_WRITE);
+					else
+						blob->reopen(rowid);
+
+					blob->write(0, std::data(m_encoded), std::size(m_encoded));
+					stored_bytes += std::size(m_encoded);
+				}
+
+				// Closed before the Commit, an Open Blob is a Statement still Running
+				blob.reset();
+				block_ps.reset();
+
+				m_db.transactionEnd();
+			}
+			catch (...)
+			{
+				m_db.transactionRollback();
+				throw;
+			}
+		}
+		// Whatever Failed, a SQLite Error or a URI which is not Valid UTF-16
+		// it must not Reach the WebClient, the Response is Served all the same
+		catch (...)
+		{
+			return std::nullopt;
+		}
+
+		m_responses_archived.increment();
+		m_raw_bytes.increment(std::size(p_body));
+		m_stored_bytes.increment(stored_bytes);
+
+		if (m_dictionary_id == 0 && m_options.train_after_responses != 0 &&
+			 ++m_responses_without_dictionary >= m_options.train_after_responses)
+		{
+			// Training Reads back every Sample, which is not for the Thread of a Request
+			std::lock_guard<std::mutex> training_lock{m_training_mutex};
+			if (!m_is_training)
+			{
+				m_is_training = true;
+				TrainInBackground();
+			}
+		}
+
+		return id;
+	}
+	std::vector<ArchivedResponse> ResponseArchive::RecentResponses(const std::size_t p_count)
+	{
+		static const std::string sql =
+			 "SELECT "s + ColumnNames::Archive::COLUMN_ID + ","s + ColumnNames::Archive::COLUMN_URI +
+			 ","s + ColumnNames::Archive::COLUMN_TIME + ","s + ColumnNames::Archive::COLUMN_SIZE +
+			 ","s + ColumnNames::Archive::COLUMN_DICTIONARY + " FROM "s +
+			 TableNames::TABLE_RESPONSE_ARCHIVE + " ORDER BY "s + ColumnNames::Archive::COLUMN_ID +
+			 " DESC LIMIT ?;"s;
+
+		PrepareStatement ps;
+		ps.prepare(m_db, sql);
+		ps.bind(static_cast<DataTypes::Int64>(p_count));
+
+		std::vector<ArchivedResponse> responses;
+		while (ps.hasNext())
+		{
+			ArchivedResponse response;
+			response.id			= ps.get<DataTypes::Int64>().value_or(0);
+			response.uri		= ps.get<std::wstring>().value_or(L"");
+			response.time		= ps.get<DataTypes::Int64>().value_or(0);
+			response.size		= static_cast<std::size_t>(ps.get<DataTypes::Int64>().value_or(0));
+			response.dictionary = ps.get<DataTypes::Int64>().value_or(0);
+			responses.push_back(std::move(response));
+		}
+		return responses;
+	}
+	std::optional<ArchivedResponseReader> ResponseArchive::Open(const std::int64_t p_id)
+	{
+		static const std::string sql =
+			 "SELECT "s + ColumnNames::Archive::COLUMN_URI + ","s +
+			 ColumnNames::Archive::COLUMN_TIME + ","s + ColumnNames::Archive::COLUMN_SIZE + ","s +
+			 ColumnNames::Archive::COLUMN_DICTIONARY + " FROM "s +
+			 TableNames::TABLE_RESPONSE_ARCHIVE + " WHERE "s + ColumnNames::Archive::COLUMN_ID +
+			 " = ?;"s;
+
+		PrepareStatement ps;
+		ps.prepare(m_db, sql);
+		ps.bind(static_cast<DataTypes::Int64>(p_id));
+		if (!ps.hasNext())
+			return std::nullopt;
+
+		ArchivedResponse response;
+		response.id			= p_id;
+		response.uri		= ps.get<std::wstring>().value_or(L"");
+		response.time		= ps.get<DataTypes::Int64>().value_or(0);
+		response.size		= static_cast<std::size_t>(ps.get<DataTypes::Int64>().value_or(0));
+		response.dictionary = ps.get<DataTypes::Int64>().value_or(0);
+		ps.reset();
+
+		auto decoder = DecoderFor(response.dictionary);
+		if (!decoder)
+			return std::nullopt;
+
+		return std::optional<ArchivedResponseReader>{
+			 std::in_place, m_db, std::move(response), std::move(decoder)};
+	}
+	std::optional<std::string> ResponseArchive::ReadAll(const std::int64_t p_id)
+	{
+		auto reader = Open(p_id);
+		if (!reader.has_value())
+			return std::nullopt;
+
+		std::string body(reader->response().size, '\0');
+
+		std::size_t read = 0;
+		while (read < std::size(body))
+		{
+			const auto length = reader->read(std::data(body) + read, std::size(body) - read);
+			if (length == 0)
+				break;
+			read += length;
+		}
+
+		if (read != std::size(body) || reader->isCorrupt())
+			return std::nullopt;
+		return body;
+	}
+	ArchiveStatistics ResponseArchive::Statistics()
+	{
+		static const std::string sql =
+			 "SELECT (SELECT COUNT(*) FROM "s + TableNames::TABLE_RESPONSE_ARCHIVE +
+			 "), (SELECT COALESCE(SUM("s + ColumnNames::Archive::COLUMN_SIZE + "), 0) FROM "s +
+			 TableNames::TABLE_RESPONSE_ARCHIVE + "), (SELECT COALESCE(SUM(length("s +
+			 ColumnNames::Blocks::COLUMN_DATA + ")), 0) FROM "s +
+			 TableNames::TABLE_RESPONSE_BLOCKS + "), (SELECT COALESCE(SUM(length("s +
+			 ColumnNames::Dictionaries::COLUMN_DATA + ")), 0) FROM "s +
+			 TableNames::TABLE_RESPONSE_DICTIONARIES + ");"s;
+
+		PrepareStatement ps;
+		ps.prepare(m_db, sql);
+
+		ArchiveStatistics statistics;
+		if (ps.hasNext())
+		{
+			const auto next = [&] {
+				return static_cast<std::size_t>(ps.get<DataTypes::Int64>().value_or(0));
+			};
+			statistics.responses			= next();
+			statistics.raw_bytes			= next();
+			statistics.stored_bytes		= next();
+			statistics.dictionary_bytes = next();
+		}
+		return statistics;
+	}
+} // namespace Currency
@@ -0,0 +1,215 @@
+#pragma once
+
+// Keeps every Response Body the Upstream Returned, for Audit
+//
+// Bodies are Cut into Blocks, each Compressed against the Dictionary in use
+// and Streamed into a Row of its own through sqlite3_blob_write
+// As such only a Block of a Body is ever Held besides the Body itself
+// Reading one back Decompresses a Block at a time in the same way
+//
+// The first Responses are Compressed without a Dictionary
+// Once ArchiveOptions::train_after_responses are Archived one is Trained on them
+// on a Pool Thread, the Writer only Waits for it to be Stored
+// Every Response Remembers its Dictionary, as such Training anew never Breaks older ones
+//
+// Only the last ArchiveOptions::max_responses are Kept, see ExpireResponses
+//
+// Counts what it Stores, the Ratio is raw over stored
+//	currency_archive_responses_total
+//	currency_archive_bytes_total{form="raw"|"stored"}
+//	currency_archive_write_seconds
+
+#include <winrt/Windows.Foundation.h>
+
+#include <TUESL/Compression/DictionaryCodec.hxx>
+#include <TUESL/Metrics/Registry.hxx>
+#include <TUESL/SQLite/Blob.hxx>
+#include <TUESL/SQLite/PrepareStatement.hxx>
+
+#include <condition_variable>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Currency
+{
+	struct ArchiveOptions
+	{
+		// Responses Compressed without a Dictionary before the first is Trained
+		// 0 Leaves Training to TrainDictionary
+		std::size_t train_after_responses = 64;
+		// Responses a Dictionary is Trained on, the most Recent
+		std::size_t training_responses = 256;
+		// Larger Responses are Left out once the Samples hold this much
+		std::size_t max_training_bytes = 1024 * 1024;
+		// Responses Kept, ExpireResponses Deletes the Oldest beyond them
+		// 0 Keeps every one
+		std::size_t max_responses = 10'000;
+	};
+
+	struct ArchiveStatistics
+	{
+		std::size_t responses = 0;
+		// Bytes of the Bodies as they were Returned
+		std::size_t raw_bytes = 0;
+		// Bytes of their Blocks as Stored
+		std::size_t stored_bytes = 0;
+		// Bytes of every Dictionary Trained
+		std::size_t dictionary_bytes = 0;
+
+		double ratio() const noexcept
+		{
+			return stored_bytes == 0 ? 0.0 : static_cast<double>(raw_bytes) / stored_bytes;
+		}
+	};
+
+	struct ArchivedResponse
+	{
+		std::int64_t id = 0;
+		std::wstring uri;
+		// Ticks of winrt::clock
+		std::int64_t time = 0;
+		// Bytes of the Body as it was Returned
+		std::size_t size = 0;
+		// 0 where it was Compressed without one
+		std::int64_t dictionary = 0;
+	};
+
+	// Reads one Archived Body a Block at a time
+	// Holds a Statement on the Database, which must outlive it
+	class ArchivedResponseReader
+	{
+	 private:
+		ArchivedResponse m_response;
+
+		TUESL::SQLite::Database*			 m_db;
+		TUESL::SQLite::PrepareStatement	 m_blocks;
+		std::optional<TUESL::SQLite::Blob> m_blob;
+
+		std::shared_ptr<const TUESL::Compression::DictionaryDecoder> m_decoder;
+
+		std::vector<std::byte> m_encoded;
+		std::string				  m_block;
+		std::size_t				  m_block_position = 0;
+		std::size_t				  m_remaining		 = 0;
+		bool						  m_is_corrupt		 = false;
+
+	 private:
+		bool readBlock();
+
+	 public:
+		ArchivedResponseReader(
+			 TUESL::SQLite::Database&												  p_db,
+			 ArchivedResponse															  p_response,
+			 std::shared_ptr<const TUESL::Compression::DictionaryDecoder> p_decoder);
+
+		const ArchivedResponse& response() const noexcept
+		{
+			return m_response;
+		}
+
+		// Copies up to p_size Bytes of the Body to p_buffer
+		// Returns how many, 0 once the whole Body has been Read or it is Corrupt
+		std::size_t read(char* p_buffer, const std::size_t p_size);
+
+		// Set once a Block failed to Decode, or the Body came out Shorter than it was
+		bool isCorrupt() const noexcept
+		{
+			return m_is_corrupt;
+		}
+	};
+
+	class ResponseArchive
+	{
+	 private:
+		TUESL::SQLite::Database& m_db;
+		// Shared with every other Writer of the Connection
+		// As such no Archive Row ends up in another Writer's Transaction
+		std::mutex& m_write_mutex;
+
+		ArchiveOptions m_options;
+
+		// Dictionary new Responses are Compressed with, 0 for none
+		// Guarded by m_write_mutex
+		std::int64_t										m_dictionary_id = 0;
+		TUESL::Compression::DictionaryEncoder	m_encoder;
+		std::vector<std::byte>						m_encoded;
+		std::size_t										m_responses_without_dictionary = 0;
+
+		// Set while the first Dictionary is Trained in the Background, as such one at a time
+		// The Destructor Waits for it to be Cleared
+		bool							m_is_training = false;
+		std::mutex					m_training_mutex;
+		std::condition_variable m_training_done;
+
+		// By Dictionary, Shared with the Readers
+		std::map<std::int64_t, std::shared_ptr<const TUESL::Compression::DictionaryDecoder>>
+					  m_decoders;
+		std::mutex m_decoder_mutex;
+
+		TUESL::Metrics::Counter&	m_responses_archived;
+		TUESL::Metrics::Counter&	m_raw_bytes;
+		TUESL::Metrics::Counter&	m_stored_bytes;
+		TUESL::Metrics::Histogram& m_write_time;
+
+	 private:
+		void CreateTables();
+		void LoadDictionary();
+
+		std::shared_ptr<const TUESL::Compression::DictionaryDecoder> DecoderFor(
+			 const std::int64_t p_dictionary_id);
+
+		// Stores it and Compresses with it from then on, m_write_mutex must be Held
+		void UseDictionary(const TUESL::Compression::Dictionary& p_dictionary);
+		// Reads and Trains on the last p_responses Responses without m_write_mutex
+		// Empty if they have too little in Common
+		TUESL::Compression::Dictionary TrainOnRecent(const std::size_t p_responses);
+		winrt::fire_and_forget			 TrainInBackground();
+
+	 public:
+		// Creates the Tables on p_db where they do not Exist yet
+		ResponseArchive(TUESL::SQLite::Database& p_db,
+							 std::mutex&				 p_write_mutex,
+							 const ArchiveOptions&	 p_options = ArchiveOptions{});
+
+		// Waits for a Dictionary still being Trained
+		~ResponseArchive();
+
+		ResponseArchive(const ResponseArchive&) = delete;
+		ResponseArchive& operator=(const ResponseArchive&) = delete;
+
+		// Writes p_body, in one Transaction, and Returns its id
+		// nullopt if it could not be Written, in which case nothing is
+		// Never Throws, as such it can Observe the WebClient
+		// Starts Training the first Dictionary once enough Responses have been Archived
+		// without one, and Returns without Waiting for it
+		std::optional<std::int64_t> Archive(const std::wstring_view p_uri,
+														const std::string_view	p_body,
+														const std::int64_t		p_time);
+
+		// Trains a Dictionary on the last p_responses Responses, and Compresses with it from
+		// then on, Returns its id
+		// nullopt if they have too little in Common for a Dictionary to Help
+		std::optional<std::int64_t> TrainDictionary(const std::size_t p_responses);
+
+		// Deletes the Oldest Responses beyond ArchiveOptions::max_responses, in one
+		// Transaction, and Returns how many
+		// Run by the Expiry Tick of the Converter, Throws SQLiteException as it does
+		std::size_t ExpireResponses();
+
+		// Most Recent first
+		std::vector<ArchivedResponse> RecentResponses(const std::size_t p_count);
+
+		// nullopt if there is no such Response, or its Dictionary is Missing
+		std::optional<ArchivedResponseReader> Open(const std::int64_t p_id);
+		// Reads the whole Body at once, nullopt as for Open or if it is Corrupt
+		std::optional<std::string> ReadAll(const std::int64_t p_id);
+
+		ArchiveStatistics Statistics();
+	};
+} // namespace Currency
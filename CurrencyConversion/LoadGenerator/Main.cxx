@@ -0,0 +1,283 @@
+#include "pch.h"
+
+#include "Protocol.hxx"
+
+#include <TUESL/Net/LocalSocket.hxx>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// Drives the Conversion Service at its Sustained Rate
+//
+// Each Connection keeps a Fixed Number of Requests Outstanding
+// Every Response is Replaced by a new Request at once, all of them Sent together
+// Latency is from Queuing the Request to Decoding its Response
+//
+// Requests Sent during the Warm Up are not Counted
+// The first of them Fetches the Rate, after which it is Served from Memory
+//
+// Example
+//	LoadGenerator.exe C:\Temp\conversion.sock 4 32 10 > service.jsonl
+//	Arguments are the Socket, Connections, Requests Outstanding per Connection, Seconds
+//	and the Pair to Convert
+
+namespace
+{
+	using Service::Protocol::DecodeStatus;
+	using Service::Protocol::Operation;
+	using Service::Protocol::Request;
+	using Service::Protocol::Response;
+	using Service::Protocol::Status;
+
+	using TUESL::Net::IOStatus;
+	using TUESL::Net::LocalSocket;
+
+	using Clock = std::chrono::steady_clock;
+
+	constexpr const auto WARM_UP = std::chrono::seconds{1};
+
+	// 100.0000 in Units of Money
+	constexpr const std::int64_t AMOUNT_UNITS = 1'000'000;
+
+	constexpr const std::size_t RECEIVE_CHUNK_SIZE = 16 * 1024;
+
+	struct Options
+	{
+		std::string	 socket_path;
+		std::size_t	 connections = 4;
+		std::size_t	 depth		 = 32;
+		Clock::duration duration	 = std::chrono::seconds{10};
+		std::string	 from_code	 = "USD";
+		std::string	 to_code		 = "EUR";
+	};
+
+	struct ClientResult
+	{
+		bool is_connected = false;
+		// Of Requests Sent after the Warm Up
+		std::uint64_t completed = 0;
+		std::uint64_t errors		= 0;
+		// Nanoseconds, Clamped to what fits
+		std::vector<std::uint32_t> latencies;
+	};
+
+	bool sendAll(LocalSocket& p_socket, const std::vector<std::uint8_t>& p_data)
+	{
+		std::size_t sent = 0;
+		while (sent < std::size(p_data))
+		{
+			const auto result = p_socket.send(std::data(p_data) + sent, std::size(p_data) - sent);
+			if (result.status != IOStatus::DONE)
+				return false;
+			sent += result.bytes;
+		}
+		return true;
+	}
+
+	void runClient(const Options&			p_options,
+						const Clock::time_point p_measure_from,
+						const Clock::time_point p_stop_at,
+						ClientResult&				p_result)
+	{
+		// Blocking, as each Client has its own Thread
+		auto socket = LocalSocket::connect(p_options.socket_path);
+		if (!socket.has_value())
+			return;
+		p_result.is_connected = true;
+
+		Request request;
+		request.operation	  = Operation::CONVERT;
+		request.amount_units = AMOUNT_UNITS;
+		request.from_code	  = p_options.from_code;
+		request.to_code		  = p_options.to_code;
+
+		std::unordered_map<std::uint32_t, Clock::time_point> sent_at;
+		std::vector<std::uint8_t>									  output;
+		std::vector<std::uint8_t>									  input;
+
+		std::uint32_t next_id = 0;
+
+		while (true)
+		{
+			// Refill to the Full Depth, then Send all at once
+			const auto now = Clock::now();
+			if (now < p_stop_at)
+			{
+				while (std::size(sent_at) < p_options.depth)
+				{
+					request.id = next_id++;
+					sent_at.emplace(request.id, now);
+					Service::Protocol::encodeRequest(request, output);
+				}
+			}
+
+			if (!std::empty(output))
+			{
+				if (!sendAll(socket.value(), output))
+					break;
+				output.clear();
+			}
+
+			if (std::empty(sent_at))
+				return;
+
+			const auto offset = std::size(input);
+			input.resize(offset + RECEIVE_CHUNK_SIZE);
+			const auto received = socket->receive(std::data(input) + offset, RECEIVE_CHUNK_SIZE);
+			input.resize(offset + received.bytes);
+			if (received.status != IOStatus::DONE)
+				break;
+
+			const auto	received_at = Clock::now();
+			std::size_t consumed	 = 0;
+
+			while (true)
+			{
+				Response		response;
+				std::size_t frame_size = 0;
+				const auto	status		= Service::Protocol::decodeResponse(
+					  std::data(input) + consumed, std::size(input) - consumed, response, frame_size);
+
+				if (status == DecodeStatus::INCOMPLETE)
+					break;
+				if (status == DecodeStatus::CORRUPT)
+				{
+					p_result.errors += std::size(sent_at);
+					return;
+				}
+				consumed += frame_size;
+
+				const auto found = sent_at.find(response.id);
+				if (found == std::end(sent_at))
+				{
+					++p_result.errors;
+					continue;
+				}
+
+				const auto queued_at = found->second;
+				sent_at.erase(found);
+
+				if (queued_at < p_measure_from)
+					continue;
+
+				if (status != DecodeStatus::DECODED || response.status != Status::OK)
+				{
+					++p_result.errors;
+					continue;
+				}
+
+				++p_result.completed;
+
+				const std::chrono::nanoseconds latency = received_at - queued_at;
+				p_result.latencies.push_back(static_cast<std::uint32_t>(
+					 (std::min)(latency.count(), static_cast<std::int64_t>(UINT32_MAX))));
+			}
+
+			input.erase(std::begin(input), std::begin(input) + consumed);
+		}
+
+		// The Service went away, whatever was Outstanding is Lost
+		p_result.errors += std::size(sent_at);
+	}
+
+	double percentileMicroseconds(const std::vector<std::uint32_t>& p_sorted,
+										  const double						  p_percentile)
+	{
+		if (std::empty(p_sorted))
+			return 0.0;
+
+		const auto last	= static_cast<double>(std::size(p_sorted) - 1);
+		const auto index = static_cast<std::size_t>(p_percentile / 100.0 * last);
+		return p_sorted[index] / 1000.0;
+	}
+
+	void report(const std::string_view p_metric, const double p_value)
+	{
+		// Same Shape as the Lines of the Benchmarks
+		std::cout << R"({"benchmark":"service/convert","metric":")" << p_metric
+					 << R"(","value":)" << std::setprecision(17) << p_value << "}\n";
+	}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+	if (argc < 2)
+	{
+		std::cerr << "Usage: LoadGenerator <socket path> [connections] [depth] [seconds] [from] [to]"
+					 << std::endl;
+		return 1;
+	}
+
+	Options options;
+	options.socket_path = argv[1];
+	if (argc > 2)
+		options.connections = (std::max)(std::stoul(argv[2]), 1ul);
+	if (argc > 3)
+		options.depth = (std::max)(std::stoul(argv[3]), 1ul);
+	if (argc > 4)
+		options.duration = std::chrono::seconds{std::stoul(argv[4])};
+	if (argc > 6)
+	{
+		options.from_code = argv[5];
+		options.to_code	= argv[6];
+	}
+
+	TUESL::Net::WinsockSession winsock;
+	if (!winsock.isStarted())
+	{
+		std::cerr << "Winsock could not be Started" << std::endl;
+		return 1;
+	}
+
+	const auto measure_from = Clock::now() + WARM_UP;
+	const auto stop_at		= measure_from + options.duration;
+
+	std::vector<ClientResult> results(options.connections);
+	std::vector<std::thread>  clients;
+	for (auto& result : results)
+		clients.emplace_back(runClient, std::cref(options), measure_from, stop_at, std::ref(result));
+	for (auto& client : clients)
+		client.join();
+
+	std::size_t					 connected = 0;
+	std::uint64_t				 completed = 0;
+	std::uint64_t				 errors	  = 0;
+	std::vector<std::uint32_t> latencies;
+
+	for (const auto& result : results)
+	{
+		connected += result.is_connected ? 1 : 0;
+		completed += result.completed;
+		errors += result.errors;
+		latencies.insert(
+			 std::end(latencies), std::begin(result.latencies), std::end(result.latencies));
+	}
+
+	if (connected == 0)
+	{
+		std::cerr << "Could not Connect to " << options.socket_path << std::endl;
+		return 1;
+	}
+
+	std::sort(std::begin(latencies), std::end(latencies));
+
+	const std::chrono::duration<double> measured = options.duration;
+
+	report("connections", double(connected));
+	report("depth", double(options.depth));
+	report("conversions_per_sec", completed / measured.count());
+	report("latency_p50_us", percentileMicroseconds(latencies, 50.0));
+	report("latency_p99_us", percentileMicroseconds(latencies, 99.0));
+	report("latency_p999_us", percentileMicroseconds(latencies, 99.9));
+	report("latency_max_us", std::empty(latencies) ? 0.0 : latencies.back() / 1000.0);
+	report("errors", double(errors));
+
+	return errors == 0 ? 0 : 2;
+}
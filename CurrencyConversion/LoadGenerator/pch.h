@@ -0,0 +1,11 @@
+#pragma once
+
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+
+// Winsock 2 must come before Windows.h
+#include <winsock2.h>
+
+#include <afunix.h>
+#include <Windows.h>
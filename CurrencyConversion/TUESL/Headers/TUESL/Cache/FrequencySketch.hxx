@@ -0,0 +1,64 @@
+#pragma once
+
+// Estimates how often each Key was Seen Recently, in 4 Bits per Counter
+// A Count-Min Sketch, laid out as TinyLFU and Caffeine lay it out
+//
+// Every Key has a Counter in each of DEPTH Rows, Picked by a Hash of its own per Row
+// Its Frequency is the Smallest of them, as such Collisions only ever Overestimate it
+// Counters Saturate at 15, which is enough to tell Popular Keys from the Rest
+//
+// Once sampleSize Increments have been Counted every Counter is Halved
+// As such Keys which were Popular long ago Fade, and a new Favourite can Overtake them
+//
+// Example
+//	FrequencySketch sketch{10'000};
+//	sketch.increment(hash);
+//	if (sketch.frequency(candidate_hash) > sketch.frequency(victim_hash))
+//		...
+//
+// Not Thread Safe
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace TUESL::Cache
+{
+	class FrequencySketch
+	{
+	 public:
+		static constexpr const unsigned DEPTH				= 4;
+		static constexpr const unsigned MAX_FREQUENCY	= 15;
+		static constexpr const unsigned COUNTERS_PER_WORD = 16;
+
+	 private:
+		// 16 Counters of 4 Bits per Word
+		std::vector<std::uint64_t> m_table;
+		std::uint64_t				  m_word_mask;
+
+		std::size_t m_sample_size;
+		std::size_t m_additions = 0;
+
+	 private:
+		// Word and Nibble of p_hash's Counter in p_row
+		std::size_t counterIndex(const std::uint64_t p_hash, const unsigned p_row) const noexcept;
+
+		// Halves every Counter
+		void age() noexcept;
+
+	 public:
+		// Sized for about p_capacity Distinct Keys, which Age after 10 Times as many Increments
+		explicit FrequencySketch(const std::size_t p_capacity);
+
+		// Counts p_hash once more, Aging every Counter once the Sample is Full
+		void increment(const std::uint64_t p_hash) noexcept;
+
+		// Estimated Count of p_hash since it last Aged, at most MAX_FREQUENCY
+		unsigned frequency(const std::uint64_t p_hash) const noexcept;
+
+		std::size_t sampleSize() const noexcept
+		{
+			return m_sample_size;
+		}
+	};
+} // namespace TUESL::Cache
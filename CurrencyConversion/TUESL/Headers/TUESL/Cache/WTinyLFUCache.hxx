@@ -0,0 +1,366 @@
+#pragma once
+
+// Bounded Cache which Admits a new Key only if it is Wanted more often than what it Evicts
+// See Einziger, Friedman and Manes, TinyLFU: A Highly Efficient Cache Admission Policy
+//
+// Entries are Weighed, and the Cache never holds more than its max_weight
+// It is Split in three Segments, each in Order of Recency
+//	Window		A small LRU every new Entry Enters, as such a Burst of new Keys is Served
+//	Probation	Entries Admitted from the Window, not yet Hit since
+//	Protected	Entries Hit while on Probation, Demoted back once it is Full
+//
+// An Entry Pushed out of the Window is a Candidate against the Victim, the Probation Tail
+// The one a FrequencySketch has Seen more often Stays, and a Tie goes to the Victim
+// As such a Scan of Keys each Asked for once Passes through the Window alone,
+// and never Displaces the Popular Keys of the Main Segments, as it would those of an LRU
+//
+// Frequencies are Counted by get, Hit or Miss, but not by put
+// As such a Miss Filled by its put Counts once
+//
+// Example
+//	using Cache = WTinyLFUCache<std::string, Quote>;
+//	Cache::Options options;
+//	options.max_weight		 = 4 << 20;
+//	options.expected_entries = 50'000;
+//	Cache quotes{options, [](auto& p_key, auto&) {
+//		return std::size(p_key) + sizeof(Quote) + Cache::ENTRY_OVERHEAD;
+//	}};
+//
+//	if (auto quote = quotes.get(key))
+//		return quote.value();
+//	quotes.put(key, fetch(key));
+//
+// Not Thread Safe
+
+#include <TUESL/Cache/FrequencySketch.hxx>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <optional>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+namespace TUESL::Cache
+{
+	template <typename Key,
+				 typename Value,
+				 typename Hash	  = std::hash<Key>,
+				 typename KeyEqual = std::equal_to<Key>>
+	class WTinyLFUCache
+	{
+	 public:
+		// Weight of an Entry, in whatever Unit max_weight is, such as Bytes
+		using Weigher = std::function<std::size_t(const Key& p_key, const Value& p_value)>;
+
+		struct Options
+		{
+			std::size_t max_weight = 0;
+			// Sizes the FrequencySketch, about how many Entries fit in max_weight
+			std::size_t expected_entries = 0;
+			// Of max_weight, the rest is the Main Segments
+			double window_fraction = 0.01;
+			// Of the Main Segments, the rest is Probation
+			double protected_fraction = 0.8;
+		};
+
+		struct Statistics
+		{
+			std::uint64_t hits		 = 0;
+			std::uint64_t misses		 = 0;
+			// Candidates the Window Pushed out, and whether they were Kept
+			std::uint64_t admissions = 0;
+			std::uint64_t rejections = 0;
+			// Entries of the Main Segments Evicted to make Room
+			std::uint64_t evictions = 0;
+
+			double hitRatio() const noexcept
+			{
+				const auto requests = hits + misses;
+				return requests == 0 ? 0.0 : static_cast<double>(hits) / requests;
+			}
+		};
+
+		// Estimate of what the Cache spends per Entry besides the Key and Value
+		// Links, Weight and Segment of the List Node
+		// Link, Hash, Iterator and Bucket of the Index
+		static constexpr const std::size_t ENTRY_OVERHEAD = 8 * sizeof(void*);
+
+	 private:
+		enum class Segment
+		{
+			WINDOW,
+			PROBATION,
+			PROTECTED
+		};
+
+		struct Entry
+		{
+			Key			key;
+			Value			value;
+			std::size_t weight;
+			Segment		segment;
+		};
+
+		// Most Recent at the Front
+		using List = std::list<Entry>;
+
+		List m_window;
+		List m_probation;
+		List m_protected;
+
+		std::size_t m_window_weight	 = 0;
+		std::size_t m_probation_weight = 0;
+		std::size_t m_protected_weight = 0;
+
+		std::size_t m_max_weight;
+		std::size_t m_max_window_weight;
+		std::size_t m_max_protected_weight;
+
+		std::unordered_map<Key, typename List::iterator, Hash, KeyEqual> m_index;
+
+		FrequencySketch m_sketch;
+		Hash				 m_hash;
+		Weigher			 m_weigher;
+		Statistics		 m_statistics;
+
+	 private:
+		std::uint64_t hashOf(const Key& p_key) const
+		{
+			return static_cast<std::uint64_t>(m_hash(p_key));
+		}
+
+		List& listOf(const Segment p_segment) noexcept
+		{
+			switch (p_segment)
+			{
+				case Segment::WINDOW: return m_window;
+				case Segment::PROBATION: return m_probation;
+				default: return m_protected;
+			}
+		}
+		std::size_t& weightOf(const Segment p_segment) noexcept
+		{
+			switch (p_segment)
+			{
+				case Segment::WINDOW: return m_window_weight;
+				case Segment::PROBATION: return m_probation_weight;
+				default: return m_protected_weight;
+			}
+		}
+
+		std::size_t mainWeight() const noexcept
+		{
+			return m_probation_weight + m_protected_weight;
+		}
+		std::size_t maxMainWeight() const noexcept
+		{
+			return m_max_weight - m_max_window_weight;
+		}
+
+		// To the Front of p_segment, Iterators stay Valid
+		void moveTo(const typename List::iterator p_entry, const Segment p_segment)
+		{
+			weightOf(p_entry->segment) -= p_entry->weight;
+			weightOf(p_segment) += p_entry->weight;
+
+			listOf(p_segment).splice(
+				 std::begin(listOf(p_segment)), listOf(p_entry->segment), p_entry);
+			p_entry->segment = p_segment;
+		}
+
+		void remove(const typename List::iterator p_entry)
+		{
+			weightOf(p_entry->segment) -= p_entry->weight;
+			m_index.erase(p_entry->key);
+			listOf(p_entry->segment).erase(p_entry);
+		}
+
+		// Demotes the Least Recent of Protected to Probation until Protected Fits
+		void demoteProtected()
+		{
+			while (m_protected_weight > m_max_protected_weight && !std::empty(m_protected))
+				moveTo(std::prev(std::end(m_protected)), Segment::PROBATION);
+		}
+
+		// Least Recent of Probation, or of Protected once Probation is Empty
+		std::optional<typename List::iterator> victim()
+		{
+			if (!std::empty(m_probation))
+				return std::prev(std::end(m_probation));
+			if (!std::empty(m_protected))
+				return std::prev(std::end(m_protected));
+			return std::nullopt;
+		}
+
+		// Moves what Overflows the Window to the Main Segments, if it Wins against the Victims
+		void evict()
+		{
+			while (m_window_weight > m_max_window_weight && !std::empty(m_window))
+			{
+				const auto candidate			  = std::prev(std::end(m_window));
+				const auto candidate_frequency = m_sketch.frequency(hashOf(candidate->key));
+
+				// Victims are Evicted one by one, as a heavy Candidate may need several
+				bool is_admitted = true;
+				while (mainWeight() + candidate->weight > maxMainWeight())
+				{
+					const auto lowest = victim();
+					if (!lowest.has_value() ||
+						 candidate_frequency <= m_sketch.frequency(hashOf((*lowest)->key)))
+					{
+						is_admitted = false;
+						break;
+					}
+
+					remove(*lowest);
+					++m_statistics.evictions;
+				}
+
+				if (is_admitted)
+				{
+					moveTo(candidate, Segment::PROBATION);
+					++m_statistics.admissions;
+				}
+				else
+				{
+					remove(candidate);
+					++m_statistics.rejections;
+				}
+			}
+
+			// An Entry of the Main Segments Replaced by a heavier one
+			while (mainWeight() > maxMainWeight())
+			{
+				remove(victim().value());
+				++m_statistics.evictions;
+			}
+		}
+
+	 public:
+		// Throws std::invalid_argument if max_weight is 0, or a Fraction is not within [0, 1]
+		WTinyLFUCache(const Options& p_options, Weigher p_weigher) :
+			 m_max_weight{p_options.max_weight},
+			 m_sketch{(std::max)(p_options.expected_entries, std::size_t{1})},
+			 m_weigher{std::move(p_weigher)}
+		{
+			if (p_options.max_weight == 0)
+				throw std::invalid_argument("A Cache must hold at least some Weight");
+			if (p_options.window_fraction < 0.0 || p_options.window_fraction > 1.0 ||
+				 p_options.protected_fraction < 0.0 || p_options.protected_fraction > 1.0)
+				throw std::invalid_argument("Fractions of a Cache must be within 0 and 1");
+			if (!m_weigher)
+				throw std::invalid_argument("A Cache needs a Weigher");
+
+			m_max_window_weight = static_cast<std::size_t>(static_cast<double>(m_max_weight) *
+																		  p_options.window_fraction);
+			m_max_protected_weight = static_cast<std::size_t>(
+				 static_cast<double>(maxMainWeight()) * p_options.protected_fraction);
+		}
+
+		// Counts the Request, and Promotes an Entry Hit on Probation to Protected
+		std::optional<Value> get(const Key& p_key)
+		{
+			m_sketch.increment(hashOf(p_key));
+
+			const auto found = m_index.find(p_key);
+			if (found == std::end(m_index))
+			{
+				++m_statistics.misses;
+				return std::nullopt;
+			}
+			++m_statistics.hits;
+
+			const auto entry = found->second;
+			if (entry->segment == Segment::PROBATION)
+			{
+				moveTo(entry, Segment::PROTECTED);
+				demoteProtected();
+			}
+			else
+				moveTo(entry, entry->segment);
+
+			return entry->value;
+		}
+
+		// Neither Counts as a Request nor Changes the Order
+		bool contains(const Key& p_key) const
+		{
+			return m_index.find(p_key) != std::end(m_index);
+		}
+
+		// Inserts into the Window, or Replaces the Value where p_key is already held
+		// Returns false, holding nothing for p_key, if the Entry alone Outweighs the Main Segments
+		bool put(const Key& p_key, Value p_value)
+		{
+			const auto weight = m_weigher(p_key, p_value);
+			if (weight > maxMainWeight())
+			{
+				erase(p_key);
+				return false;
+			}
+
+			if (const auto found = m_index.find(p_key); found != std::end(m_index))
+			{
+				const auto entry = found->second;
+				weightOf(entry->segment) += weight;
+				weightOf(entry->segment) -= entry->weight;
+				entry->weight = weight;
+				entry->value  = std::move(p_value);
+
+				moveTo(entry, entry->segment);
+				demoteProtected();
+			}
+			else
+			{
+				m_window.push_front(Entry{p_key, std::move(p_value), weight, Segment::WINDOW});
+				m_window_weight += weight;
+				m_index.emplace(p_key, std::begin(m_window));
+			}
+
+			evict();
+			return true;
+		}
+
+		// false if p_key was not held
+		bool erase(const Key& p_key)
+		{
+			const auto found = m_index.find(p_key);
+			if (found == std::end(m_index))
+				return false;
+
+			remove(found->second);
+			return true;
+		}
+
+		void clear()
+		{
+			m_index.clear();
+			m_window.clear();
+			m_probation.clear();
+			m_protected.clear();
+			m_window_weight = m_probation_weight = m_protected_weight = 0;
+		}
+
+		std::size_t size() const noexcept
+		{
+			return std::size(m_index);
+		}
+		std::size_t weight() const noexcept
+		{
+			return m_window_weight + mainWeight();
+		}
+		std::size_t maxWeight() const noexcept
+		{
+			return m_max_weight;
+		}
+
+		const Statistics& statistics() const noexcept
+		{
+			return m_statistics;
+		}
+	};
+} // namespace TUESL::Cache
@@ -0,0 +1,122 @@
+#pragma once
+
+// LZ77 Compression of Blocks against a Dictionary Trained on Samples of the Data
+// As zstd does with its Dictionaries, see
+// https://github.com/facebook/zstd#the-case-for-small-data-compression
+//
+// Small Payloads, such as Json Responses, have too little History of their own
+// to Compress well, yet share most of their Keys and Layout with one another
+// A Dictionary holds what they Share, and every Block may Refer back into it
+//
+// Each Block is Compressed on its own, as such a Payload is Read a Block at a time
+// Blocks carry their own Size, and are Stored as is where they would not Shrink
+//
+// Example
+//	const auto dictionary = Dictionary::train(samples);
+//	DictionaryEncoder encoder{dictionary};
+//	encoder.encode(block, compressed);
+//
+//	DictionaryDecoder decoder{dictionary};
+//	decoder.decode(std::data(compressed), std::size(compressed), text);
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace TUESL::Compression
+{
+	// Largest Block encode Accepts
+	constexpr const std::size_t MAX_BLOCK_SIZE = 64 * 1024;
+
+	// Largest Size a Block of p_size Bytes can be Encoded to
+	constexpr std::size_t encodedBound(const std::size_t p_size) noexcept
+	{
+		// Header, and a Stored Block where it would not Shrink
+		return p_size + 16;
+	}
+
+	class Dictionary
+	{
+	 public:
+		static constexpr const std::size_t DEFAULT_CAPACITY = 16 * 1024;
+		// Beyond this the Encoder's Hash Table is too Crowded to Find what it Holds
+		static constexpr const std::size_t MAX_CAPACITY = 64 * 1024;
+
+	 private:
+		std::string m_bytes;
+
+	 public:
+		Dictionary() = default;
+		// As Returned by bytes, such as when Read back from Storage
+		// Throws std::invalid_argument above MAX_CAPACITY
+		explicit Dictionary(std::string p_bytes);
+
+		// Picks the Segments of p_samples which most other Samples also hold
+		// As the Cover Algorithm of zstd does, see
+		// https://www.usenix.org/system/files/conference/hotstorage16/hotstorage16-liu.pdf
+		// Segments found in only one Sample are never Picked
+		// As such the Dictionary may come out Smaller than p_capacity, or Empty
+		static Dictionary train(const std::vector<std::string_view>& p_samples,
+										const std::size_t p_capacity = DEFAULT_CAPACITY);
+
+		std::string_view bytes() const noexcept
+		{
+			return m_bytes;
+		}
+		bool empty() const noexcept
+		{
+			return std::empty(m_bytes);
+		}
+	};
+
+	// Reused across Blocks, as such its Tables are only Allocated once
+	// Not Thread Safe, each Thread needs an Encoder of its own
+	class DictionaryEncoder
+	{
+	 private:
+		struct Entry
+		{
+			// Block the Entry was Written for, older Entries are Ignored
+			std::uint32_t block	 = 0;
+			std::uint32_t position = 0;
+		};
+
+		// Copied, as such the Dictionary need not outlive the Encoder
+		std::string m_dictionary;
+
+		// Position in the Dictionary of the last Occurrence of each Hash
+		// Filled once, and never Changed by a Block
+		std::vector<std::uint32_t> m_dictionary_table;
+		// Position in the Block of the last Occurrence of each Hash
+		// Entries of earlier Blocks are told apart by their Block rather than Cleared
+		std::vector<Entry> m_block_table;
+		std::uint32_t		 m_block = 0;
+
+	 public:
+		explicit DictionaryEncoder(const Dictionary& p_dictionary = Dictionary{});
+
+		// Appends the Encoded Form of p_block, at most encodedBound of its Size, to p_out
+		// Throws std::invalid_argument above MAX_BLOCK_SIZE
+		void encode(const std::string_view p_block, std::vector<std::byte>& p_out);
+	};
+
+	class DictionaryDecoder
+	{
+	 private:
+		std::string m_dictionary;
+
+	 public:
+		// Must be the Dictionary the Blocks were Encoded with
+		explicit DictionaryDecoder(const Dictionary& p_dictionary = Dictionary{});
+
+		// Appends the Block p_data holds to p_out
+		// Returns false if it is Corrupt, in which case p_out is left as it was
+		// Never Reads outside p_data nor Writes beyond the Size the Block Declares
+		bool decode(const std::byte* p_data, const std::size_t p_size, std::string& p_out) const;
+
+		// Size the Block p_data holds Decodes to, 0 if it is Empty or its Header Corrupt
+		static std::size_t decodedSize(const std::byte* p_data, const std::size_t p_size) noexcept;
+	};
+} // namespace TUESL::Compression
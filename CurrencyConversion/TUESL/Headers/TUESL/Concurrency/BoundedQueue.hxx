@@ -0,0 +1,207 @@
+#pragma once
+
+// Fixed Capacity Queue for any Number of Producers and Consumers
+// Pushing and Popping never Lock and never Allocate
+//
+// Each Cell carries a Sequence Number which says whose Turn it is
+// A Producer Claims the next Cell by a Compare and Swap on the Tail once the Cell is Free,
+// writes it, and then Publishes it by Advancing its Sequence, Consumers do the same at the Head
+// See Dmitry Vyukov's Bounded MPMC Queue
+//
+// A Full Queue makes push Wait, which is what Slows a Producer down to its Consumers
+// Waiting Spins briefly and then Yields the Thread
+//
+// Example
+//	BoundedQueue<Chunk> chunks{64};
+//
+//	Producer
+//	for (auto& chunk : split(text))
+//		chunks.push(std::move(chunk));
+//	chunks.close();
+//
+//	Consumers
+//	while (auto chunk = chunks.pop())
+//		parse(chunk.value());
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+namespace TUESL::Concurrency
+{
+	template <typename T>
+	class BoundedQueue
+	{
+	 private:
+		struct alignas(64) Cell
+		{
+			std::atomic<std::size_t> sequence{0};
+			T								 value{};
+		};
+
+		// Tries before a Waiting Thread Yields
+		static constexpr const int SPINS_BEFORE_YIELD = 64;
+
+		std::unique_ptr<Cell[]> m_cells;
+		std::size_t					m_mask;
+
+		// Each on a Line of its own, as Producers and Consumers Write them apart
+		alignas(64) std::atomic<std::size_t> m_tail{0};
+		alignas(64) std::atomic<std::size_t> m_head{0};
+		alignas(64) std::atomic<bool> m_is_closed{false};
+
+		static std::size_t roundUpToPowerOfTwo(const std::size_t p_value) noexcept
+		{
+			std::size_t power = 1;
+			while (power < p_value)
+				power <<= 1;
+			return power;
+		}
+
+		template <typename Function>
+		static auto waitFor(Function p_try)
+		{
+			for (int spins = 0;; ++spins)
+			{
+				if (auto result = p_try(); result.has_value())
+					return result;
+
+				if (spins >= SPINS_BEFORE_YIELD)
+					std::this_thread::yield();
+			}
+		}
+
+	 public:
+		// The Capacity is Rounded up to a Power of Two
+		// Throws std::invalid_argument for a Capacity of 0
+		explicit BoundedQueue(const std::size_t p_capacity)
+		{
+			if (p_capacity == 0)
+				throw std::invalid_argument("A Queue must hold at least one Value");
+
+			const auto capacity = roundUpToPowerOfTwo(p_capacity);
+
+			m_cells = std::make_unique<Cell[]>(capacity);
+			m_mask  = capacity - 1;
+			for (std::size_t i = 0; i < capacity; ++i)
+				m_cells[i].sequence.store(i, std::memory_order_relaxed);
+		}
+
+		// Threads hold on to the Cells
+		BoundedQueue(const BoundedQueue&) = delete;
+		BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+		// Moves p_value in and Returns true, or Returns false, leaving it, if the Queue is Full
+		bool tryPush(T& p_value)
+		{
+			auto tail = m_tail.load(std::memory_order_relaxed);
+			for (;;)
+			{
+				auto&		  cell		= m_cells[tail & m_mask];
+				const auto sequence = cell.sequence.load(std::memory_order_acquire);
+				const auto lag		  = static_cast<std::ptrdiff_t>(sequence - tail);
+
+				if (lag == 0)
+				{
+					if (m_tail.compare_exchange_weak(tail, tail + 1, std::memory_order_relaxed))
+					{
+						cell.value = std::move(p_value);
+						cell.sequence.store(tail + 1, std::memory_order_release);
+						return true;
+					}
+				}
+				else if (lag < 0)
+					return false;
+				else
+					tail = m_tail.load(std::memory_order_relaxed);
+			}
+		}
+
+		// nullopt if the Queue is Empty
+		std::optional<T> tryPop()
+		{
+			auto head = m_head.load(std::memory_order_relaxed);
+			for (;;)
+			{
+				auto&		  cell		= m_cells[head & m_mask];
+				const auto sequence = cell.sequence.load(std::memory_order_acquire);
+				const auto lag		  = static_cast<std::ptrdiff_t>(sequence - (head + 1));
+
+				if (lag == 0)
+				{
+					if (m_head.compare_exchange_weak(head, head + 1, std::memory_order_relaxed))
+					{
+						std::optional<T> value{std::move(cell.value)};
+						cell.sequence.store(head + m_mask + 1, std::memory_order_release);
+						return value;
+					}
+				}
+				else if (lag < 0)
+					return std::nullopt;
+				else
+					head = m_head.load(std::memory_order_relaxed);
+			}
+		}
+
+		// Waits while the Queue is Full
+		// Returns false, Dropping p_value, once the Queue is Closed
+		bool push(T p_value)
+		{
+			const auto pushed = waitFor([&]() -> std::optional<bool> {
+				if (m_is_closed.load(std::memory_order_acquire))
+					return false;
+				if (tryPush(p_value))
+					return true;
+				return std::nullopt;
+			});
+			return pushed.value();
+		}
+
+		// Waits while the Queue is Empty
+		// nullopt once the Queue is Closed and every Value has been Popped
+		std::optional<T> pop()
+		{
+			// Outer nullopt is Keep Waiting, Inner nullopt is Closed
+			auto value = waitFor([&]() -> std::optional<std::optional<T>> {
+				if (auto value = tryPop(); value.has_value())
+					return std::optional<std::optional<T>>{std::in_place, std::move(value)};
+
+				// Everything Pushed before close is Visible from here on
+				if (m_is_closed.load(std::memory_order_acquire))
+					return std::optional<std::optional<T>>{std::in_place, tryPop()};
+
+				return std::nullopt;
+			});
+			return std::move(value.value());
+		}
+
+		// Called once every Producer is Done, or by a Consumer to make Producers Stop
+		// Values already in the Queue can still be Popped
+		void close() noexcept
+		{
+			m_is_closed.store(true, std::memory_order_release);
+		}
+
+		bool isClosed() const noexcept
+		{
+			return m_is_closed.load(std::memory_order_acquire);
+		}
+
+		// Values in the Queue, only Approximate while Threads Push or Pop
+		std::size_t size() const noexcept
+		{
+			const auto head = m_head.load(std::memory_order_relaxed);
+			const auto tail = m_tail.load(std::memory_order_relaxed);
+			return tail > head ? tail - head : 0;
+		}
+
+		std::size_t capacity() const noexcept
+		{
+			return m_mask + 1;
+		}
+	};
+} // namespace TUESL::Concurrency
@@ -0,0 +1,80 @@
+#pragma once
+
+// Epoch Based Reclamation
+// Tells a Writer when no Reader can still hold an Object it has Unpublished
+//
+// Readers Announce the Epoch they Entered in a Slot of their own for the Duration of a Read
+// Writers Advance the Epoch after Unpublishing an Object and Tag it with the old Epoch
+// Once every Announced Epoch is past the Tag, the Object can be Deleted
+//
+// Entering and Leaving never Lock and never Allocate
+// A Reader holding its Guard for long only Delays Reclamation, never a Writer
+//
+// See RCUSnapshot for the Intended Use
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace TUESL::Concurrency
+{
+	using Epoch = std::uint64_t;
+
+	class EpochDomain
+	{
+	 public:
+		// More Readers than this at once Spin until a Slot is Free
+		static constexpr const std::size_t MAX_READERS = 64;
+
+		class Guard
+		{
+		 private:
+			std::atomic<Epoch>* m_slot;
+
+		 public:
+			explicit Guard(std::atomic<Epoch>* p_slot) noexcept : m_slot{p_slot} {}
+
+			Guard(Guard&& p_other) noexcept : m_slot{p_other.m_slot}
+			{
+				p_other.m_slot = nullptr;
+			}
+			Guard& operator=(Guard&& p_other) noexcept;
+
+			Guard(const Guard&) = delete;
+			Guard& operator=(const Guard&) = delete;
+
+			~Guard();
+		};
+
+	 private:
+		static constexpr const Epoch IDLE = (std::numeric_limits<Epoch>::max)();
+
+		// One Cache Line per Slot
+		// Otherwise Readers on different Cores would Contend on the Line
+		struct alignas(64) Slot
+		{
+			std::atomic<Epoch> epoch{IDLE};
+		};
+
+		alignas(64) std::atomic<Epoch> m_epoch{0};
+		Slot m_slots[MAX_READERS];
+
+	 public:
+		EpochDomain() = default;
+
+		// Readers hold Pointers into the Slots
+		EpochDomain(const EpochDomain&) = delete;
+		EpochDomain& operator=(const EpochDomain&) = delete;
+
+		// Anything Published before this Call is Protected until the Guard is Destroyed
+		Guard enter() noexcept;
+
+		// Called after Unpublishing
+		// Returns the Tag of what was Unpublished
+		Epoch advance() noexcept;
+
+		// Objects Tagged below this can be Deleted
+		Epoch oldestActive() const noexcept;
+	};
+} // namespace TUESL::Concurrency
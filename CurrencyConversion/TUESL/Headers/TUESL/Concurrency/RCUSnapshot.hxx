@@ -0,0 +1,152 @@
+#pragma once
+
+// Read Copy Update Cell
+// Readers see an Immutable T behind an Atomic Pointer and never Lock
+// Writers Copy the current T, Change the Copy and Publish it in one Store
+//
+// Example
+//	RCUSnapshot<Table> table;
+//	{
+//		const auto view = table.read();
+//		use(view->rows);
+//	}
+//	table.update([](Table& p_table) { p_table.rows.push_back(row); });
+//
+// A View keeps its T alive, even across a Publish, until it is Destroyed
+// As such Views should be Short Lived, an old View Delays the Deletion of every later T
+// Writers take Turns, so that no Update is Lost to a Concurrent one
+
+#include "EpochDomain.hxx"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace TUESL::Concurrency
+{
+	template <typename T>
+	class RCUSnapshot
+	{
+	 public:
+		class View
+		{
+		 private:
+			EpochDomain::Guard m_guard;
+			const T*				 m_value;
+
+		 public:
+			View(EpochDomain::Guard p_guard, const T* p_value) noexcept :
+				 m_guard{std::move(p_guard)}, m_value{p_value}
+			{
+			}
+
+			const T& operator*() const noexcept
+			{
+				return *m_value;
+			}
+			const T* operator->() const noexcept
+			{
+				return m_value;
+			}
+		};
+
+	 private:
+		struct Retired
+		{
+			const T* value;
+			Epoch		tag;
+		};
+
+		std::atomic<const T*> m_current;
+		mutable EpochDomain	 m_domain;
+
+		// Serialises Writers and Guards the Retired List
+		std::mutex			  m_write_mutex;
+		std::vector<Retired> m_retired;
+
+	 private:
+		// Called with m_write_mutex Held
+		void publishLocked(std::unique_ptr<const T> p_value)
+		{
+			// Reserved first, so that nothing below can Throw once the Value is Published
+			m_retired.reserve(std::size(m_retired) + 1);
+
+			const T* previous = m_current.exchange(p_value.release(), std::memory_order_seq_cst);
+			m_retired.push_back(Retired{previous, m_domain.advance()});
+
+			reclaimLocked();
+		}
+		void reclaimLocked() noexcept
+		{
+			const auto oldest = m_domain.oldestActive();
+
+			auto it = std::begin(m_retired);
+			for (; it != std::end(m_retired) && it->tag < oldest; ++it)
+				delete it->value;
+
+			// Tags only Grow, as such everything Reclaimable is at the Front
+			m_retired.erase(std::begin(m_retired), it);
+		}
+
+	 public:
+		explicit RCUSnapshot(T p_value = T{}) : m_current{new T(std::move(p_value))} {}
+
+		RCUSnapshot(const RCUSnapshot&) = delete;
+		RCUSnapshot& operator=(const RCUSnapshot&) = delete;
+
+		// No View may outlive the Snapshot
+		~RCUSnapshot()
+		{
+			for (const auto& retired : m_retired)
+				delete retired.value;
+			delete m_current.load(std::memory_order_relaxed);
+		}
+
+		// Wait Free unless more than EpochDomain::MAX_READERS Views are Open
+		View read() const noexcept
+		{
+			auto guard = m_domain.enter();
+			return View{std::move(guard), m_current.load(std::memory_order_seq_cst)};
+		}
+
+		// Replaces the Value outright
+		void publish(T p_value)
+		{
+			auto value = std::make_unique<const T>(std::move(p_value));
+
+			std::lock_guard<std::mutex> lock{m_write_mutex};
+			publishLocked(std::move(value));
+		}
+
+		// p_function Changes a Copy of the current Value which is then Published
+		// If it Throws, Nothing is Published
+		template <typename Function>
+		void update(Function&& p_function)
+		{
+			std::lock_guard<std::mutex> lock{m_write_mutex};
+
+			// Only Writers Store, as such the current Value is Stable here
+			auto value = std::make_unique<T>(*m_current.load(std::memory_order_relaxed));
+			p_function(*value);
+
+			publishLocked(std::move(value));
+		}
+
+		// Deletes whatever is no longer Read
+		// Publishing does so as well, this is for when Writes Stop
+		void reclaim()
+		{
+			std::lock_guard<std::mutex> lock{m_write_mutex};
+			reclaimLocked();
+		}
+
+		// Values Unpublished but still Read
+		std::size_t pendingReclamation()
+		{
+			std::lock_guard<std::mutex> lock{m_write_mutex};
+			return std::size(m_retired);
+		}
+	};
+} // namespace TUESL::Concurrency
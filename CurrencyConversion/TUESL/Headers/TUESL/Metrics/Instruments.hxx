@@ -0,0 +1,158 @@
+#pragma once
+
+// Counters, Gauges and Histograms of a Running Process
+// Updates are Lock Free and never Allocate, as such they may sit on Hot Paths
+// Reads Combine whatever has been Recorded so far, without Stopping Writers
+//
+// Example
+//	Counter& hits = registry.counter("lookups_total", "Lookups", {{"layer", "memory"}});
+//	hits.increment();
+//
+//	Histogram& latency = registry.histogram("query_seconds", "Query Time");
+//	{
+//		ScopedTimer timer{latency};
+//		...
+//	}
+//	latency.snapshot().percentile(99.0);
+//
+// Instruments are Owned by a Registry, which Exports them
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace TUESL::Metrics
+{
+	// Only ever goes up
+	// Striped over Cache Lines, as such Threads Counting at once rarely share one
+	class Counter
+	{
+	 public:
+		static constexpr const std::size_t STRIPES = 16;
+
+	 private:
+		struct alignas(64) Stripe
+		{
+			std::atomic<std::uint64_t> value{0};
+		};
+
+		Stripe m_stripes[STRIPES];
+
+		// Fixed per Thread
+		static std::size_t stripeIndex() noexcept;
+
+	 public:
+		void increment(const std::uint64_t p_amount = 1) noexcept
+		{
+			m_stripes[stripeIndex()].value.fetch_add(p_amount, std::memory_order_relaxed);
+		}
+
+		std::uint64_t value() const noexcept;
+	};
+
+	// Current Level of something, may go either way
+	class Gauge
+	{
+	 private:
+		std::atomic<std::int64_t> m_value{0};
+
+	 public:
+		void set(const std::int64_t p_value) noexcept
+		{
+			m_value.store(p_value, std::memory_order_relaxed);
+		}
+		void add(const std::int64_t p_amount) noexcept
+		{
+			m_value.fetch_add(p_amount, std::memory_order_relaxed);
+		}
+
+		std::int64_t value() const noexcept
+		{
+			return m_value.load(std::memory_order_relaxed);
+		}
+	};
+
+	// Distribution of Unsigned Values in Log Linear Buckets, as HdrHistogram lays them out
+	// Values below SUB_BUCKETS each have their own Bucket
+	// Above that every Power of Two is Split into SUB_BUCKETS Buckets of equal Width
+	// As such any Value is Known to within 1 / SUB_BUCKETS, about 3 Percent
+	//
+	// Durations are Recorded in Nanoseconds, up to about an Hour
+	// Larger Values are Counted in the last Bucket
+	class Histogram
+	{
+	 public:
+		static constexpr const unsigned	 SUB_BUCKET_BITS = 5;
+		static constexpr const std::size_t SUB_BUCKETS		= std::size_t{1} << SUB_BUCKET_BITS;
+		// Highest Power of Two with Buckets of its own
+		static constexpr const unsigned	 MAX_EXPONENT = 41;
+		static constexpr const std::size_t BUCKET_COUNT =
+			 SUB_BUCKETS + (MAX_EXPONENT - SUB_BUCKET_BITS + 1) * SUB_BUCKETS;
+
+		// Counts as they were at one Moment
+		// Buckets are Read one at a Time, as such Values Recorded meanwhile may be Partially in it
+		struct Snapshot
+		{
+			std::vector<std::uint64_t> counts;
+			std::uint64_t				  count = 0;
+			std::uint64_t				  sum	  = 0;
+
+			// Upper Bound of the Bucket holding the p_percentile th Value, 0 if Empty
+			std::uint64_t percentile(const double p_percentile) const noexcept;
+
+			// Values in Buckets whose every Value is at most p_bound
+			std::uint64_t countAtOrBelow(const std::uint64_t p_bound) const noexcept;
+		};
+
+	 private:
+		std::array<std::atomic<std::uint64_t>, BUCKET_COUNT> m_buckets{};
+		// The Count is the Sum of the Buckets, as such it is not kept apart
+		std::atomic<std::uint64_t> m_sum{0};
+
+	 public:
+		static std::size_t bucketIndex(const std::uint64_t p_value) noexcept;
+		// Smallest and Largest Value Counted in the Bucket
+		static std::uint64_t bucketLowerBound(const std::size_t p_index) noexcept;
+		static std::uint64_t bucketUpperBound(const std::size_t p_index) noexcept;
+
+		void record(const std::uint64_t p_value) noexcept
+		{
+			m_buckets[bucketIndex(p_value)].fetch_add(1, std::memory_order_relaxed);
+			m_sum.fetch_add(p_value, std::memory_order_relaxed);
+		}
+
+		template <typename Rep, typename Period>
+		void record(const std::chrono::duration<Rep, Period> p_duration) noexcept
+		{
+			const auto nanoseconds =
+				 std::chrono::duration_cast<std::chrono::nanoseconds>(p_duration).count();
+			record(static_cast<std::uint64_t>(nanoseconds < 0 ? 0 : nanoseconds));
+		}
+
+		Snapshot snapshot() const;
+	};
+
+	// Records the Time from Construction to Destruction
+	class ScopedTimer
+	{
+	 private:
+		Histogram&										 m_histogram;
+		const std::chrono::steady_clock::time_point m_start;
+
+	 public:
+		explicit ScopedTimer(Histogram& p_histogram) noexcept :
+			 m_histogram{p_histogram}, m_start{std::chrono::steady_clock::now()}
+		{
+		}
+		~ScopedTimer()
+		{
+			m_histogram.record(std::chrono::steady_clock::now() - m_start);
+		}
+
+		ScopedTimer(const ScopedTimer&) = delete;
+		ScopedTimer& operator=(const ScopedTimer&) = delete;
+	};
+} // namespace TUESL::Metrics
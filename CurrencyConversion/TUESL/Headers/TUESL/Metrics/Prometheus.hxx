@@ -0,0 +1,27 @@
+#pragma once
+
+// Publishes a Registry where Prometheus can Scrape it
+//
+// Example
+//	A File for the Textfile Collector of node_exporter, Rewritten on every Tick
+//	writePrometheusFile(Registry::global(), L"C:\\Temp\\metrics\\converter.prom");
+//
+//	Or to whoever Connects to a Local Socket
+//	while (auto client = listener.accept())
+//		sendPrometheus(Registry::global(), client.value());
+
+#include <TUESL/Metrics/Registry.hxx>
+#include <TUESL/Net/LocalSocket.hxx>
+
+#include <string_view>
+
+namespace TUESL::Metrics
+{
+	// Written to a Temporary File, which then Replaces p_file_name
+	// As such a Reader never sees a Partial Export
+	bool writePrometheusFile(const Registry& p_registry, const std::wstring_view p_file_name);
+
+	// Sends the whole Export, Blocking until it is Sent
+	// false if the Peer went away, or the Socket would Block
+	bool sendPrometheus(const Registry& p_registry, Net::LocalSocket& p_socket);
+} // namespace TUESL::Metrics
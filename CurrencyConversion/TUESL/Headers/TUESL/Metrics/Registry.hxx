@@ -0,0 +1,88 @@
+#pragma once
+
+// Names every Instrument of the Process and Exports them together
+//
+// Example
+//	auto& registry = Registry::global();
+//	Counter& bytes = registry.counter("upstream_response_bytes_total", "Bytes Downloaded");
+//	bytes.increment(std::size(body));
+//
+//	Then from a Timer, see Prometheus.hxx
+//	writePrometheusFile(registry, L"C:\\Temp\\metrics.prom");
+//
+// Asking again for a Name and Labels already Registered Returns the same Instrument
+// As such Components Register theirs on Construction and keep the Reference
+// Instruments are never Removed, every Reference stays Valid for the Registry's Lifetime
+//
+// Registration Locks, Updating an Instrument never does
+
+#include <TUESL/Metrics/Instruments.hxx>
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace TUESL::Metrics
+{
+	// Name and Value of each Label, in the Order they are Exported
+	using Labels = std::vector<std::pair<std::string, std::string>>;
+
+	class Registry
+	{
+	 private:
+		template <typename Instrument>
+		struct Family
+		{
+			std::string help;
+			// By the Labels as Exported, {name="value",...}
+			std::map<std::string, std::unique_ptr<Instrument>> series;
+		};
+
+		mutable std::mutex m_mutex;
+
+		std::map<std::string, Family<Counter>>	 m_counters;
+		std::map<std::string, Family<Gauge>>	 m_gauges;
+		std::map<std::string, Family<Histogram>> m_histograms;
+
+	 private:
+		// Throws std::invalid_argument if the Name is Invalid or Registered as another Type
+		template <typename Instrument>
+		Instrument& add(std::map<std::string, Family<Instrument>>& p_families,
+							 const std::string_view						p_name,
+							 const std::string_view						p_help,
+							 const Labels&									p_labels);
+
+		bool isRegistered(const std::string_view p_name) const;
+
+	 public:
+		// Instruments of the Library Register here
+		static Registry& global();
+
+		Counter& counter(const std::string_view p_name,
+							  const std::string_view p_help,
+							  const Labels&			 p_labels = {});
+		Gauge&	gauge(const std::string_view p_name,
+						const std::string_view p_help,
+						const Labels&			  p_labels = {});
+
+		// Durations in Nanoseconds, Exported in Seconds
+		Histogram& histogram(const std::string_view p_name,
+									const std::string_view p_help,
+									const Labels&			  p_labels = {});
+
+		// Prometheus Text Exposition Format 0.0.4
+		// Histograms are Exported as Cumulative Buckets at DURATION_BOUNDS
+		std::string exportPrometheus() const;
+	};
+
+	// Upper Bounds of Exported Histogram Buckets, in Seconds
+	// Counts are Exact to the Width of the Log Linear Bucket holding the Bound
+	constexpr const double DURATION_BOUNDS[] = {0.000'01, 0.000'025, 0.000'05, 0.000'1, 0.000'25,
+															  0.000'5,	 0.001,		0.002'5,	 0.005,	  0.01,
+															  0.025,		 0.05,		0.1,		 0.25,	  0.5,
+															  1.0,		 2.5,			5.0,		 10.0};
+} // namespace TUESL::Metrics
@@ -0,0 +1,59 @@
+#pragma once
+
+// Latencies of the most Recent Requests to one Upstream
+// Unlike a Metrics::Histogram it Forgets, as such its Percentiles Follow the Upstream
+// as it Speeds up or Slows down
+//
+// Example
+//	LatencyWindow latency{128};
+//	latency.record(std::chrono::steady_clock::now() - sent_at);
+//	const auto delay = latency.percentile(95.0, 16).value_or(fallback);
+//
+// Thread Safe, the Lock is Held for a Record or a Copy of the Window
+
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace TUESL::Net
+{
+	class LatencyWindow
+	{
+	 public:
+		using Duration = std::chrono::steady_clock::duration;
+
+	 private:
+		// Ring of the last Samples, the Oldest is Overwritten first
+		std::vector<Duration> m_samples;
+		std::size_t				 m_capacity;
+		std::size_t				 m_next = 0;
+
+		mutable std::mutex m_mutex;
+
+	 private:
+		void recordSample(const Duration p_latency);
+
+	 public:
+		// Throws std::invalid_argument if p_capacity is 0
+		explicit LatencyWindow(const std::size_t p_capacity = 128);
+
+		LatencyWindow(const LatencyWindow&) = delete;
+		LatencyWindow& operator=(const LatencyWindow&) = delete;
+
+		template <typename Rep, typename Period>
+		void record(const std::chrono::duration<Rep, Period> p_latency)
+		{
+			recordSample(std::chrono::duration_cast<Duration>(p_latency));
+		}
+
+		// Samples in the Window, at most its Capacity
+		std::size_t size() const;
+
+		// Nearest Rank among the Samples in the Window
+		// nullopt while it holds fewer than p_min_samples, or none at all
+		std::optional<Duration> percentile(const double		p_percentile,
+													  const std::size_t p_min_samples = 1) const;
+	};
+} // namespace TUESL::Net
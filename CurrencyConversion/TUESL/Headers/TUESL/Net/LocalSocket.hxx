@@ -0,0 +1,120 @@
+#pragma once
+
+// Stream Socket over a Unix Domain Socket, as Windows has had since 10 1803
+// Meant for Non Blocking Use within a WSAPoll Event Loop
+//
+// Example
+//	WinsockSession winsock;
+//	auto listener = LocalSocket::listen("C:\\Temp\\service.sock");
+//	listener->setNonBlocking();
+//	while (auto client = listener->accept())
+//		...
+//
+// Every Process must hold a WinsockSession while it uses Sockets
+
+// Winsock 2 must come before Windows.h, which otherwise brings in Winsock 1
+#include <winsock2.h>
+
+#include <afunix.h>
+
+#include <TUESL/Utility/UniqueHandler.hxx>
+
+#include <cstddef>
+#include <optional>
+#include <string_view>
+
+namespace TUESL::Net::Traits
+{
+	struct SocketHandlerTraits
+	{
+		using POINTER		  = SOCKET;
+		using CONST_POINTER = const POINTER;
+
+		static auto invalid() noexcept
+		{
+			return INVALID_SOCKET;
+		}
+		static auto close(POINTER p_socket)
+		{
+			VERIFY_FUNCTION(0, closesocket(p_socket));
+		}
+	};
+} // namespace TUESL::Net::Traits
+
+namespace TUESL::Net::Handler
+{
+	using Socket = TUESL::Utility::Handler::UniqueHandler<Traits::SocketHandlerTraits>;
+} // namespace TUESL::Net::Handler
+
+namespace TUESL::Net
+{
+	// Starts Winsock for as long as it lives
+	class WinsockSession
+	{
+	 private:
+		bool m_is_started = false;
+
+	 public:
+		WinsockSession();
+		~WinsockSession();
+
+		WinsockSession(const WinsockSession&) = delete;
+		WinsockSession& operator=(const WinsockSession&) = delete;
+
+		bool isStarted() const noexcept
+		{
+			return m_is_started;
+		}
+	};
+
+	enum class IOStatus
+	{
+		DONE,
+		// Nothing could be Transferred without Blocking
+		WOULD_BLOCK,
+		// The Peer has Closed its End
+		CLOSED,
+		FAILED
+	};
+
+	struct IOResult
+	{
+		IOStatus	   status = IOStatus::FAILED;
+		std::size_t bytes  = 0;
+	};
+
+	class LocalSocket
+	{
+	 private:
+		Handler::Socket m_socket;
+
+	 public:
+		LocalSocket() = default;
+		explicit LocalSocket(const SOCKET p_socket) noexcept : m_socket{p_socket} {}
+
+		// A Socket File left behind by an earlier Listener is Replaced
+		// nullopt if the Path is too Long or the Socket could not be Bound
+		static std::optional<LocalSocket> listen(const std::string_view p_path,
+															  const int					p_backlog = SOMAXCONN);
+
+		static std::optional<LocalSocket> connect(const std::string_view p_path);
+
+		// nullopt once no Connection is Waiting, or on Failure
+		std::optional<LocalSocket> accept() noexcept;
+
+		bool setNonBlocking() noexcept;
+
+		// At most p_size Bytes, in a Single Call
+		IOResult receive(void* p_buffer, const std::size_t p_size) noexcept;
+		IOResult send(const void* p_buffer, const std::size_t p_size) noexcept;
+
+		SOCKET get() const noexcept
+		{
+			return m_socket.get();
+		}
+		bool empty() const noexcept
+		{
+			return m_socket.empty();
+		}
+	};
+} // namespace TUESL::Net
@@ -0,0 +1,182 @@
+#pragma once
+
+// Schedules Requests to an Upstream Service within its Budget
+//
+// Tokens Refill at Options::requests_per_second up to Options::burst, each Request takes one
+// At most Options::max_in_flight Requests are Outstanding at once
+//
+// Requests Queue in one of two Lanes
+//	INTERACTIVE, for Requests a User is Waiting on, is always Granted first
+//	BACKGROUND, for Refreshes and Batches, only takes what INTERACTIVE would not Miss
+//	It Leaves Options::interactive_tokens Tokens and Options::interactive_slots Slots Unused
+//
+// A Request is Granted by calling its Grant with a Permit
+// The Slot is Held until the Permit is Destroyed or Released
+//
+// Nothing here Waits on a Thread, and Time comes from an Injectable Clock
+// When Requests Wait on Tokens, WakeAt is called with the Time they may go
+// The Owner then calls dispatch at that Time, from a Timer or a Test Stepping its Clock
+//
+// Example
+//	RequestScheduler scheduler{options, now, [&](TimePoint p_time) { timer.arm(p_time); }};
+//	scheduler.submit(Priority::INTERACTIVE, [](RequestScheduler::Permit p_permit) { ... });
+//	When the Timer Fires
+//	scheduler.dispatch();
+//
+// Thread Safe
+// Grants and WakeAt are called without the Lock Held, on whichever Thread made room
+// A Grant must not Throw, Permits must not outlive the Scheduler
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace TUESL::Net
+{
+	enum class Priority
+	{
+		INTERACTIVE,
+		BACKGROUND
+	};
+
+	class RequestScheduler
+	{
+	 public:
+		using Clock		= std::chrono::steady_clock;
+		using TimePoint = Clock::time_point;
+		using Now		= std::function<TimePoint()>;
+		using WakeAt	= std::function<void(TimePoint)>;
+
+		struct Options
+		{
+			// Sustained Rate the Upstream Allows
+			double requests_per_second = 1.0;
+			// Requests that may go at once after a Quiet Period
+			double burst = 1.0;
+			std::size_t max_in_flight = 4;
+
+			// Held back from BACKGROUND for INTERACTIVE
+			double		interactive_tokens = 0.0;
+			std::size_t interactive_slots	 = 0;
+		};
+
+		struct LaneMetrics
+		{
+			std::size_t queue_depth		= 0;
+			std::size_t max_queue_depth = 0;
+
+			std::uint64_t granted = 0;
+			// From submit to Grant, across all Granted Requests
+			std::chrono::microseconds total_wait{0};
+			std::chrono::microseconds max_wait{0};
+		};
+
+		struct Metrics
+		{
+			LaneMetrics interactive;
+			LaneMetrics background;
+
+			std::size_t in_flight = 0;
+			double		tokens	 = 0.0;
+		};
+
+		class Permit
+		{
+		 private:
+			RequestScheduler* m_scheduler = nullptr;
+
+			friend class RequestScheduler;
+			explicit Permit(RequestScheduler* p_scheduler) noexcept : m_scheduler{p_scheduler}
+			{
+			}
+
+		 public:
+			Permit() = default;
+			Permit(Permit&& p_other) noexcept :
+				 m_scheduler{std::exchange(p_other.m_scheduler, nullptr)}
+			{
+			}
+			Permit& operator=(Permit&& p_other) noexcept
+			{
+				if (this != &p_other)
+				{
+					release();
+					m_scheduler = std::exchange(p_other.m_scheduler, nullptr);
+				}
+				return *this;
+			}
+			~Permit()
+			{
+				release();
+			}
+
+			// Frees the Slot before the Permit is Destroyed
+			// The next Request in Line may be Granted on this Thread
+			void release() noexcept;
+		};
+
+		using Grant = std::function<void(Permit)>;
+
+	 private:
+		struct Waiting
+		{
+			Grant		 grant;
+			TimePoint submitted;
+		};
+
+		static constexpr const std::size_t LANE_COUNT = 2;
+
+		const Options m_options;
+		const Now	  m_now;
+		const WakeAt  m_wake_at;
+
+		mutable std::mutex m_mutex;
+
+		std::deque<Waiting> m_lanes[LANE_COUNT];
+		LaneMetrics			  m_lane_metrics[LANE_COUNT];
+
+		double		m_tokens;
+		TimePoint	m_refilled;
+		std::size_t m_in_flight = 0;
+
+		// Earliest Time the Owner was asked to dispatch at and has not yet
+		// Later Requests for the same or a later Time are not Passed on
+		std::optional<TimePoint> m_wake_time;
+
+	 private:
+		void refillLocked(const TimePoint p_now) noexcept;
+
+		// Takes a Token and a Slot for every Request that may go now
+		// Returns their Grants, to be called once the Lock is Released
+		// Sets p_wake_time if a Request is Waiting on Tokens the Owner was not yet asked about
+		std::vector<Grant> takeGrantsLocked(const TimePoint			  p_now,
+													  std::optional<TimePoint>& p_wake_time);
+
+		void runGrants(std::vector<Grant> p_grants, const std::optional<TimePoint> p_wake_time);
+
+		void releaseSlot() noexcept;
+
+	 public:
+		explicit RequestScheduler(const Options& p_options,
+										  Now				  p_now		= &Clock::now,
+										  WakeAt			  p_wake_at = {});
+
+		RequestScheduler(const RequestScheduler&) = delete;
+		RequestScheduler& operator=(const RequestScheduler&) = delete;
+
+		// Queues the Request, it may be Granted before this Returns
+		void submit(const Priority p_priority, Grant p_grant);
+
+		// Grants Requests which were Waiting on Tokens
+		// Meant to be called at the Time given to WakeAt
+		void dispatch();
+
+		Metrics metrics() const;
+	};
+} // namespace TUESL::Net
@@ -16,10 +16,26 @@
 #	include <winrt/Windows.Web.Http.Headers.h>
 #	include <winrt/Windows.Web.Http.h>
 
+// Required to Read Responses as Bytes
+#	include <winrt/Windows.Storage.Streams.h>
+
 // Required to deal with CoRoutines
 #	include <winrt/Windows.Foundation.h>
+
+// Required to Wake the Scheduler once Tokens have Refilled
+#	include <winrt/Windows.System.Threading.h>
 #endif
 
+// Required to keep Requests within the Upstream Budget
+#include <TUESL/Net/RequestScheduler.hxx>
+
+#include <TUESL/Metrics/Registry.hxx>
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string_view>
+
 namespace TUESL::Net
 {
 	namespace
@@ -32,18 +48,96 @@ namespace TUESL::Net
 		using Windows::Web::Http::HttpResponseMessage;
 		using Windows::Web::Http::HttpStatusCode;
 
+		using Windows::Foundation::IAsyncInfo;
 		using Windows::Foundation::IAsyncOperation;
+
+		using Windows::System::Threading::ThreadPoolTimer;
 #endif
 	} // namespace
 
+	// Lets a Caller Abandon a Request it no longer Waits on, such as the Loser of a Hedge
+	// Shared between the Caller and the Request
+	// Once cancel is called the Request Aborts what it is Waiting on, and Returns Empty
+	// A Request not yet Granted is Dropped once it is, without being Sent
+	class RequestCancellation
+	{
+	 private:
+		std::mutex m_mutex;
+		bool		  m_is_cancelled = false;
+
+#ifdef TUESL_USING_CPP_WINRT
+		// Operation the Request is Waiting on, Cancelled along with it
+		IAsyncInfo m_pending{nullptr};
+#endif
+
+	 public:
+		void cancel() noexcept;
+		bool isCancelled() noexcept;
+
+#ifdef TUESL_USING_CPP_WINRT
+		// Replaces the Operation Pending, and Cancels p_operation at once if the Request is
+		void attach(const IAsyncInfo& p_operation);
+#endif
+	};
+
 	struct WebClient
 	{
+	 public:
+		// Called with the URI and Body of every Successful Response, before it is Returned
+		// The Body is only Valid for the Call, and is not Copied for it
+		// Runs on the Thread the Response was Read on, once the Request is Counted
+		// Whatever it Throws is Ignored, as such it never Fails the Request
+		using ResponseObserver =
+			 std::function<void(const std::wstring_view p_uri, const std::string_view p_body)>;
+
 	 private:
+		// Every Request to the Upstream goes through it
+		RequestScheduler m_scheduler;
+
+		// Clients Registering in the same Registry Share these
+		// Latency is from the Grant to the last Byte of the Response
+		Metrics::Histogram& m_queue_wait;
+		Metrics::Histogram& m_request_latency;
+		Metrics::Counter&	  m_requests_succeeded;
+		Metrics::Counter&	  m_requests_failed;
+		Metrics::Counter&	  m_requests_cancelled;
+		Metrics::Counter&	  m_response_bytes;
+		Metrics::Gauge&	  m_requests_in_flight;
+
+		ResponseObserver m_response_observer;
+
 #ifdef TUESL_USING_CPP_WINRT
 		HttpClient m_web_client;
+
+		// Calls dispatch once Requests Waiting on Tokens may go
+		// Only the Earliest is kept, a later one is Cancelled when an Earlier is Armed
+		ThreadPoolTimer m_refill_timer{nullptr};
+		std::mutex		 m_refill_timer_mutex;
 #endif
 
+	 private:
+		void armRefillTimer(const RequestScheduler::TimePoint p_time);
+
 	 public:
+		explicit WebClient(const RequestScheduler::Options& p_options = {},
+								 Metrics::Registry& p_metrics = Metrics::Registry::global());
+		~WebClient();
+
+		// The Scheduler and Timer refer back to the Client
+		WebClient(const WebClient&) = delete;
+		WebClient& operator=(const WebClient&) = delete;
+
+		RequestScheduler::Metrics schedulerMetrics() const
+		{
+			return m_scheduler.metrics();
+		}
+
+		// Set before the first Request, it is Read without a Lock
+		void setResponseObserver(ResponseObserver p_observer)
+		{
+			m_response_observer = std::move(p_observer);
+		}
+
 #ifdef TUESL_USING_CPP_WINRT
 		void setUserAgent(const std::wstring_view p_user_agent);
 
@@ -59,7 +153,13 @@ namespace TUESL::Net
 		auto getAsync(const Uri& p_uri);
 		auto getAsync(const std::wstring_view p_uri);
 
-		IAsyncOperation<hstring> ReadJsonFromUriAsync(const std::wstring_view p_uri);
+		// Waits in p_priority's Lane until the Scheduler Grants the Request
+		// The Body is Decoded as UTF-8
+		// Empty on any Failure, and once p_cancellation is Cancelled
+		IAsyncOperation<hstring> ReadJsonFromUriAsync(
+			 const std::wstring_view					  p_uri,
+			 const Priority								  p_priority	  = Priority::INTERACTIVE,
+			 const std::shared_ptr<RequestCancellation> p_cancellation = nullptr);
 #endif
 	};
 } // namespace TUESL::Net
\ No newline at end of file
@@ -0,0 +1,150 @@
+#pragma once
+
+// Exact Decimal Money and Rates held as Scaled 64 Bit Integers
+// Unlike double, every Amount typed or stored is Represented Exactly
+// and every Conversion Rounds the same way on every Machine
+//
+// Money is held in Units of 10^-4, enough for every ISO 4217 Minor Unit
+// Rates are held in Units of 10^-9
+//
+// Example
+//	const auto amount = Money::parse("1234.56");
+//	const auto rate	= Rate::parse("83.123456789");
+//	const auto result = convert(*amount, *rate); // 102620.8948
+
+#include <TUESL/Numeric/InstructionSet.hxx>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace TUESL::Numeric
+{
+	struct Money
+	{
+		static constexpr const int				DECIMALS = 4;
+		static constexpr const std::int64_t SCALE	 = 10'000;
+
+		// Never a Valid Amount
+		// Marks Results that did not fit
+		static constexpr const std::int64_t INVALID_UNITS =
+			 (std::numeric_limits<std::int64_t>::min)();
+
+		std::int64_t units = 0;
+
+		// Accepts an Optional Sign, Digits and an Optional Fraction
+		// Digits past DECIMALS are Rounded Half Away from Zero
+		// Returns nullopt on anything else or if the Amount does not fit
+		static std::optional<Money> parse(const std::string_view p_text) noexcept;
+
+		// Rounds Half Away from Zero
+		// Returns nullopt for Non Finite or Out of Range Values
+		static std::optional<Money> fromDouble(const double p_value) noexcept;
+
+		// Trailing Zeros of the Fraction are Dropped
+		std::string toString() const;
+
+		double toDouble() const noexcept
+		{
+			return static_cast<double>(units) / SCALE;
+		}
+		bool isValid() const noexcept
+		{
+			return units != INVALID_UNITS;
+		}
+
+		friend bool operator==(const Money p_lhs, const Money p_rhs) noexcept
+		{
+			return p_lhs.units == p_rhs.units;
+		}
+		friend bool operator!=(const Money p_lhs, const Money p_rhs) noexcept
+		{
+			return p_lhs.units != p_rhs.units;
+		}
+	};
+
+	struct Rate
+	{
+		static constexpr const int				DECIMALS = 9;
+		static constexpr const std::int64_t SCALE	 = 1'000'000'000;
+
+		// Rates are never Negative
+		// 0 is kept as the Error Value, as it was with double Rates
+		std::int64_t units = 0;
+
+		static std::optional<Rate> parse(const std::string_view p_text) noexcept;
+
+		// Rounds to the Nearest Unit
+		// Returns nullopt for Negative, Non Finite or Out of Range Values
+		static std::optional<Rate> fromDouble(const double p_value) noexcept;
+
+		std::string toString() const;
+
+		double toDouble() const noexcept
+		{
+			return static_cast<double>(units) / SCALE;
+		}
+
+		// 1 / Rate Rounded to the Nearest Unit
+		// Computed in Integers, as such it is the same on every Machine
+		std::optional<Rate> inverse() const noexcept;
+
+		friend bool operator==(const Rate p_lhs, const Rate p_rhs) noexcept
+		{
+			return p_lhs.units == p_rhs.units;
+		}
+		friend bool operator!=(const Rate p_lhs, const Rate p_rhs) noexcept
+		{
+			return p_lhs.units != p_rhs.units;
+		}
+	};
+
+	// Kernels below Reinterpret Buffers of Money as Buffers of Units
+	static_assert(sizeof(Money) == sizeof(std::int64_t), "Money must stay a Single Integer");
+	static_assert(sizeof(Rate) == sizeof(std::int64_t), "Rate must stay a Single Integer");
+
+	// p_amount * p_rate Rounded Half Away from Zero
+	// Returns nullopt if the Result does not fit
+	std::optional<Money> convert(const Money p_amount, const Rate p_rate) noexcept;
+
+	// Rate of Converting by p_first and then by p_second
+	// p_first * p_second Rounded to the Nearest Unit, Computed in Integers
+	// Returns nullopt for Negative Rates or if the Result does not fit
+	std::optional<Rate> chain(const Rate p_first, const Rate p_second) noexcept;
+
+	// p_output[i] = convert(p_amounts[i], p_rate)
+	// Results that do not fit are set to Money::INVALID_UNITS
+	// Returns the Number of such Results
+	std::size_t convertAmounts(const Money*		p_amounts,
+										const std::size_t p_count,
+										const Rate			p_rate,
+										Money*				p_output) noexcept;
+
+	// Row Major Matrix of p_rate_count Rows and p_amount_count Columns
+	// Same Layout as scaleOuter
+	// Returns the Number of Results that did not fit
+	std::size_t convertOuter(const Money*		p_amounts,
+									 const std::size_t p_amount_count,
+									 const Rate*		p_rates,
+									 const std::size_t p_rate_count,
+									 Money*				p_output) noexcept;
+
+	// Kernels for a Specific Instruction Set
+	// Used by Benchmarks to Compare them
+	// convertAmountsAVX2 must only be called if detectInstructionSet() returned AVX2
+	namespace Kernels
+	{
+		std::size_t convertAmountsScalar(const Money*		p_amounts,
+													const std::size_t p_count,
+													const Rate			p_rate,
+													Money*				p_output) noexcept;
+
+		std::size_t convertAmountsAVX2(const Money*		 p_amounts,
+												 const std::size_t p_count,
+												 const Rate			 p_rate,
+												 Money*				 p_output) noexcept;
+	} // namespace Kernels
+} // namespace TUESL::Numeric
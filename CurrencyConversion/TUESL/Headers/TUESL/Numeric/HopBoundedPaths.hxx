@@ -0,0 +1,97 @@
+#pragma once
+
+// Cheapest Paths between every Pair of Nodes using at most a Fixed Number of Edges
+//
+// Weights are Floats, NO_EDGE where there is none
+// Negative Weights and Cycles are Allowed, the Bound on Edges keeps every Distance Finite
+// Floyd Warshall can do neither, as it Bounds the Intermediate Nodes rather than the Edges
+//
+// Layer h holds the Cheapest Walks of at most h Edges
+//	layer(h) = layer(h - 1) (min, +) W, with W Zero on its Diagonal
+// Each Layer is one Tiled min-plus Product, as such a recompute is O(max_edges * N^3)
+// An Edge that got Cheaper is Folded in by lowerWeight in O(max_edges^2 * N^2)
+//
+// Example
+//	HopBoundedPaths paths{3, 2};
+//	paths.setWeight(0, 1, 1.0f);
+//	paths.setWeight(1, 2, 1.0f);
+//	paths.recompute();
+//	paths.distance(0, 2);	// 2
+//	paths.path(0, 2);			// {0, 1, 2}
+//
+// Not Thread Safe, Copies are Independent
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace TUESL::Numeric
+{
+	class HopBoundedPaths
+	{
+	 public:
+		static constexpr const float NO_EDGE = std::numeric_limits<float>::infinity();
+
+	 private:
+		std::size_t m_count;
+		std::size_t m_stride;
+		std::size_t m_max_edges;
+
+		// m_count Rows of m_stride Floats, Padding Columns are NO_EDGE
+		std::vector<float> m_weights;
+		// Layers 1 to m_max_edges one after the other, each Shaped as m_weights
+		// Layer 0 is only Implied, it is 0 on the Diagonal and NO_EDGE elsewhere
+		std::vector<float> m_layers;
+
+	 private:
+		float*		 layer(const std::size_t p_edges) noexcept;
+		const float* layer(const std::size_t p_edges) const noexcept;
+
+		// Entry of Layer p_edges, including Layer 0
+		float layerAt(const std::size_t p_edges,
+						  const std::size_t p_from,
+						  const std::size_t p_to) const noexcept;
+
+	 public:
+		HopBoundedPaths() : HopBoundedPaths(0, 1) {}
+		HopBoundedPaths(const std::size_t p_count, const std::size_t p_max_edges);
+
+		std::size_t count() const noexcept
+		{
+			return m_count;
+		}
+		std::size_t maxEdges() const noexcept
+		{
+			return m_max_edges;
+		}
+
+		float weight(const std::size_t p_from, const std::size_t p_to) const noexcept
+		{
+			return m_weights[p_from * m_stride + p_to];
+		}
+
+		// Distances are not Updated until recompute
+		// Weights on the Diagonal are Ignored, a Node is always 0 from itself
+		void setWeight(const std::size_t p_from, const std::size_t p_to, const float p_weight);
+
+		// Rebuilds every Layer from the Weights
+		void recompute();
+
+		// Sets the Weight and Updates every Layer with the Walks that take the Edge once
+		// Walks taking it more often would need a Negative Cycle to be any Cheaper
+		// Returns false, Changing nothing, if p_weight is above the Current Weight
+		// A Weight that Rises may Invalidate any Distance, only recompute can tell
+		bool lowerWeight(const std::size_t p_from, const std::size_t p_to, const float p_weight);
+
+		// Cheapest Walk of at most maxEdges Edges, NO_EDGE if there is none
+		float distance(const std::size_t p_from, const std::size_t p_to) const noexcept
+		{
+			return layerAt(m_max_edges, p_from, p_to);
+		}
+
+		// Nodes along the Cheapest Walk, p_from and p_to Included
+		// Empty if p_to can not be Reached within maxEdges
+		// Traced back through the Layers, as such no Predecessors are Stored
+		std::vector<std::size_t> path(const std::size_t p_from, const std::size_t p_to) const;
+	};
+} // namespace TUESL::Numeric
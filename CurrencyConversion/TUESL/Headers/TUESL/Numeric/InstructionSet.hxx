@@ -0,0 +1,29 @@
+#pragma once
+
+// Runtime Selection of SIMD Kernels
+// The Widest Instruction Set the CPU supports is Picked once
+// So that the same Binary runs on Machines without AVX2
+//
+// TUESL_TARGET_AVX2 marks Functions which use AVX2 Intrinsics
+// MSVC allows Intrinsics of any Instruction Set, GCC and Clang need to be told per Function
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#	define TUESL_HAS_X86
+#	if defined(_MSC_VER)
+#		define TUESL_TARGET_AVX2
+#	else
+#		define TUESL_TARGET_AVX2 __attribute__((target("avx2")))
+#	endif
+#endif
+
+namespace TUESL::Numeric
+{
+	enum class InstructionSet
+	{
+		SCALAR,
+		AVX2
+	};
+
+	// Checks both the CPU and whether the OS Saves the YMM Registers
+	InstructionSet detectInstructionSet() noexcept;
+} // namespace TUESL::Numeric
@@ -0,0 +1,63 @@
+#pragma once
+
+// Matrix Product over the (min, +) Semiring
+// The Shortest Path Counterpart of a Matrix Multiply
+//	p_c[i][j] = min(p_c[i][j], min over k of p_a[i][k] + p_b[k][j])
+//
+// Square Row Major Matrices of Floats
+// Rows are p_stride Floats apart, p_stride must be a Multiple of MIN_PLUS_LANES
+// Columns from p_count up to p_stride are Padding and must hold +Infinity
+// As such every Row is Processed in whole Vectors
+//
+// +Infinity stands for No Edge, Entries are never NaN
+// Only Adds and Compares are Performed
+// As such every Kernel gives Bit Identical Results
+
+#include <TUESL/Numeric/InstructionSet.hxx>
+
+#include <cstddef>
+
+namespace TUESL::Numeric
+{
+	// Floats per AVX2 Vector
+	constexpr const std::size_t MIN_PLUS_LANES = 8;
+
+	// Smallest Valid Stride for p_count Columns
+	constexpr std::size_t minPlusStride(const std::size_t p_count) noexcept
+	{
+		return (p_count + MIN_PLUS_LANES - 1) / MIN_PLUS_LANES * MIN_PLUS_LANES;
+	}
+
+	// p_c must not be the Same Buffer as p_a or p_b
+	// Processed in Tiles so that the Tile of p_b stays in L1 across all Rows
+	void minPlusProduct(const float*		  p_a,
+							  const float*		  p_b,
+							  float*				  p_c,
+							  const std::size_t p_count,
+							  const std::size_t p_stride) noexcept;
+
+	// p_row[j] = min(p_row[j], p_offset + p_other[j]) for j < p_stride
+	// A Single Row Step of the above, for Incremental Updates
+	void minPlusRow(const float*		 p_other,
+						 const float		 p_offset,
+						 float*				 p_row,
+						 const std::size_t p_stride) noexcept;
+
+	// Kernels for a Specific Instruction Set
+	// Used by Benchmarks to Compare them
+	// minPlusProductAVX2 must only be called if detectInstructionSet() returned AVX2
+	namespace Kernels
+	{
+		void minPlusProductScalar(const float*		  p_a,
+										  const float*		  p_b,
+										  float*				  p_c,
+										  const std::size_t p_count,
+										  const std::size_t p_stride) noexcept;
+
+		void minPlusProductAVX2(const float*		p_a,
+										const float*		p_b,
+										float*				p_c,
+										const std::size_t p_count,
+										const std::size_t p_stride) noexcept;
+	} // namespace Kernels
+} // namespace TUESL::Numeric
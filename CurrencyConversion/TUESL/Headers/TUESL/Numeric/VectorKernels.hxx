@@ -0,0 +1,45 @@
+#pragma once
+
+// Multiply Kernels over Contiguous Buffers of Doubles
+//
+// Only Multiplies are Performed, never Fused Multiply Add
+// As such every Kernel gives Bit Identical Results
+
+#include <TUESL/Numeric/InstructionSet.hxx>
+
+#include <cstddef>
+
+namespace TUESL::Numeric
+{
+	// p_output[i] = p_input[i] * p_factor
+	// p_input and p_output may be the Same Buffer
+	void scale(const double*		p_input,
+				  const std::size_t p_count,
+				  const double			p_factor,
+				  double*				p_output) noexcept;
+
+	// Row Major Matrix of p_factor_count Rows and p_amount_count Columns
+	// p_output[row * p_amount_count + column] = p_amounts[column] * p_factors[row]
+	// Amounts are Processed in Tiles so that each Tile stays in Cache across all Rows
+	void scaleOuter(const double*		  p_amounts,
+						 const std::size_t p_amount_count,
+						 const double*		  p_factors,
+						 const std::size_t p_factor_count,
+						 double*				  p_output) noexcept;
+
+	// Kernels for a Specific Instruction Set
+	// Used by Benchmarks to Compare them
+	// scaleAVX2 must only be called if detectInstructionSet() returned AVX2
+	namespace Kernels
+	{
+		void scaleScalar(const double*	  p_input,
+							  const std::size_t p_count,
+							  const double		  p_factor,
+							  double*			  p_output) noexcept;
+
+		void scaleAVX2(const double*		p_input,
+							const std::size_t p_count,
+							const double		p_factor,
+							double*				p_output) noexcept;
+	} // namespace Kernels
+} // namespace TUESL::Numeric
@@ -0,0 +1,51 @@
+#pragma once
+
+// Online Backup of one Database into another
+// Built on sqlite3_backup_init, sqlite3_backup_step and sqlite3_backup_finish
+//
+// Pages are Copied a few at a time
+// Between Steps both Connections are Free for other Statements
+// If the Source Changes in between, SQLite Restarts or Updates the Copy by itself
+// As such a Completed Backup always holds a Consistent Database
+//
+// Example
+//	Backup backup{disk_db, memory_db};
+//	while (!backup.step(16))
+//		; // Other Work
+//
+// Both Databases must outlive the Backup
+
+#include "Database.hxx"
+
+namespace TUESL::SQLite
+{
+	class Backup
+	{
+	 public:
+		// Pass to step to Copy every Remaining Page at once
+		static constexpr const int ALL_PAGES = -1;
+
+	 private:
+		Handler::Backup m_backup;
+		bool				 m_is_complete = false;
+
+	 public:
+		// Copies the main Database of p_source over the main Database of p_destination
+		// p_destination must not be used by anything else until Complete
+		Backup(Database& p_destination, Database& p_source);
+
+		// Copies up to p_pages Pages
+		// Returns true once every Page has been Copied
+		// A Busy or Locked Database is not an Error, the Step simply Copies Nothing
+		bool step(const int p_pages);
+
+		bool isComplete() const noexcept
+		{
+			return m_is_complete;
+		}
+
+		// As of the last Step
+		int remainingPages() const noexcept;
+		int pageCount() const noexcept;
+	};
+} // namespace TUESL::SQLite
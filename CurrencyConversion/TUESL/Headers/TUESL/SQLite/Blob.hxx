@@ -0,0 +1,58 @@
+#pragma once
+
+// Incremental I/O on a single BLOB, without Reading or Writing the rest of its Row
+// Built on sqlite3_blob_open, sqlite3_blob_read and sqlite3_blob_write
+//
+// A Blob can not change Size, as such its Row is Inserted holding zeroblob(n)
+// and the Bytes are then Written into it a Chunk at a time
+// As such a Payload is never Bound to a Statement as a Copy of its own
+//
+// Example
+//	PrepareStatement insert{db, "INSERT INTO blocks(data) VALUES (zeroblob(?));"};
+//	insert.bind(size).execute();
+//	Blob blob{db, "blocks", "data", db.lastInsertRowID(), Blob::Mode::READ_WRITE};
+//	blob.write(0, chunk, chunk_size);
+//
+// Writes do not Reach Change Listeners, only the Insert of the Row does
+// The Database must outlive the Blob
+
+#include "Database.hxx"
+
+#include <cstddef>
+#include <string_view>
+
+namespace TUESL::SQLite
+{
+	class Blob
+	{
+	 public:
+		enum class Mode
+		{
+			READ_ONLY,
+			READ_WRITE
+		};
+
+	 private:
+		Handler::Blob m_blob;
+
+	 public:
+		// Opens p_column of the Row p_rowid of p_table in the main Database
+		// Throws SQLiteException if there is no such Row, or the Column is not a BLOB or TEXT
+		Blob(Database&					p_db,
+			  const std::string_view p_table,
+			  const std::string_view p_column,
+			  const DataTypes::Int64 p_rowid,
+			  const Mode				p_mode = Mode::READ_ONLY);
+
+		// Moves to p_rowid of the same Table and Column
+		// Cheaper than Opening a Blob anew, as the Statement behind it is Kept
+		void reopen(const DataTypes::Int64 p_rowid);
+
+		std::size_t size() const noexcept;
+
+		// Throws SQLiteException if p_offset and p_size go beyond the Blob
+		// or if its Row was Changed or Deleted since it was Opened
+		void read(const std::size_t p_offset, void* p_buffer, const std::size_t p_size);
+		void write(const std::size_t p_offset, const void* p_data, const std::size_t p_size);
+	};
+} // namespace TUESL::SQLite
@@ -0,0 +1,114 @@
+#pragma once
+
+// Row Level Change Notifications of a Connection
+// Built on sqlite3_update_hook, sqlite3_commit_hook and sqlite3_rollback_hook
+// Subscribe via Database::subscribe
+//
+// Rows Changed within a Transaction are Held back until it Commits
+// and are then Delivered together as one Batch per Listener
+// Rows of a Transaction that Rolls back are never Delivered
+//
+// As with the Update Hook itself, no Events are Raised for
+//	DELETE without a WHERE Clause, which SQLite runs as a Truncate
+//	Rows Replaced by ON CONFLICT REPLACE
+//	WITHOUT ROWID Tables
+// As such Caches relying on this must not be Cleared through those
+
+#include "DataTypes.hxx"
+#include "SQLite3PCH.hxx"
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace TUESL::SQLite
+{
+	// Not INSERT, UPDATE and DELETE as winnt.h defines DELETE
+	enum class ChangeOperation
+	{
+		INSERTED,
+		UPDATED,
+		DELETED
+	};
+
+	struct ChangeEvent
+	{
+		std::string		  table;
+		DataTypes::Int64 rowid;
+		ChangeOperation  operation;
+	};
+
+	// Called on the Thread whose Commit Completed, outside of any Lock
+	// Listeners may run Statements of their own on the same Connection
+	// Listeners must not Throw
+	using ChangeListener = std::function<void(const std::vector<ChangeEvent>&)>;
+
+	using SubscriptionID = std::uint64_t;
+
+	class ChangeNotifier
+	{
+	 private:
+		struct Subscription
+		{
+			SubscriptionID id;
+			// Empty for every Table
+			std::string	   table;
+			ChangeListener listener;
+		};
+
+		sqlite3* m_db = nullptr;
+
+		// Hooks run with the Connection Locked, Dispatch does not
+		// As such the Queues have a Lock of their own
+		std::mutex m_mutex;
+
+		// Rows of the Open Transaction
+		std::vector<ChangeEvent> m_pending;
+		// Rows of Committed Transactions not yet Delivered
+		std::vector<ChangeEvent> m_committed;
+		// Lets dispatch skip the Lock after every Statement
+		std::atomic<bool> m_has_committed{false};
+
+		// Shared so that Dispatch can call Listeners without the Lock
+		std::vector<std::shared_ptr<const Subscription>> m_subscriptions;
+		SubscriptionID												 m_next_id = 1;
+
+	 private:
+		static void onUpdate(void*					p_notifier,
+									int					p_operation,
+									const char*			p_database_name,
+									const char*			p_table_name,
+									sqlite3_int64		p_rowid);
+		static int	onCommit(void* p_notifier);
+		static void onRollback(void* p_notifier);
+
+		void installHooks() noexcept;
+		void removeHooks() noexcept;
+
+	 public:
+		ChangeNotifier() = default;
+
+		// Hooks hold a Pointer to the Notifier
+		ChangeNotifier(const ChangeNotifier&) = delete;
+		ChangeNotifier& operator=(const ChangeNotifier&) = delete;
+
+		~ChangeNotifier();
+
+		// Moves the Hooks to p_db
+		// Events of the previous Connection are Dropped
+		// p_db of nullptr only Removes them, before the Connection is Closed
+		void attach(sqlite3* p_db);
+
+		// p_table of "" Subscribes to every Table of the main Database
+		SubscriptionID subscribe(const std::string_view p_table, ChangeListener p_listener);
+		void			   unsubscribe(const SubscriptionID p_id);
+
+		// Delivers every Committed Batch
+		// Cheap if there is Nothing to Deliver
+		void dispatch() noexcept;
+	};
+} // namespace TUESL::SQLite
@@ -1,7 +1,12 @@
 #pragma once
 
+#include "ChangeNotifier.hxx"
+#include "Function.hxx"
 #include "SQLHandler.hxx"
 #include "SQLiteException.hxx"
+#include "VirtualTable.hxx"
+
+#include <memory>
 
 namespace TUESL::SQLite
 {
@@ -28,6 +33,11 @@ namespace TUESL::SQLite
 	 private:
 		Handler::Database m_db;
 
+		// Held by Pointer as the Hooks refer to it
+		// Declared after m_db so that it is Destroyed first, and Removes its Hooks
+		// while the Connection is still Open
+		std::unique_ptr<ChangeNotifier> m_change_notifier = std::make_unique<ChangeNotifier>();
+
 	 public:
 		Database(const std::string_view p_file_name,
 					const int p_flags = SQLITE_OPEN_CREATE | SQLITE_OPEN_READWRITE |
@@ -54,6 +64,43 @@ namespace TUESL::SQLite
 
 		Database& executeSQL(const std::string_view p_sql);
 
+		// Registers p_name(...) on this Connection, replacing any Function of that Name
+		// p_argument_count of -1 accepts any Number of Arguments
+		// Drop SQLITE_DETERMINISTIC for Functions whose Results change over Time
+		Database& createFunction(const std::string_view p_name,
+										 const int					p_argument_count,
+										 ScalarFunction			p_function,
+										 const int p_flags = SQLITE_UTF8 | SQLITE_DETERMINISTIC);
+
+		// Registers a Read Only Eponymous Virtual Table
+		// p_columns are the Column Declarations, such as "name TEXT, price REAL"
+		Database& createEponymousTable(const std::string_view p_name,
+												 const std::string_view p_columns,
+												 RowSource				  p_rows);
+
+		// Calls p_listener with the Rows of p_table Changed by each Committed Transaction
+		// p_table of "" Listens to every Table
+		// See ChangeNotifier for what is and is not Reported
+		SubscriptionID subscribe(const std::string_view p_table, ChangeListener p_listener);
+		void			   unsubscribe(const SubscriptionID p_id);
+
+		// Delivers Committed Changes to Listeners
+		// executeSQL and PrepareStatement call this once a Statement Commits
+		// Only Statements Stepped outside of TUESL need to call it themselves
+		void dispatchChanges() noexcept;
+
+		// Number of Rows Modified, Inserted or Deleted
+		// by the most recently completed statement
+		int noOfRowsModified() const noexcept;
+
+		// rowid of the Row most recently Inserted on this Connection, 0 if none was
+		// Tells which Row a zeroblob was Inserted into, so that a Blob can be Opened on it
+		DataTypes::Int64 lastInsertRowID() const noexcept;
+
+		// Number of Rows Modified, Inserted or Deleted since the Connection was Opened
+		// Tells whether anything was Written since it was last Read
+		int noOfTotalRowsModified() const noexcept;
+
 		int  errorCode() const noexcept;
 		int  errorExtendedCode() const noexcept;
 		auto errorMessageString() const noexcept;
@@ -0,0 +1,75 @@
+#pragma once
+
+// Application Defined SQL Functions
+// Registered on a Database via Database::createFunction
+// Example
+//	db.createFunction("twice", 1, [](FunctionContext& p_context) {
+//		p_context.setResult(p_context.getDouble(0).value_or(0.0) * 2.0);
+//	});
+//	SELECT twice(price) FROM items;
+
+#include "DataTypes.hxx"
+#include "SQLite3PCH.hxx"
+
+#include <functional>
+#include <optional>
+#include <string>
+
+namespace TUESL::SQLite
+{
+	// Arguments and Result of a Single Call
+	// Only Valid for the Duration of that Call
+	struct FunctionContext
+	{
+	 private:
+		using Index = std::size_t;
+
+		sqlite3_context* m_context;
+		int				  m_argument_count;
+		sqlite3_value**  m_arguments;
+
+	 private:
+		sqlite3_value* argument(const Index p_index) const noexcept;
+
+	 public:
+		FunctionContext(sqlite3_context* p_context,
+							 const int		  p_argument_count,
+							 sqlite3_value**  p_arguments) noexcept :
+			 m_context{p_context},
+			 m_argument_count{p_argument_count},
+			 m_arguments{p_arguments}
+		{
+		}
+
+		int argumentCount() const noexcept
+		{
+			return m_argument_count;
+		}
+
+		// One of SQLITE_INTEGER, SQLITE_FLOAT, SQLITE_TEXT, SQLITE_BLOB or SQLITE_NULL
+		// SQLITE_NULL for an Index past the last Argument
+		int getType(const Index p_index) const noexcept;
+		bool isNull(const Index p_index) const noexcept
+		{
+			return getType(p_index) == SQLITE_NULL;
+		}
+
+		// nullopt for NULL Arguments and an Index past the last Argument
+		std::optional<double>			  getDouble(const Index p_index) const noexcept;
+		std::optional<DataTypes::Int64> getInt64(const Index p_index) const noexcept;
+
+		std::optional<std::string>  getString(const Index p_index) const;
+		std::optional<std::wstring> getWString(const Index p_index) const;
+
+		void setResult(const double p_value) noexcept;
+		void setResult(const DataTypes::Int64 p_value) noexcept;
+		void setResult(const std::string_view p_value) noexcept;
+		void setNull() noexcept;
+
+		// Fails the Statement which made the Call
+		void setError(const std::string_view p_message) noexcept;
+	};
+
+	// Exceptions thrown from within become Errors of the Calling Statement
+	using ScalarFunction = std::function<void(FunctionContext&)>;
+} // namespace TUESL::SQLite
@@ -0,0 +1,170 @@
+#pragma once
+
+// Streams the Rows of a Table in Pages, Read on a Background Thread
+//
+// Every Page Resumes after the Key of the last Row of the Page before
+//	SELECT name, rowid FROM t ORDER BY name, rowid LIMIT 256
+//	SELECT name, rowid FROM t WHERE (name, rowid) > (?, ?) ORDER BY name, rowid LIMIT 256
+// As such no Page Skips Rows the way OFFSET does, and with an Index on the Key
+// every Page costs the same however far into the Table it is
+//
+// Example
+//	PagedCursor<hstring> names{db, {"name", "t", {"name", "rowid"}}, [](PrepareStatement& ps) {
+//		return ps.get<hstring>().value_or(L"");
+//	}};
+//	while (co_await names.nextPage())
+//		for (const auto& name : names.page())
+//			...
+//
+// The next Page is Read while the Caller works through the one it has
+// Rows Changed meanwhile are Seen or not depending on which side of the Key they are
+
+#include "PrepareStatement.hxx"
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace TUESL::SQLite
+{
+	struct PagedQuery
+	{
+		// Selected for the Caller, as after SELECT
+		std::string columns;
+		// Table or View the Rows come from
+		std::string table;
+		// Order the Rows are Read in, together they must be Unique, such as {"name", "rowid"}
+		std::vector<std::string> key_columns;
+
+		std::size_t page_size = 256;
+	};
+
+	// SELECT of the first Page, or of one Resumed after the Key of the last Row Read
+	// Exposed so that the Plans of Pages can be Checked, see QueryPlan.hxx
+	std::string pageSQL(const PagedQuery& p_query, const bool p_is_first_page);
+
+	// Reads one Page after another on the Calling Thread
+	// Used by PagedCursor, which only ever Reads one Page at a Time
+	class KeysetPager
+	{
+	 private:
+		Database&  m_db;
+		PagedQuery m_query;
+
+		// Prepared on first use, from the Thread that Reads the Page
+		PrepareStatement m_first_page;
+		PrepareStatement m_next_page;
+
+		// Key of the last Row Read, Empty before the first Page
+		std::vector<Handler::Value> m_last_key;
+
+		bool m_is_done = false;
+
+	 public:
+		// Throws std::invalid_argument without Key Columns or with a Page Size of 0
+		KeysetPager(Database& p_db, PagedQuery p_query);
+
+		// Calls p_read_row on every Row of the next Page
+		// The Key Columns follow those of the Query, p_read_row need not Read them
+		// Returns the Rows Read, none once the last Page has been Read
+		std::size_t readPage(const std::function<void(PrepareStatement&)>& p_read_row);
+
+		// True once a Page came back Short, there is nothing after it
+		bool isDone() const noexcept
+		{
+			return m_is_done;
+		}
+		std::size_t pageSize() const noexcept
+		{
+			return m_query.page_size;
+		}
+	};
+
+#ifdef TUESL_USING_CPP_WINRT
+	template <typename Row>
+	class PagedCursor
+	{
+	 public:
+		using ReadRow = std::function<Row(PrepareStatement&)>;
+
+	 private:
+		// Shared with the Page being Read, which may outlive the Cursor
+		struct State
+		{
+			KeysetPager		  pager;
+			ReadRow			  read_row;
+			std::vector<Row> rows;
+
+			State(Database& p_db, PagedQuery p_query, ReadRow p_read_row) :
+				 pager{p_db, std::move(p_query)}, read_row{std::move(p_read_row)}
+			{
+			}
+		};
+
+		std::shared_ptr<State> m_state;
+
+		std::vector<Row>								  m_page;
+		winrt::Windows::Foundation::IAsyncAction m_prefetch{nullptr};
+		bool												  m_is_done = false;
+
+		static winrt::Windows::Foundation::IAsyncAction prefetch(std::shared_ptr<State> p_state)
+		{
+			co_await winrt::resume_background();
+
+			p_state->rows.clear();
+			p_state->rows.reserve(p_state->pager.pageSize());
+			p_state->pager.readPage([&](PrepareStatement& p_ps) {
+				p_state->rows.push_back(p_state->read_row(p_ps));
+			});
+		}
+
+	 public:
+		// The first Page is only Read once Asked for
+		// p_db must outlive the Cursor and any Page still being Read
+		PagedCursor(Database& p_db, PagedQuery p_query, ReadRow p_read_row) :
+			 m_state{std::make_shared<State>(p_db, std::move(p_query), std::move(p_read_row))}
+		{
+		}
+
+		// Resumes on the Caller's Context once the next Page is there
+		// false once every Row has been Returned, page() is then Empty
+		// Errors Reading the Page are Rethrown here
+		// The Cursor must outlive the Operation
+		winrt::Windows::Foundation::IAsyncOperation<bool> nextPage()
+		{
+			if (m_is_done)
+			{
+				m_page.clear();
+				co_return false;
+			}
+
+			if (!m_prefetch)
+				m_prefetch = prefetch(m_state);
+
+			co_await m_prefetch;
+
+			m_page = std::move(m_state->rows);
+
+			// Nothing is Read past a Short Page
+			if (m_state->pager.isDone())
+			{
+				m_is_done  = true;
+				m_prefetch = nullptr;
+			}
+			else
+				m_prefetch = prefetch(m_state);
+
+			co_return !std::empty(m_page);
+		}
+
+		// Rows of the Page the last nextPage Returned
+		const std::vector<Row>& page() const noexcept
+		{
+			return m_page;
+		}
+	};
+#endif
+} // namespace TUESL::SQLite
@@ -1,8 +1,11 @@
 #pragma once
 
 #include <iostream>
+#include <memory_resource>
 #include <optional>
 #include <string>
+#include <string_view>
+#include <type_traits>
 
 #if __has_include("winrt/Windows.Foundation.h")
 // This definition is defined only when C++WinRT is being used
@@ -64,6 +67,24 @@ namespace TUESL::SQLite
 	// Note that the get methods return Optional rather than throw exceptions
 	// While exception handling is used, it is not used purely!
 
+	// Types get<ColumnType> can Read a Column as
+	// Schema Checks Members against it, as such both Accept the same Types
+	template <typename ColumnType>
+	constexpr bool isColumnType = [] {
+		using ColumnCheck = std::remove_cv_t<std::remove_reference_t<ColumnType>>;
+
+		return std::is_same_v<ColumnCheck, double> || std::is_integral_v<ColumnCheck> ||
+				 std::is_same_v<ColumnCheck, std::string> || std::is_same_v<ColumnCheck, char*> ||
+				 std::is_same_v<ColumnCheck, std::string_view> ||
+				 std::is_same_v<ColumnCheck, std::wstring> ||
+				 std::is_same_v<ColumnCheck, wchar_t*> ||
+				 std::is_same_v<ColumnCheck, std::wstring_view>
+#ifdef TUESL_USING_CPP_WINRT
+				 || std::is_same_v<ColumnCheck, winrt::hstring>
+#endif
+			 ;
+	}();
+
 	struct PrepareStatement
 	{
 	 private:
@@ -71,6 +92,10 @@ namespace TUESL::SQLite
 
 		Handler::PrepareStatement m_stmt{};
 
+		// Connection the Statement was Prepared on
+		// Told once a Statement Commits, so Change Listeners hear of it
+		Database* m_db = nullptr;
+
 		// Stores the Counter for the Values to be Binded
 		// In case the User does not want to provide
 		// Integer or String based formatting for Index
@@ -89,6 +114,8 @@ namespace TUESL::SQLite
 		void incrementCurrentBindIndex(const Index p_bind_cur_index) noexcept;
 		void incrementCurrentGetIndex(const Index p_get_cur_index) noexcept;
 
+		void dispatchChangesIfCommitted() noexcept;
+
 	 public:
 		PrepareStatement() {}
 		PrepareStatement(Database& p_db, const std::string_view p_sql)
@@ -99,14 +126,26 @@ namespace TUESL::SQLite
 		bool checkTableExistence(Database& p_db, const std::string_view p_tbl_name);
 
 		PrepareStatement& prepare(Database& p_db, const std::string_view p_sql);
+		// Transcoded to UTF-8 first, throws std::invalid_argument if not Valid UTF-16
 		PrepareStatement& prepare(Database& p_db, const std::wstring_view p_sql);
 
 		std::string getPrepareSQLStatement() noexcept;
 
+		// Finalizes the Compiled Statement, prepare must be called before it is Run again
 		void reset();
 
+		// Rewinds the Statement and Clears its Bindings so that it can be Run again
+		// Unlike reset the Compiled Statement is Kept
+		// As such a Statement run once per Row is only Prepared once
+		void restart();
+
 		bool isReadOnly() noexcept;
 
+		// Counter SQLite Keeps for the Statement, such as SQLITE_STMTSTATUS_FULLSCAN_STEP
+		// See https://www.sqlite.org/c3ref/c_stmtstatus_counter.html
+		// Counts from when it was Prepared, or last Reset through p_reset
+		int status(const int p_counter, const bool p_reset = false) noexcept;
+
 		std::optional<int> noOfColumns() noexcept;
 
 		// Useful for Iterating over a Loop
@@ -147,17 +186,33 @@ namespace TUESL::SQLite
 		std::optional<int>				  getInteger(const Index p_index) noexcept;
 		std::optional<DataTypes::Int64> getInt64(const Index p_index) noexcept;
 
-		std::optional<std::string>  getString(const Index p_index) noexcept;
+		std::optional<std::string> getString(const Index p_index) noexcept;
+		// Text is Stored as UTF-8 and Transcoded here, nullopt if it is not Valid UTF-8
+		// Prefer getStringView where the Text does not go on to the UI
 		std::optional<std::wstring> getWString(const Index p_index) noexcept;
+
+		// Views SQLite's own Copy of the Column, as such nothing is Allocated
+		// Valid until the next hasNext, restart or reset
+		std::optional<std::string_view> getStringView(const Index p_index) noexcept;
+		// Copies into p_resource, such as an Arena, rather than the Heap
+		std::optional<std::pmr::string> getString(const Index						 p_index,
+																std::pmr::memory_resource* p_resource);
 #ifdef TUESL_USING_CPP_WINRT
 		std::optional<winrt::hstring> getHString(const Index p_index) noexcept;
 #endif
 
+		// Copy of the Column whatever its Type, which outlives the Row
+		// Bind it to another Statement to Compare against it, as PagedCursor does
+		// Empty if there is no Row, or SQLite is out of Memory
+		Handler::Value getValue(const Index p_index) noexcept;
+
 		template <typename ColumnType>
 		auto get(const Index p_index) noexcept
 		{
 			using ColumnCheck = std::remove_cv_t<std::remove_reference_t<ColumnType>>;
 
+			static_assert(isColumnType<ColumnCheck>, "This Type can't be Indexed in Given ROW");
+
 			if constexpr (std::is_same_v<ColumnCheck, double>)
 				return getDouble(p_index);
 			else if constexpr (std::is_same_v<ColumnCheck, DataTypes::Int64>)
@@ -165,9 +220,10 @@ namespace TUESL::SQLite
 			else if constexpr (std::is_integral_v<ColumnCheck>)
 				return getInteger(p_index);
 			else if constexpr (std::is_same_v<ColumnCheck, std::string> ||
-									 std::is_same_v<ColumnCheck, char*> ||
-									 std::is_same_v<ColumnCheck, std::string_view>)
+									 std::is_same_v<ColumnCheck, char*>)
 				return getString(p_index);
+			else if constexpr (std::is_same_v<ColumnCheck, std::string_view>)
+				return getStringView(p_index);
 			else if constexpr (std::is_same_v<ColumnCheck, std::wstring> ||
 									 std::is_same_v<ColumnCheck, wchar_t*> ||
 									 std::is_same_v<ColumnCheck, std::wstring_view>)
@@ -176,8 +232,6 @@ namespace TUESL::SQLite
 			else if constexpr (std::is_same_v<ColumnCheck, winrt::hstring>)
 				return getHString(p_index);
 #endif
-			else
-				static_assert(false, "This Type can't be Indexed in Given ROW");
 		}
 		template <typename ColumnType>
 		inline auto at(const Index p_index) noexcept;
@@ -210,6 +264,7 @@ namespace TUESL::SQLite
 		}
 
 		PrepareStatement& bind(const Index p_index, const std::string_view p_value);
+		// Transcoded to UTF-8 and Copied, throws std::invalid_argument if not Valid UTF-16
 		PrepareStatement& bind(const Index p_index, const std::wstring_view p_value);
 		PrepareStatement& bind(const Index p_index, const double p_value);
 		PrepareStatement& bind(const Index p_index, const std::int32_t p_value);
@@ -219,6 +274,8 @@ namespace TUESL::SQLite
 		PrepareStatement& bind(const Index p_index, const DateTime& p_value);
 #endif
 		PrepareStatement& bind(const Index p_index, const std::nullptr_t);
+		// Binds a Copy, as such p_value may go before the Statement does
+		PrepareStatement& bind(const Index p_index, const Handler::Value& p_value);
 
 		PrepareStatement& bind(const std::string_view p_index, const std::nullptr_t);
 		// Provide Index to Bind in the form of a String
@@ -0,0 +1,116 @@
+#pragma once
+
+// Guards the Plans SQLite Picks for the Statements of a Component
+// Built on EXPLAIN QUERY PLAN and sqlite3_stmt_status
+//
+// A Component Registers every Statement it Prepares, by Name
+// Their Plans are Recorded once as a Baseline, and Captured again after every Change
+// A Plan which gains a Full Scan or a Temp B-Tree the Baseline did not have is a Regression,
+// such as a Lookup whose Index was Dropped or no longer Applies to its WHERE
+// Scans the Baseline already has, such as Loading a whole Table, are left alone
+//
+// Example
+//	QueryPlanGuard guard;
+//	guard.registerStatement("select_rate", sql);
+//
+//	const auto baseline = QueryPlanGuard::parse(baseline_text);
+//	for (const auto& regression : QueryPlanGuard::compare(baseline, guard.capture(db)))
+//		...
+//
+// Plans depend on the Schema and its Indexes alone, not on the Rows
+// The Counters of measure are what tells how much a Scan costs at a given Size
+
+#include "Database.hxx"
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace TUESL::SQLite
+{
+	struct StatementPlan
+	{
+		std::string name;
+		// Detail of every Step, in the Order EXPLAIN QUERY PLAN Returns them
+		// Normalised by normalizePlanStep
+		std::vector<std::string> steps;
+	};
+
+	struct PlanRegression
+	{
+		std::string name;
+		// Step of the Plan the Baseline does not have
+		std::string step;
+	};
+
+	struct StatementCounters
+	{
+		std::string name;
+		std::size_t rows = 0;
+		// Rows Stepped over by Full Scans, 0 where every Table was Searched
+		int full_scan_steps = 0;
+		// Sorts through a Temp B-Tree
+		int sorts = 0;
+		// Rows Inserted into Indexes SQLite Built for the Statement alone
+		int auto_index_rows = 0;
+		int vm_steps		  = 0;
+	};
+
+	// Older Versions of SQLite Write "SCAN TABLE t" where newer ones Write "SCAN t"
+	// Both are Normalised to the newer Form, as such a Baseline Outlives an Upgrade
+	std::string normalizePlanStep(const std::string_view p_detail);
+
+	// Reads every Row of a Table or Index
+	// Scans of Constant Rows and of Subqueries already Materialised are not
+	bool isFullScan(const std::string_view p_step) noexcept;
+	// Sorts or Deduplicates the Rows through a Temporary B-Tree
+	bool isTempBTree(const std::string_view p_step) noexcept;
+
+	// Plan of p_sql, Throws SQLiteException if it does not Prepare on p_db
+	std::vector<std::string> explainQueryPlan(Database& p_db, const std::string_view p_sql);
+
+	class QueryPlanGuard
+	{
+	 private:
+		struct Statement
+		{
+			std::string name;
+			std::string sql;
+		};
+
+		std::vector<Statement> m_statements;
+
+	 public:
+		// Throws std::invalid_argument if p_name is Empty, already Registered,
+		// or holds a Character the Baseline can not Store
+		void registerStatement(std::string p_name, std::string p_sql);
+
+		std::size_t size() const noexcept
+		{
+			return std::size(m_statements);
+		}
+
+		// Plans of every Statement, in the Order they were Registered
+		// Throws SQLiteException if any does not Prepare on p_db
+		std::vector<StatementPlan> capture(Database& p_db) const;
+
+		// Runs every Read Only Statement to its End, Parameters left NULL
+		// A Search then Finds nothing, while a Scan still Steps over every Row
+		// Statements which Write are left out, as such p_db is never Changed
+		std::vector<StatementCounters> measure(Database& p_db) const;
+
+		// Steps of p_current which Scan or use a Temp B-Tree, and which the Plan of the
+		// same Statement in p_baseline does not have
+		// Scans of the same Table Match whichever Index they Read
+		// A Statement missing from p_baseline may have no such Steps at all
+		static std::vector<PlanRegression> compare(const std::vector<StatementPlan>& p_baseline,
+																 const std::vector<StatementPlan>& p_current);
+
+		// Text a Baseline is Stored as, a [name] Line followed by a Line per Step
+		static std::string serialize(const std::vector<StatementPlan>& p_plans);
+		// Blank Lines and Lines starting with # are Skipped
+		// Throws std::invalid_argument on a Step before any [name]
+		static std::vector<StatementPlan> parse(const std::string_view p_text);
+	};
+} // namespace TUESL::SQLite
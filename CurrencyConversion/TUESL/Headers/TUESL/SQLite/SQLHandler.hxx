@@ -6,4 +6,7 @@ namespace TUESL::SQLite::Handler
 {
 	using Database = TUESL::Utility::Handler::UniqueHandler<Traits::SQLiteDatabaseHandlerTraits>;
 	using PrepareStatement = TUESL::Utility::Handler::UniqueHandler<Traits::SQLitePrepareStatementHandlerTraits>;
+	using Backup = TUESL::Utility::Handler::UniqueHandler<Traits::SQLiteBackupHandlerTraits>;
+	using Blob = TUESL::Utility::Handler::UniqueHandler<Traits::SQLiteBlobHandlerTraits>;
+	using Value = TUESL::Utility::Handler::UniqueHandler<Traits::SQLiteValueHandlerTraits>;
 }
@@ -0,0 +1,219 @@
+#pragma once
+
+// Maps a Struct to the Rows of a Table, from one Description of its Columns
+//
+// Example
+//	struct Employee
+//	{
+//		std::string name;
+//		DataTypes::Int64 salary;
+//
+//		static constexpr auto schema()
+//		{
+//			return Schema::table("employees",
+//										Schema::column("name", &Employee::name),
+//										Schema::column("salary", &Employee::salary));
+//		}
+//	};
+//
+//	db.executeSQL(Schema::createTableSQL<Employee>());
+//	ps.prepare(db, Schema::insertSQL<Employee>());
+//	Schema::bindRow(ps, employee);
+//	...
+//	ps.prepare(db, Schema::selectSQL<Employee>() + " WHERE salary > 100;");
+//	while (ps.hasNext())
+//		employees.push_back(Schema::readRow<Employee>(ps));
+//
+// schema() is a Member Function, as the Struct is only Complete within it
+// Every Member must be a Type get<ColumnType> Reads, which is Checked when Compiling
+// Columns are Bound and Read by a Fixed Index, Unrolled for each Member,
+// as such nothing is Looked up or Dispatched per Row
+
+#include "PrepareStatement.hxx"
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace TUESL::SQLite::Schema
+{
+	template <typename Struct, typename Member>
+	struct Column
+	{
+		using Type = Member;
+
+		const char*		 name;
+		Member Struct::*member;
+		// Declared Type and Constraints, Derived from Member when nullptr
+		const char* declaration;
+	};
+
+	template <typename Struct, typename... Members>
+	struct Table
+	{
+		const char*									  name;
+		std::tuple<Column<Struct, Members>...> columns;
+	};
+
+	// p_declaration is only needed to Match a Table which already Exists
+	template <typename Struct, typename Member>
+	constexpr Column<Struct, Member> column(const char*		 p_name,
+														 Member Struct::*p_member,
+														 const char*		 p_declaration = nullptr)
+	{
+		static_assert(isColumnType<Member>, "PrepareStatement can't get a Column of this Type");
+		// Views would Refer to the Row which was Read, and not outlive the next Step
+		static_assert(!std::is_pointer_v<Member> && !std::is_same_v<Member, std::string_view> &&
+								!std::is_same_v<Member, std::wstring_view>,
+						  "Members must Own their Text");
+
+		return {p_name, p_member, p_declaration};
+	}
+
+	template <typename Struct, typename... Members>
+	constexpr Table<Struct, Members...> table(const char* p_name,
+															const Column<Struct, Members>... p_columns)
+	{
+		return {p_name, std::make_tuple(p_columns...)};
+	}
+
+	template <typename Row>
+	constexpr std::size_t columnCount()
+	{
+		return std::tuple_size_v<decltype(Row::schema().columns)>;
+	}
+
+	namespace Detail
+	{
+		template <typename Member>
+		constexpr const char* declaredType()
+		{
+			if constexpr (std::is_floating_point_v<Member>)
+				return "REAL NOT NULL";
+			else if constexpr (std::is_integral_v<Member>)
+				return "INTEGER NOT NULL";
+			else
+				return "TEXT NOT NULL";
+		}
+
+		template <typename Row, typename Function, std::size_t... Indices>
+		void forEachColumn(Function&& p_function, std::index_sequence<Indices...>)
+		{
+			constexpr auto schema = Row::schema();
+			(p_function(std::get<Indices>(schema.columns)), ...);
+		}
+		template <typename Row, typename Function>
+		void forEachColumn(Function&& p_function)
+		{
+			forEachColumn<Row>(std::forward<Function>(p_function),
+									 std::make_index_sequence<columnCount<Row>()>{});
+		}
+
+		template <typename Row, std::size_t... Indices>
+		void bindRow(PrepareStatement&	p_ps,
+						 const Row&			p_row,
+						 const std::size_t p_first_index,
+						 std::index_sequence<Indices...>)
+		{
+			constexpr auto schema = Row::schema();
+			(p_ps.bind(p_first_index + Indices, p_row.*(std::get<Indices>(schema.columns).member)),
+			 ...);
+		}
+
+		template <typename Row, typename Struct, typename Member>
+		void readColumn(PrepareStatement&					p_ps,
+							 Row&									p_row,
+							 const Column<Struct, Member>& p_column,
+							 const std::size_t				p_index)
+		{
+			p_row.*(p_column.member) = p_ps.get<Member>(p_index).value_or(Member{});
+		}
+
+		template <typename Row, std::size_t... Indices>
+		Row readRow(PrepareStatement&	 p_ps,
+						const std::size_t p_first_index,
+						std::index_sequence<Indices...>)
+		{
+			constexpr auto schema = Row::schema();
+
+			Row row{};
+			(readColumn(p_ps, row, std::get<Indices>(schema.columns), p_first_index + Indices),
+			 ...);
+			return row;
+		}
+	} // namespace Detail
+
+	// a,b,c in the Order of the Columns
+	template <typename Row>
+	std::string columnList()
+	{
+		std::string list;
+		Detail::forEachColumn<Row>([&](const auto& p_column) {
+			if (!std::empty(list))
+				list += ',';
+			list += p_column.name;
+		});
+		return list;
+	}
+
+	template <typename Row>
+	std::string createTableSQL()
+	{
+		using namespace std::string_literals;
+
+		std::string columns;
+		Detail::forEachColumn<Row>([&](const auto& p_column) {
+			using Member = typename std::decay_t<decltype(p_column)>::Type;
+
+			if (!std::empty(columns))
+				columns += ',';
+			columns += p_column.name;
+			columns += ' ';
+			columns += p_column.declaration != nullptr ? p_column.declaration
+																	 : Detail::declaredType<Member>();
+		});
+		return "CREATE TABLE IF NOT EXISTS "s + Row::schema().name + " (" + columns + ");";
+	}
+
+	// p_verb such as INSERT OR IGNORE
+	template <typename Row>
+	std::string insertSQL(const std::string_view p_verb = "INSERT")
+	{
+		using namespace std::string_literals;
+
+		std::string parameters;
+		for (std::size_t i = 0; i < columnCount<Row>(); ++i)
+			parameters += i == 0 ? "?" : ",?";
+
+		return std::string{p_verb} + " INTO "s + Row::schema().name + "(" + columnList<Row>() +
+				 ") VALUES(" + parameters + ");";
+	}
+
+	// Without a Semicolon, as such a WHERE or ORDER BY can follow
+	template <typename Row>
+	std::string selectSQL()
+	{
+		using namespace std::string_literals;
+		return "SELECT "s + columnList<Row>() + " FROM " + Row::schema().name;
+	}
+
+	// Binds every Column from p_first_index on, as insertSQL Orders them
+	template <typename Row>
+	void bindRow(PrepareStatement& p_ps, const Row& p_row, const std::size_t p_first_index = 1)
+	{
+		Detail::bindRow(
+			 p_ps, p_row, p_first_index, std::make_index_sequence<columnCount<Row>()>{});
+	}
+
+	// Reads every Column from p_first_index on, as selectSQL Orders them
+	// Columns get Returns nullopt for are Read as the Default of their Member
+	template <typename Row>
+	Row readRow(PrepareStatement& p_ps, const std::size_t p_first_index = 0)
+	{
+		return Detail::readRow<Row>(
+			 p_ps, p_first_index, std::make_index_sequence<columnCount<Row>()>{});
+	}
+} // namespace TUESL::SQLite::Schema
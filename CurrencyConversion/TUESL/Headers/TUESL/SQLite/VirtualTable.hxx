@@ -0,0 +1,56 @@
+#pragma once
+
+// Read Only Eponymous Virtual Tables over Rows produced in C++
+// Registered on a Database via Database::createEponymousTable
+//
+// Eponymous Tables need no CREATE VIRTUAL TABLE
+// They can be Queried and Joined by Name as soon as they are Registered
+// Example
+//	db.createEponymousTable("squares", "n INTEGER, square INTEGER", [] {
+//		return std::vector<Row>{Row{DataTypes::Int64{2}, DataTypes::Int64{4}}};
+//	});
+//	SELECT square FROM squares WHERE n = 2;
+//
+// Rows are Fetched once per Scan, as such every Scan sees a Consistent Set
+// Equality Constraints are Applied before Rows reach SQLite
+
+#include "DataTypes.hxx"
+#include "SQLite3PCH.hxx"
+
+#include <functional>
+#include <string>
+#include <variant>
+#include <vector>
+
+namespace TUESL::SQLite
+{
+	using Value = std::variant<std::nullptr_t, DataTypes::Int64, double, std::string>;
+
+	// One Value per Declared Column, in Order
+	// Missing Trailing Values read as NULL
+	using Row = std::vector<Value>;
+
+	// Exceptions thrown from within become Errors of the Scanning Statement
+	using RowSource = std::function<std::vector<Row>()>;
+
+	namespace VirtualTable
+	{
+		// Only the first Columns can be Constrained
+		// Their Mask must fit the int which SQLite Passes back
+		constexpr const int MAX_INDEXED_COLUMNS = 31;
+
+		struct Definition
+		{
+			// Column Declarations as within CREATE TABLE
+			// Such as "name TEXT, price REAL"
+			std::string columns;
+			RowSource	rows;
+		};
+
+		// Shared by every Eponymous Table
+		// The Client Data of the Module is a Definition owned by SQLite
+		const sqlite3_module& rowSourceModule() noexcept;
+
+		void destroyDefinition(void* p_definition) noexcept;
+	} // namespace VirtualTable
+} // namespace TUESL::SQLite
@@ -33,4 +33,48 @@ namespace TUESL::SQLite::Traits
 			VERIFY_FUNCTION(SQLITE_OK, sqlite3_finalize(p_connection));
 		}
 	};
+	struct SQLiteBackupHandlerTraits
+	{
+		using POINTER		  = sqlite3_backup*;
+		using CONST_POINTER = const POINTER;
+
+		static auto invalid() noexcept
+		{
+			return nullptr;
+		}
+		static auto close(POINTER p_backup)
+		{
+			// Returns the Error of the last Step, which has already been Reported
+			sqlite3_backup_finish(p_backup);
+		}
+	};
+	struct SQLiteBlobHandlerTraits
+	{
+		using POINTER		  = sqlite3_blob*;
+		using CONST_POINTER = const POINTER;
+
+		static auto invalid() noexcept
+		{
+			return nullptr;
+		}
+		static auto close(POINTER p_blob)
+		{
+			// Nothing is Buffered, every Write has already Reached the Row
+			sqlite3_blob_close(p_blob);
+		}
+	};
+	struct SQLiteValueHandlerTraits
+	{
+		using POINTER		  = sqlite3_value*;
+		using CONST_POINTER = const POINTER;
+
+		static auto invalid() noexcept
+		{
+			return nullptr;
+		}
+		static auto close(POINTER p_value)
+		{
+			sqlite3_value_free(p_value);
+		}
+	};
 } // namespace TUESL::SQLite::Traits
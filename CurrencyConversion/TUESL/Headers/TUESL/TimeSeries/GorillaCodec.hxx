@@ -0,0 +1,149 @@
+#pragma once
+
+// Compression of (Time, Value) Samples as described in
+// Gorilla: A Fast, Scalable, In-Memory Time Series Database
+// http://www.vldb.org/pvldb/vol8/p1816-teller.pdf
+//
+// Timestamps are stored as Delta of Deltas
+// Values are stored as the XOR with the Previous Value
+// Slowly Moving Series, such as Exchange Rates, compress to a few bits per Sample
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace TUESL::TimeSeries
+{
+	struct Sample
+	{
+		std::int64_t time;
+		double		 value;
+	};
+
+	// Appends Bits, Most Significant First
+	class BitWriter
+	{
+	 private:
+		std::vector<std::byte> m_bytes;
+		std::size_t				  m_bit_length = 0;
+
+	 public:
+		void writeBit(const bool p_bit);
+		// Writes the Lower p_count Bits of p_value
+		void writeBits(const std::uint64_t p_value, const int p_count);
+
+		const std::vector<std::byte>& bytes() const noexcept
+		{
+			return m_bytes;
+		}
+		std::size_t bitLength() const noexcept
+		{
+			return m_bit_length;
+		}
+		void clear() noexcept
+		{
+			m_bytes.clear();
+			m_bit_length = 0;
+		}
+	};
+
+	// Reads Bits written by the BitWriter
+	// Reading past the End yields Zero Bits and sets the Overrun flag
+	// rather than touching Memory outside the Buffer
+	class BitReader
+	{
+	 private:
+		const std::byte* m_data;
+		std::size_t		  m_bit_length;
+		std::size_t		  m_position = 0;
+		bool				  m_overrun  = false;
+
+	 public:
+		BitReader(const std::byte* p_data, const std::size_t p_bit_length) noexcept :
+			 m_data{p_data}, m_bit_length{p_bit_length}
+		{
+		}
+
+		bool			  readBit() noexcept;
+		std::uint64_t readBits(const int p_count) noexcept;
+
+		bool hasOverrun() const noexcept
+		{
+			return m_overrun;
+		}
+	};
+
+	class GorillaEncoder
+	{
+	 private:
+		BitWriter m_writer;
+
+		std::size_t	 m_count		  = 0;
+		std::int64_t m_first_time = 0;
+		std::int64_t m_last_time  = 0;
+		std::int64_t m_last_delta = 0;
+
+		std::uint64_t m_last_value_bits = 0;
+		int			  m_last_leading	 = -1;
+		int			  m_last_trailing	 = 0;
+
+	 private:
+		void encodeTime(const std::int64_t p_time);
+		void encodeValue(const double p_value);
+
+	 public:
+		// Samples must be appended in Non Decreasing Time Order
+		void append(const Sample& p_sample);
+
+		void reset() noexcept;
+
+		std::size_t count() const noexcept
+		{
+			return m_count;
+		}
+		std::int64_t firstTime() const noexcept
+		{
+			return m_first_time;
+		}
+		std::int64_t lastTime() const noexcept
+		{
+			return m_last_time;
+		}
+		const BitWriter& stream() const noexcept
+		{
+			return m_writer;
+		}
+	};
+
+	class GorillaDecoder
+	{
+	 private:
+		BitReader m_reader;
+
+		std::size_t	 m_remaining;
+		bool			 m_is_first	  = true;
+		bool			 m_is_corrupt = false;
+		std::int64_t m_last_time  = 0;
+		std::int64_t m_last_delta = 0;
+
+		std::uint64_t m_last_value_bits = 0;
+		int			  m_last_leading	 = 0;
+		int			  m_last_trailing	 = 0;
+
+	 private:
+		std::int64_t decodeTime() noexcept;
+		double		 decodeValue() noexcept;
+
+	 public:
+		GorillaDecoder(const std::byte*	p_data,
+							const std::size_t p_bit_length,
+							const std::size_t p_count) noexcept :
+			 m_reader{p_data, p_bit_length},
+			 m_remaining{p_count}
+		{
+		}
+
+		// Returns false once all Samples are Read or the Stream is Corrupt
+		bool next(Sample& p_sample) noexcept;
+	};
+} // namespace TUESL::TimeSeries
@@ -0,0 +1,125 @@
+#pragma once
+
+// Append Only Store of Time Series
+// Every Series is a Single File holding a Sequence of Gorilla Compressed Blocks
+//
+// Block Layout
+// BlockHeader | Compressed Stream padded to 8 Bytes
+//
+// Samples are Buffered in an Open Block which is Written once Full or on flush()
+// Reads Memory Map the File and only Decode Blocks overlapping the Range
+
+#include <TUESL/TimeSeries/GorillaCodec.hxx>
+#include <TUESL/Utility/MemoryMappedFile.hxx>
+
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace TUESL::TimeSeries
+{
+	// Open, High, Low and Close of all Samples within one Interval
+	struct OHLC
+	{
+		// Start of the Interval
+		std::int64_t time;
+
+		double open;
+		double high;
+		double low;
+		double close;
+
+		std::size_t count;
+	};
+
+	class TimeSeriesFile
+	{
+	 private:
+		std::wstring m_file_name;
+		std::size_t	 m_block_samples;
+
+		// Samples not yet Written to Disk
+		GorillaEncoder m_open_block;
+
+		// Appends must not go back in Time
+		std::int64_t m_last_time = (std::numeric_limits<std::int64_t>::min)();
+
+		// Bytes of Complete Blocks on Disk
+		std::uint64_t m_file_size = 0;
+
+		Utility::MemoryMappedFile m_view;
+
+	 private:
+		// Validates the Blocks on Disk and Drops a Torn Tail
+		void recover();
+		bool remap();
+
+		template <typename Visitor>
+		void forEachSample(const std::int64_t p_from, const std::int64_t p_to, Visitor p_visitor);
+
+	 public:
+		TimeSeriesFile(std::wstring p_file_name, const std::size_t p_block_samples);
+
+		// Returns false if p_sample is older than the Last Sample
+		bool append(const Sample& p_sample);
+		bool flush();
+
+		// Samples within [p_from, p_to)
+		std::vector<Sample> range(const std::int64_t p_from, const std::int64_t p_to);
+
+		std::vector<OHLC> downsample(const std::int64_t p_from,
+											  const std::int64_t p_to,
+											  const std::int64_t p_interval);
+
+		std::uint64_t sizeOnDisk() const noexcept
+		{
+			return m_file_size;
+		}
+	};
+
+	class TimeSeriesStore
+	{
+	 public:
+		// Samples per Block
+		// Larger Blocks Compress better, Smaller Blocks lose less on a Crash
+		static constexpr const std::size_t DEFAULT_BLOCK_SAMPLES = 256;
+
+		static constexpr const auto FILE_EXTENSION = L".tsc";
+
+	 private:
+		std::wstring m_directory;
+		std::size_t	 m_block_samples;
+
+		std::map<std::wstring, std::unique_ptr<TimeSeriesFile>, std::less<>> m_series;
+		std::mutex																			 m_mutex;
+
+	 private:
+		TimeSeriesFile& series(const std::wstring_view p_series_name);
+
+	 public:
+		explicit TimeSeriesStore(const std::wstring_view p_directory,
+										 const std::size_t		p_block_samples = DEFAULT_BLOCK_SAMPLES);
+
+		~TimeSeriesStore();
+
+		bool append(const std::wstring_view p_series_name, const Sample& p_sample);
+
+		// Writes out all Open Blocks
+		void flush();
+
+		std::vector<Sample> range(const std::wstring_view p_series_name,
+										  const std::int64_t		 p_from,
+										  const std::int64_t		 p_to);
+
+		std::vector<OHLC> downsample(const std::wstring_view p_series_name,
+											  const std::int64_t		p_from,
+											  const std::int64_t		p_to,
+											  const std::int64_t		p_interval);
+
+		std::uint64_t sizeOnDisk(const std::wstring_view p_series_name);
+	};
+} // namespace TUESL::TimeSeries
@@ -0,0 +1,95 @@
+#pragma once
+
+// Monotonic Arena for Allocations that all End together
+// Such as the Strings and Vectors of one Refresh or one Query
+//
+// Allocating is a Pointer Bump, Deallocating does Nothing
+// Everything is Freed at once by reset, or when the Arena is Destroyed
+// Containers take it as their Memory Resource
+//
+// Example
+//	Arena arena;
+//	std::pmr::vector<std::pmr::string> names{&arena};
+//	... One Refresh ...
+//	names.clear();
+//	arena.reset();
+//
+// Not Thread Safe, one Arena per Thread or per Operation
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+
+namespace TUESL::Utility
+{
+	class Arena : public std::pmr::memory_resource
+	{
+	 public:
+		static constexpr const std::size_t DEFAULT_INITIAL_SIZE = 16 * 1024;
+
+		struct Statistics
+		{
+			// Requests Served since the last Reset
+			std::size_t allocations = 0;
+			std::size_t bytes			= 0;
+			// Blocks the Arena itself had to take from the Heap since the last Reset
+			// 0 once the Initial Buffer has grown to fit
+			std::size_t heap_allocations = 0;
+		};
+
+	 private:
+		// Counts what the Arena takes from the Heap
+		class CountingResource : public std::pmr::memory_resource
+		{
+		 public:
+			std::size_t allocations = 0;
+
+		 private:
+			void* do_allocate(std::size_t p_bytes, std::size_t p_alignment) override;
+			void	do_deallocate(void*		  p_pointer,
+									std::size_t p_bytes,
+									std::size_t p_alignment) override;
+			bool	do_is_equal(
+				  const std::pmr::memory_resource& p_other) const noexcept override;
+		};
+
+		// Owned Buffers Grow to what the last Cycle Needed
+		// Borrowed Buffers are Fixed
+		std::unique_ptr<std::byte[]> m_owned_buffer;
+		std::byte*						  m_buffer;
+		std::size_t						  m_buffer_size;
+
+		CountingResource										 m_upstream;
+		std::optional<std::pmr::monotonic_buffer_resource> m_resource;
+
+		Statistics m_statistics;
+
+	 private:
+		void* do_allocate(std::size_t p_bytes, std::size_t p_alignment) override;
+		void	do_deallocate(void*, std::size_t, std::size_t) noexcept override {}
+		bool	do_is_equal(const std::pmr::memory_resource& p_other) const noexcept override
+		{
+			return this == &p_other;
+		}
+
+	 public:
+		explicit Arena(const std::size_t p_initial_size = DEFAULT_INITIAL_SIZE);
+
+		// p_buffer, such as one on the Stack, must outlive the Arena
+		Arena(std::byte* p_buffer, const std::size_t p_size);
+
+		// Containers hold a Pointer to the Arena
+		Arena(const Arena&) = delete;
+		Arena& operator=(const Arena&) = delete;
+
+		// Frees everything Allocated
+		// Nothing Allocated from the Arena may be used afterwards
+		void reset();
+
+		const Statistics& statistics() const noexcept
+		{
+			return m_statistics;
+		}
+	};
+} // namespace TUESL::Utility
@@ -0,0 +1,98 @@
+#pragma once
+
+// Finds every Delimiter within a Text, such as the Commas and Line Ends of a CSV File
+//
+// The Text is Compared a Block of 32 Bytes at a Time with SSE2 or NEON
+// Each Block gives a Mask with a Bit per Delimiter, which is then Walked a Bit at a Time
+// As such Fields of any Length cost the same per Byte, and nothing is Copied
+//
+// Example
+//	DelimiterScanner scanner{text, Delimiters{",\n"}};
+//	std::size_t field = 0;
+//	for (auto at = scanner.next(); at != std::string_view::npos; at = scanner.next())
+//	{
+//		use(text.substr(field, at - field), text[at]);
+//		field = at + 1;
+//	}
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace TUESL::Utility
+{
+	class Delimiters
+	{
+	 public:
+		static constexpr const std::size_t MAX_BYTES = 4;
+
+	 private:
+		std::array<char, MAX_BYTES> m_bytes{};
+		std::size_t						 m_count = 0;
+
+	 public:
+		// Throws std::invalid_argument for none or more than MAX_BYTES
+		explicit Delimiters(const std::string_view p_bytes);
+
+		const char* data() const noexcept
+		{
+			return std::data(m_bytes);
+		}
+		std::size_t size() const noexcept
+		{
+			return m_count;
+		}
+	};
+
+	// Kernels the Scanner Picks from
+	// Used by Benchmarks to Compare them
+	// The Vector Kernel falls back to Scalar where neither SSE2 nor NEON is there
+	namespace Kernels
+	{
+		// Bit i is Set when p_block[i] is a Delimiter, p_length is at most 32
+		using DelimiterMask = std::uint32_t (*)(const char*		 p_block,
+															 const std::size_t p_length,
+															 const Delimiters& p_delimiters) noexcept;
+
+		std::uint32_t delimiterMaskScalar(const char*		  p_block,
+													 const std::size_t p_length,
+													 const Delimiters& p_delimiters) noexcept;
+		std::uint32_t delimiterMaskVector(const char*		  p_block,
+													 const std::size_t p_length,
+													 const Delimiters& p_delimiters) noexcept;
+	} // namespace Kernels
+
+	class DelimiterScanner
+	{
+	 public:
+		static constexpr const std::size_t BLOCK_BYTES = 32;
+
+	 private:
+		std::string_view		 m_text;
+		Delimiters				 m_delimiters;
+		Kernels::DelimiterMask m_kernel;
+
+		// Start of the Block m_mask was Taken from
+		std::size_t m_block = 0;
+		// Delimiters of the Block not yet Returned
+		std::uint32_t m_mask = 0;
+		// Where the next Block Starts
+		std::size_t m_next_block = 0;
+
+	 private:
+		void load(const std::size_t p_position) noexcept;
+
+	 public:
+		// The Text must outlive the Scanner
+		DelimiterScanner(const std::string_view p_text,
+							  const Delimiters&		 p_delimiters,
+							  Kernels::DelimiterMask p_kernel = Kernels::delimiterMaskVector) noexcept;
+
+		// Position of the next Delimiter, std::string_view::npos once there are none left
+		std::size_t next() noexcept;
+
+		// Continues from p_position, as when a Field is Skipped without being Scanned
+		void seek(const std::size_t p_position) noexcept;
+	};
+} // namespace TUESL::Utility
@@ -0,0 +1,28 @@
+#pragma once
+
+// Small Set of File Operations required by the On Disk Stores
+// Uses CreateFile2 so that it is usable within the App Container
+
+#include <TUESL/Utility/MemoryMappedFile.hxx>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace TUESL::Utility::FileSystem
+{
+	// Succeeds if the Directory already Exists
+	bool createDirectory(const std::wstring_view p_directory);
+
+	std::optional<std::uint64_t> fileSize(const std::wstring_view p_file_name);
+
+	// Creates the File if it does not Exist
+	bool appendToFile(const std::wstring_view p_file_name,
+							const void*				 p_data,
+							const std::size_t		 p_size);
+
+	// Drops everything past p_size
+	// Used to Discard a Partially Written Tail after a Crash
+	bool truncateFile(const std::wstring_view p_file_name, const std::uint64_t p_size);
+} // namespace TUESL::Utility::FileSystem
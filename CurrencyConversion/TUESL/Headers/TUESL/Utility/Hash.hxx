@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace TUESL::Utility::Hash
+{
+	// FNV-1a 64 Bit
+	// Not Cryptographic, but Fast and Stable across Runs and Machines
+	// Which is what On-Disk Checksums and Fingerprints require
+	// For further reference, please see
+	// http://www.isthe.com/chongo/tech/comp/fnv/index.html
+
+	constexpr const std::uint64_t FNV_OFFSET_BASIS = 14695981039346656037ull;
+	constexpr const std::uint64_t FNV_PRIME			= 1099511628211ull;
+
+	inline std::uint64_t fnv1a64(const void*			  p_data,
+										  const std::size_t	  p_size,
+										  const std::uint64_t p_seed = FNV_OFFSET_BASIS) noexcept
+	{
+		const auto* bytes = static_cast<const unsigned char*>(p_data);
+
+		std::uint64_t hash = p_seed;
+		for (std::size_t i = 0; i < p_size; ++i)
+		{
+			hash ^= bytes[i];
+			hash *= FNV_PRIME;
+		}
+		return hash;
+	}
+
+	template <typename CharType>
+	std::uint64_t fnv1a64(const std::basic_string_view<CharType> p_text,
+								 const std::uint64_t						p_seed = FNV_OFFSET_BASIS) noexcept
+	{
+		return fnv1a64(std::data(p_text), std::size(p_text) * sizeof(CharType), p_seed);
+	}
+} // namespace TUESL::Utility::Hash
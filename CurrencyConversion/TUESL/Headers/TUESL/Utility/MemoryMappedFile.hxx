@@ -0,0 +1,111 @@
+#pragma once
+
+// Read Only Memory Mapping of a File
+// Uses the *FromApp variants so that it is usable within the App Container
+
+#include <TUESL/Utility/UniqueHandler.hxx>
+
+#include <cstddef>
+#include <string_view>
+
+namespace TUESL::Utility::Traits
+{
+	struct FileHandlerTraits
+	{
+		using POINTER		  = HANDLE;
+		using CONST_POINTER = const POINTER;
+
+		static auto invalid() noexcept
+		{
+			return INVALID_HANDLE_VALUE;
+		}
+		static auto close(POINTER p_handle)
+		{
+			VERIFY_FUNCTION(TRUE, CloseHandle(p_handle));
+		}
+	};
+	struct FileMappingHandlerTraits
+	{
+		using POINTER		  = HANDLE;
+		using CONST_POINTER = const POINTER;
+
+		static auto invalid() noexcept
+		{
+			return HANDLE{nullptr};
+		}
+		static auto close(POINTER p_handle)
+		{
+			VERIFY_FUNCTION(TRUE, CloseHandle(p_handle));
+		}
+	};
+	struct MappedViewHandlerTraits
+	{
+		using POINTER		  = void*;
+		using CONST_POINTER = const void*;
+
+		static auto invalid() noexcept
+		{
+			return static_cast<void*>(nullptr);
+		}
+		static auto close(POINTER p_view)
+		{
+			VERIFY_FUNCTION(TRUE, UnmapViewOfFile(p_view));
+		}
+	};
+} // namespace TUESL::Utility::Traits
+
+namespace TUESL::Utility::Handler
+{
+	using File			= UniqueHandler<Traits::FileHandlerTraits>;
+	using FileMapping = UniqueHandler<Traits::FileMappingHandlerTraits>;
+	using MappedView  = UniqueHandler<Traits::MappedViewHandlerTraits>;
+} // namespace TUESL::Utility::Handler
+
+namespace TUESL::Utility
+{
+	class MemoryMappedFile
+	{
+	 private:
+		// Note that Order Matters
+		// The View must be Unmapped before the Mapping and File are Closed
+		Handler::File			m_file;
+		Handler::FileMapping m_mapping;
+		Handler::MappedView	m_view;
+
+		std::size_t m_size = 0;
+
+	 public:
+		MemoryMappedFile() {}
+		explicit MemoryMappedFile(const std::wstring_view p_file_name)
+		{
+			open(p_file_name);
+		}
+
+		MemoryMappedFile(MemoryMappedFile&&) = default;
+		MemoryMappedFile& operator=(MemoryMappedFile&&) = default;
+
+		~MemoryMappedFile()
+		{
+			close();
+		}
+
+		// Returns false if the File does not exist or is Empty
+		// An Absent File is an Expected Condition, hence no exception
+		bool open(const std::wstring_view p_file_name);
+		void close() noexcept;
+
+		bool isOpen() const noexcept
+		{
+			return m_view.hasValue();
+		}
+
+		const std::byte* data() const noexcept
+		{
+			return static_cast<const std::byte*>(m_view.get());
+		}
+		std::size_t size() const noexcept
+		{
+			return m_size;
+		}
+	};
+} // namespace TUESL::Utility
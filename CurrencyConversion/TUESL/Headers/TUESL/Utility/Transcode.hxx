@@ -0,0 +1,108 @@
+#pragma once
+
+// Validated Conversion between UTF-8 and UTF-16
+// SQLite Stores Text as UTF-8, WinRT hands it out as UTF-16
+// As such Text is Kept in UTF-8 and Transcoded once, where it meets the UI
+//
+// Example
+//	wchar_t buffer[64];
+//	const auto result = utf8ToUTF16(name, buffer, std::size(buffer));
+//	if (result.status == TranscodeStatus::DONE)
+//		use(std::wstring_view{buffer, result.written});
+//
+//	Or, Allocating the Result
+//	const auto name = toHString(ps.get<std::string_view>().value_or(""));
+//
+// Runs of ASCII are Converted 16 Units at a Time with SSE2 or NEON
+// Everything else one Code Point at a Time
+// Overlong Forms, Surrogates Encoded in UTF-8, Code Points above U+10FFFF
+// and Unpaired Surrogates in UTF-16 are all Invalid
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#if __has_include("winrt/Windows.Foundation.h")
+// This definition is defined only when C++WinRT is being used
+#	ifndef TUESL_USING_CPP_WINRT
+#		define TUESL_USING_CPP_WINRT
+#	endif
+#else
+#	ifdef TUESL_USING_CPP_WINRT
+#		undef TUESL_USING_CPP_WINRT
+#	endif
+#endif
+
+#ifdef TUESL_USING_CPP_WINRT
+#	include <winrt/Windows.Foundation.h>
+#endif
+
+namespace TUESL::Utility
+{
+	static_assert(sizeof(wchar_t) == 2, "wchar_t must be a 16-bit type to hold UTF-16");
+
+	enum class TranscodeStatus
+	{
+		DONE,
+		// The Source holds a Sequence which is not Valid, it starts at read
+		INVALID,
+		// The Destination is Full, the Source from read on was not Converted
+		TOO_SMALL
+	};
+
+	struct TranscodeResult
+	{
+		TranscodeStatus status = TranscodeStatus::DONE;
+		// Units of the Source Converted, never Splitting a Code Point
+		std::size_t read = 0;
+		// Units Written to the Destination
+		std::size_t written = 0;
+	};
+
+	// Capacity which Fits any Source of p_size Units
+	constexpr std::size_t maxUTF16Length(const std::size_t p_utf8_size) noexcept
+	{
+		return p_utf8_size;
+	}
+	constexpr std::size_t maxUTF8Length(const std::size_t p_utf16_size) noexcept
+	{
+		return 3 * p_utf16_size;
+	}
+
+	// Nothing is Allocated, the Destination is not Null Terminated
+	// Units of the Destination past those written may have been Overwritten
+	TranscodeResult utf8ToUTF16(const std::string_view p_source,
+										 wchar_t*					p_destination,
+										 const std::size_t		p_capacity) noexcept;
+	TranscodeResult utf16ToUTF8(const std::wstring_view p_source,
+										 char*						 p_destination,
+										 const std::size_t		 p_capacity) noexcept;
+
+	// nullopt if p_source is not Valid
+	std::optional<std::wstring> toUTF16(const std::string_view p_source);
+	std::optional<std::string>	 toUTF8(const std::wstring_view p_source);
+#ifdef TUESL_USING_CPP_WINRT
+	std::optional<winrt::hstring> toHString(const std::string_view p_source);
+#endif
+
+	// Kernels the Functions above Pick from
+	// Used by Benchmarks to Compare them
+	// The Vector Kernels fall back to Scalar where neither SSE2 nor NEON is there
+	namespace Kernels
+	{
+		TranscodeResult utf8ToUTF16Scalar(const std::string_view p_source,
+													 wchar_t*					p_destination,
+													 const std::size_t		p_capacity) noexcept;
+		TranscodeResult utf8ToUTF16Vector(const std::string_view p_source,
+													 wchar_t*					p_destination,
+													 const std::size_t		p_capacity) noexcept;
+
+		TranscodeResult utf16ToUTF8Scalar(const std::wstring_view p_source,
+													 char*						 p_destination,
+													 const std::size_t		 p_capacity) noexcept;
+		TranscodeResult utf16ToUTF8Vector(const std::wstring_view p_source,
+													 char*						 p_destination,
+													 const std::size_t		 p_capacity) noexcept;
+	} // namespace Kernels
+} // namespace TUESL::Utility
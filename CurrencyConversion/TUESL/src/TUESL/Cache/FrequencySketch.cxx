@@ -0,0 +1,98 @@
+#include "pch.h"
+#include <TUESL/Cache/FrequencySketch.hxx>
+
+#include <algorithm>
+
+namespace TUESL::Cache
+{
+	namespace
+	{
+		// Odd Constants, one per Row, as Caffeine Seeds them
+		constexpr const std::uint64_t ROW_SEEDS[FrequencySketch::DEPTH] = {
+			 0xc3a5c85c97cb3127ull, 0xb492b66fbe98f273ull, 0x9ae16a3b2f90404full,
+			 0xcbf29ce484222325ull};
+
+		// Keeps the Low Bit of every Nibble off, as such Shifting Right Halves each
+		constexpr const std::uint64_t RESET_MASK = 0x7777777777777777ull;
+
+		// Finaliser of SplitMix64, Spreads every Bit of the Input over the Output
+		std::uint64_t mix(std::uint64_t p_value) noexcept
+		{
+			p_value ^= p_value >> 30;
+			p_value *= 0xbf58476d1ce4e5b9ull;
+			p_value ^= p_value >> 27;
+			p_value *= 0x94d049bb133111ebull;
+			p_value ^= p_value >> 31;
+			return p_value;
+		}
+
+		std::size_t roundUpToPowerOfTwo(const std::size_t p_value) noexcept
+		{
+			std::size_t power = 1;
+			while (power < p_value)
+				power <<= 1;
+			return power;
+		}
+	} // namespace
+
+	FrequencySketch::FrequencySketch(const std::size_t p_capacity) :
+		 m_table(roundUpToPowerOfTwo((std::max)(p_capacity, std::size_t{COUNTERS_PER_WORD}) /
+											  (COUNTERS_PER_WORD / DEPTH))),
+		 m_word_mask{std::size(m_table) - 1},
+		 m_sample_size{10 * (std::max)(p_capacity, std::size_t{1})}
+	{
+	}
+
+	std::size_t FrequencySketch::counterIndex(const std::uint64_t p_hash,
+															const unsigned		 p_row) const noexcept
+	{
+		const auto hash = mix(p_hash + ROW_SEEDS[p_row]);
+
+		// The Low Bits Pick the Word, the High Bits the Nibble within it
+		const auto word	  = static_cast<std::size_t>(hash & m_word_mask);
+		const auto nibble = static_cast<std::size_t>(hash >> 60);
+		return word * COUNTERS_PER_WORD + nibble;
+	}
+
+	void FrequencySketch::increment(const std::uint64_t p_hash) noexcept
+	{
+		bool is_added = false;
+		for (unsigned row = 0; row < DEPTH; ++row)
+		{
+			const auto index = counterIndex(p_hash, row);
+			auto&		  word  = m_table[index / COUNTERS_PER_WORD];
+			const auto shift = (index % COUNTERS_PER_WORD) * 4;
+
+			if (((word >> shift) & 0xf) < MAX_FREQUENCY)
+			{
+				word += std::uint64_t{1} << shift;
+				is_added = true;
+			}
+		}
+
+		if (is_added && ++m_additions >= m_sample_size)
+			age();
+	}
+
+	unsigned FrequencySketch::frequency(const std::uint64_t p_hash) const noexcept
+	{
+		unsigned frequency = MAX_FREQUENCY;
+		for (unsigned row = 0; row < DEPTH; ++row)
+		{
+			const auto index = counterIndex(p_hash, row);
+			const auto word  = m_table[index / COUNTERS_PER_WORD];
+			const auto shift = (index % COUNTERS_PER_WORD) * 4;
+
+			frequency = (std::min)(frequency, static_cast<unsigned>((word >> shift) & 0xf));
+		}
+		return frequency;
+	}
+
+	void FrequencySketch::age() noexcept
+	{
+		for (auto& word : m_table)
+			word = (word >> 1) & RESET_MASK;
+
+		m_additions /= 2;
+	}
+} // namespace TUESL::Cache
@@ -0,0 +1,521 @@
+#include "pch.h"
+#include <TUESL/Compression/DictionaryCodec.hxx>
+
+#include <algorithm>
+#include <cstring>
+#include <queue>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace TUESL::Compression
+{
+	namespace
+	{
+		// Block
+		//	Size			Varint, Bytes the Block Decodes to
+		//	Method		Byte
+		//	Sequences	Method LZ, until Size Bytes are Out
+		//
+		// Sequence
+		//	Token			Byte, Literal Length in the High Nibble, Match Length - 4 in the Low
+		//	Literal Length Bytes of 255 and the Remainder, when the Nibble is 15
+		//	Literals
+		//	Offset		Varint, back from the end of the Output, into the Dictionary beyond it
+		//	Match Length Bytes, as for the Literal Length
+		// The last Sequence ends at its Literals, unless the Block Ends with a Match
+		enum class Method : std::uint8_t
+		{
+			STORED = 0,
+			LZ		 = 1,
+		};
+
+		constexpr const std::size_t MIN_MATCH = 4;
+		constexpr const unsigned	 NIBBLE_MAX = 15;
+
+		constexpr const int			  HASH_BITS		 = 14;
+		constexpr const std::size_t  HASH_ENTRIES	 = std::size_t{1} << HASH_BITS;
+		constexpr const std::uint32_t NO_POSITION	 = ~std::uint32_t{0};
+		// Steps over Incompressible Data faster the longer no Match has been Found
+		constexpr const unsigned SKIP_SHIFT = 6;
+
+		// Dictionary Training
+		// Bytes Compared as one Key, Shorter Matches save little once their Offset is Paid
+		constexpr const std::size_t DMER_SIZE = 6;
+		// Bytes Picked at a time, Candidates Start every half Segment
+		constexpr const std::size_t SEGMENT_SIZE = 64;
+
+		std::uint32_t read32(const char* p_data) noexcept
+		{
+			std::uint32_t value;
+			std::memcpy(&value, p_data, sizeof(value));
+			return value;
+		}
+		std::uint64_t read64(const char* p_data) noexcept
+		{
+			std::uint64_t value;
+			std::memcpy(&value, p_data, sizeof(value));
+			return value;
+		}
+
+		// The DMER_SIZE Bytes at p_data as one Value, as such Keys never Collide
+		std::uint64_t keyOf(const char* p_data) noexcept
+		{
+			std::uint64_t key = 0;
+			std::memcpy(&key, p_data, DMER_SIZE);
+			return key;
+		}
+
+		std::size_t hash4(const char* p_data) noexcept
+		{
+			return (read32(p_data) * 2654435761u) >> (32 - HASH_BITS);
+		}
+
+		// Bytes p_a and p_b have in Common, at most p_limit
+		std::size_t matchLength(const char* p_a, const char* p_b, const std::size_t p_limit) noexcept
+		{
+			std::size_t length = 0;
+			while (length + sizeof(std::uint64_t) <= p_limit)
+			{
+				// The Differing Byte lies within these eight
+				if (read64(p_a + length) != read64(p_b + length))
+				{
+					while (p_a[length] == p_b[length])
+						++length;
+					return length;
+				}
+				length += sizeof(std::uint64_t);
+			}
+			while (length < p_limit && p_a[length] == p_b[length])
+				++length;
+			return length;
+		}
+
+		void writeVarint(std::vector<std::byte>& p_out, std::size_t p_value)
+		{
+			while (p_value >= 0x80)
+			{
+				p_out.push_back(static_cast<std::byte>((p_value & 0x7F) | 0x80));
+				p_value >>= 7;
+			}
+			p_out.push_back(static_cast<std::byte>(p_value));
+		}
+		void writeLength(std::vector<std::byte>& p_out, std::size_t p_excess)
+		{
+			for (; p_excess >= 255; p_excess -= 255)
+				p_out.push_back(std::byte{255});
+			p_out.push_back(static_cast<std::byte>(p_excess));
+		}
+
+		void writeSequence(std::vector<std::byte>& p_out,
+								 const std::string_view	p_literals,
+								 const std::size_t		p_offset,
+								 const std::size_t		p_match_length)
+		{
+			const auto literal_length = std::size(p_literals);
+			const auto match_excess	  = p_match_length == 0 ? 0 : p_match_length - MIN_MATCH;
+
+			const auto literal_nibble = (std::min)(literal_length, std::size_t{NIBBLE_MAX});
+			const auto match_nibble	  = (std::min)(match_excess, std::size_t{NIBBLE_MAX});
+			p_out.push_back(static_cast<std::byte>((literal_nibble << 4) | match_nibble));
+
+			if (literal_nibble == NIBBLE_MAX)
+				writeLength(p_out, literal_length - NIBBLE_MAX);
+
+			const auto literals = reinterpret_cast<const std::byte*>(std::data(p_literals));
+			p_out.insert(std::end(p_out), literals, literals + literal_length);
+
+			if (p_match_length == 0)
+				return;
+
+			writeVarint(p_out, p_offset);
+			if (match_nibble == NIBBLE_MAX)
+				writeLength(p_out, match_excess - NIBBLE_MAX);
+		}
+
+		// Reads within [p_position, p_end), false once it would go beyond
+		struct ByteReader
+		{
+			const std::byte* position;
+			const std::byte* end;
+
+			bool readByte(std::size_t& p_value) noexcept
+			{
+				if (position == end)
+					return false;
+				p_value = static_cast<std::size_t>(*position++);
+				return true;
+			}
+			bool readVarint(std::size_t& p_value) noexcept
+			{
+				p_value = 0;
+				for (int shift = 0; shift < 35; shift += 7)
+				{
+					std::size_t byte = 0;
+					if (!readByte(byte))
+						return false;
+					p_value |= (byte & 0x7F) << shift;
+					if ((byte & 0x80) == 0)
+						return true;
+				}
+				return false;
+			}
+			// Adds the Extra Bytes of a Length whose Nibble was 15
+			bool readLength(std::size_t& p_length) noexcept
+			{
+				if (p_length != NIBBLE_MAX)
+					return true;
+
+				std::size_t byte = 255;
+				while (byte == 255)
+				{
+					if (!readByte(byte))
+						return false;
+					p_length += byte;
+				}
+				return true;
+			}
+		};
+
+		// Segment of a Sample which may be Picked
+		struct Candidate
+		{
+			std::size_t sample;
+			std::size_t begin;
+			std::size_t length;
+		};
+		struct KeyCount
+		{
+			// Samples holding the Key, 0 once a Picked Segment holds it
+			std::uint32_t samples = 0;
+			// Last Sample Counted, plus one
+			std::uint32_t last_sample = 0;
+		};
+		using KeyCounts = std::unordered_map<std::uint64_t, KeyCount>;
+
+		// Bytes the Segment would add to the Dictionary that other Samples also hold
+		// Each Key is Counted once however often the Segment holds it
+		// p_keys is Left holding them
+		std::uint64_t scoreOf(const std::string_view				 p_segment,
+									 const KeyCounts&					 p_counts,
+									 std::vector<std::uint64_t>& p_keys)
+		{
+			p_keys.clear();
+			for (std::size_t i = 0; i + DMER_SIZE <= std::size(p_segment); ++i)
+				p_keys.push_back(keyOf(std::data(p_segment) + i));
+
+			std::sort(std::begin(p_keys), std::end(p_keys));
+			p_keys.erase(std::unique(std::begin(p_keys), std::end(p_keys)), std::end(p_keys));
+
+			std::uint64_t score = 0;
+			for (const auto key : p_keys)
+			{
+				const auto count = p_counts.find(key);
+				// Keys only one Sample holds help no other
+				if (count != std::end(p_counts) && count->second.samples >= 2)
+					score += count->second.samples;
+			}
+			return score;
+		}
+	} // namespace
+
+	Dictionary::Dictionary(std::string p_bytes) : m_bytes{std::move(p_bytes)}
+	{
+		if (std::size(m_bytes) > MAX_CAPACITY)
+			throw std::invalid_argument("Dictionaries are at most 64 KiB");
+	}
+
+	Dictionary Dictionary::train(const std::vector<std::string_view>& p_samples,
+										  const std::size_t							p_capacity)
+	{
+		const auto capacity = (std::min)(p_capacity, MAX_CAPACITY);
+
+		KeyCounts counts;
+		for (std::size_t sample = 0; sample < std::size(p_samples); ++sample)
+		{
+			const auto& text = p_samples[sample];
+			for (std::size_t i = 0; i + DMER_SIZE <= std::size(text); ++i)
+			{
+				auto& count = counts[keyOf(std::data(text) + i)];
+				if (count.last_sample != sample + 1)
+				{
+					++count.samples;
+					count.last_sample = static_cast<std::uint32_t>(sample + 1);
+				}
+			}
+		}
+
+		std::vector<Candidate> candidates;
+		for (std::size_t sample = 0; sample < std::size(p_samples); ++sample)
+		{
+			const auto size = std::size(p_samples[sample]);
+			for (std::size_t begin = 0; begin + DMER_SIZE <= size; begin += SEGMENT_SIZE / 2)
+				candidates.push_back(
+					 Candidate{sample, begin, (std::min)(SEGMENT_SIZE, size - begin)});
+		}
+
+		const auto segmentOf = [&](const Candidate& p_candidate) {
+			return p_samples[p_candidate.sample].substr(p_candidate.begin, p_candidate.length);
+		};
+
+		std::vector<std::uint64_t> keys;
+
+		// Scores only ever Fall as Segments are Picked
+		// As such a Candidate whose Rescored Value still Leads is the Best
+		std::priority_queue<std::pair<std::uint64_t, std::size_t>> queue;
+		for (std::size_t i = 0; i < std::size(candidates); ++i)
+		{
+			const auto score = scoreOf(segmentOf(candidates[i]), counts, keys);
+			if (score != 0)
+				queue.emplace(score, i);
+		}
+
+		std::vector<std::string_view> picked;
+		std::size_t						size = 0;
+		while (!std::empty(queue) && size < capacity)
+		{
+			const auto index = queue.top().second;
+			queue.pop();
+
+			const auto segment = segmentOf(candidates[index]);
+			const auto score	 = scoreOf(segment, counts, keys);
+			if (score == 0)
+				continue;
+			if (!std::empty(queue) && score < queue.top().first)
+			{
+				queue.emplace(score, index);
+				continue;
+			}
+
+			for (const auto key : keys)
+				counts[key].samples = 0;
+
+			picked.push_back(segment);
+			size += std::size(segment);
+		}
+
+		// The Best Segments go last, nearest the Data, where Offsets are Shortest
+		std::string bytes;
+		bytes.reserve((std::min)(size, capacity));
+		for (auto segment = std::rbegin(picked); segment != std::rend(picked); ++segment)
+			bytes.append(*segment);
+
+		// The last Picked, and as such the Least Useful, are Cut
+		if (std::size(bytes) > capacity)
+			bytes.erase(0, std::size(bytes) - capacity);
+
+		return Dictionary{std::move(bytes)};
+	}
+
+	DictionaryEncoder::DictionaryEncoder(const Dictionary& p_dictionary) :
+		 m_dictionary{p_dictionary.bytes()},
+		 m_dictionary_table(HASH_ENTRIES, NO_POSITION),
+		 m_block_table(HASH_ENTRIES)
+	{
+		// Later Positions Overwrite earlier ones, as such the Nearest is Kept
+		for (std::size_t i = 0; i + MIN_MATCH <= std::size(m_dictionary); ++i)
+			m_dictionary_table[hash4(std::data(m_dictionary) + i)] =
+				 static_cast<std::uint32_t>(i);
+	}
+
+	void DictionaryEncoder::encode(const std::string_view p_block, std::vector<std::byte>& p_out)
+	{
+		if (std::size(p_block) > MAX_BLOCK_SIZE)
+			throw std::invalid_argument("Blocks are at most 64 KiB");
+
+		const auto start = std::size(p_out);
+		const auto size	= std::size(p_block);
+
+		writeVarint(p_out, size);
+		const auto header_size = std::size(p_out) - start;
+
+		p_out.push_back(static_cast<std::byte>(Method::LZ));
+
+		// Entries of every earlier Block are now Stale
+		if (++m_block == 0)
+		{
+			std::fill(std::begin(m_block_table), std::end(m_block_table), Entry{});
+			m_block = 1;
+		}
+
+		const auto* const block				 = std::data(p_block);
+		const auto* const dictionary		 = std::data(m_dictionary);
+		const auto			dictionary_size = std::size(m_dictionary);
+
+		std::size_t literal_begin = 0;
+		std::size_t i				  = 0;
+		while (i + MIN_MATCH <= size)
+		{
+			const auto hash = hash4(block + i);
+
+			std::size_t best_length = 0;
+			std::size_t best_offset = 0;
+
+			const auto entry = m_block_table[hash];
+			if (entry.block == m_block)
+			{
+				best_length = matchLength(block + entry.position, block + i, size - i);
+				best_offset = i - entry.position;
+			}
+
+			const auto dictionary_position = m_dictionary_table[hash];
+			if (dictionary_position != NO_POSITION)
+			{
+				// Matches End with the Dictionary, they do not Run on into the Block
+				const auto limit  = (std::min)(dictionary_size - dictionary_position, size - i);
+				const auto length = matchLength(dictionary + dictionary_position, block + i, limit);
+				if (length > best_length)
+				{
+					best_length = length;
+					best_offset = dictionary_size - dictionary_position + i;
+				}
+			}
+
+			m_block_table[hash] = Entry{m_block, static_cast<std::uint32_t>(i)};
+
+			if (best_length < MIN_MATCH)
+			{
+				i += 1 + ((i - literal_begin) >> SKIP_SHIFT);
+				continue;
+			}
+
+			writeSequence(p_out,
+							  p_block.substr(literal_begin, i - literal_begin),
+							  best_offset,
+							  best_length);
+
+			// Lets the next Repetition of the Match's End be Found as well
+			const auto end = i + best_length;
+			if (end >= 2 && end - 2 > i && end - 2 + MIN_MATCH <= size)
+				m_block_table[hash4(block + end - 2)] =
+					 Entry{m_block, static_cast<std::uint32_t>(end - 2)};
+
+			i				  = end;
+			literal_begin = end;
+		}
+
+		if (literal_begin < size || size == 0)
+			writeSequence(p_out, p_block.substr(literal_begin), 0, 0);
+
+		// Stored as is where it did not Shrink
+		if (std::size(p_out) - start - header_size - 1 >= size)
+		{
+			p_out.resize(start + header_size);
+			p_out.push_back(static_cast<std::byte>(Method::STORED));
+
+			const auto bytes = reinterpret_cast<const std::byte*>(block);
+			p_out.insert(std::end(p_out), bytes, bytes + size);
+		}
+	}
+
+	DictionaryDecoder::DictionaryDecoder(const Dictionary& p_dictionary) :
+		 m_dictionary{p_dictionary.bytes()}
+	{
+	}
+
+	std::size_t DictionaryDecoder::decodedSize(const std::byte* p_data,
+															 const std::size_t p_size) noexcept
+	{
+		ByteReader	reader{p_data, p_data + p_size};
+		std::size_t size = 0;
+		if (!reader.readVarint(size) || size > MAX_BLOCK_SIZE)
+			return 0;
+		return size;
+	}
+
+	bool DictionaryDecoder::decode(const std::byte*	p_data,
+											 const std::size_t p_size,
+											 std::string&		 p_out) const
+	{
+		ByteReader reader{p_data, p_data + p_size};
+
+		std::size_t size	 = 0;
+		std::size_t method = 0;
+		if (!reader.readVarint(size) || size > MAX_BLOCK_SIZE || !reader.readByte(method))
+			return false;
+
+		const auto available = static_cast<std::size_t>(reader.end - reader.position);
+
+		if (method == static_cast<std::size_t>(Method::STORED))
+		{
+			if (available != size)
+				return false;
+			p_out.append(reinterpret_cast<const char*>(reader.position), size);
+			return true;
+		}
+		if (method != static_cast<std::size_t>(Method::LZ))
+			return false;
+
+		const auto start = std::size(p_out);
+		p_out.resize(start + size);
+
+		auto* const			output			  = std::data(p_out) + start;
+		const auto* const dictionary		  = std::data(m_dictionary);
+		const auto			dictionary_size = std::size(m_dictionary);
+
+		const auto corrupt = [&] {
+			p_out.resize(start);
+			return false;
+		};
+
+		std::size_t written = 0;
+		for (;;)
+		{
+			std::size_t token = 0;
+			if (!reader.readByte(token))
+				return corrupt();
+
+			std::size_t literal_length = token >> 4;
+			std::size_t match_length	= token & NIBBLE_MAX;
+			if (!reader.readLength(literal_length))
+				return corrupt();
+
+			if (literal_length > size - written ||
+				 literal_length > static_cast<std::size_t>(reader.end - reader.position))
+				return corrupt();
+
+			std::memcpy(output + written, reader.position, literal_length);
+			reader.position += literal_length;
+			written += literal_length;
+
+			if (written == size)
+				break;
+
+			std::size_t offset = 0;
+			if (!reader.readVarint(offset) || !reader.readLength(match_length))
+				return corrupt();
+			match_length += MIN_MATCH;
+
+			if (offset == 0 || offset > written + dictionary_size ||
+				 match_length > size - written)
+				return corrupt();
+
+			// The Part of the Match which lies in the Dictionary
+			if (offset > written)
+			{
+				const auto from	 = dictionary_size - (offset - written);
+				const auto length = (std::min)(match_length, dictionary_size - from);
+				std::memcpy(output + written, dictionary + from, length);
+				written += length;
+				match_length -= length;
+			}
+
+			// Byte by Byte where the Match Overlaps what it Writes, as for Runs
+			const auto* source = output + written - offset;
+			if (offset >= match_length)
+				std::memcpy(output + written, source, match_length);
+			else
+				for (std::size_t j = 0; j < match_length; ++j)
+					output[written + j] = source[j];
+			written += match_length;
+
+			// Where the Block Ends with a Match there are no last Literals
+			if (written == size)
+				break;
+		}
+
+		// Trailing Bytes are not part of any Block the Encoder Writes
+		if (reader.position != reader.end)
+			return corrupt();
+		return true;
+	}
+} // namespace TUESL::Compression
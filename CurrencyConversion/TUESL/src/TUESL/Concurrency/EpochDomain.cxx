@@ -0,0 +1,78 @@
+#include "pch.h"
+#include <TUESL/Concurrency/EpochDomain.hxx>
+
+#include <thread>
+
+namespace TUESL::Concurrency
+{
+	namespace
+	{
+		// Where a Thread last found a Free Slot
+		// Spreads Threads across Slots so that they rarely Race for the same one
+		thread_local std::size_t slot_hint =
+			 std::hash<std::thread::id>{}(std::this_thread::get_id());
+	} // namespace
+
+	EpochDomain::Guard& EpochDomain::Guard::operator=(Guard&& p_other) noexcept
+	{
+		if (this != &p_other)
+		{
+			if (m_slot != nullptr)
+				m_slot->store(IDLE, std::memory_order_release);
+
+			m_slot			= p_other.m_slot;
+			p_other.m_slot = nullptr;
+		}
+		return *this;
+	}
+	EpochDomain::Guard::~Guard()
+	{
+		// Release, as Reads through the Guard must not move past it
+		if (m_slot != nullptr)
+			m_slot->store(IDLE, std::memory_order_release);
+	}
+
+	EpochDomain::Guard EpochDomain::enter() noexcept
+	{
+		for (std::size_t attempt = 0;; ++attempt)
+		{
+			for (std::size_t i = 0; i < MAX_READERS; ++i)
+			{
+				auto& slot = m_slots[(slot_hint + i) % MAX_READERS].epoch;
+
+				// A Stale Epoch is only more Conservative
+				Epoch expected = IDLE;
+				if (slot.load(std::memory_order_relaxed) == IDLE &&
+					 slot.compare_exchange_strong(
+						  expected, m_epoch.load(std::memory_order_seq_cst), std::memory_order_seq_cst))
+				{
+					slot_hint = (slot_hint + i) % MAX_READERS;
+
+					// Sequentially Consistent with the Writer's Exchange and Scan
+					// Either the Writer sees this Slot, or this Reader sees the new Object
+					return Guard{&slot};
+				}
+			}
+
+			// Every Slot is Taken
+			if (attempt > 0)
+				std::this_thread::yield();
+		}
+	}
+	Epoch EpochDomain::advance() noexcept
+	{
+		return m_epoch.fetch_add(1, std::memory_order_seq_cst);
+	}
+	Epoch EpochDomain::oldestActive() const noexcept
+	{
+		auto oldest = m_epoch.load(std::memory_order_seq_cst);
+
+		for (const auto& slot : m_slots)
+		{
+			const auto epoch = slot.epoch.load(std::memory_order_seq_cst);
+			if (epoch < oldest)
+				oldest = epoch;
+		}
+		return oldest;
+	}
+} // namespace TUESL::Concurrency
@@ -0,0 +1,106 @@
+#include "pch.h"
+#include <TUESL/Metrics/Instruments.hxx>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <thread>
+
+namespace TUESL::Metrics
+{
+	namespace
+	{
+		unsigned highestBit(std::uint64_t p_value) noexcept
+		{
+			unsigned bit = 0;
+			while (p_value >>= 1)
+				++bit;
+			return bit;
+		}
+	} // namespace
+
+	std::size_t Counter::stripeIndex() noexcept
+	{
+		// Hashed once per Thread, Threads of a Pool then Spread over the Stripes
+		thread_local const std::size_t index =
+			 std::hash<std::thread::id>{}(std::this_thread::get_id()) % STRIPES;
+		return index;
+	}
+	std::uint64_t Counter::value() const noexcept
+	{
+		std::uint64_t total = 0;
+		for (const auto& stripe : m_stripes)
+			total += stripe.value.load(std::memory_order_relaxed);
+		return total;
+	}
+
+	std::size_t Histogram::bucketIndex(const std::uint64_t p_value) noexcept
+	{
+		if (p_value < SUB_BUCKETS)
+			return static_cast<std::size_t>(p_value);
+
+		const auto exponent = highestBit(p_value);
+		if (exponent > MAX_EXPONENT)
+			return BUCKET_COUNT - 1;
+
+		// The Bits below the Leading one, Truncated to SUB_BUCKET_BITS
+		const auto group		= exponent - SUB_BUCKET_BITS;
+		const auto sub_bucket = static_cast<std::size_t>(p_value >> group) - SUB_BUCKETS;
+		return SUB_BUCKETS + group * SUB_BUCKETS + sub_bucket;
+	}
+	std::uint64_t Histogram::bucketLowerBound(const std::size_t p_index) noexcept
+	{
+		if (p_index < SUB_BUCKETS)
+			return p_index;
+
+		const auto group		= (p_index - SUB_BUCKETS) / SUB_BUCKETS;
+		const auto sub_bucket = (p_index - SUB_BUCKETS) % SUB_BUCKETS;
+		return static_cast<std::uint64_t>(SUB_BUCKETS + sub_bucket) << group;
+	}
+	std::uint64_t Histogram::bucketUpperBound(const std::size_t p_index) noexcept
+	{
+		if (p_index + 1 >= BUCKET_COUNT)
+			return UINT64_MAX;
+		return bucketLowerBound(p_index + 1) - 1;
+	}
+
+	Histogram::Snapshot Histogram::snapshot() const
+	{
+		Snapshot snapshot;
+		snapshot.counts.resize(BUCKET_COUNT);
+		for (std::size_t i = 0; i < BUCKET_COUNT; ++i)
+			snapshot.counts[i] = m_buckets[i].load(std::memory_order_relaxed);
+
+		snapshot.sum = m_sum.load(std::memory_order_relaxed);
+		for (const auto count : snapshot.counts)
+			snapshot.count += count;
+		return snapshot;
+	}
+
+	std::uint64_t Histogram::Snapshot::percentile(const double p_percentile) const noexcept
+	{
+		if (count == 0)
+			return 0;
+
+		// Rank of the Value, from 1
+		const auto clamped = (std::min)((std::max)(p_percentile, 0.0), 100.0);
+		const auto rank	 = (std::max)(
+			  std::uint64_t{1}, static_cast<std::uint64_t>(std::ceil(clamped / 100.0 * count)));
+
+		std::uint64_t seen = 0;
+		for (std::size_t i = 0; i < std::size(counts); ++i)
+		{
+			seen += counts[i];
+			if (seen >= rank)
+				return bucketUpperBound(i);
+		}
+		return bucketUpperBound(std::size(counts) - 1);
+	}
+	std::uint64_t Histogram::Snapshot::countAtOrBelow(const std::uint64_t p_bound) const noexcept
+	{
+		std::uint64_t total = 0;
+		for (std::size_t i = 0; i < std::size(counts) && bucketUpperBound(i) <= p_bound; ++i)
+			total += counts[i];
+		return total;
+	}
+} // namespace TUESL::Metrics
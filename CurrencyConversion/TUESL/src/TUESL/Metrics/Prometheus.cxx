@@ -0,0 +1,45 @@
+#include "pch.h"
+#include <TUESL/Metrics/Prometheus.hxx>
+
+#include <fstream>
+#include <string>
+
+namespace TUESL::Metrics
+{
+	bool writePrometheusFile(const Registry& p_registry, const std::wstring_view p_file_name)
+	{
+		const auto exported = p_registry.exportPrometheus();
+
+		const std::wstring file_name{p_file_name};
+		const std::wstring temp_file_name = file_name + L".tmp";
+
+		{
+			std::ofstream stream{temp_file_name, std::ios::binary | std::ios::trunc};
+			if (!stream)
+				return false;
+
+			stream.write(std::data(exported), static_cast<std::streamsize>(std::size(exported)));
+			if (!stream)
+				return false;
+		}
+
+		return MoveFileExW(temp_file_name.c_str(), file_name.c_str(), MOVEFILE_REPLACE_EXISTING) !=
+				 FALSE;
+	}
+
+	bool sendPrometheus(const Registry& p_registry, Net::LocalSocket& p_socket)
+	{
+		const auto exported = p_registry.exportPrometheus();
+
+		std::size_t sent = 0;
+		while (sent < std::size(exported))
+		{
+			const auto result =
+				 p_socket.send(std::data(exported) + sent, std::size(exported) - sent);
+			if (result.status != Net::IOStatus::DONE)
+				return false;
+			sent += result.bytes;
+		}
+		return true;
+	}
+} // namespace TUESL::Metrics
@@ -0,0 +1,240 @@
+#include "pch.h"
+#include <TUESL/Metrics/Registry.hxx>
+
+#include <cstdio>
+#include <stdexcept>
+
+namespace TUESL::Metrics
+{
+	namespace
+	{
+		bool isNameCharacter(const char p_character, const bool p_is_first) noexcept
+		{
+			const bool is_letter = (p_character >= 'a' && p_character <= 'z') ||
+										  (p_character >= 'A' && p_character <= 'Z') ||
+										  p_character == '_';
+			const bool is_digit = p_character >= '0' && p_character <= '9';
+			return is_letter || (!p_is_first && is_digit);
+		}
+
+		// Metric and Label Names as Prometheus Allows them, less the Colon kept for Rules
+		bool isValidName(const std::string_view p_name) noexcept
+		{
+			if (std::empty(p_name))
+				return false;
+
+			for (std::size_t i = 0; i < std::size(p_name); ++i)
+			{
+				if (!isNameCharacter(p_name[i], i == 0))
+					return false;
+			}
+			return true;
+		}
+
+		void appendEscaped(std::string&				p_out,
+								 const std::string_view p_text,
+								 const bool				  p_escape_quotes)
+		{
+			for (const char character : p_text)
+			{
+				if (character == '\\')
+					p_out += "\\\\";
+				else if (character == '\n')
+					p_out += "\\n";
+				else if (character == '"' && p_escape_quotes)
+					p_out += "\\\"";
+				else
+					p_out += character;
+			}
+		}
+
+		// {name="value",...}, or Empty without Labels
+		std::string renderLabels(const Labels& p_labels)
+		{
+			if (std::empty(p_labels))
+				return {};
+
+			std::string rendered = "{";
+			for (const auto& [name, value] : p_labels)
+			{
+				if (!isValidName(name))
+					throw std::invalid_argument("Label Names may only contain [A-Za-z0-9_]");
+
+				if (std::size(rendered) > 1)
+					rendered += ',';
+				rendered += name;
+				rendered += "=\"";
+				appendEscaped(rendered, value, true);
+				rendered += '"';
+			}
+			rendered += '}';
+			return rendered;
+		}
+
+		// p_labels with one more Label at the End
+		std::string withLabel(const std::string_view p_labels,
+									 const std::string_view p_name,
+									 const std::string_view p_value)
+		{
+			// Without its Closing Brace
+			const auto open_labels =
+				 p_labels.substr(0, std::empty(p_labels) ? 0 : std::size(p_labels) - 1);
+
+			std::string rendered{open_labels};
+			rendered += std::empty(p_labels) ? '{' : ',';
+			rendered += p_name;
+			rendered += "=\"";
+			rendered += p_value;
+			rendered += "\"}";
+			return rendered;
+		}
+
+		std::string formatNumber(const double p_value)
+		{
+			char digits[32];
+			std::snprintf(digits, sizeof(digits), "%.9g", p_value);
+			return digits;
+		}
+
+		void appendHeader(std::string&				p_out,
+								const std::string&		p_name,
+								const std::string&		p_help,
+								const std::string_view p_type)
+		{
+			p_out += "# HELP ";
+			p_out += p_name;
+			p_out += ' ';
+			appendEscaped(p_out, p_help, false);
+			p_out += "\n# TYPE ";
+			p_out += p_name;
+			p_out += ' ';
+			p_out += p_type;
+			p_out += '\n';
+		}
+
+		void appendSample(std::string&				p_out,
+								const std::string_view p_name,
+								const std::string_view p_labels,
+								const std::string_view p_value)
+		{
+			p_out += p_name;
+			p_out += p_labels;
+			p_out += ' ';
+			p_out += p_value;
+			p_out += '\n';
+		}
+	} // namespace
+
+	Registry& Registry::global()
+	{
+		static Registry registry;
+		return registry;
+	}
+
+	bool Registry::isRegistered(const std::string_view p_name) const
+	{
+		const std::string name{p_name};
+		return m_counters.count(name) != 0 || m_gauges.count(name) != 0 ||
+				 m_histograms.count(name) != 0;
+	}
+
+	template <typename Instrument>
+	Instrument& Registry::add(std::map<std::string, Family<Instrument>>& p_families,
+									  const std::string_view						 p_name,
+									  const std::string_view						 p_help,
+									  const Labels&									 p_labels)
+	{
+		if (!isValidName(p_name))
+			throw std::invalid_argument("Metric Names may only contain [A-Za-z0-9_]");
+
+		auto labels = renderLabels(p_labels);
+
+		std::lock_guard<std::mutex> lock{m_mutex};
+
+		auto family = p_families.find(std::string{p_name});
+		if (family == std::end(p_families))
+		{
+			if (isRegistered(p_name))
+				throw std::invalid_argument("Metric is already Registered as another Type");
+
+			family = p_families.emplace(std::string{p_name}, Family<Instrument>{}).first;
+			family->second.help = std::string{p_help};
+		}
+
+		auto& series = family->second.series[std::move(labels)];
+		if (!series)
+			series = std::make_unique<Instrument>();
+		return *series;
+	}
+
+	Counter& Registry::counter(const std::string_view p_name,
+										const std::string_view p_help,
+										const Labels&			  p_labels)
+	{
+		return add(m_counters, p_name, p_help, p_labels);
+	}
+	Gauge& Registry::gauge(const std::string_view p_name,
+								  const std::string_view p_help,
+								  const Labels&			 p_labels)
+	{
+		return add(m_gauges, p_name, p_help, p_labels);
+	}
+	Histogram& Registry::histogram(const std::string_view p_name,
+											 const std::string_view p_help,
+											 const Labels&				p_labels)
+	{
+		return add(m_histograms, p_name, p_help, p_labels);
+	}
+
+	std::string Registry::exportPrometheus() const
+	{
+		std::string out;
+
+		std::lock_guard<std::mutex> lock{m_mutex};
+
+		for (const auto& [name, family] : m_counters)
+		{
+			appendHeader(out, name, family.help, "counter");
+			for (const auto& [labels, counter] : family.series)
+				appendSample(out, name, labels, std::to_string(counter->value()));
+		}
+
+		for (const auto& [name, family] : m_gauges)
+		{
+			appendHeader(out, name, family.help, "gauge");
+			for (const auto& [labels, gauge] : family.series)
+				appendSample(out, name, labels, std::to_string(gauge->value()));
+		}
+
+		for (const auto& [name, family] : m_histograms)
+		{
+			appendHeader(out, name, family.help, "histogram");
+
+			const auto bucket_name = name + "_bucket";
+			const auto sum_name	  = name + "_sum";
+			const auto count_name  = name + "_count";
+
+			for (const auto& [labels, histogram] : family.series)
+			{
+				const auto snapshot = histogram->snapshot();
+
+				for (const auto bound : DURATION_BOUNDS)
+				{
+					const auto bound_nanoseconds = static_cast<std::uint64_t>(bound * 1e9 + 0.5);
+					appendSample(out,
+									 bucket_name,
+									 withLabel(labels, "le", formatNumber(bound)),
+									 std::to_string(snapshot.countAtOrBelow(bound_nanoseconds)));
+				}
+				appendSample(out,
+								 bucket_name,
+								 withLabel(labels, "le", "+Inf"),
+								 std::to_string(snapshot.count));
+				appendSample(out, sum_name, labels, formatNumber(snapshot.sum / 1e9));
+				appendSample(out, count_name, labels, std::to_string(snapshot.count));
+			}
+		}
+
+		return out;
+	}
+} // namespace TUESL::Metrics
@@ -0,0 +1,57 @@
+#include "pch.h"
+#include <TUESL/Net/LatencyWindow.hxx>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace TUESL::Net
+{
+	LatencyWindow::LatencyWindow(const std::size_t p_capacity) : m_capacity{p_capacity}
+	{
+		if (p_capacity == 0)
+			throw std::invalid_argument("A Latency Window must hold at least one Sample");
+
+		m_samples.reserve(p_capacity);
+	}
+
+	void LatencyWindow::recordSample(const Duration p_latency)
+	{
+		std::lock_guard<std::mutex> lock{m_mutex};
+
+		if (std::size(m_samples) < m_capacity)
+			m_samples.push_back(p_latency);
+		else
+			m_samples[m_next] = p_latency;
+
+		m_next = (m_next + 1) % m_capacity;
+	}
+
+	std::size_t LatencyWindow::size() const
+	{
+		std::lock_guard<std::mutex> lock{m_mutex};
+		return std::size(m_samples);
+	}
+
+	std::optional<LatencyWindow::Duration>
+		 LatencyWindow::percentile(const double		 p_percentile,
+											const std::size_t p_min_samples) const
+	{
+		// Copied, as such Recording never Waits on the Selection
+		std::vector<Duration> samples;
+		{
+			std::lock_guard<std::mutex> lock{m_mutex};
+			samples = m_samples;
+		}
+
+		if (std::empty(samples) || std::size(samples) < p_min_samples)
+			return std::nullopt;
+
+		const auto fraction = std::clamp(p_percentile / 100.0, 0.0, 1.0);
+		const auto rank		= static_cast<std::size_t>(std::ceil(fraction * std::size(samples)));
+		const auto index		= (std::max)(rank, std::size_t{1}) - 1;
+
+		std::nth_element(std::begin(samples), std::begin(samples) + index, std::end(samples));
+		return samples[index];
+	}
+} // namespace TUESL::Net
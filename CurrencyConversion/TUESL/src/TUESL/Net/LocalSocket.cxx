@@ -0,0 +1,133 @@
+#include "pch.h"
+#include <TUESL/Net/LocalSocket.hxx>
+
+#include <algorithm>
+#include <climits>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+namespace TUESL::Net
+{
+	namespace
+	{
+		std::optional<sockaddr_un> makeAddress(const std::string_view p_path) noexcept
+		{
+			sockaddr_un address{};
+			address.sun_family = AF_UNIX;
+
+			// The Path must leave room for its Terminator
+			if (std::empty(p_path) || std::size(p_path) >= sizeof(address.sun_path))
+				return std::nullopt;
+
+			std::memcpy(address.sun_path, std::data(p_path), std::size(p_path));
+			return address;
+		}
+
+		IOStatus lastErrorStatus() noexcept
+		{
+			return WSAGetLastError() == WSAEWOULDBLOCK ? IOStatus::WOULD_BLOCK : IOStatus::FAILED;
+		}
+
+		// Winsock takes int Sizes
+		int clampSize(const std::size_t p_size) noexcept
+		{
+			return static_cast<int>((std::min)(p_size, static_cast<std::size_t>(INT_MAX)));
+		}
+	} // namespace
+
+	WinsockSession::WinsockSession()
+	{
+		WSADATA data{};
+		m_is_started = WSAStartup(MAKEWORD(2, 2), &data) == 0;
+	}
+	WinsockSession::~WinsockSession()
+	{
+		if (m_is_started)
+			WSACleanup();
+	}
+
+	std::optional<LocalSocket> LocalSocket::listen(const std::string_view p_path,
+																  const int					 p_backlog)
+	{
+		const auto address = makeAddress(p_path);
+		if (!address.has_value())
+			return std::nullopt;
+
+		LocalSocket listener{::socket(AF_UNIX, SOCK_STREAM, 0)};
+		if (listener.empty())
+			return std::nullopt;
+
+		// Binding Fails while the File of an earlier Listener is still there
+		std::remove(std::string{p_path}.c_str());
+
+		if (::bind(listener.get(),
+					  reinterpret_cast<const sockaddr*>(&address.value()),
+					  sizeof(sockaddr_un)) == SOCKET_ERROR)
+			return std::nullopt;
+
+		if (::listen(listener.get(), p_backlog) == SOCKET_ERROR)
+			return std::nullopt;
+
+		return listener;
+	}
+
+	std::optional<LocalSocket> LocalSocket::connect(const std::string_view p_path)
+	{
+		const auto address = makeAddress(p_path);
+		if (!address.has_value())
+			return std::nullopt;
+
+		LocalSocket client{::socket(AF_UNIX, SOCK_STREAM, 0)};
+		if (client.empty())
+			return std::nullopt;
+
+		if (::connect(client.get(),
+						  reinterpret_cast<const sockaddr*>(&address.value()),
+						  sizeof(sockaddr_un)) == SOCKET_ERROR)
+			return std::nullopt;
+
+		return client;
+	}
+
+	std::optional<LocalSocket> LocalSocket::accept() noexcept
+	{
+		const SOCKET client = ::accept(m_socket.get(), nullptr, nullptr);
+		if (client == INVALID_SOCKET)
+			return std::nullopt;
+		return LocalSocket{client};
+	}
+
+	bool LocalSocket::setNonBlocking() noexcept
+	{
+		u_long is_non_blocking = 1;
+		return ioctlsocket(m_socket.get(), FIONBIO, &is_non_blocking) == 0;
+	}
+
+	IOResult LocalSocket::receive(void* p_buffer, const std::size_t p_size) noexcept
+	{
+		const int received =
+			 ::recv(m_socket.get(), static_cast<char*>(p_buffer), clampSize(p_size), 0);
+
+		if (received == SOCKET_ERROR)
+			return IOResult{lastErrorStatus(), 0};
+		if (received == 0)
+			return IOResult{IOStatus::CLOSED, 0};
+		return IOResult{IOStatus::DONE, static_cast<std::size_t>(received)};
+	}
+
+	IOResult LocalSocket::send(const void* p_buffer, const std::size_t p_size) noexcept
+	{
+		const int sent =
+			 ::send(m_socket.get(), static_cast<const char*>(p_buffer), clampSize(p_size), 0);
+
+		if (sent == SOCKET_ERROR)
+		{
+			const auto error = WSAGetLastError();
+			if (error == WSAECONNRESET || error == WSAECONNABORTED || error == WSAESHUTDOWN)
+				return IOResult{IOStatus::CLOSED, 0};
+			return IOResult{error == WSAEWOULDBLOCK ? IOStatus::WOULD_BLOCK : IOStatus::FAILED, 0};
+		}
+		return IOResult{IOStatus::DONE, static_cast<std::size_t>(sent)};
+	}
+} // namespace TUESL::Net
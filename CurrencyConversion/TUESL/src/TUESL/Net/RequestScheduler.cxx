@@ -0,0 +1,191 @@
+#include "pch.h"
+#include <TUESL/Net/RequestScheduler.hxx>
+
+#include <algorithm>
+
+namespace TUESL::Net
+{
+	namespace
+	{
+		constexpr const std::size_t INTERACTIVE_LANE = 0;
+		constexpr const std::size_t BACKGROUND_LANE	= 1;
+
+		std::size_t laneOf(const Priority p_priority) noexcept
+		{
+			return p_priority == Priority::INTERACTIVE ? INTERACTIVE_LANE : BACKGROUND_LANE;
+		}
+	} // namespace
+
+	void RequestScheduler::Permit::release() noexcept
+	{
+		if (m_scheduler != nullptr)
+			std::exchange(m_scheduler, nullptr)->releaseSlot();
+	}
+
+	RequestScheduler::RequestScheduler(const Options& p_options, Now p_now, WakeAt p_wake_at) :
+		 m_options{p_options},
+		 m_now{std::move(p_now)},
+		 m_wake_at{std::move(p_wake_at)},
+		 m_tokens{p_options.burst},
+		 m_refilled{m_now()}
+	{
+	}
+
+	void RequestScheduler::refillLocked(const TimePoint p_now) noexcept
+	{
+		if (p_now <= m_refilled)
+			return;
+
+		const std::chrono::duration<double> elapsed = p_now - m_refilled;
+		m_tokens =
+			 (std::min)(m_options.burst, m_tokens + elapsed.count() * m_options.requests_per_second);
+		m_refilled = p_now;
+	}
+
+	std::vector<RequestScheduler::Grant>
+		 RequestScheduler::takeGrantsLocked(const TimePoint			  p_now,
+														std::optional<TimePoint>& p_wake_time)
+	{
+		refillLocked(p_now);
+
+		std::vector<Grant> grants;
+
+		// Tokens the Head of the Lane in Line Needs, if it is Held up by them
+		std::optional<double> tokens_needed;
+
+		while (true)
+		{
+			std::size_t lane;
+			double		tokens_kept;
+			std::size_t slots_kept;
+
+			// BACKGROUND never Overtakes a Waiting INTERACTIVE Request
+			if (!std::empty(m_lanes[INTERACTIVE_LANE]))
+			{
+				lane			= INTERACTIVE_LANE;
+				tokens_kept = 0.0;
+				slots_kept	= 0;
+			}
+			else if (!std::empty(m_lanes[BACKGROUND_LANE]))
+			{
+				lane			= BACKGROUND_LANE;
+				tokens_kept = m_options.interactive_tokens;
+				slots_kept	= m_options.interactive_slots;
+			}
+			else
+				break;
+
+			// A Slot is Freed by a Permit, which then comes back here
+			if (m_in_flight + slots_kept >= m_options.max_in_flight)
+				break;
+
+			if (m_tokens < tokens_kept + 1.0)
+			{
+				tokens_needed = tokens_kept + 1.0;
+				break;
+			}
+
+			auto waiting = std::move(m_lanes[lane].front());
+			m_lanes[lane].pop_front();
+
+			m_tokens -= 1.0;
+			++m_in_flight;
+
+			auto&		 metrics = m_lane_metrics[lane];
+			const auto wait	  = std::chrono::duration_cast<std::chrono::microseconds>(
+				  p_now - waiting.submitted);
+			metrics.queue_depth = std::size(m_lanes[lane]);
+			++metrics.granted;
+			metrics.total_wait += wait;
+			metrics.max_wait = (std::max)(metrics.max_wait, wait);
+
+			grants.push_back(std::move(waiting.grant));
+		}
+
+		// Tokens never Refill without a Rate, nothing would come of Waking
+		if (tokens_needed.has_value() && m_options.requests_per_second > 0.0)
+		{
+			const std::chrono::duration<double> refill_time{
+				 (tokens_needed.value() - m_tokens) / m_options.requests_per_second};
+			const auto wake_time = p_now + std::chrono::ceil<Clock::duration>(refill_time);
+
+			if (!m_wake_time.has_value() || wake_time < m_wake_time.value())
+			{
+				m_wake_time = wake_time;
+				p_wake_time = wake_time;
+			}
+		}
+
+		return grants;
+	}
+
+	void RequestScheduler::runGrants(std::vector<Grant>				 p_grants,
+												const std::optional<TimePoint> p_wake_time)
+	{
+		if (p_wake_time.has_value() && m_wake_at)
+			m_wake_at(p_wake_time.value());
+
+		for (auto& grant : p_grants)
+			grant(Permit{this});
+	}
+
+	void RequestScheduler::releaseSlot() noexcept
+	{
+		std::vector<Grant>		 grants;
+		std::optional<TimePoint> wake_time;
+		{
+			std::lock_guard<std::mutex> lock{m_mutex};
+			--m_in_flight;
+			grants = takeGrantsLocked(m_now(), wake_time);
+		}
+		runGrants(std::move(grants), wake_time);
+	}
+
+	void RequestScheduler::submit(const Priority p_priority, Grant p_grant)
+	{
+		std::vector<Grant>		 grants;
+		std::optional<TimePoint> wake_time;
+		{
+			std::lock_guard<std::mutex> lock{m_mutex};
+
+			const auto now	 = m_now();
+			const auto lane = laneOf(p_priority);
+			m_lanes[lane].push_back(Waiting{std::move(p_grant), now});
+
+			auto& metrics			  = m_lane_metrics[lane];
+			metrics.queue_depth	  = std::size(m_lanes[lane]);
+			metrics.max_queue_depth = (std::max)(metrics.max_queue_depth, metrics.queue_depth);
+
+			grants = takeGrantsLocked(now, wake_time);
+		}
+		runGrants(std::move(grants), wake_time);
+	}
+
+	void RequestScheduler::dispatch()
+	{
+		std::vector<Grant>		 grants;
+		std::optional<TimePoint> wake_time;
+		{
+			std::lock_guard<std::mutex> lock{m_mutex};
+
+			// The Owner has Woken, as such any later Wait must be Passed on again
+			// Even one for the same Time, should the Timer have Fired a little Early
+			m_wake_time.reset();
+
+			grants = takeGrantsLocked(m_now(), wake_time);
+		}
+		runGrants(std::move(grants), wake_time);
+	}
+
+	RequestScheduler::Metrics RequestScheduler::metrics() const
+	{
+		std::lock_guard<std::mutex> lock{m_mutex};
+
+		Metrics metrics;
+		metrics.interactive = m_lane_metrics[INTERACTIVE_LANE];
+		metrics.background  = m_lane_metrics[BACKGROUND_LANE];
+		metrics.in_flight	  = m_in_flight;
+		metrics.tokens		  = m_tokens;
+		return metrics;
+	}
+} // namespace TUESL::Net
@@ -1,8 +1,153 @@
 #include "pch.h"
 #include <TUESL/Net/WebClient.hxx>
 
+#include <algorithm>
+#include <chrono>
+#include <optional>
+#include <string_view>
+#include <utility>
+
 namespace TUESL::Net
 {
+	namespace
+	{
+#ifdef TUESL_USING_CPP_WINRT
+		using Windows::Foundation::TimeSpan;
+
+		// Suspends the Coroutine until the Scheduler Grants it a Permit
+		// It is Resumed on the Thread that Granted it
+		struct PermitAwaiter
+		{
+			RequestScheduler&			 scheduler;
+			const Priority				 priority;
+			RequestScheduler::Permit permit;
+
+			bool await_ready() const noexcept
+			{
+				return false;
+			}
+			void await_suspend(std::experimental::coroutine_handle<> p_handle)
+			{
+				// May be Granted, and thereby Resumed, before submit Returns
+				// As such nothing may be Touched after it
+				scheduler.submit(priority, [this, p_handle](RequestScheduler::Permit p_permit) {
+					permit = std::move(p_permit);
+					p_handle.resume();
+				});
+			}
+			RequestScheduler::Permit await_resume() noexcept
+			{
+				return std::move(permit);
+			}
+		};
+
+		// Cancelled along with p_cancellation, where there is one
+		template <typename Operation>
+		Operation cancellable(Operation p_operation, RequestCancellation* const p_cancellation)
+		{
+			if (p_cancellation != nullptr)
+				p_cancellation->attach(p_operation);
+			return p_operation;
+		}
+#endif
+	} // namespace
+
+	void RequestCancellation::cancel() noexcept
+	{
+#ifdef TUESL_USING_CPP_WINRT
+		IAsyncInfo pending{nullptr};
+#endif
+		{
+			std::lock_guard<std::mutex> lock{m_mutex};
+			m_is_cancelled = true;
+#ifdef TUESL_USING_CPP_WINRT
+			pending = std::exchange(m_pending, nullptr);
+#endif
+		}
+
+#ifdef TUESL_USING_CPP_WINRT
+		// Outside the Lock, as the Request may be Resumed on this Thread
+		if (pending)
+		{
+			try
+			{
+				pending.Cancel();
+			}
+			catch (...)
+			{
+			}
+		}
+#endif
+	}
+	bool RequestCancellation::isCancelled() noexcept
+	{
+		std::lock_guard<std::mutex> lock{m_mutex};
+		return m_is_cancelled;
+	}
+#ifdef TUESL_USING_CPP_WINRT
+	void RequestCancellation::attach(const IAsyncInfo& p_operation)
+	{
+		{
+			std::lock_guard<std::mutex> lock{m_mutex};
+			if (!m_is_cancelled)
+			{
+				m_pending = p_operation;
+				return;
+			}
+		}
+		p_operation.Cancel();
+	}
+#endif
+
+	WebClient::WebClient(const RequestScheduler::Options& p_options,
+								Metrics::Registry&					p_metrics) :
+		 m_scheduler{p_options,
+						 &RequestScheduler::Clock::now,
+						 [this](const RequestScheduler::TimePoint p_time) { armRefillTimer(p_time); }},
+		 m_queue_wait{p_metrics.histogram("upstream_queue_wait_seconds",
+													 "Time Requests Waited on the Upstream Budget")},
+		 m_request_latency{p_metrics.histogram("upstream_request_seconds",
+														  "Time from Sending a Request to its whole Response")},
+		 m_requests_succeeded{p_metrics.counter(
+			  "upstream_requests_total", "Requests to the Upstream", {{"outcome", "ok"}})},
+		 m_requests_failed{p_metrics.counter(
+			  "upstream_requests_total", "Requests to the Upstream", {{"outcome", "failed"}})},
+		 m_requests_cancelled{p_metrics.counter(
+			  "upstream_requests_total", "Requests to the Upstream", {{"outcome", "cancelled"}})},
+		 m_response_bytes{p_metrics.counter("upstream_response_bytes_total",
+														"Bytes of Response Bodies Downloaded")},
+		 m_requests_in_flight{p_metrics.gauge("upstream_requests_in_flight",
+														  "Requests Granted and not yet Answered")}
+	{
+	}
+	WebClient::~WebClient()
+	{
+#ifdef TUESL_USING_CPP_WINRT
+		std::lock_guard<std::mutex> lock{m_refill_timer_mutex};
+		if (m_refill_timer)
+			m_refill_timer.Cancel();
+#endif
+	}
+	void WebClient::armRefillTimer(const RequestScheduler::TimePoint p_time)
+	{
+#ifdef TUESL_USING_CPP_WINRT
+		const auto delay = std::chrono::duration_cast<TimeSpan>(
+			 (std::max)(p_time - RequestScheduler::Clock::now(), RequestScheduler::Clock::duration{0}));
+
+		std::lock_guard<std::mutex> lock{m_refill_timer_mutex};
+
+		// The Scheduler only asks for a Time Earlier than the one Pending
+		if (m_refill_timer)
+			m_refill_timer.Cancel();
+
+		m_refill_timer = ThreadPoolTimer::CreateTimer(
+			 [this](const ThreadPoolTimer&) { m_scheduler.dispatch(); }, delay);
+#else
+		// Without a Timer Requests Waiting on Tokens go with the next submit
+		static_cast<void>(p_time);
+#endif
+	}
+
 #ifdef TUESL_USING_CPP_WINRT
 	void WebClient::setUserAgent(const std::wstring_view p_user_agent)
 	{
@@ -41,17 +186,86 @@ namespace TUESL::Net
 	{
 		return getAsync(Uri{p_uri});
 	}
-	IAsyncOperation<hstring> WebClient::ReadJsonFromUriAsync(const std::wstring_view p_uri)
+	IAsyncOperation<hstring>
+		 WebClient::ReadJsonFromUriAsync(const std::wstring_view					 p_uri,
+												  const Priority								 p_priority,
+												  const std::shared_ptr<RequestCancellation> p_cancellation)
 	{
+		bool is_in_flight = false;
+
+		// Kept for the Observer, which only Runs once the Outcome is Settled
+		std::optional<hstring>				  json;
+		hstring									  absolute_uri;
+		Windows::Storage::Streams::IBuffer body{nullptr};
 		try
 		{
-			// Read the JSON String and Store it
-			const hstring json = co_await getStringAsync(p_uri);
-			co_return json;
+			// Parsed before the first Suspension, p_uri need not outlive it
+			const Uri uri{p_uri};
+
+			const auto queued_at = std::chrono::steady_clock::now();
+
+			// The Slot is Held until the Response has been Read
+			const auto permit = co_await PermitAwaiter{m_scheduler, p_priority};
+
+			const auto sent_at = std::chrono::steady_clock::now();
+			m_queue_wait.record(sent_at - queued_at);
+
+			// Abandoned while Queued, the Slot goes back without anything Sent
+			if (p_cancellation != nullptr && p_cancellation->isCancelled())
+			{
+				m_requests_cancelled.increment();
+				co_return L"";
+			}
+
+			m_requests_in_flight.add(1);
+			is_in_flight = true;
+
+			// Read as Bytes, so that what was Downloaded can be Counted
+			const auto response = co_await cancellable(getAsync(uri), p_cancellation.get());
+			response.EnsureSuccessStatusCode();
+			body = co_await cancellable(response.Content().ReadAsBufferAsync(),
+												 p_cancellation.get());
+
+			json = to_hstring(std::string_view{reinterpret_cast<const char*>(body.data()),
+														  body.Length()});
+			absolute_uri = uri.AbsoluteUri();
+
+			m_request_latency.record(std::chrono::steady_clock::now() - sent_at);
+			m_response_bytes.increment(body.Length());
+			m_requests_succeeded.increment();
+			m_requests_in_flight.add(-1);
+			is_in_flight = false;
 		}
 		catch (...)
 		{
+			json.reset();
 		}
+
+		if (json.has_value())
+		{
+			// Outside the Latency, which is the Upstream's alone
+			// A Throwing Observer must not Change the Outcome, nor Lose the Body
+			if (m_response_observer)
+			{
+				try
+				{
+					m_response_observer(absolute_uri,
+											  std::string_view{reinterpret_cast<const char*>(body.data()),
+																	 body.Length()});
+				}
+				catch (...)
+				{
+				}
+			}
+			co_return json.value();
+		}
+
+		if (p_cancellation != nullptr && p_cancellation->isCancelled())
+			m_requests_cancelled.increment();
+		else
+			m_requests_failed.increment();
+		if (is_in_flight)
+			m_requests_in_flight.add(-1);
 		co_return L"";
 	}
 #endif
@@ -0,0 +1,526 @@
+#include "pch.h"
+#include <TUESL/Numeric/FixedPoint.hxx>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#ifdef TUESL_HAS_X86
+#	include <immintrin.h>
+#endif
+
+namespace TUESL::Numeric
+{
+	namespace
+	{
+		using UInt64 = std::uint64_t;
+
+		constexpr const UInt64 INT64_MAXIMUM = (std::numeric_limits<std::int64_t>::max)();
+		constexpr const UInt64 RATE_SCALE	 = Rate::SCALE;
+
+		// Same as in scaleOuter
+		constexpr const std::size_t TILE_AMOUNTS = 2048;
+
+		template <int Decimals>
+		constexpr UInt64 powerOfTen() noexcept
+		{
+			UInt64 value = 1;
+			for (int i = 0; i < Decimals; ++i)
+				value *= 10;
+			return value;
+		}
+
+		// Exact Parse of [+-]digits[.digits]
+		// Surrounding Spaces are Ignored
+		template <int Decimals>
+		std::optional<std::int64_t> parseDecimal(std::string_view p_text) noexcept
+		{
+			while (!std::empty(p_text) && p_text.front() == ' ')
+				p_text.remove_prefix(1);
+			while (!std::empty(p_text) && p_text.back() == ' ')
+				p_text.remove_suffix(1);
+
+			bool is_negative = false;
+			if (!std::empty(p_text) && (p_text.front() == '-' || p_text.front() == '+'))
+			{
+				is_negative = p_text.front() == '-';
+				p_text.remove_prefix(1);
+			}
+
+			UInt64 units			  = 0;
+			int	 decimals		  = -1;
+			bool	 has_digits	  = false;
+			bool	 should_round_up = false;
+
+			for (const char c : p_text)
+			{
+				if (c == '.')
+				{
+					if (decimals >= 0)
+						return std::nullopt;
+					decimals = 0;
+					continue;
+				}
+				if (c < '0' || c > '9')
+					return std::nullopt;
+
+				has_digits = true;
+
+				// Only the first Digit past the Scale decides the Rounding
+				if (decimals >= Decimals)
+				{
+					if (decimals == Decimals)
+						should_round_up = c >= '5';
+					++decimals;
+					continue;
+				}
+
+				const UInt64 digit = static_cast<UInt64>(c - '0');
+				if (units > (INT64_MAXIMUM - digit) / 10)
+					return std::nullopt;
+
+				units = units * 10 + digit;
+				if (decimals >= 0)
+					++decimals;
+			}
+
+			if (!has_digits)
+				return std::nullopt;
+
+			// Pad the Fraction up to the Scale
+			for (int i = (std::max)(decimals, 0); i < Decimals; ++i)
+			{
+				if (units > INT64_MAXIMUM / 10)
+					return std::nullopt;
+				units *= 10;
+			}
+
+			if (should_round_up)
+			{
+				if (units == INT64_MAXIMUM)
+					return std::nullopt;
+				++units;
+			}
+
+			const auto value = static_cast<std::int64_t>(units);
+			return is_negative ? -value : value;
+		}
+
+		template <int Decimals>
+		std::string formatDecimal(const std::int64_t p_units)
+		{
+			constexpr const UInt64 scale = powerOfTen<Decimals>();
+
+			// Negating in Unsigned so that the Minimum does not Overflow
+			const bool	 is_negative = p_units < 0;
+			const UInt64 magnitude	  = is_negative ? UInt64{0} - static_cast<UInt64>(p_units)
+															  : static_cast<UInt64>(p_units);
+
+			std::string text = std::to_string(magnitude / scale);
+
+			std::string fraction = std::to_string(magnitude % scale);
+			fraction.insert(0, Decimals - std::size(fraction), '0');
+			while (!std::empty(fraction) && fraction.back() == '0')
+				fraction.pop_back();
+
+			if (!std::empty(fraction))
+				text += "." + fraction;
+			if (is_negative)
+				text.insert(0, 1, '-');
+			return text;
+		}
+
+		// 2^50
+		// Below this double Estimates every Result to within 3/4 of a Unit
+		constexpr const UInt64 ESTIMATE_LIMIT = UInt64{1} << 50;
+
+		// Adding 1.5 * 2^52 leaves the Nearest Integer in the low Mantissa Bits
+		// Valid for Magnitudes below 2^51, which ESTIMATE_LIMIT Ensures
+		constexpr const double		 ROUNDING_MAGIC		= 6755399441055744.0;
+		constexpr const std::int64_t ROUNDING_MAGIC_BITS = 0x4338000000000000;
+
+		// Rate Split as Whole * SCALE + Fraction
+		// Computed once per Rate rather than once per Amount
+		struct SplitRate
+		{
+			UInt64 units;
+			UInt64 whole;
+			UInt64 fraction;
+
+			// Amounts up to this Magnitude can never Overflow
+			// As Amount * Rate / SCALE < Amount * (whole + 1)
+			UInt64 safe_magnitude;
+
+			// Amounts up to this Magnitude have a Result below ESTIMATE_LIMIT
+			UInt64 estimate_magnitude;
+			double estimate_factor;
+
+			explicit SplitRate(const Rate p_rate) noexcept :
+				 units{static_cast<UInt64>(p_rate.units)},
+				 whole{units / RATE_SCALE},
+				 fraction{units % RATE_SCALE},
+				 safe_magnitude{INT64_MAXIMUM / (whole + 1)},
+				 estimate_magnitude{ESTIMATE_LIMIT / (whole + 1)},
+				 estimate_factor{static_cast<double>(p_rate.units) / Rate::SCALE}
+			{
+			}
+		};
+
+		// Nearest Integer to p_value for 0 <= p_value < 2^51
+		// No Branch and no Call, unlike llround
+		inline UInt64 roundToNearest(const double p_value) noexcept
+		{
+			const double  shifted = p_value + ROUNDING_MAGIC;
+			std::int64_t bits;
+			std::memcpy(&bits, &shifted, sizeof(bits));
+			return static_cast<UInt64>(bits - ROUNDING_MAGIC_BITS);
+		}
+
+		// Rounds Half Away from Zero given an Estimate within 3/4 of the Exact Quotient
+		// Amount * Rate - estimate * SCALE is then the Exact Remainder within (-SCALE, SCALE)
+		// As such it is Computed Exactly in Wrapping 64 Bit Arithmetic
+		inline UInt64 correctEstimate(const UInt64 p_magnitude,
+												const UInt64 p_rate_units,
+												const UInt64 p_estimate) noexcept
+		{
+			const auto remainder = static_cast<std::int64_t>(p_magnitude * p_rate_units -
+																			 p_estimate * RATE_SCALE);
+
+			// Compares rather than Branches, the Sign of the Remainder is Random
+			return p_estimate + (remainder >= Rate::SCALE / 2) - (remainder < -Rate::SCALE / 2);
+		}
+
+		// Amount * Rate / SCALE with Amount = high * SCALE + low
+		//	= Amount * whole + high * fraction + low * fraction / SCALE
+		// low * fraction < SCALE^2 = 10^18, as such every Term fits in 64 Bits
+		// Only the last Term has a Fraction, it alone is Rounded
+		// Each Step is Checked, as this is taken for Amounts too large to Estimate
+		std::optional<UInt64> multiplyMagnitudeExact(const UInt64		p_magnitude,
+																	const SplitRate& p_rate) noexcept
+		{
+			const UInt64 high = p_magnitude / RATE_SCALE;
+			const UInt64 low	= p_magnitude % RATE_SCALE;
+
+			if (p_magnitude > p_rate.safe_magnitude)
+			{
+				if (p_rate.whole != 0 && p_magnitude > INT64_MAXIMUM / p_rate.whole)
+					return std::nullopt;
+				if (p_rate.fraction != 0 && high > INT64_MAXIMUM / p_rate.fraction)
+					return std::nullopt;
+			}
+
+			const UInt64 low_product = low * p_rate.fraction;
+			const UInt64 rounded		 = low_product / RATE_SCALE +
+											(low_product % RATE_SCALE >= RATE_SCALE / 2 ? 1 : 0);
+
+			// Each Term is at most INT64_MAXIMUM, as such the Sums can not Wrap
+			const UInt64 result = p_magnitude * p_rate.whole + high * p_rate.fraction + rounded;
+			if (result > INT64_MAXIMUM)
+				return std::nullopt;
+			return result;
+		}
+
+		inline std::int64_t convertUnits(const std::int64_t p_units,
+													const SplitRate&	  p_rate,
+													std::size_t&		  p_overflow_count) noexcept
+		{
+			if (p_units == Money::INVALID_UNITS)
+			{
+				++p_overflow_count;
+				return Money::INVALID_UNITS;
+			}
+
+			const bool	 is_negative = p_units < 0;
+			const UInt64 magnitude	  = static_cast<UInt64>(is_negative ? -p_units : p_units);
+
+			UInt64 result;
+			if (magnitude <= p_rate.estimate_magnitude)
+			{
+				// Nearly every Amount takes this Path
+				// Two Integer Multiplies rather than the Five of the Exact Path
+				// Converted through int64, the Conversion from uint64 is a Branch on x64
+				const auto estimate = roundToNearest(
+					 static_cast<double>(static_cast<std::int64_t>(magnitude)) *
+					 p_rate.estimate_factor);
+				result = correctEstimate(magnitude, p_rate.units, estimate);
+			}
+			else
+			{
+				const auto exact = multiplyMagnitudeExact(magnitude, p_rate);
+				if (!exact.has_value())
+				{
+					++p_overflow_count;
+					return Money::INVALID_UNITS;
+				}
+				result = exact.value();
+			}
+
+			// Rounding on the Magnitude is Half Away from Zero for either Sign
+			const auto value = static_cast<std::int64_t>(result);
+			return is_negative ? -value : value;
+		}
+
+		using ConvertKernel = std::size_t (*)(const Money*, std::size_t, Rate, Money*) noexcept;
+
+		ConvertKernel selectConvertKernel() noexcept
+		{
+			if (detectInstructionSet() == InstructionSet::AVX2)
+				return &Kernels::convertAmountsAVX2;
+			return &Kernels::convertAmountsScalar;
+		}
+
+#ifdef TUESL_HAS_X86
+		// Low 64 Bits of p_lhs * p_rhs per Lane
+		// AVX2 only has 32 x 32 Bit Multiplies
+		TUESL_TARGET_AVX2 inline __m256i multiplyLow64(const __m256i p_lhs,
+																	  const __m256i p_rhs) noexcept
+		{
+			const __m256i low_low	= _mm256_mul_epu32(p_lhs, p_rhs);
+			const __m256i low_high	= _mm256_mul_epu32(p_lhs, _mm256_srli_epi64(p_rhs, 32));
+			const __m256i high_low	= _mm256_mul_epu32(_mm256_srli_epi64(p_lhs, 32), p_rhs);
+			const __m256i cross_sum = _mm256_add_epi64(low_high, high_low);
+			return _mm256_add_epi64(low_low, _mm256_slli_epi64(cross_sum, 32));
+		}
+
+		// Same as multiplyLow64 for p_rhs below 2^32
+		TUESL_TARGET_AVX2 inline __m256i multiplyLow64By32(const __m256i p_lhs,
+																			const __m256i p_rhs) noexcept
+		{
+			const __m256i low_low  = _mm256_mul_epu32(p_lhs, p_rhs);
+			const __m256i high_low = _mm256_mul_epu32(_mm256_srli_epi64(p_lhs, 32), p_rhs);
+			return _mm256_add_epi64(low_low, _mm256_slli_epi64(high_low, 32));
+		}
+#endif
+	} // namespace
+
+	std::optional<Money> Money::parse(const std::string_view p_text) noexcept
+	{
+		const auto units = parseDecimal<DECIMALS>(p_text);
+		if (!units.has_value())
+			return std::nullopt;
+		return Money{units.value()};
+	}
+	std::optional<Money> Money::fromDouble(const double p_value) noexcept
+	{
+		if (!std::isfinite(p_value))
+			return std::nullopt;
+
+		const double units = std::round(p_value * SCALE);
+
+		// -2^63 is INVALID_UNITS, as such it is Excluded as well
+		if (units <= -9223372036854775808.0 || units >= 9223372036854775808.0)
+			return std::nullopt;
+		return Money{static_cast<std::int64_t>(units)};
+	}
+	std::string Money::toString() const
+	{
+		return formatDecimal<DECIMALS>(units);
+	}
+
+	std::optional<Rate> Rate::parse(const std::string_view p_text) noexcept
+	{
+		const auto units = parseDecimal<DECIMALS>(p_text);
+		if (!units.has_value() || units.value() < 0)
+			return std::nullopt;
+		return Rate{units.value()};
+	}
+	std::optional<Rate> Rate::fromDouble(const double p_value) noexcept
+	{
+		if (!std::isfinite(p_value) || p_value < 0.0)
+			return std::nullopt;
+
+		const double units = std::round(p_value * SCALE);
+
+		// 2^63 is Exactly Representable, INT64_MAXIMUM is not
+		if (units >= 9223372036854775808.0)
+			return std::nullopt;
+		return Rate{static_cast<std::int64_t>(units)};
+	}
+	std::string Rate::toString() const
+	{
+		return formatDecimal<DECIMALS>(units);
+	}
+	std::optional<Rate> Rate::inverse() const noexcept
+	{
+		if (units <= 0)
+			return std::nullopt;
+
+		// SCALE / (units / SCALE) = SCALE^2 / units
+		// SCALE^2 = 10^18 fits in 64 Bits
+		constexpr const UInt64 SCALE_SQUARED = RATE_SCALE * RATE_SCALE;
+
+		const auto	 divisor	  = static_cast<UInt64>(units);
+		const UInt64 quotient  = SCALE_SQUARED / divisor;
+		const UInt64 remainder = SCALE_SQUARED % divisor;
+
+		// remainder * 2 >= divisor, written so that it can not Overflow
+		const UInt64 rounded = quotient + (remainder >= divisor - remainder ? 1 : 0);
+		return Rate{static_cast<std::int64_t>(rounded)};
+	}
+
+	std::optional<Money> convert(const Money p_amount, const Rate p_rate) noexcept
+	{
+		if (p_rate.units < 0)
+			return std::nullopt;
+
+		std::size_t overflow_count = 0;
+		const auto	units = convertUnits(p_amount.units, SplitRate{p_rate}, overflow_count);
+
+		if (overflow_count != 0)
+			return std::nullopt;
+		return Money{units};
+	}
+
+	std::optional<Rate> chain(const Rate p_first, const Rate p_second) noexcept
+	{
+		if (p_first.units < 0 || p_second.units < 0)
+			return std::nullopt;
+
+		// The same Product as convert, with p_first in place of the Amount
+		const auto units =
+			 multiplyMagnitudeExact(static_cast<UInt64>(p_first.units), SplitRate{p_second});
+		if (!units.has_value())
+			return std::nullopt;
+		return Rate{static_cast<std::int64_t>(units.value())};
+	}
+
+	std::size_t convertAmounts(const Money*		p_amounts,
+										const std::size_t p_count,
+										const Rate			p_rate,
+										Money*				p_output) noexcept
+	{
+		static const ConvertKernel kernel = selectConvertKernel();
+		return kernel(p_amounts, p_count, p_rate, p_output);
+	}
+
+	std::size_t convertOuter(const Money*		p_amounts,
+									 const std::size_t p_amount_count,
+									 const Rate*		p_rates,
+									 const std::size_t p_rate_count,
+									 Money*				p_output) noexcept
+	{
+		static const ConvertKernel kernel = selectConvertKernel();
+
+		std::size_t overflow_count = 0;
+
+		for (std::size_t tile = 0; tile < p_amount_count; tile += TILE_AMOUNTS)
+		{
+			const std::size_t tile_count = (std::min)(TILE_AMOUNTS, p_amount_count - tile);
+
+			for (std::size_t row = 0; row < p_rate_count; ++row)
+				overflow_count += kernel(p_amounts + tile,
+												 tile_count,
+												 p_rates[row],
+												 p_output + row * p_amount_count + tile);
+		}
+		return overflow_count;
+	}
+
+	namespace Kernels
+	{
+		std::size_t convertAmountsScalar(const Money*		p_amounts,
+													const std::size_t p_count,
+													const Rate			p_rate,
+													Money*				p_output) noexcept
+		{
+			if (p_rate.units < 0)
+			{
+				std::fill(p_output, p_output + p_count, Money{Money::INVALID_UNITS});
+				return p_count;
+			}
+
+			const SplitRate rate{p_rate};
+			std::size_t		 overflow_count = 0;
+
+			for (std::size_t i = 0; i < p_count; ++i)
+				p_output[i].units = convertUnits(p_amounts[i].units, rate, overflow_count);
+
+			return overflow_count;
+		}
+
+#ifdef TUESL_HAS_X86
+		// Same Estimate and Correction as convertUnits, 4 Amounts at a Time
+		// Groups holding an Amount past estimate_magnitude are left to convertUnits
+		TUESL_TARGET_AVX2 std::size_t convertAmountsAVX2(const Money*		 p_amounts,
+																		 const std::size_t p_count,
+																		 const Rate			 p_rate,
+																		 Money*				 p_output) noexcept
+		{
+			if (p_rate.units < 0)
+				return convertAmountsScalar(p_amounts, p_count, p_rate, p_output);
+
+			const SplitRate rate{p_rate};
+			std::size_t		 overflow_count = 0;
+
+			const auto* input	= reinterpret_cast<const std::int64_t*>(p_amounts);
+			auto*			output = reinterpret_cast<std::int64_t*>(p_output);
+
+			const __m256i zero			= _mm256_setzero_si256();
+			const __m256i scale			= _mm256_set1_epi64x(Rate::SCALE);
+			const __m256i below_half	= _mm256_set1_epi64x(Rate::SCALE / 2 - 1);
+			const __m256i minus_half	= _mm256_set1_epi64x(-Rate::SCALE / 2);
+			const __m256i rate_units	= _mm256_set1_epi64x(p_rate.units);
+			const __m256i limit			= _mm256_set1_epi64x(
+				  static_cast<std::int64_t>(rate.estimate_magnitude));
+			const __m256d factor		= _mm256_set1_pd(rate.estimate_factor);
+
+			const __m256d magic = _mm256_set1_pd(ROUNDING_MAGIC);
+
+			std::size_t i = 0;
+			for (; i + 4 <= p_count; i += 4)
+			{
+				const __m256i units = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i));
+
+				// |units| without AVX-512
+				const __m256i sign		= _mm256_cmpgt_epi64(zero, units);
+				const __m256i magnitude = _mm256_sub_epi64(_mm256_xor_si256(units, sign), sign);
+
+				// INVALID_UNITS has no Positive Magnitude and is Caught by the second Test
+				const __m256i is_slow = _mm256_or_si256(_mm256_cmpgt_epi64(magnitude, limit),
+																	 _mm256_cmpgt_epi64(zero, magnitude));
+				if (_mm256_movemask_pd(_mm256_castsi256_pd(is_slow)) != 0)
+				{
+					for (std::size_t j = i; j < i + 4; ++j)
+						output[j] = convertUnits(input[j], rate, overflow_count);
+					continue;
+				}
+
+				// Exact as Magnitudes are below 2^51
+				const __m256d magnitude_double = _mm256_sub_pd(
+					 _mm256_castsi256_pd(_mm256_or_si256(magnitude, _mm256_castpd_si256(magic))),
+					 magic);
+
+				const __m256d estimate_double =
+					 _mm256_add_pd(_mm256_mul_pd(magnitude_double, factor), magic);
+				__m256i estimate = _mm256_sub_epi64(_mm256_castpd_si256(estimate_double),
+																_mm256_castpd_si256(magic));
+
+				const __m256i remainder = _mm256_sub_epi64(multiplyLow64(magnitude, rate_units),
+																		 multiplyLow64By32(estimate, scale));
+
+				// Compare Masks are -1, as such Subtracting adds 1
+				const __m256i rounds_up	  = _mm256_cmpgt_epi64(remainder, below_half);
+				const __m256i rounds_down = _mm256_cmpgt_epi64(minus_half, remainder);
+				estimate = _mm256_add_epi64(_mm256_sub_epi64(estimate, rounds_up), rounds_down);
+
+				// Restore the Sign
+				const __m256i result = _mm256_sub_epi64(_mm256_xor_si256(estimate, sign), sign);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), result);
+			}
+
+			for (; i < p_count; ++i)
+				output[i] = convertUnits(input[i], rate, overflow_count);
+
+			return overflow_count;
+		}
+#else
+		std::size_t convertAmountsAVX2(const Money*		 p_amounts,
+												 const std::size_t p_count,
+												 const Rate			 p_rate,
+												 Money*				 p_output) noexcept
+		{
+			return convertAmountsScalar(p_amounts, p_count, p_rate, p_output);
+		}
+#endif
+	} // namespace Kernels
+} // namespace TUESL::Numeric
@@ -0,0 +1,163 @@
+#include "pch.h"
+#include <TUESL/Numeric/HopBoundedPaths.hxx>
+
+#include <TUESL/Numeric/MinPlus.hxx>
+
+#include <algorithm>
+
+namespace TUESL::Numeric
+{
+	HopBoundedPaths::HopBoundedPaths(const std::size_t p_count, const std::size_t p_max_edges) :
+		 m_count{p_count},
+		 m_stride{minPlusStride(p_count)},
+		 m_max_edges{(std::max)(p_max_edges, std::size_t{1})},
+		 m_weights(m_count * m_stride, NO_EDGE),
+		 m_layers(m_max_edges * m_count * m_stride, NO_EDGE)
+	{
+		for (std::size_t i = 0; i < m_count; ++i)
+			m_weights[i * m_stride + i] = 0.0f;
+
+		recompute();
+	}
+
+	float* HopBoundedPaths::layer(const std::size_t p_edges) noexcept
+	{
+		return std::data(m_layers) + (p_edges - 1) * m_count * m_stride;
+	}
+	const float* HopBoundedPaths::layer(const std::size_t p_edges) const noexcept
+	{
+		return std::data(m_layers) + (p_edges - 1) * m_count * m_stride;
+	}
+
+	float HopBoundedPaths::layerAt(const std::size_t p_edges,
+											 const std::size_t p_from,
+											 const std::size_t p_to) const noexcept
+	{
+		if (p_edges == 0)
+			return p_from == p_to ? 0.0f : NO_EDGE;
+		return layer(p_edges)[p_from * m_stride + p_to];
+	}
+
+	void HopBoundedPaths::setWeight(const std::size_t p_from,
+											  const std::size_t p_to,
+											  const float		  p_weight)
+	{
+		if (p_from != p_to)
+			m_weights[p_from * m_stride + p_to] = p_weight;
+	}
+
+	void HopBoundedPaths::recompute()
+	{
+		if (m_count == 0)
+			return;
+
+		std::copy(std::begin(m_weights), std::end(m_weights), layer(1));
+
+		// The Zero Diagonal of the Weights carries every Walk of the previous Layer over
+		// As such Starting from a Copy of it changes nothing but saves a Pass
+		for (std::size_t edges = 2; edges <= m_max_edges; ++edges)
+		{
+			const float* previous = layer(edges - 1);
+			float*		 current	 = layer(edges);
+
+			std::copy(previous, previous + m_count * m_stride, current);
+			minPlusProduct(previous, std::data(m_weights), current, m_count, m_stride);
+		}
+	}
+
+	bool HopBoundedPaths::lowerWeight(const std::size_t p_from,
+												 const std::size_t p_to,
+												 const float		 p_weight)
+	{
+		if (p_from == p_to)
+			return true;
+		if (p_weight > weight(p_from, p_to))
+			return false;
+		if (p_weight == weight(p_from, p_to))
+			return true;
+
+		m_weights[p_from * m_stride + p_to] = p_weight;
+
+		// A Walk of at most h Edges through the Edge is
+		//	at most a Edges to p_from, the Edge, then at most b Edges from p_to
+		// Shorter Layers are never Cheaper, as such only a + b = h - 1 need be Tried
+		// Layers are Updated from the Longest down, so that those Read are still the Old ones
+		for (std::size_t edges = m_max_edges; edges >= 1; --edges)
+		{
+			float* current = layer(edges);
+
+			for (std::size_t before = 0; before < edges; ++before)
+			{
+				const std::size_t after = edges - 1 - before;
+
+				for (std::size_t i = 0; i < m_count; ++i)
+				{
+					const float to_from = layerAt(before, i, p_from);
+					if (to_from == NO_EDGE)
+						continue;
+
+					const float offset = to_from + p_weight;
+					float*		row	 = current + i * m_stride;
+
+					if (after == 0)
+						row[p_to] = (std::min)(row[p_to], offset);
+					else
+						minPlusRow(layer(after) + p_to * m_stride, offset, row, m_stride);
+				}
+			}
+		}
+		return true;
+	}
+
+	std::vector<std::size_t> HopBoundedPaths::path(const std::size_t p_from,
+																  const std::size_t p_to) const
+	{
+		if (distance(p_from, p_to) == NO_EDGE)
+			return {};
+
+		// Walks back from p_to, at each Node either
+		//	Taking the Cheapest last Edge into it, within one Edge less
+		//	or Dropping to the Layer below if that Reaches it as Cheaply without the Edge
+		std::vector<std::size_t> nodes{p_to};
+
+		std::size_t node  = p_to;
+		std::size_t edges = m_max_edges;
+		while (node != p_from)
+		{
+			if (edges == 0)
+				return {};
+
+			float		best		  = NO_EDGE;
+			std::size_t best_node = m_count;
+			for (std::size_t previous = 0; previous < m_count; ++previous)
+			{
+				if (previous == node)
+					continue;
+
+				const float cost =
+					 layerAt(edges - 1, p_from, previous) + weight(previous, node);
+				if (cost < best)
+				{
+					best		 = cost;
+					best_node = previous;
+				}
+			}
+
+			const float without_edge = layerAt(edges - 1, p_from, node);
+			if (without_edge != NO_EDGE && without_edge <= best)
+			{
+				--edges;
+				continue;
+			}
+			if (best_node == m_count)
+				return {};
+
+			nodes.push_back(best_node);
+			node = best_node;
+			--edges;
+		}
+
+		std::reverse(std::begin(nodes), std::end(nodes));
+		return nodes;
+	}
+} // namespace TUESL::Numeric
@@ -0,0 +1,179 @@
+#include "pch.h"
+#include <TUESL/Numeric/MinPlus.hxx>
+
+#include <algorithm>
+#include <limits>
+
+#ifdef TUESL_HAS_X86
+#	include <immintrin.h>
+#endif
+
+namespace TUESL::Numeric
+{
+	namespace
+	{
+		constexpr const float INFINITE = std::numeric_limits<float>::infinity();
+
+		// Columns of p_c per Tile
+		// 8 Vectors, as such a Tile of a Row of p_c stays in Registers across the whole Depth
+		constexpr const std::size_t TILE_COLUMNS = 64;
+		// Rows of p_b per Tile
+		// 64 x 64 Floats is 16 KiB, well within L1
+		constexpr const std::size_t TILE_DEPTH = 64;
+
+		using ProductKernel =
+			 void (*)(const float*, const float*, float*, std::size_t, std::size_t) noexcept;
+
+		ProductKernel selectProductKernel() noexcept
+		{
+			if (detectInstructionSet() == InstructionSet::AVX2)
+				return &Kernels::minPlusProductAVX2;
+			return &Kernels::minPlusProductScalar;
+		}
+	} // namespace
+
+	void minPlusProduct(const float*		  p_a,
+							  const float*		  p_b,
+							  float*				  p_c,
+							  const std::size_t p_count,
+							  const std::size_t p_stride) noexcept
+	{
+		static const ProductKernel kernel = selectProductKernel();
+		kernel(p_a, p_b, p_c, p_count, p_stride);
+	}
+
+	void minPlusRow(const float*		 p_other,
+						 const float		 p_offset,
+						 float*				 p_row,
+						 const std::size_t p_stride) noexcept
+	{
+		// A Single Pass over one Row, left to the Compiler to Vectorise
+		for (std::size_t j = 0; j < p_stride; ++j)
+		{
+			const float candidate = p_offset + p_other[j];
+			p_row[j]					 = candidate < p_row[j] ? candidate : p_row[j];
+		}
+	}
+
+	namespace Kernels
+	{
+		void minPlusProductScalar(const float*		  p_a,
+										  const float*		  p_b,
+										  float*				  p_c,
+										  const std::size_t p_count,
+										  const std::size_t p_stride) noexcept
+		{
+			for (std::size_t tile_column = 0; tile_column < p_stride; tile_column += TILE_COLUMNS)
+			{
+				const std::size_t columns = (std::min)(TILE_COLUMNS, p_stride - tile_column);
+
+				for (std::size_t tile_depth = 0; tile_depth < p_count; tile_depth += TILE_DEPTH)
+				{
+					const std::size_t depth = (std::min)(TILE_DEPTH, p_count - tile_depth);
+
+					for (std::size_t i = 0; i < p_count; ++i)
+					{
+						const float* a = p_a + i * p_stride + tile_depth;
+						float*		 c = p_c + i * p_stride + tile_column;
+
+						for (std::size_t k = 0; k < depth; ++k)
+						{
+							// Most Pairs have no Edge, nothing can come of them
+							if (a[k] == INFINITE)
+								continue;
+
+							const float* b = p_b + (tile_depth + k) * p_stride + tile_column;
+							for (std::size_t j = 0; j < columns; ++j)
+							{
+								const float candidate = a[k] + b[j];
+								c[j]						 = candidate < c[j] ? candidate : c[j];
+							}
+						}
+					}
+				}
+			}
+		}
+
+#ifdef TUESL_HAS_X86
+		TUESL_TARGET_AVX2 void minPlusProductAVX2(const float*		  p_a,
+																const float*		  p_b,
+																float*				  p_c,
+																const std::size_t p_count,
+																const std::size_t p_stride) noexcept
+		{
+			constexpr const std::size_t TILE_VECTORS = TILE_COLUMNS / MIN_PLUS_LANES;
+
+			for (std::size_t tile_column = 0; tile_column < p_stride; tile_column += TILE_COLUMNS)
+			{
+				const std::size_t columns = (std::min)(TILE_COLUMNS, p_stride - tile_column);
+
+				for (std::size_t tile_depth = 0; tile_depth < p_count; tile_depth += TILE_DEPTH)
+				{
+					const std::size_t depth = (std::min)(TILE_DEPTH, p_count - tile_depth);
+
+					for (std::size_t i = 0; i < p_count; ++i)
+					{
+						const float* a = p_a + i * p_stride + tile_depth;
+						float*		 c = p_c + i * p_stride + tile_column;
+
+						if (columns == TILE_COLUMNS)
+						{
+							// The whole Tile of the Row is Held in Registers
+							// Loaded and Stored once per Tile rather than once per k
+							__m256 row[TILE_VECTORS];
+							for (std::size_t v = 0; v < TILE_VECTORS; ++v)
+								row[v] = _mm256_loadu_ps(c + v * MIN_PLUS_LANES);
+
+							for (std::size_t k = 0; k < depth; ++k)
+							{
+								if (a[k] == INFINITE)
+									continue;
+
+								const __m256 offset = _mm256_set1_ps(a[k]);
+								const float* b = p_b + (tile_depth + k) * p_stride + tile_column;
+
+								// Operands in this Order, as the Second is Returned on a Tie
+								// The same as the Scalar Kernel
+								for (std::size_t v = 0; v < TILE_VECTORS; ++v)
+									row[v] = _mm256_min_ps(
+										 _mm256_add_ps(offset, _mm256_loadu_ps(b + v * MIN_PLUS_LANES)),
+										 row[v]);
+							}
+
+							for (std::size_t v = 0; v < TILE_VECTORS; ++v)
+								_mm256_storeu_ps(c + v * MIN_PLUS_LANES, row[v]);
+						}
+						else
+						{
+							// Last Tile of a Row, Narrower than TILE_COLUMNS
+							for (std::size_t k = 0; k < depth; ++k)
+							{
+								if (a[k] == INFINITE)
+									continue;
+
+								const __m256 offset = _mm256_set1_ps(a[k]);
+								const float* b = p_b + (tile_depth + k) * p_stride + tile_column;
+
+								for (std::size_t j = 0; j < columns; j += MIN_PLUS_LANES)
+									_mm256_storeu_ps(
+										 c + j,
+										 _mm256_min_ps(_mm256_add_ps(offset, _mm256_loadu_ps(b + j)),
+															_mm256_loadu_ps(c + j)));
+							}
+						}
+					}
+				}
+			}
+		}
+#else
+		void minPlusProductAVX2(const float*		p_a,
+										const float*		p_b,
+										float*				p_c,
+										const std::size_t p_count,
+										const std::size_t p_stride) noexcept
+		{
+			minPlusProductScalar(p_a, p_b, p_c, p_count, p_stride);
+		}
+#endif
+	} // namespace Kernels
+} // namespace TUESL::Numeric
@@ -0,0 +1,152 @@
+#include "pch.h"
+#include <TUESL/Numeric/VectorKernels.hxx>
+
+#include <algorithm>
+
+#ifdef TUESL_HAS_X86
+#	include <immintrin.h>
+#	if defined(_MSC_VER)
+#		include <intrin.h>
+#	endif
+#endif
+
+namespace TUESL::Numeric
+{
+	namespace
+	{
+		// Amounts per Tile in scaleOuter
+		// 16 KiB of Input, well within L1 alongside the Output being Written
+		constexpr const std::size_t TILE_AMOUNTS = 2048;
+
+#ifdef TUESL_HAS_X86
+		bool isAVX2Supported() noexcept
+		{
+#	if defined(_MSC_VER)
+			int info[4]{};
+
+			__cpuid(info, 0);
+			if (info[0] < 7)
+				return false;
+
+			__cpuid(info, 1);
+			const bool has_osxsave = (info[2] & (1 << 27)) != 0;
+			const bool has_avx	  = (info[2] & (1 << 28)) != 0;
+			if (!has_osxsave || !has_avx)
+				return false;
+
+			// XMM and YMM State must both be Saved by the OS
+			if ((_xgetbv(0) & 0x6) != 0x6)
+				return false;
+
+			__cpuidex(info, 7, 0);
+			return (info[1] & (1 << 5)) != 0;
+#	else
+			return __builtin_cpu_supports("avx2");
+#	endif
+		}
+#endif
+
+		using ScaleKernel = void (*)(const double*, std::size_t, double, double*) noexcept;
+
+		ScaleKernel selectScaleKernel() noexcept
+		{
+			if (detectInstructionSet() == InstructionSet::AVX2)
+				return &Kernels::scaleAVX2;
+			return &Kernels::scaleScalar;
+		}
+	} // namespace
+
+	InstructionSet detectInstructionSet() noexcept
+	{
+#ifdef TUESL_HAS_X86
+		static const InstructionSet instruction_set =
+			 isAVX2Supported() ? InstructionSet::AVX2 : InstructionSet::SCALAR;
+		return instruction_set;
+#else
+		return InstructionSet::SCALAR;
+#endif
+	}
+
+	void scale(const double*		p_input,
+				  const std::size_t p_count,
+				  const double			p_factor,
+				  double*				p_output) noexcept
+	{
+		static const ScaleKernel kernel = selectScaleKernel();
+		kernel(p_input, p_count, p_factor, p_output);
+	}
+
+	void scaleOuter(const double*		  p_amounts,
+						 const std::size_t p_amount_count,
+						 const double*		  p_factors,
+						 const std::size_t p_factor_count,
+						 double*				  p_output) noexcept
+	{
+		static const ScaleKernel kernel = selectScaleKernel();
+
+		for (std::size_t tile = 0; tile < p_amount_count; tile += TILE_AMOUNTS)
+		{
+			const std::size_t tile_count = (std::min)(TILE_AMOUNTS, p_amount_count - tile);
+
+			for (std::size_t row = 0; row < p_factor_count; ++row)
+				kernel(p_amounts + tile,
+						 tile_count,
+						 p_factors[row],
+						 p_output + row * p_amount_count + tile);
+		}
+	}
+
+	namespace Kernels
+	{
+		void scaleScalar(const double*	  p_input,
+							  const std::size_t p_count,
+							  const double		  p_factor,
+							  double*			  p_output) noexcept
+		{
+			for (std::size_t i = 0; i < p_count; ++i)
+				p_output[i] = p_input[i] * p_factor;
+		}
+
+#ifdef TUESL_HAS_X86
+		TUESL_TARGET_AVX2 void scaleAVX2(const double*		p_input,
+													const std::size_t p_count,
+													const double		p_factor,
+													double*				p_output) noexcept
+		{
+			const __m256d factor = _mm256_set1_pd(p_factor);
+
+			std::size_t i = 0;
+
+			// 4 Independent Vectors per Iteration
+			// Keeps both Multiply Ports Busy
+			for (; i + 16 <= p_count; i += 16)
+			{
+				const __m256d a = _mm256_loadu_pd(p_input + i);
+				const __m256d b = _mm256_loadu_pd(p_input + i + 4);
+				const __m256d c = _mm256_loadu_pd(p_input + i + 8);
+				const __m256d d = _mm256_loadu_pd(p_input + i + 12);
+
+				_mm256_storeu_pd(p_output + i, _mm256_mul_pd(a, factor));
+				_mm256_storeu_pd(p_output + i + 4, _mm256_mul_pd(b, factor));
+				_mm256_storeu_pd(p_output + i + 8, _mm256_mul_pd(c, factor));
+				_mm256_storeu_pd(p_output + i + 12, _mm256_mul_pd(d, factor));
+			}
+			for (; i + 4 <= p_count; i += 4)
+				_mm256_storeu_pd(p_output + i,
+									  _mm256_mul_pd(_mm256_loadu_pd(p_input + i), factor));
+
+			// Remaining Amounts are not worth a Masked Load
+			for (; i < p_count; ++i)
+				p_output[i] = p_input[i] * p_factor;
+		}
+#else
+		void scaleAVX2(const double*		p_input,
+							const std::size_t p_count,
+							const double		p_factor,
+							double*				p_output) noexcept
+		{
+			scaleScalar(p_input, p_count, p_factor, p_output);
+		}
+#endif
+	} // namespace Kernels
+} // namespace TUESL::Numeric
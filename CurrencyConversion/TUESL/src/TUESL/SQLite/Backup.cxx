@@ -0,0 +1,44 @@
+#include "pch.h"
+#include <TUESL/SQLite/Backup.hxx>
+
+namespace TUESL::SQLite
+{
+	Backup::Backup(Database& p_destination, Database& p_source) :
+		 m_backup{sqlite3_backup_init(p_destination.getDatabaseRAWHandle(),
+												"main",
+												p_source.getDatabaseRAWHandle(),
+												"main")}
+	{
+		// On Failure the Error is Left on the Destination
+		if (m_backup.empty())
+			throw SQLiteException(sqlite3_errcode(p_destination.getDatabaseRAWHandle()));
+	}
+	bool Backup::step(const int p_pages)
+	{
+		if (m_is_complete)
+			return true;
+
+		const auto result = sqlite3_backup_step(m_backup.get(), p_pages);
+
+		switch (result)
+		{
+			case SQLITE_DONE:
+				m_is_complete = true;
+				return true;
+			case SQLITE_OK:
+			case SQLITE_BUSY:
+			case SQLITE_LOCKED:
+				return false;
+			default:
+				throw SQLiteException(result);
+		}
+	}
+	int Backup::remainingPages() const noexcept
+	{
+		return sqlite3_backup_remaining(m_backup.get());
+	}
+	int Backup::pageCount() const noexcept
+	{
+		return sqlite3_backup_pagecount(m_backup.get());
+	}
+} // namespace TUESL::SQLite
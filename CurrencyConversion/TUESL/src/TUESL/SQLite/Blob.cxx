@@ -0,0 +1,65 @@
+#include "pch.h"
+#include <TUESL/SQLite/Blob.hxx>
+
+#include <limits>
+#include <string>
+
+namespace TUESL::SQLite
+{
+	namespace
+	{
+		// Offsets and Sizes are int to SQLite
+		int toInt(const std::size_t p_value)
+		{
+			if (p_value > static_cast<std::size_t>((std::numeric_limits<int>::max)()))
+				throw SQLiteException(SQLITE_TOOBIG);
+			return static_cast<int>(p_value);
+		}
+	} // namespace
+
+	Blob::Blob(Database&					p_db,
+				  const std::string_view p_table,
+				  const std::string_view p_column,
+				  const DataTypes::Int64 p_rowid,
+				  const Mode				p_mode)
+	{
+		const std::string table{p_table};
+		const std::string column{p_column};
+
+		const auto result = sqlite3_blob_open(p_db.getDatabaseRAWHandle(),
+														  "main",
+														  table.c_str(),
+														  column.c_str(),
+														  p_rowid,
+														  p_mode == Mode::READ_WRITE ? 1 : 0,
+														  m_blob.getAddressOf());
+
+		if (result != SQLITE_OK)
+			throw SQLiteException(result);
+	}
+	void Blob::reopen(const DataTypes::Int64 p_rowid)
+	{
+		// On Failure the Blob is Aborted, and every later Call Fails as well
+		const auto result = sqlite3_blob_reopen(m_blob.get(), p_rowid);
+		if (result != SQLITE_OK)
+			throw SQLiteException(result);
+	}
+	std::size_t Blob::size() const noexcept
+	{
+		return static_cast<std::size_t>(sqlite3_blob_bytes(m_blob.get()));
+	}
+	void Blob::read(const std::size_t p_offset, void* p_buffer, const std::size_t p_size)
+	{
+		const auto result =
+			 sqlite3_blob_read(m_blob.get(), p_buffer, toInt(p_size), toInt(p_offset));
+		if (result != SQLITE_OK)
+			throw SQLiteException(result);
+	}
+	void Blob::write(const std::size_t p_offset, const void* p_data, const std::size_t p_size)
+	{
+		const auto result =
+			 sqlite3_blob_write(m_blob.get(), p_data, toInt(p_size), toInt(p_offset));
+		if (result != SQLITE_OK)
+			throw SQLiteException(result);
+	}
+} // namespace TUESL::SQLite
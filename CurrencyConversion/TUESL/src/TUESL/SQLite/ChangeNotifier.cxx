@@ -0,0 +1,192 @@
+#include "pch.h"
+#include <TUESL/SQLite/ChangeNotifier.hxx>
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+namespace TUESL::SQLite
+{
+	namespace
+	{
+		ChangeOperation toChangeOperation(const int p_operation) noexcept
+		{
+			switch (p_operation)
+			{
+				case SQLITE_INSERT:
+					return ChangeOperation::INSERTED;
+				case SQLITE_DELETE:
+					return ChangeOperation::DELETED;
+				default:
+					return ChangeOperation::UPDATED;
+			}
+		}
+	} // namespace
+
+	ChangeNotifier::~ChangeNotifier()
+	{
+		removeHooks();
+	}
+	void ChangeNotifier::onUpdate(void*				  p_notifier,
+											const int		  p_operation,
+											const char*		  p_database_name,
+											const char*		  p_table_name,
+											const sqlite3_int64 p_rowid)
+	{
+		// Temporary and Attached Databases are not Tracked
+		if (std::strcmp(p_database_name, "main") != 0)
+			return;
+
+		auto* notifier = static_cast<ChangeNotifier*>(p_notifier);
+
+		std::lock_guard<std::mutex> lock{notifier->m_mutex};
+		notifier->m_pending.push_back(
+			 ChangeEvent{p_table_name, p_rowid, toChangeOperation(p_operation)});
+	}
+	int ChangeNotifier::onCommit(void* p_notifier)
+	{
+		auto* notifier = static_cast<ChangeNotifier*>(p_notifier);
+
+		std::lock_guard<std::mutex> lock{notifier->m_mutex};
+
+		if (!std::empty(notifier->m_pending))
+		{
+			auto& committed = notifier->m_committed;
+			committed.insert(std::end(committed),
+								  std::make_move_iterator(std::begin(notifier->m_pending)),
+								  std::make_move_iterator(std::end(notifier->m_pending)));
+			notifier->m_pending.clear();
+
+			notifier->m_has_committed.store(true, std::memory_order_release);
+		}
+
+		// Non Zero would turn the Commit into a Rollback
+		return 0;
+	}
+	void ChangeNotifier::onRollback(void* p_notifier)
+	{
+		auto* notifier = static_cast<ChangeNotifier*>(p_notifier);
+
+		std::lock_guard<std::mutex> lock{notifier->m_mutex};
+		notifier->m_pending.clear();
+	}
+	void ChangeNotifier::installHooks() noexcept
+	{
+		if (m_db == nullptr)
+			return;
+
+		sqlite3_update_hook(m_db, &ChangeNotifier::onUpdate, this);
+		sqlite3_commit_hook(m_db, &ChangeNotifier::onCommit, this);
+		sqlite3_rollback_hook(m_db, &ChangeNotifier::onRollback, this);
+	}
+	void ChangeNotifier::removeHooks() noexcept
+	{
+		if (m_db == nullptr)
+			return;
+
+		sqlite3_update_hook(m_db, nullptr, nullptr);
+		sqlite3_commit_hook(m_db, nullptr, nullptr);
+		sqlite3_rollback_hook(m_db, nullptr, nullptr);
+	}
+	void ChangeNotifier::attach(sqlite3* p_db)
+	{
+		removeHooks();
+
+		bool has_subscriptions;
+		{
+			std::lock_guard<std::mutex> lock{m_mutex};
+			m_db = p_db;
+			m_pending.clear();
+			m_committed.clear();
+			m_has_committed.store(false, std::memory_order_relaxed);
+
+			has_subscriptions = !std::empty(m_subscriptions);
+		}
+
+		// Hooks only cost anything once someone Listens
+		if (has_subscriptions)
+			installHooks();
+	}
+	SubscriptionID ChangeNotifier::subscribe(const std::string_view p_table,
+														  ChangeListener			p_listener)
+	{
+		bool is_first = false;
+		SubscriptionID id;
+		{
+			std::lock_guard<std::mutex> lock{m_mutex};
+
+			id			= m_next_id++;
+			is_first = std::empty(m_subscriptions);
+
+			m_subscriptions.push_back(std::make_shared<const Subscription>(
+				 Subscription{id, std::string{p_table}, std::move(p_listener)}));
+		}
+
+		// Installed outside the Lock
+		// As the Hooks themselves take it with the Connection Locked
+		if (is_first)
+			installHooks();
+
+		return id;
+	}
+	void ChangeNotifier::unsubscribe(const SubscriptionID p_id)
+	{
+		bool is_last = false;
+		{
+			std::lock_guard<std::mutex> lock{m_mutex};
+
+			auto& subscriptions = m_subscriptions;
+			const auto it		  = std::find_if(
+				  std::begin(subscriptions), std::end(subscriptions), [&](const auto& p_subscription) {
+					  return p_subscription->id == p_id;
+				  });
+			if (it == std::end(subscriptions))
+				return;
+
+			subscriptions.erase(it);
+			is_last = std::empty(subscriptions);
+		}
+
+		if (is_last)
+			removeHooks();
+	}
+	void ChangeNotifier::dispatch() noexcept
+	{
+		if (!m_has_committed.load(std::memory_order_acquire))
+			return;
+
+		std::vector<ChangeEvent>								events;
+		std::vector<std::shared_ptr<const Subscription>> subscriptions;
+		{
+			std::lock_guard<std::mutex> lock{m_mutex};
+
+			events.swap(m_committed);
+			subscriptions = m_subscriptions;
+			m_has_committed.store(false, std::memory_order_relaxed);
+		}
+
+		if (std::empty(events))
+			return;
+
+		std::vector<ChangeEvent> table_events;
+		for (const auto& subscription : subscriptions)
+		{
+			if (std::empty(subscription->table))
+			{
+				subscription->listener(events);
+				continue;
+			}
+
+			table_events.clear();
+			std::copy_if(std::begin(events),
+							 std::end(events),
+							 std::back_inserter(table_events),
+							 [&](const ChangeEvent& p_event) {
+								 return p_event.table == subscription->table;
+							 });
+
+			if (!std::empty(table_events))
+				subscription->listener(table_events);
+		}
+	}
+} // namespace TUESL::SQLite
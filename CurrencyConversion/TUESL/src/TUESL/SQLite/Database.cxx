@@ -1,8 +1,40 @@
 #include "pch.h"
 #include <TUESL/SQLite/Database.hxx>
 
+#include <memory>
+
 namespace TUESL::SQLite
 {
+	namespace
+	{
+		void callScalarFunction(sqlite3_context* p_context,
+										int					p_argument_count,
+										sqlite3_value**  p_arguments)
+		{
+			auto& function = *static_cast<ScalarFunction*>(sqlite3_user_data(p_context));
+
+			FunctionContext context{p_context, p_argument_count, p_arguments};
+
+			// Exceptions must not Unwind through SQLite
+			try
+			{
+				function(context);
+			}
+			catch (const std::exception& p_exception)
+			{
+				context.setError(p_exception.what());
+			}
+			catch (...)
+			{
+				context.setError("Function Failed");
+			}
+		}
+		void destroyScalarFunction(void* p_function)
+		{
+			delete static_cast<ScalarFunction*>(p_function);
+		}
+	} // namespace
+
 	Database& Database::open(const std::string_view p_file_name, const int p_flags)
 	{
 		if (std::empty(p_file_name))
@@ -19,8 +51,15 @@ namespace TUESL::SQLite
 		if (result != SQLITE_OK)
 			throw SQLiteException(result);
 
+		// Off the previous Connection while it is still Open, as Assigning Closes it
+		if (m_change_notifier)
+			m_change_notifier->attach(nullptr);
+
 		m_db = std::move(local);
 
+		if (m_change_notifier)
+			m_change_notifier->attach(m_db.get());
+
 		return *this;
 	}
 	Database& Database::transactionBegin()
@@ -49,9 +88,97 @@ namespace TUESL::SQLite
 				 sqlite3_exec(m_db.get(), std::data(p_sql), nullptr, nullptr, nullptr);
 			if (result != SQLITE_OK)
 				throw SQLiteException(result);
+
+			// Covers transactionEnd
+			if (sqlite3_get_autocommit(m_db.get()) != 0)
+				dispatchChanges();
 		}
 		return *this;
 	}
+	Database& Database::createFunction(const std::string_view p_name,
+												  const int				  p_argument_count,
+												  ScalarFunction			  p_function,
+												  const int				  p_flags)
+	{
+		if (std::empty(m_db))
+			return *this;
+
+		const std::string name{p_name};
+
+		// SQLite Owns the Function from here on, even if Registration Fails
+		// It is Destroyed when Replaced or when the Connection Closes
+		auto function = std::make_unique<ScalarFunction>(std::move(p_function));
+
+		const auto result = sqlite3_create_function_v2(m_db.get(),
+																	  name.c_str(),
+																	  p_argument_count,
+																	  p_flags,
+																	  function.release(),
+																	  &callScalarFunction,
+																	  nullptr,
+																	  nullptr,
+																	  &destroyScalarFunction);
+		if (result != SQLITE_OK)
+			throw SQLiteException(result);
+
+		return *this;
+	}
+	Database& Database::createEponymousTable(const std::string_view p_name,
+														  const std::string_view p_columns,
+														  RowSource				  p_rows)
+	{
+		if (std::empty(m_db))
+			return *this;
+
+		const std::string name{p_name};
+
+		// SQLite Owns the Definition from here on, even if Registration Fails
+		auto definition = std::make_unique<VirtualTable::Definition>(
+			 VirtualTable::Definition{std::string{p_columns}, std::move(p_rows)});
+
+		const auto result = sqlite3_create_module_v2(m_db.get(),
+																	name.c_str(),
+																	&VirtualTable::rowSourceModule(),
+																	definition.release(),
+																	&VirtualTable::destroyDefinition);
+		if (result != SQLITE_OK)
+			throw SQLiteException(result);
+
+		return *this;
+	}
+	SubscriptionID Database::subscribe(const std::string_view p_table,
+												  ChangeListener			 p_listener)
+	{
+		return m_change_notifier->subscribe(p_table, std::move(p_listener));
+	}
+	void Database::unsubscribe(const SubscriptionID p_id)
+	{
+		if (m_change_notifier)
+			m_change_notifier->unsubscribe(p_id);
+	}
+	void Database::dispatchChanges() noexcept
+	{
+		if (m_change_notifier)
+			m_change_notifier->dispatch();
+	}
+	int Database::noOfRowsModified() const noexcept
+	{
+		if (std::empty(m_db))
+			return 0;
+		return sqlite3_changes(m_db.get());
+	}
+	DataTypes::Int64 Database::lastInsertRowID() const noexcept
+	{
+		if (std::empty(m_db))
+			return 0;
+		return sqlite3_last_insert_rowid(m_db.get());
+	}
+	int Database::noOfTotalRowsModified() const noexcept
+	{
+		if (std::empty(m_db))
+			return 0;
+		return sqlite3_total_changes(m_db.get());
+	}
 	inline int Database::errorCode() const noexcept
 	{
 		return sqlite3_errcode(m_db.get());
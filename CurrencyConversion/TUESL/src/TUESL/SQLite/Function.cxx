@@ -0,0 +1,91 @@
+#include "pch.h"
+#include <TUESL/SQLite/Function.hxx>
+
+namespace TUESL::SQLite
+{
+	sqlite3_value* FunctionContext::argument(const Index p_index) const noexcept
+	{
+		if (p_index >= static_cast<Index>(m_argument_count))
+			return nullptr;
+		return m_arguments[p_index];
+	}
+	int FunctionContext::getType(const Index p_index) const noexcept
+	{
+		const auto value = argument(p_index);
+		if (value == nullptr)
+			return SQLITE_NULL;
+		return sqlite3_value_type(value);
+	}
+	std::optional<double> FunctionContext::getDouble(const Index p_index) const noexcept
+	{
+		if (isNull(p_index))
+			return std::nullopt;
+		return sqlite3_value_double(argument(p_index));
+	}
+	std::optional<DataTypes::Int64>
+		 FunctionContext::getInt64(const Index p_index) const noexcept
+	{
+		if (isNull(p_index))
+			return std::nullopt;
+		return sqlite3_value_int64(argument(p_index));
+	}
+	std::optional<std::string> FunctionContext::getString(const Index p_index) const
+	{
+		if (isNull(p_index))
+			return std::nullopt;
+
+		const auto value = argument(p_index);
+		const auto text	= sqlite3_value_text(value);
+
+		if (text == nullptr)
+			return std::nullopt;
+
+		// Length is taken after the Text, as Fetching it may Convert the Value
+		return std::string{reinterpret_cast<const char*>(text),
+								 static_cast<std::size_t>(sqlite3_value_bytes(value))};
+	}
+	std::optional<std::wstring> FunctionContext::getWString(const Index p_index) const
+	{
+		// Verify if wchar_t is 16 Bit or Not
+		// If it's not, then issue a static_assert
+		static_assert(sizeof(std::wstring::value_type) == 2,
+						  "Error Occured. wchar_t must be a 16-bit type to use with SQLite");
+
+		if (isNull(p_index))
+			return std::nullopt;
+
+		const auto value = argument(p_index);
+		const auto text	= sqlite3_value_text16(value);
+
+		if (text == nullptr)
+			return std::nullopt;
+
+		return std::wstring{reinterpret_cast<const wchar_t*>(text),
+								  static_cast<std::size_t>(sqlite3_value_bytes16(value)) /
+										sizeof(wchar_t)};
+	}
+	void FunctionContext::setResult(const double p_value) noexcept
+	{
+		sqlite3_result_double(m_context, p_value);
+	}
+	void FunctionContext::setResult(const DataTypes::Int64 p_value) noexcept
+	{
+		sqlite3_result_int64(m_context, p_value);
+	}
+	void FunctionContext::setResult(const std::string_view p_value) noexcept
+	{
+		sqlite3_result_text(m_context,
+								  std::data(p_value),
+								  static_cast<int>(std::size(p_value)),
+								  SQLITE_TRANSIENT);
+	}
+	void FunctionContext::setNull() noexcept
+	{
+		sqlite3_result_null(m_context);
+	}
+	void FunctionContext::setError(const std::string_view p_message) noexcept
+	{
+		sqlite3_result_error(
+			 m_context, std::data(p_message), static_cast<int>(std::size(p_message)));
+	}
+} // namespace TUESL::SQLite
@@ -0,0 +1,93 @@
+#include "pch.h"
+#include <TUESL/SQLite/PagedCursor.hxx>
+
+#include <stdexcept>
+
+namespace TUESL::SQLite
+{
+	namespace
+	{
+		// a, b, c
+		std::string joinColumns(const std::vector<std::string>& p_columns)
+		{
+			std::string joined;
+			for (const auto& column : p_columns)
+			{
+				if (!std::empty(joined))
+					joined += ", ";
+				joined += column;
+			}
+			return joined;
+		}
+	} // namespace
+
+	std::string pageSQL(const PagedQuery& p_query, const bool p_is_first_page)
+	{
+		const auto keys = joinColumns(p_query.key_columns);
+
+		// The Page Size is an Integer, as such Formatting it into the SQL is Safe
+		std::string sql = "SELECT " + p_query.columns + ", " + keys + " FROM " + p_query.table;
+		if (!p_is_first_page)
+		{
+			sql += " WHERE (" + keys + ") > (?";
+			for (std::size_t i = 1; i < std::size(p_query.key_columns); ++i)
+				sql += ", ?";
+			sql += ")";
+		}
+		sql += " ORDER BY " + keys + " LIMIT " + std::to_string(p_query.page_size) + ";";
+
+		return sql;
+	}
+
+	KeysetPager::KeysetPager(Database& p_db, PagedQuery p_query) :
+		 m_db{p_db}, m_query{std::move(p_query)}
+	{
+		if (std::empty(m_query.key_columns))
+			throw std::invalid_argument("Pages need a Key to Resume after");
+		if (m_query.page_size == 0)
+			throw std::invalid_argument("Pages must hold at least one Row");
+	}
+
+	std::size_t KeysetPager::readPage(const std::function<void(PrepareStatement&)>& p_read_row)
+	{
+		if (m_is_done)
+			return 0;
+
+		const auto key_count = std::size(m_query.key_columns);
+
+		const auto is_first_page = std::empty(m_last_key);
+		auto&		  ps				= is_first_page ? m_first_page : m_next_page;
+
+		if (!ps.noOfColumns().has_value())
+			ps.prepare(m_db, pageSQL(m_query, is_first_page));
+		else
+			ps.restart();
+
+		for (std::size_t i = 0; i < std::size(m_last_key); ++i)
+			ps.bind(i + 1, m_last_key[i]);
+
+		std::size_t rows = 0;
+		while (ps.hasNext())
+		{
+			p_read_row(ps);
+
+			// Only the last Row of a Full Page is Resumed after
+			// as such the Key is not Copied for any other
+			if (++rows == m_query.page_size)
+			{
+				const auto columns	= static_cast<std::size_t>(ps.noOfColumns().value());
+				const auto first_key = columns - key_count;
+
+				std::vector<Handler::Value> last_key;
+				for (std::size_t i = 0; i < key_count; ++i)
+					last_key.push_back(ps.getValue(first_key + i));
+				m_last_key = std::move(last_key);
+			}
+		}
+
+		if (rows < m_query.page_size)
+			m_is_done = true;
+
+		return rows;
+	}
+} // namespace TUESL::SQLite
@@ -1,8 +1,18 @@
 #include "pch.h"
 #include <TUESL/SQLite/PrepareStatement.hxx>
 
+#include <TUESL/Utility/Transcode.hxx>
+
+#include <stdexcept>
+
 namespace TUESL::SQLite
 {
+	namespace
+	{
+		// Text up to this Long is Transcoded on the Stack before it is Bound
+		constexpr const std::size_t BIND_STACK_BYTES = 512;
+	} // namespace
+
 	inline void PrepareStatement::verify(const int result_code) const
 	{
 		if (result_code != SQLITE_OK)
@@ -29,6 +39,12 @@ namespace TUESL::SQLite
 		else
 			m_get_cur_index = p_get_cur_index;
 	}
+	inline void PrepareStatement::dispatchChangesIfCommitted() noexcept
+	{
+		// Outside of a Transaction every Completed Statement has Committed
+		if (m_db != nullptr && sqlite3_get_autocommit(m_db->getDatabaseRAWHandle()) != 0)
+			m_db->dispatchChanges();
+	}
 	bool PrepareStatement::checkTableExistence(Database&					p_db,
 															 const std::string_view p_tbl_name)
 	{
@@ -57,6 +73,8 @@ namespace TUESL::SQLite
 
 		verify(result_code);
 
+		m_db = &p_db;
+
 		// Minimum Value of Index
 		m_bind_cur_index = 1;
 		m_get_cur_index  = 0;
@@ -67,27 +85,12 @@ namespace TUESL::SQLite
 	PrepareStatement& PrepareStatement::prepare(Database&					  p_db,
 															  const std::wstring_view p_sql)
 	{
-		// Verify if wchar_t is 2 Byte or Not
-		// If it's not, then issue a static_assert
-		static_assert(sizeof(std::wstring_view::value_type) == 2,
-						  "Error Occured. wchar_t must be a 16-bit type to use with SQLite");
-
-		if (m_stmt.hasValue())
-			reset();
-
-		const auto result_code = sqlite3_prepare16_v2(p_db.getDatabaseRAWHandle(),
-																	 std::data(p_sql),
-																	 static_cast<int>(std::size(p_sql)),
-																	 m_stmt.getAddressOf(),
-																	 nullptr);
+		// SQLite Compiles UTF-8, sqlite3_prepare16_v2 would only Convert it first
+		const auto sql = Utility::toUTF8(p_sql);
+		if (!sql.has_value())
+			throw std::invalid_argument("SQL is not Valid UTF-16");
 
-		verify(result_code);
-
-		// Minimum Value of Index
-		m_bind_cur_index = 1;
-		m_get_cur_index  = 0;
-
-		return *this;
+		return prepare(p_db, sql.value());
 	}
 
 	inline std::string PrepareStatement::getPrepareSQLStatement() noexcept
@@ -101,16 +104,31 @@ namespace TUESL::SQLite
 		if (std::empty(m_stmt))
 			return;
 
-		const auto reset_code = sqlite3_reset(m_stmt.get());
-		verify(reset_code);
+		// The Error of the last Step is Returned again here, as it is by sqlite3_finalize
+		// It was already Thrown by that Step, as such it is not an Error of reset
+		sqlite3_reset(m_stmt.get());
+
+		// Finalizes the Statement, its Bindings go with it
+		// Releasing it instead Leaked one Compiled Statement per prepare
+		m_stmt.reset();
+
+		// Minimum Value of Index
+		m_bind_cur_index = 1;
+		m_get_cur_index  = 0;
+	}
+
+	void PrepareStatement::restart()
+	{
+		if (std::empty(m_stmt))
+			return;
+
+		// The Error of the last Step is Returned again here
+		// It was already Thrown by that Step, as such it is not an Error of restart
+		sqlite3_reset(m_stmt.get());
 
-		// sqlite3_reset does not clear Bindings!
 		const auto clear_binding_code = sqlite3_clear_bindings(m_stmt.get());
 		verify(clear_binding_code);
 
-		// Release Statements so its Nulled and can be reused
-		m_stmt.release();
-
 		// Minimum Value of Index
 		m_bind_cur_index = 1;
 		m_get_cur_index  = 0;
@@ -123,6 +141,13 @@ namespace TUESL::SQLite
 		return sqlite3_stmt_readonly(m_stmt.get());
 	}
 
+	int PrepareStatement::status(const int p_counter, const bool p_reset) noexcept
+	{
+		if (std::empty(m_stmt))
+			return 0;
+		return sqlite3_stmt_status(m_stmt.get(), p_counter, p_reset ? 1 : 0);
+	}
+
 	std::optional<int> PrepareStatement::noOfColumns() noexcept
 	{
 		// If No Statements exist, this returns -1
@@ -147,6 +172,7 @@ namespace TUESL::SQLite
 		if (result_code == SQLITE_DONE)
 		{
 			m_get_cur_index = 0;
+			dispatchChangesIfCommitted();
 			return false;
 		}
 		else
@@ -171,6 +197,9 @@ namespace TUESL::SQLite
 
 		const int result_code = sqlite3_step(m_stmt.get());
 
+		if (result_code == SQLITE_DONE)
+			dispatchChangesIfCommitted();
+
 		if (result_code == SQLITE_ROW || result_code == SQLITE_DONE)
 			return *this; // As these Indicate Success
 		else
@@ -228,44 +257,73 @@ namespace TUESL::SQLite
 		const std::string text = reinterpret_cast<const char*>(value);
 		return text;
 	}
-	std::optional<std::wstring> PrepareStatement::getWString(const Index p_index) noexcept
+	std::optional<std::string_view>
+		 PrepareStatement::getStringView(const Index p_index) noexcept
 	{
-		// Verify if wchar_t is 16 Bit or Not
-		// If it's not, then issue a static_assert
-		static_assert(Utility::size_in_bytes<std::wstring_view::value_type> == 16,
-						  "Error Occurred. wchar_t must be a 16-bit type to use with SQLite");
-
 		if (std::empty(m_stmt) || p_index < 0)
 			return std::nullopt;
 
-		const auto value = sqlite3_column_text16(m_stmt.get(), static_cast<int>(p_index));
+		const auto value = sqlite3_column_text(m_stmt.get(), static_cast<int>(p_index));
 
 		if (value == nullptr)
 			return std::nullopt;
 
 		incrementCurrentGetIndex(p_index);
 
-		const std::wstring text = reinterpret_cast<const wchar_t*>(value);
-		return text;
+		// Length is taken after the Text, as Fetching it may Convert the Value
+		return std::string_view{
+			 reinterpret_cast<const char*>(value),
+			 static_cast<std::size_t>(sqlite3_column_bytes(m_stmt.get(), static_cast<int>(p_index)))};
+	}
+	std::optional<std::pmr::string>
+		 PrepareStatement::getString(const Index p_index, std::pmr::memory_resource* p_resource)
+	{
+		const auto text = getStringView(p_index);
+
+		if (!text.has_value())
+			return std::nullopt;
+
+		return std::pmr::string{text.value(), p_resource};
+	}
+	std::optional<std::wstring> PrepareStatement::getWString(const Index p_index) noexcept
+	{
+		// Verify if wchar_t is 16 Bit or Not
+		// If it's not, then issue a static_assert
+		static_assert(Utility::size_in_bytes<std::wstring_view::value_type> == 16,
+						  "Error Occurred. wchar_t must be a 16-bit type to use with SQLite");
+
+		// Read as Stored rather than through sqlite3_column_text16
+		// Which would Convert it and keep the Converted Copy alongside
+		const auto text = getStringView(p_index);
+
+		if (!text.has_value())
+			return std::nullopt;
+
+		return Utility::toUTF16(text.value());
 	}
 #ifdef TUESL_USING_CPP_WINRT
 	std::optional<winrt::hstring>
 		 PrepareStatement::getHString(const Index p_index) noexcept
 	{
-		if (std::empty(m_stmt) || p_index < 0)
-			return std::nullopt;
+		const auto text = getStringView(p_index);
 
-		const auto value = sqlite3_column_text16(m_stmt.get(), static_cast<int>(p_index));
-
-		if (value == nullptr)
+		if (!text.has_value())
 			return std::nullopt;
 
+		return Utility::toHString(text.value());
+	}
+#endif
+	Handler::Value PrepareStatement::getValue(const Index p_index) noexcept
+	{
+		if (std::empty(m_stmt))
+			return Handler::Value{};
+
 		incrementCurrentGetIndex(p_index);
 
-		const winrt::hstring text = reinterpret_cast<const wchar_t*>(value);
-		return text;
+		// Column Values are Unprotected and only Valid until the next Step
+		return Handler::Value{
+			 sqlite3_value_dup(sqlite3_column_value(m_stmt.get(), static_cast<int>(p_index)))};
 	}
-#endif
 	inline int PrepareStatement::getNoOfColumns() noexcept
 	{
 		return sqlite3_data_count(m_stmt.get());
@@ -299,26 +357,29 @@ namespace TUESL::SQLite
 	PrepareStatement& PrepareStatement::bind(const Index				  p_index,
 														  const std::wstring_view p_value)
 	{
-		// Verify if wchar_t is 16 Bit or Not
-		// If it's not, then issue a static_assert
-		static_assert(sizeof(std::wstring_view::value_type) == 2,
-						  "Error Occured. wchar_t must be a 16-bit type to use with SQLite");
-
 		// If It is Empty, what is it that has to be binded
 		// Minimum Value of Index is 1
 		if (std::empty(m_stmt) || p_index < 1)
 			return *this;
 
-		const auto result_code = sqlite3_bind_text16(m_stmt.get(),
-																	static_cast<int>(p_index),
-																	std::data(p_value),
-																	-1,
-																	SQLITE_STATIC);
-		verify(result_code);
+		// Bound as UTF-8, which the Database Stores, as such SQLite Converts nothing
+		// The UTF-8 Copy is Bound Transient, so it need not outlive this Call
+		char		  stack_buffer[BIND_STACK_BYTES];
+		std::string heap_buffer;
 
-		incrementCurrentBindIndex(p_index);
+		const auto capacity = Utility::maxUTF8Length(std::size(p_value));
+		auto*		  buffer	 = stack_buffer;
+		if (capacity > BIND_STACK_BYTES)
+		{
+			heap_buffer.resize(capacity);
+			buffer = std::data(heap_buffer);
+		}
 
-		return *this;
+		const auto result = Utility::utf16ToUTF8(p_value, buffer, capacity);
+		if (result.status != Utility::TranscodeStatus::DONE)
+			throw std::invalid_argument("Text is not Valid UTF-16");
+
+		return bind(p_index, std::string_view{buffer, result.written});
 	}
 	PrepareStatement& PrepareStatement::bind(const Index p_index, const double p_value)
 	{
@@ -391,6 +452,25 @@ namespace TUESL::SQLite
 
 		incrementCurrentBindIndex(p_index);
 
+		return *this;
+	}
+	PrepareStatement& PrepareStatement::bind(const Index p_index, const Handler::Value& p_value)
+	{
+		// If It is Empty, what is it that has to be binded
+		// Minimum Value of Index is 1
+		if (m_stmt.empty() || p_index < 1)
+			return *this;
+
+		// getValue only Returns Empty when SQLite could not Copy the Column
+		if (p_value.empty())
+			throw SQLiteException(SQLITE_NOMEM);
+
+		const auto result_code =
+			 sqlite3_bind_value(m_stmt.get(), static_cast<int>(p_index), p_value.get());
+		verify(result_code);
+
+		incrementCurrentBindIndex(p_index);
+
 		return *this;
 	}
 } // namespace TUESL::SQLite
\ No newline at end of file
@@ -0,0 +1,212 @@
+#include "pch.h"
+#include <TUESL/SQLite/QueryPlan.hxx>
+
+#include <TUESL/SQLite/PrepareStatement.hxx>
+
+#include <map>
+#include <stdexcept>
+
+namespace TUESL::SQLite
+{
+	namespace
+	{
+		bool startsWith(const std::string_view p_text, const std::string_view p_prefix) noexcept
+		{
+			return p_text.substr(0, std::size(p_prefix)) == p_prefix;
+		}
+
+		std::string_view trim(std::string_view p_text) noexcept
+		{
+			while (!std::empty(p_text) && (p_text.front() == ' ' || p_text.front() == '\t'))
+				p_text.remove_prefix(1);
+			while (!std::empty(p_text) &&
+					 (p_text.back() == ' ' || p_text.back() == '\t' || p_text.back() == '\r'))
+				p_text.remove_suffix(1);
+			return p_text;
+		}
+
+		// Scans are told apart by what they Scan alone
+		// SQLite Picks whichever Covering Index is Smallest, which is no Regression
+		std::string guardedKey(const std::string_view p_step)
+		{
+			if (!isFullScan(p_step))
+				return std::string{p_step};
+
+			const auto end = p_step.find(' ', std::size(std::string_view{"SCAN "}));
+			return std::string{p_step.substr(0, end)};
+		}
+
+		// Steps a Baseline must already have, by how often they Occur
+		std::map<std::string, std::size_t> guardedSteps(const StatementPlan& p_plan)
+		{
+			std::map<std::string, std::size_t> steps;
+			for (const auto& step : p_plan.steps)
+			{
+				if (isFullScan(step) || isTempBTree(step))
+					++steps[guardedKey(step)];
+			}
+			return steps;
+		}
+	} // namespace
+
+	std::string normalizePlanStep(const std::string_view p_detail)
+	{
+		const auto detail = trim(p_detail);
+
+		for (const std::string_view verb : {"SCAN ", "SEARCH "})
+		{
+			if (startsWith(detail, verb) && startsWith(detail.substr(std::size(verb)), "TABLE "))
+				return std::string{verb} + std::string{detail.substr(std::size(verb) + 6)};
+		}
+		return std::string{detail};
+	}
+
+	bool isFullScan(const std::string_view p_step) noexcept
+	{
+		return startsWith(p_step, "SCAN ") && !startsWith(p_step, "SCAN CONSTANT ROW") &&
+				 !startsWith(p_step, "SCAN SUBQUERY") && !startsWith(p_step, "SCAN (");
+	}
+
+	bool isTempBTree(const std::string_view p_step) noexcept
+	{
+		return p_step.find("TEMP B-TREE") != std::string_view::npos;
+	}
+
+	std::vector<std::string> explainQueryPlan(Database& p_db, const std::string_view p_sql)
+	{
+		PrepareStatement ps{p_db, "EXPLAIN QUERY PLAN " + std::string{p_sql}};
+
+		// Each Row is id, parent, notused and detail
+		std::vector<std::string> steps;
+		while (ps.hasNext())
+			steps.push_back(normalizePlanStep(ps.get<std::string>(3).value_or("")));
+		return steps;
+	}
+
+	void QueryPlanGuard::registerStatement(std::string p_name, std::string p_sql)
+	{
+		if (std::empty(p_name) || p_name.find_first_of("[]\r\n") != std::string::npos)
+			throw std::invalid_argument("Statement Names must be a Single Line without Brackets");
+
+		for (const auto& statement : m_statements)
+		{
+			if (statement.name == p_name)
+				throw std::invalid_argument("Statement " + p_name + " is already Registered");
+		}
+
+		m_statements.push_back(Statement{std::move(p_name), std::move(p_sql)});
+	}
+
+	std::vector<StatementPlan> QueryPlanGuard::capture(Database& p_db) const
+	{
+		std::vector<StatementPlan> plans;
+		plans.reserve(std::size(m_statements));
+
+		for (const auto& statement : m_statements)
+			plans.push_back(StatementPlan{statement.name, explainQueryPlan(p_db, statement.sql)});
+		return plans;
+	}
+
+	std::vector<StatementCounters> QueryPlanGuard::measure(Database& p_db) const
+	{
+		std::vector<StatementCounters> counters;
+
+		for (const auto& statement : m_statements)
+		{
+			PrepareStatement ps{p_db, statement.sql};
+			if (!ps.isReadOnly())
+				continue;
+
+			StatementCounters counter;
+			counter.name = statement.name;
+			while (ps.hasNext())
+				++counter.rows;
+
+			counter.full_scan_steps = ps.status(SQLITE_STMTSTATUS_FULLSCAN_STEP);
+			counter.sorts				= ps.status(SQLITE_STMTSTATUS_SORT);
+			counter.auto_index_rows = ps.status(SQLITE_STMTSTATUS_AUTOINDEX);
+			counter.vm_steps			= ps.status(SQLITE_STMTSTATUS_VM_STEP);
+
+			counters.push_back(std::move(counter));
+		}
+		return counters;
+	}
+
+	std::vector<PlanRegression>
+		 QueryPlanGuard::compare(const std::vector<StatementPlan>& p_baseline,
+										 const std::vector<StatementPlan>& p_current)
+	{
+		std::map<std::string_view, const StatementPlan*> baseline;
+		for (const auto& plan : p_baseline)
+			baseline[plan.name] = &plan;
+
+		std::vector<PlanRegression> regressions;
+		for (const auto& plan : p_current)
+		{
+			const auto it = baseline.find(plan.name);
+
+			auto allowed = it == std::end(baseline) ? std::map<std::string, std::size_t>{}
+																 : guardedSteps(*it->second);
+
+			// A Step the Baseline has once is only Allowed once
+			for (const auto& step : plan.steps)
+			{
+				if (!isFullScan(step) && !isTempBTree(step))
+					continue;
+
+				auto& count = allowed[guardedKey(step)];
+				if (count == 0)
+					regressions.push_back(PlanRegression{plan.name, step});
+				else
+					--count;
+			}
+		}
+		return regressions;
+	}
+
+	std::string QueryPlanGuard::serialize(const std::vector<StatementPlan>& p_plans)
+	{
+		std::string text;
+		for (const auto& plan : p_plans)
+		{
+			if (!std::empty(text))
+				text += '\n';
+
+			text += '[' + plan.name + "]\n";
+			for (const auto& step : plan.steps)
+				text += step + '\n';
+		}
+		return text;
+	}
+
+	std::vector<StatementPlan> QueryPlanGuard::parse(const std::string_view p_text)
+	{
+		std::vector<StatementPlan> plans;
+
+		std::size_t begin = 0;
+		while (begin < std::size(p_text))
+		{
+			auto end = p_text.find('\n', begin);
+			if (end == std::string_view::npos)
+				end = std::size(p_text);
+
+			const auto line = trim(p_text.substr(begin, end - begin));
+			begin				 = end + 1;
+
+			if (std::empty(line) || line.front() == '#')
+				continue;
+
+			if (line.front() == '[' && line.back() == ']')
+			{
+				plans.push_back(StatementPlan{std::string{line.substr(1, std::size(line) - 2)}, {}});
+				continue;
+			}
+
+			if (std::empty(plans))
+				throw std::invalid_argument("Step of a Query Plan before the Name of its Statement");
+
+			plans.back().steps.push_back(normalizePlanStep(line));
+		}
+		return plans;
+	}
+} // namespace TUESL::SQLite
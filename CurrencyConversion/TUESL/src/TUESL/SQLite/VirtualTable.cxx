@@ -0,0 +1,281 @@
+#include "pch.h"
+#include <TUESL/SQLite/VirtualTable.hxx>
+
+#include <algorithm>
+#include <cstring>
+#include <exception>
+#include <new>
+
+namespace TUESL::SQLite::VirtualTable
+{
+	namespace
+	{
+		// SQLite expects its own Struct as the first Member
+		struct Table
+		{
+			sqlite3_vtab		base;
+			const Definition* definition;
+		};
+		struct Cursor
+		{
+			sqlite3_vtab_cursor base;
+			std::vector<Row>	  rows;
+			std::size_t			  position;
+		};
+
+		void setErrorMessage(sqlite3_vtab* p_table, const char* p_message) noexcept
+		{
+			sqlite3_free(p_table->zErrMsg);
+			p_table->zErrMsg = sqlite3_mprintf("%s", p_message);
+		}
+
+		// False only if p_value can not Equal p_argument
+		// Values of differing Types are left for SQLite to Compare with Affinity
+		bool mayEqual(const Value& p_value, sqlite3_value* p_argument) noexcept
+		{
+			const auto type = sqlite3_value_type(p_argument);
+
+			// x = NULL is never True
+			if (type == SQLITE_NULL)
+				return false;
+
+			if (const auto text = std::get_if<std::string>(&p_value);
+				 text != nullptr && type == SQLITE_TEXT)
+			{
+				const auto argument = sqlite3_value_text(p_argument);
+				const auto length	  = static_cast<std::size_t>(sqlite3_value_bytes(p_argument));
+				return std::size(*text) == length &&
+						 std::memcmp(std::data(*text), argument, length) == 0;
+			}
+			if (const auto integer = std::get_if<DataTypes::Int64>(&p_value);
+				 integer != nullptr && type == SQLITE_INTEGER)
+				return *integer == sqlite3_value_int64(p_argument);
+
+			if (const auto real = std::get_if<double>(&p_value);
+				 real != nullptr && type == SQLITE_FLOAT)
+				return *real == sqlite3_value_double(p_argument);
+
+			return true;
+		}
+
+		int connect(sqlite3*				p_db,
+						void*					p_client_data,
+						int,
+						const char* const*,
+						sqlite3_vtab** p_table,
+						char**)
+		{
+			const auto* definition = static_cast<const Definition*>(p_client_data);
+
+			// The Table Name within the Declaration is Ignored by SQLite
+			const std::string sql = "CREATE TABLE x(" + definition->columns + ");";
+
+			const auto result_code = sqlite3_declare_vtab(p_db, sql.c_str());
+			if (result_code != SQLITE_OK)
+				return result_code;
+
+			auto* table = new (std::nothrow) Table{};
+			if (table == nullptr)
+				return SQLITE_NOMEM;
+
+			table->definition = definition;
+			*p_table			   = &table->base;
+			return SQLITE_OK;
+		}
+		int disconnect(sqlite3_vtab* p_table)
+		{
+			auto* table = reinterpret_cast<Table*>(p_table);
+			sqlite3_free(table->base.zErrMsg);
+			delete table;
+			return SQLITE_OK;
+		}
+
+		// Takes the first Usable Equality Constraint per Column
+		// idxNum is the Mask of Constrained Columns
+		// Their Values are Passed to filter in Column Order
+		int bestIndex(sqlite3_vtab*, sqlite3_index_info* p_info)
+		{
+			int constraint_of_column[MAX_INDEXED_COLUMNS];
+			std::fill(std::begin(constraint_of_column), std::end(constraint_of_column), -1);
+
+			for (int i = 0; i < p_info->nConstraint; ++i)
+			{
+				const auto& constraint = p_info->aConstraint[i];
+
+				if (!constraint.usable || constraint.op != SQLITE_INDEX_CONSTRAINT_EQ ||
+					 constraint.iColumn < 0 || constraint.iColumn >= MAX_INDEXED_COLUMNS)
+					continue;
+
+				if (constraint_of_column[constraint.iColumn] < 0)
+					constraint_of_column[constraint.iColumn] = i;
+			}
+
+			int mask			  = 0;
+			int argument_index = 0;
+			for (int column = 0; column < MAX_INDEXED_COLUMNS; ++column)
+			{
+				const int constraint = constraint_of_column[column];
+				if (constraint < 0)
+					continue;
+
+				mask |= 1 << column;
+				p_info->aConstraintUsage[constraint].argvIndex = ++argument_index;
+				// SQLite still Checks the Constraint
+				// As filter Compares without Affinity
+				p_info->aConstraintUsage[constraint].omit = 0;
+			}
+
+			p_info->idxNum = mask;
+
+			// Every Constraint narrows the Scan, which the Planner should prefer
+			p_info->estimatedCost = 1000.0 / (1 << (std::min)(argument_index, 8));
+			p_info->estimatedRows = 1000 >> (std::min)(argument_index, 8);
+			return SQLITE_OK;
+		}
+
+		int open(sqlite3_vtab*, sqlite3_vtab_cursor** p_cursor)
+		{
+			auto* cursor = new (std::nothrow) Cursor{};
+			if (cursor == nullptr)
+				return SQLITE_NOMEM;
+
+			*p_cursor = &cursor->base;
+			return SQLITE_OK;
+		}
+		int close(sqlite3_vtab_cursor* p_cursor)
+		{
+			delete reinterpret_cast<Cursor*>(p_cursor);
+			return SQLITE_OK;
+		}
+
+		int filter(sqlite3_vtab_cursor* p_cursor,
+					  int						p_mask,
+					  const char*,
+					  int						p_argument_count,
+					  sqlite3_value**		p_arguments)
+		{
+			auto*	cursor = reinterpret_cast<Cursor*>(p_cursor);
+			auto* table	 = reinterpret_cast<Table*>(p_cursor->pVtab);
+
+			try
+			{
+				cursor->rows = table->definition->rows();
+			}
+			catch (const std::exception& p_exception)
+			{
+				setErrorMessage(&table->base, p_exception.what());
+				return SQLITE_ERROR;
+			}
+			catch (...)
+			{
+				setErrorMessage(&table->base, "Rows could not be Obtained");
+				return SQLITE_ERROR;
+			}
+
+			cursor->position = 0;
+
+			static const Value null_value{};
+
+			int argument_index = 0;
+			for (int column = 0; column < MAX_INDEXED_COLUMNS && argument_index < p_argument_count;
+				  ++column)
+			{
+				if ((p_mask & (1 << column)) == 0)
+					continue;
+
+				const auto	   index	  = static_cast<std::size_t>(column);
+				sqlite3_value* argument = p_arguments[argument_index++];
+
+				auto& rows = cursor->rows;
+				rows.erase(std::remove_if(std::begin(rows),
+												  std::end(rows),
+												  [&](const Row& p_row) {
+													  return !mayEqual(
+															index < std::size(p_row) ? p_row[index] : null_value,
+															argument);
+												  }),
+							  std::end(rows));
+			}
+			return SQLITE_OK;
+		}
+		int next(sqlite3_vtab_cursor* p_cursor)
+		{
+			reinterpret_cast<Cursor*>(p_cursor)->position += 1;
+			return SQLITE_OK;
+		}
+		int eof(sqlite3_vtab_cursor* p_cursor)
+		{
+			const auto* cursor = reinterpret_cast<Cursor*>(p_cursor);
+			return cursor->position >= std::size(cursor->rows);
+		}
+		int column(sqlite3_vtab_cursor* p_cursor, sqlite3_context* p_context, int p_column)
+		{
+			const auto* cursor = reinterpret_cast<Cursor*>(p_cursor);
+			const auto& row	 = cursor->rows[cursor->position];
+
+			if (p_column < 0 || static_cast<std::size_t>(p_column) >= std::size(row))
+			{
+				sqlite3_result_null(p_context);
+				return SQLITE_OK;
+			}
+
+			std::visit(
+				 [&](const auto& p_value) {
+					 using Type = std::decay_t<decltype(p_value)>;
+
+					 if constexpr (std::is_same_v<Type, DataTypes::Int64>)
+						 sqlite3_result_int64(p_context, p_value);
+					 else if constexpr (std::is_same_v<Type, double>)
+						 sqlite3_result_double(p_context, p_value);
+					 else if constexpr (std::is_same_v<Type, std::string>)
+						 sqlite3_result_text(p_context,
+													std::data(p_value),
+													static_cast<int>(std::size(p_value)),
+													SQLITE_TRANSIENT);
+					 else
+						 sqlite3_result_null(p_context);
+				 },
+				 row[static_cast<std::size_t>(p_column)]);
+
+			return SQLITE_OK;
+		}
+		int rowid(sqlite3_vtab_cursor* p_cursor, sqlite3_int64* p_rowid)
+		{
+			*p_rowid = static_cast<sqlite3_int64>(reinterpret_cast<Cursor*>(p_cursor)->position);
+			return SQLITE_OK;
+		}
+
+		sqlite3_module makeModule() noexcept
+		{
+			sqlite3_module module{};
+
+			// Without xCreate and xDestroy the Table is Eponymous Only
+			// CREATE VIRTUAL TABLE ... USING it is Rejected
+			module.iVersion	 = 1;
+			module.xCreate		 = nullptr;
+			module.xConnect	 = &connect;
+			module.xBestIndex	 = &bestIndex;
+			module.xDisconnect = &disconnect;
+			module.xDestroy	 = nullptr;
+			module.xOpen		 = &open;
+			module.xClose		 = &close;
+			module.xFilter		 = &filter;
+			module.xNext		 = &next;
+			module.xEof			 = &eof;
+			module.xColumn		 = &column;
+			module.xRowid		 = &rowid;
+
+			return module;
+		}
+	} // namespace
+
+	const sqlite3_module& rowSourceModule() noexcept
+	{
+		static const sqlite3_module module = makeModule();
+		return module;
+	}
+	void destroyDefinition(void* p_definition) noexcept
+	{
+		delete static_cast<Definition*>(p_definition);
+	}
+} // namespace TUESL::SQLite::VirtualTable
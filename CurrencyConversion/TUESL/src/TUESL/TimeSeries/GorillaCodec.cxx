@@ -0,0 +1,315 @@
+#include "pch.h"
+#include <TUESL/TimeSeries/GorillaCodec.hxx>
+
+#include <cstring>
+
+#ifdef _MSC_VER
+#	include <intrin.h>
+#endif
+
+namespace TUESL::TimeSeries
+{
+	namespace
+	{
+		// Both are only called with a Non Zero Value
+		inline int countLeadingZeros(const std::uint64_t p_value) noexcept
+		{
+#if defined(_MSC_VER) && defined(_M_X64)
+			unsigned long index = 0;
+			_BitScanReverse64(&index, p_value);
+			return 63 - static_cast<int>(index);
+#elif defined(__GNUC__)
+			return __builtin_clzll(p_value);
+#else
+			int count = 0;
+			for (std::uint64_t mask = 1ull << 63; (p_value & mask) == 0; mask >>= 1)
+				++count;
+			return count;
+#endif
+		}
+		inline int countTrailingZeros(const std::uint64_t p_value) noexcept
+		{
+#if defined(_MSC_VER) && defined(_M_X64)
+			unsigned long index = 0;
+			_BitScanForward64(&index, p_value);
+			return static_cast<int>(index);
+#elif defined(__GNUC__)
+			return __builtin_ctzll(p_value);
+#else
+			int count = 0;
+			for (std::uint64_t mask = 1; (p_value & mask) == 0; mask <<= 1)
+				++count;
+			return count;
+#endif
+		}
+
+		inline std::uint64_t toBits(const double p_value) noexcept
+		{
+			std::uint64_t bits;
+			std::memcpy(&bits, &p_value, sizeof(bits));
+			return bits;
+		}
+		inline double fromBits(const std::uint64_t p_bits) noexcept
+		{
+			double value;
+			std::memcpy(&value, &p_bits, sizeof(value));
+			return value;
+		}
+
+		// Delta of Delta Buckets
+		// Each Bucket is a Prefix of 1s terminated by a 0
+		// followed by the Delta of Delta in that many Bits
+		struct TimeBucket
+		{
+			std::int64_t  minimum;
+			std::int64_t  maximum;
+			int			  bits;
+			std::uint64_t prefix;
+			int			  prefix_bits;
+		};
+		constexpr const TimeBucket TIME_BUCKETS[] = {
+			 {-63, 64, 7, 0b10, 2},
+			 {-255, 256, 9, 0b110, 3},
+			 {-2047, 2048, 12, 0b1110, 4},
+			 {-2147483647ll, 2147483648ll, 32, 0b11110, 5},
+		};
+		// Anything larger is written in Full after this Prefix
+		constexpr const std::uint64_t TIME_PREFIX_FULL		= 0b11111;
+		constexpr const int			  TIME_PREFIX_FULL_BITS = 5;
+
+		// Leading Zeros are stored in 5 Bits
+		constexpr const int MAX_LEADING_ZEROS = 31;
+	} // namespace
+
+	void BitWriter::writeBit(const bool p_bit)
+	{
+		const auto byte_index = m_bit_length / 8;
+		if (byte_index == std::size(m_bytes))
+			m_bytes.push_back(std::byte{0});
+
+		if (p_bit)
+		{
+			const auto mask = static_cast<unsigned char>(0x80u >> (m_bit_length % 8));
+			m_bytes[byte_index] |= std::byte{mask};
+		}
+
+		++m_bit_length;
+	}
+	void BitWriter::writeBits(const std::uint64_t p_value, const int p_count)
+	{
+		for (int bit = p_count - 1; bit >= 0; --bit)
+			writeBit(((p_value >> bit) & 1u) != 0);
+	}
+
+	bool BitReader::readBit() noexcept
+	{
+		if (m_position >= m_bit_length)
+		{
+			m_overrun = true;
+			return false;
+		}
+
+		const auto byte = static_cast<unsigned char>(m_data[m_position / 8]);
+		const bool bit	 = ((byte >> (7 - (m_position % 8))) & 1u) != 0;
+
+		++m_position;
+		return bit;
+	}
+	std::uint64_t BitReader::readBits(const int p_count) noexcept
+	{
+		std::uint64_t value = 0;
+		for (int i = 0; i < p_count; ++i)
+			value = (value << 1) | (readBit() ? 1u : 0u);
+		return value;
+	}
+
+	void GorillaEncoder::reset() noexcept
+	{
+		m_writer.clear();
+
+		m_count		 = 0;
+		m_first_time = 0;
+		m_last_time	 = 0;
+		m_last_delta = 0;
+
+		m_last_value_bits = 0;
+		m_last_leading		= -1;
+		m_last_trailing	= 0;
+	}
+	void GorillaEncoder::append(const Sample& p_sample)
+	{
+		if (m_count == 0)
+		{
+			// First Sample is Stored in Full
+			m_writer.writeBits(static_cast<std::uint64_t>(p_sample.time), 64);
+			m_writer.writeBits(toBits(p_sample.value), 64);
+
+			m_first_time		= p_sample.time;
+			m_last_time			= p_sample.time;
+			m_last_value_bits = toBits(p_sample.value);
+		}
+		else
+		{
+			encodeTime(p_sample.time);
+			encodeValue(p_sample.value);
+		}
+
+		++m_count;
+	}
+	void GorillaEncoder::encodeTime(const std::int64_t p_time)
+	{
+		const std::int64_t delta			  = p_time - m_last_time;
+		const std::int64_t delta_of_delta = delta - m_last_delta;
+
+		m_last_time	 = p_time;
+		m_last_delta = delta;
+
+		// Regularly Spaced Samples cost a Single Bit
+		if (delta_of_delta == 0)
+		{
+			m_writer.writeBit(false);
+			return;
+		}
+
+		for (const auto& bucket : TIME_BUCKETS)
+		{
+			if (delta_of_delta >= bucket.minimum && delta_of_delta <= bucket.maximum)
+			{
+				m_writer.writeBits(bucket.prefix, bucket.prefix_bits);
+				// Biased so that the Stored Value is never Negative
+				m_writer.writeBits(static_cast<std::uint64_t>(delta_of_delta - bucket.minimum),
+										 bucket.bits);
+				return;
+			}
+		}
+
+		m_writer.writeBits(TIME_PREFIX_FULL, TIME_PREFIX_FULL_BITS);
+		m_writer.writeBits(static_cast<std::uint64_t>(delta_of_delta), 64);
+	}
+	void GorillaEncoder::encodeValue(const double p_value)
+	{
+		const std::uint64_t value_bits = toBits(p_value);
+		const std::uint64_t xor_bits	 = value_bits ^ m_last_value_bits;
+
+		m_last_value_bits = value_bits;
+
+		// Unchanged Values cost a Single Bit
+		if (xor_bits == 0)
+		{
+			m_writer.writeBit(false);
+			return;
+		}
+		m_writer.writeBit(true);
+
+		int leading = countLeadingZeros(xor_bits);
+		if (leading > MAX_LEADING_ZEROS)
+			leading = MAX_LEADING_ZEROS;
+		const int trailing = countTrailingZeros(xor_bits);
+
+		// Reuse the Previous Window if the Meaningful Bits fit inside it
+		if (m_last_leading >= 0 && leading >= m_last_leading && trailing >= m_last_trailing)
+		{
+			m_writer.writeBit(false);
+
+			const int meaningful = 64 - m_last_leading - m_last_trailing;
+			m_writer.writeBits(xor_bits >> m_last_trailing, meaningful);
+			return;
+		}
+
+		const int meaningful = 64 - leading - trailing;
+
+		m_writer.writeBit(true);
+		m_writer.writeBits(static_cast<std::uint64_t>(leading), 5);
+		// 1 to 64 stored as 0 to 63
+		m_writer.writeBits(static_cast<std::uint64_t>(meaningful - 1), 6);
+		m_writer.writeBits(xor_bits >> trailing, meaningful);
+
+		m_last_leading	 = leading;
+		m_last_trailing = trailing;
+	}
+
+	bool GorillaDecoder::next(Sample& p_sample) noexcept
+	{
+		if (m_remaining == 0)
+			return false;
+
+		if (m_is_first)
+		{
+			m_last_time			= static_cast<std::int64_t>(m_reader.readBits(64));
+			m_last_value_bits = m_reader.readBits(64);
+			m_is_first			= false;
+
+			p_sample = Sample{m_last_time, fromBits(m_last_value_bits)};
+		}
+		else
+		{
+			const auto time  = decodeTime();
+			const auto value = decodeValue();
+
+			p_sample = Sample{time, value};
+		}
+
+		--m_remaining;
+
+		// A Truncated or Corrupt Block is Rejected rather than returning Garbage
+		if (m_reader.hasOverrun() || m_is_corrupt)
+		{
+			m_remaining = 0;
+			return false;
+		}
+		return true;
+	}
+	std::int64_t GorillaDecoder::decodeTime() noexcept
+	{
+		std::int64_t delta_of_delta = 0;
+
+		if (m_reader.readBit())
+		{
+			bool matched = false;
+			for (const auto& bucket : TIME_BUCKETS)
+			{
+				// The Prefix is a run of 1s ending in a 0
+				// The First 1 has already been read
+				if (!m_reader.readBit())
+				{
+					delta_of_delta =
+						 static_cast<std::int64_t>(m_reader.readBits(bucket.bits)) + bucket.minimum;
+					matched = true;
+					break;
+				}
+			}
+			if (!matched)
+				delta_of_delta = static_cast<std::int64_t>(m_reader.readBits(64));
+		}
+
+		m_last_delta += delta_of_delta;
+		m_last_time += m_last_delta;
+		return m_last_time;
+	}
+	double GorillaDecoder::decodeValue() noexcept
+	{
+		if (!m_reader.readBit())
+			return fromBits(m_last_value_bits);
+
+		if (m_reader.readBit())
+		{
+			m_last_leading		  = static_cast<int>(m_reader.readBits(5));
+			const int meaningful = static_cast<int>(m_reader.readBits(6)) + 1;
+			m_last_trailing	  = 64 - m_last_leading - meaningful;
+		}
+
+		const int meaningful = 64 - m_last_leading - m_last_trailing;
+
+		// A Corrupt Stream could produce a Negative Window
+		if (meaningful <= 0 || m_last_trailing < 0)
+		{
+			m_is_corrupt = true;
+			return 0.0;
+		}
+
+		const std::uint64_t xor_bits = m_reader.readBits(meaningful) << m_last_trailing;
+		m_last_value_bits ^= xor_bits;
+
+		return fromBits(m_last_value_bits);
+	}
+} // namespace TUESL::TimeSeries
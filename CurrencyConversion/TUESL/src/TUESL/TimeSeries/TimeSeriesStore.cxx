@@ -0,0 +1,302 @@
+#include "pch.h"
+#include <TUESL/TimeSeries/TimeSeriesStore.hxx>
+
+#include <TUESL/Utility/FileSystem.hxx>
+#include <TUESL/Utility/Hash.hxx>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace TUESL::TimeSeries
+{
+	namespace
+	{
+		namespace FileSystem = Utility::FileSystem;
+
+		constexpr const std::uint32_t BLOCK_MAGIC = 0x31425354; // TSB1
+
+		struct BlockHeader
+		{
+			std::uint32_t magic;
+			std::uint32_t count;
+			std::int64_t  first_time;
+			std::int64_t  last_time;
+			std::uint64_t bit_length;
+			// FNV-1a of the Compressed Stream
+			std::uint64_t checksum;
+		};
+		static_assert(sizeof(BlockHeader) % 8 == 0, "Blocks must stay Aligned");
+
+		constexpr std::uint64_t paddedLength(const std::uint64_t p_bit_length) noexcept
+		{
+			const std::uint64_t byte_length = (p_bit_length + 7) / 8;
+			return (byte_length + 7) & ~std::uint64_t{7};
+		}
+
+		// Names become File Names
+		// As such only a Conservative Set of Characters is Accepted
+		bool isValidSeriesName(const std::wstring_view p_series_name) noexcept
+		{
+			if (std::empty(p_series_name))
+				return false;
+
+			return std::all_of(std::begin(p_series_name), std::end(p_series_name), [](auto c) {
+				return (c >= L'A' && c <= L'Z') || (c >= L'a' && c <= L'z') ||
+						 (c >= L'0' && c <= L'9') || c == L'_' || c == L'-';
+			});
+		}
+	} // namespace
+
+	TimeSeriesFile::TimeSeriesFile(std::wstring p_file_name, const std::size_t p_block_samples) :
+		 m_file_name{std::move(p_file_name)},
+		 m_block_samples{p_block_samples}
+	{
+		recover();
+	}
+	void TimeSeriesFile::recover()
+	{
+		m_file_size = 0;
+
+		if (!m_view.open(m_file_name))
+			return;
+
+		const std::byte*	base = m_view.data();
+		const std::size_t size = m_view.size();
+
+		std::size_t position = 0;
+		while (position + sizeof(BlockHeader) <= size)
+		{
+			BlockHeader header;
+			std::memcpy(&header, base + position, sizeof(header));
+
+			const auto block_length = sizeof(BlockHeader) + paddedLength(header.bit_length);
+
+			if (header.magic != BLOCK_MAGIC || header.count == 0 ||
+				 block_length > size - position)
+				break;
+
+			const auto checksum = Utility::Hash::fnv1a64(base + position + sizeof(BlockHeader),
+																		(header.bit_length + 7) / 8);
+			if (checksum != header.checksum)
+				break;
+
+			m_last_time = header.last_time;
+			position += block_length;
+		}
+
+		m_file_size = position;
+
+		// Anything past the last Valid Block is a Torn Write
+		// It is Dropped so that new Blocks are Appended to a Clean File
+		if (position != size)
+		{
+			m_view.close();
+			FileSystem::truncateFile(m_file_name, position);
+		}
+	}
+	bool TimeSeriesFile::remap()
+	{
+		if (m_file_size == 0)
+		{
+			m_view.close();
+			return false;
+		}
+		// The Mapping is Reused until new Blocks are Written
+		if (m_view.isOpen() && m_view.size() == m_file_size)
+			return true;
+
+		return m_view.open(m_file_name) && m_view.size() >= m_file_size;
+	}
+	bool TimeSeriesFile::append(const Sample& p_sample)
+	{
+		if (p_sample.time < m_last_time)
+			return false;
+
+		m_open_block.append(p_sample);
+		m_last_time = p_sample.time;
+
+		if (m_open_block.count() >= m_block_samples)
+			return flush();
+
+		return true;
+	}
+	bool TimeSeriesFile::flush()
+	{
+		if (m_open_block.count() == 0)
+			return true;
+
+		const auto& stream = m_open_block.stream();
+
+		BlockHeader header{};
+		header.magic		= BLOCK_MAGIC;
+		header.count		= static_cast<std::uint32_t>(m_open_block.count());
+		header.first_time = m_open_block.firstTime();
+		header.last_time	= m_open_block.lastTime();
+		header.bit_length = stream.bitLength();
+		header.checksum =
+			 Utility::Hash::fnv1a64(std::data(stream.bytes()), std::size(stream.bytes()));
+
+		// Header and Padded Stream go out in a Single Write
+		std::vector<std::byte> block(sizeof(BlockHeader) + paddedLength(header.bit_length));
+		std::memcpy(std::data(block), &header, sizeof(header));
+		std::memcpy(std::data(block) + sizeof(header),
+						std::data(stream.bytes()),
+						std::size(stream.bytes()));
+
+		if (!FileSystem::appendToFile(m_file_name, std::data(block), std::size(block)))
+			return false;
+
+		m_file_size += std::size(block);
+		m_open_block.reset();
+
+		return true;
+	}
+	template <typename Visitor>
+	void TimeSeriesFile::forEachSample(const std::int64_t p_from,
+												  const std::int64_t p_to,
+												  Visitor				p_visitor)
+	{
+		Sample sample;
+
+		if (remap())
+		{
+			const std::byte* base	  = m_view.data();
+			std::size_t		  position = 0;
+
+			while (position + sizeof(BlockHeader) <= m_file_size)
+			{
+				BlockHeader header;
+				std::memcpy(&header, base + position, sizeof(header));
+
+				const auto block_length = sizeof(BlockHeader) + paddedLength(header.bit_length);
+				if (block_length > m_file_size - position)
+					break;
+
+				// Blocks are in Time Order
+				// Nothing after this Block can be in Range
+				if (header.first_time >= p_to)
+					break;
+
+				// Only Blocks overlapping the Range are Decoded
+				if (header.last_time >= p_from)
+				{
+					GorillaDecoder decoder{
+						 base + position + sizeof(BlockHeader), header.bit_length, header.count};
+
+					while (decoder.next(sample))
+						if (sample.time >= p_from && sample.time < p_to)
+							p_visitor(sample);
+				}
+
+				position += block_length;
+			}
+		}
+
+		// Samples still in Memory are Newer than anything on Disk
+		const auto& stream = m_open_block.stream();
+		if (m_open_block.count() != 0 && m_open_block.lastTime() >= p_from &&
+			 m_open_block.firstTime() < p_to)
+		{
+			GorillaDecoder decoder{
+				 std::data(stream.bytes()), stream.bitLength(), m_open_block.count()};
+
+			while (decoder.next(sample))
+				if (sample.time >= p_from && sample.time < p_to)
+					p_visitor(sample);
+		}
+	}
+	std::vector<Sample> TimeSeriesFile::range(const std::int64_t p_from,
+															const std::int64_t p_to)
+	{
+		std::vector<Sample> samples;
+		forEachSample(p_from, p_to, [&](const Sample& p_sample) { samples.push_back(p_sample); });
+		return samples;
+	}
+	std::vector<OHLC> TimeSeriesFile::downsample(const std::int64_t p_from,
+																const std::int64_t p_to,
+																const std::int64_t p_interval)
+	{
+		std::vector<OHLC> intervals;
+		if (p_interval <= 0 || p_to <= p_from)
+			return intervals;
+
+		forEachSample(p_from, p_to, [&](const Sample& p_sample) {
+			// Intervals are Aligned to p_from
+			const auto start = p_from + ((p_sample.time - p_from) / p_interval) * p_interval;
+
+			if (std::empty(intervals) || intervals.back().time != start)
+			{
+				intervals.push_back(
+					 OHLC{start, p_sample.value, p_sample.value, p_sample.value, p_sample.value, 1});
+				return;
+			}
+
+			auto& current = intervals.back();
+			current.high  = (std::max)(current.high, p_sample.value);
+			current.low	  = (std::min)(current.low, p_sample.value);
+			current.close = p_sample.value;
+			current.count += 1;
+		});
+
+		return intervals;
+	}
+
+	TimeSeriesStore::TimeSeriesStore(const std::wstring_view p_directory,
+												const std::size_t			p_block_samples) :
+		 m_directory{p_directory},
+		 m_block_samples{(std::max)(p_block_samples, std::size_t{1})}
+	{
+		FileSystem::createDirectory(m_directory);
+	}
+	TimeSeriesStore::~TimeSeriesStore()
+	{
+		flush();
+	}
+	TimeSeriesFile& TimeSeriesStore::series(const std::wstring_view p_series_name)
+	{
+		if (const auto it = m_series.find(p_series_name); it != std::end(m_series))
+			return *it->second;
+
+		if (!isValidSeriesName(p_series_name))
+			throw std::invalid_argument("Time Series Names may only contain [A-Za-z0-9_-]");
+
+		std::wstring file_name = m_directory + L"\\" + std::wstring{p_series_name} +
+										 FILE_EXTENSION;
+
+		auto file = std::make_unique<TimeSeriesFile>(std::move(file_name), m_block_samples);
+		return *m_series.emplace(std::wstring{p_series_name}, std::move(file)).first->second;
+	}
+	bool TimeSeriesStore::append(const std::wstring_view p_series_name,
+										  const Sample&			  p_sample)
+	{
+		std::lock_guard<std::mutex> lock{m_mutex};
+		return series(p_series_name).append(p_sample);
+	}
+	void TimeSeriesStore::flush()
+	{
+		std::lock_guard<std::mutex> lock{m_mutex};
+		for (auto& [name, file] : m_series)
+			file->flush();
+	}
+	std::vector<Sample> TimeSeriesStore::range(const std::wstring_view p_series_name,
+															 const std::int64_t		p_from,
+															 const std::int64_t		p_to)
+	{
+		std::lock_guard<std::mutex> lock{m_mutex};
+		return series(p_series_name).range(p_from, p_to);
+	}
+	std::vector<OHLC> TimeSeriesStore::downsample(const std::wstring_view p_series_name,
+																 const std::int64_t		  p_from,
+																 const std::int64_t		  p_to,
+																 const std::int64_t		  p_interval)
+	{
+		std::lock_guard<std::mutex> lock{m_mutex};
+		return series(p_series_name).downsample(p_from, p_to, p_interval);
+	}
+	std::uint64_t TimeSeriesStore::sizeOnDisk(const std::wstring_view p_series_name)
+	{
+		std::lock_guard<std::mutex> lock{m_mutex};
+		return series(p_series_name).sizeOnDisk();
+	}
+} // namespace TUESL::TimeSeries
@@ -0,0 +1,72 @@
+#include "pch.h"
+#include <TUESL/Utility/Arena.hxx>
+
+#include <algorithm>
+
+namespace TUESL::Utility
+{
+	void* Arena::CountingResource::do_allocate(std::size_t p_bytes, std::size_t p_alignment)
+	{
+		++allocations;
+		return std::pmr::new_delete_resource()->allocate(p_bytes, p_alignment);
+	}
+	void Arena::CountingResource::do_deallocate(void*		  p_pointer,
+															  std::size_t p_bytes,
+															  std::size_t p_alignment)
+	{
+		std::pmr::new_delete_resource()->deallocate(p_pointer, p_bytes, p_alignment);
+	}
+	bool Arena::CountingResource::do_is_equal(
+		 const std::pmr::memory_resource& p_other) const noexcept
+	{
+		return this == &p_other;
+	}
+
+	Arena::Arena(const std::size_t p_initial_size) :
+		 m_owned_buffer{std::make_unique<std::byte[]>(p_initial_size)},
+		 m_buffer{m_owned_buffer.get()},
+		 m_buffer_size{p_initial_size}
+	{
+		m_resource.emplace(m_buffer, m_buffer_size, &m_upstream);
+	}
+	Arena::Arena(std::byte* p_buffer, const std::size_t p_size) :
+		 m_buffer{p_buffer}, m_buffer_size{p_size}
+	{
+		m_resource.emplace(m_buffer, m_buffer_size, &m_upstream);
+	}
+
+	void* Arena::do_allocate(std::size_t p_bytes, std::size_t p_alignment)
+	{
+		++m_statistics.allocations;
+		m_statistics.bytes += p_bytes;
+
+		void* pointer = m_resource->allocate(p_bytes, p_alignment);
+
+		m_statistics.heap_allocations = m_upstream.allocations;
+		return pointer;
+	}
+
+	void Arena::reset()
+	{
+		// Frees every Block taken from the Heap
+		m_resource.reset();
+
+		// If the Buffer was too Small, the next Cycle likely Needs as much again
+		// As such the Buffer Grows once, rather than every Cycle Allocating again
+		if (m_owned_buffer && m_upstream.allocations != 0)
+		{
+			auto size = (std::max)(m_buffer_size, std::size_t{64});
+			while (size < m_statistics.bytes * 2)
+				size *= 2;
+
+			m_owned_buffer = std::make_unique<std::byte[]>(size);
+			m_buffer		   = m_owned_buffer.get();
+			m_buffer_size	= size;
+		}
+
+		m_upstream.allocations = 0;
+		m_statistics			  = Statistics{};
+
+		m_resource.emplace(m_buffer, m_buffer_size, &m_upstream);
+	}
+} // namespace TUESL::Utility
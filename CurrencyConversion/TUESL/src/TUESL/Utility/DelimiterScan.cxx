@@ -0,0 +1,167 @@
+#include "pch.h"
+#include <TUESL/Utility/DelimiterScan.hxx>
+
+#include <algorithm>
+#include <stdexcept>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#	define TUESL_HAS_SSE2
+#	include <emmintrin.h>
+#elif defined(_M_ARM64) || defined(__aarch64__)
+#	define TUESL_HAS_NEON
+#	include <arm_neon.h>
+#endif
+
+#if defined(_MSC_VER)
+#	include <intrin.h>
+#endif
+
+namespace TUESL::Utility
+{
+	namespace
+	{
+		constexpr const std::size_t BLOCK_BYTES = DelimiterScanner::BLOCK_BYTES;
+
+		// Index of the Lowest Set Bit, p_mask must not be 0
+		unsigned lowestBit(const std::uint32_t p_mask) noexcept
+		{
+#if defined(_MSC_VER)
+			unsigned long index = 0;
+			_BitScanForward(&index, p_mask);
+			return static_cast<unsigned>(index);
+#else
+			return static_cast<unsigned>(__builtin_ctz(p_mask));
+#endif
+		}
+
+#if defined(TUESL_HAS_NEON)
+		// One Bit per Lane of a Comparison, Lanes 0 to 7 and 8 to 15 each make a Byte
+		std::uint32_t laneMask(const uint8x16_t p_matches) noexcept
+		{
+			static const uint8x16_t bits = {
+				 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+
+			const uint8x16_t weighted = vandq_u8(p_matches, bits);
+			return static_cast<std::uint32_t>(vaddv_u8(vget_low_u8(weighted))) |
+					 (static_cast<std::uint32_t>(vaddv_u8(vget_high_u8(weighted))) << 8);
+		}
+#endif
+	} // namespace
+
+	Delimiters::Delimiters(const std::string_view p_bytes)
+	{
+		if (std::empty(p_bytes) || std::size(p_bytes) > MAX_BYTES)
+			throw std::invalid_argument("Between 1 and 4 Delimiters are Supported");
+
+		std::copy(std::begin(p_bytes), std::end(p_bytes), std::begin(m_bytes));
+		m_count = std::size(p_bytes);
+	}
+
+	namespace Kernels
+	{
+		std::uint32_t delimiterMaskScalar(const char*		  p_block,
+													 const std::size_t p_length,
+													 const Delimiters& p_delimiters) noexcept
+		{
+			const auto* const delimiters_begin = p_delimiters.data();
+			const auto* const delimiters_end	 = delimiters_begin + p_delimiters.size();
+
+			std::uint32_t mask = 0;
+			for (std::size_t i = 0; i < p_length; ++i)
+			{
+				if (std::find(delimiters_begin, delimiters_end, p_block[i]) != delimiters_end)
+					mask |= std::uint32_t{1} << i;
+			}
+			return mask;
+		}
+
+		std::uint32_t delimiterMaskVector(const char*		  p_block,
+													 const std::size_t p_length,
+													 const Delimiters& p_delimiters) noexcept
+		{
+			// The Last Block of a Text is Shorter, Loading all 32 Bytes would Read past it
+			if (p_length < BLOCK_BYTES)
+				return delimiterMaskScalar(p_block, p_length, p_delimiters);
+
+#if defined(TUESL_HAS_SSE2)
+			const __m128i low	 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_block));
+			const __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_block + 16));
+
+			__m128i low_matches	= _mm_setzero_si128();
+			__m128i high_matches = _mm_setzero_si128();
+			for (std::size_t i = 0; i < p_delimiters.size(); ++i)
+			{
+				const __m128i delimiter = _mm_set1_epi8(p_delimiters.data()[i]);
+				low_matches	 = _mm_or_si128(low_matches, _mm_cmpeq_epi8(low, delimiter));
+				high_matches = _mm_or_si128(high_matches, _mm_cmpeq_epi8(high, delimiter));
+			}
+
+			return static_cast<std::uint32_t>(_mm_movemask_epi8(low_matches)) |
+					 (static_cast<std::uint32_t>(_mm_movemask_epi8(high_matches)) << 16);
+#elif defined(TUESL_HAS_NEON)
+			const auto*		  bytes = reinterpret_cast<const std::uint8_t*>(p_block);
+			const uint8x16_t low	  = vld1q_u8(bytes);
+			const uint8x16_t high  = vld1q_u8(bytes + 16);
+
+			uint8x16_t low_matches	= vdupq_n_u8(0);
+			uint8x16_t high_matches = vdupq_n_u8(0);
+			for (std::size_t i = 0; i < p_delimiters.size(); ++i)
+			{
+				const uint8x16_t delimiter =
+					 vdupq_n_u8(static_cast<std::uint8_t>(p_delimiters.data()[i]));
+				low_matches	 = vorrq_u8(low_matches, vceqq_u8(low, delimiter));
+				high_matches = vorrq_u8(high_matches, vceqq_u8(high, delimiter));
+			}
+
+			return laneMask(low_matches) | (laneMask(high_matches) << 16);
+#else
+			return delimiterMaskScalar(p_block, p_length, p_delimiters);
+#endif
+		}
+	} // namespace Kernels
+
+	DelimiterScanner::DelimiterScanner(const std::string_view p_text,
+												  const Delimiters&		  p_delimiters,
+												  Kernels::DelimiterMask  p_kernel) noexcept :
+		 m_text{p_text},
+		 m_delimiters{p_delimiters},
+		 m_kernel{p_kernel}
+	{
+	}
+
+	void DelimiterScanner::load(const std::size_t p_position) noexcept
+	{
+		m_block		 = p_position;
+		m_next_block = p_position + BLOCK_BYTES;
+
+		if (p_position >= std::size(m_text))
+		{
+			m_mask = 0;
+			return;
+		}
+
+		const auto length = (std::min)(BLOCK_BYTES, std::size(m_text) - p_position);
+		m_mask				= m_kernel(std::data(m_text) + p_position, length, m_delimiters);
+	}
+
+	std::size_t DelimiterScanner::next() noexcept
+	{
+		while (m_mask == 0)
+		{
+			if (m_next_block >= std::size(m_text))
+				return std::string_view::npos;
+
+			load(m_next_block);
+		}
+
+		const auto position = m_block + lowestBit(m_mask);
+		// Clears the Lowest Set Bit
+		m_mask &= m_mask - 1;
+		return position;
+	}
+
+	void DelimiterScanner::seek(const std::size_t p_position) noexcept
+	{
+		load(p_position);
+	}
+} // namespace TUESL::Utility
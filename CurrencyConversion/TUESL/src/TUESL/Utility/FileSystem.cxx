@@ -0,0 +1,74 @@
+#include "pch.h"
+#include <TUESL/Utility/FileSystem.hxx>
+
+#include <string>
+
+namespace TUESL::Utility::FileSystem
+{
+	bool createDirectory(const std::wstring_view p_directory)
+	{
+		const std::wstring directory{p_directory};
+
+		if (CreateDirectoryW(directory.c_str(), nullptr))
+			return true;
+		return GetLastError() == ERROR_ALREADY_EXISTS;
+	}
+	std::optional<std::uint64_t> fileSize(const std::wstring_view p_file_name)
+	{
+		const std::wstring file_name{p_file_name};
+
+		WIN32_FILE_ATTRIBUTE_DATA attributes{};
+		if (!GetFileAttributesExW(file_name.c_str(), GetFileExInfoStandard, &attributes))
+			return std::nullopt;
+
+		return (static_cast<std::uint64_t>(attributes.nFileSizeHigh) << 32) |
+				 attributes.nFileSizeLow;
+	}
+	bool appendToFile(const std::wstring_view p_file_name,
+							const void*				 p_data,
+							const std::size_t		 p_size)
+	{
+		const std::wstring file_name{p_file_name};
+
+		// FILE_APPEND_DATA ensures every Write lands at the End of the File
+		Handler::File file{CreateFile2(file_name.c_str(),
+												 FILE_APPEND_DATA,
+												 FILE_SHARE_READ | FILE_SHARE_WRITE,
+												 OPEN_ALWAYS,
+												 nullptr)};
+		if (file.empty())
+			return false;
+
+		const auto* bytes		= static_cast<const unsigned char*>(p_data);
+		std::size_t remaining = p_size;
+
+		while (remaining != 0)
+		{
+			// WriteFile takes a 32 Bit Length
+			const auto chunk = static_cast<DWORD>((std::min)(remaining, std::size_t{1} << 30));
+
+			DWORD written = 0;
+			if (!WriteFile(file.get(), bytes, chunk, &written, nullptr) || written == 0)
+				return false;
+
+			bytes += written;
+			remaining -= written;
+		}
+		return true;
+	}
+	bool truncateFile(const std::wstring_view p_file_name, const std::uint64_t p_size)
+	{
+		const std::wstring file_name{p_file_name};
+
+		Handler::File file{CreateFile2(
+			 file_name.c_str(), GENERIC_WRITE, FILE_SHARE_READ, OPEN_EXISTING, nullptr)};
+		if (file.empty())
+			return false;
+
+		LARGE_INTEGER position{};
+		position.QuadPart = static_cast<LONGLONG>(p_size);
+
+		return SetFilePointerEx(file.get(), position, nullptr, FILE_BEGIN) &&
+				 SetEndOfFile(file.get());
+	}
+} // namespace TUESL::Utility::FileSystem
@@ -0,0 +1,57 @@
+#include "pch.h"
+#include <TUESL/Utility/MemoryMappedFile.hxx>
+
+#include <string>
+
+namespace TUESL::Utility
+{
+	bool MemoryMappedFile::open(const std::wstring_view p_file_name)
+	{
+		close();
+
+		// CreateFile2 requires a Null Terminated String
+		const std::wstring file_name{p_file_name};
+
+		// Note that creation of locals ensures that
+		// In case of any error in mapping
+		// The Members do not get corrupted
+		// Writers are allowed so that Append Only Files can Grow while Mapped
+		Handler::File local_file{CreateFile2(file_name.c_str(),
+														 GENERIC_READ,
+														 FILE_SHARE_READ | FILE_SHARE_WRITE,
+														 OPEN_EXISTING,
+														 nullptr)};
+		if (local_file.empty())
+			return false;
+
+		LARGE_INTEGER file_size{};
+		if (!GetFileSizeEx(local_file.get(), &file_size) || file_size.QuadPart == 0)
+			return false;
+
+		Handler::FileMapping local_mapping{CreateFileMappingFromApp(
+			 local_file.get(), nullptr, PAGE_READONLY, 0, nullptr)};
+		if (local_mapping.empty())
+			return false;
+
+		Handler::MappedView local_view{
+			 MapViewOfFileFromApp(local_mapping.get(), FILE_MAP_READ, 0, 0)};
+		if (local_view.empty())
+			return false;
+
+		m_file	 = std::move(local_file);
+		m_mapping = std::move(local_mapping);
+		m_view	 = std::move(local_view);
+		m_size	 = static_cast<std::size_t>(file_size.QuadPart);
+
+		return true;
+	}
+	void MemoryMappedFile::close() noexcept
+	{
+		// Unmap first, then Close the Mapping and the File
+		m_view.reset();
+		m_mapping.reset();
+		m_file.reset();
+
+		m_size = 0;
+	}
+} // namespace TUESL::Utility
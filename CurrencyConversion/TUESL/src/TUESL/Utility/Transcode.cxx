@@ -0,0 +1,434 @@
+#include "pch.h"
+#include <TUESL/Utility/Transcode.hxx>
+
+#include <algorithm>
+#include <cstdint>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#	define TUESL_HAS_SSE2
+#	include <emmintrin.h>
+#	if defined(_MSC_VER)
+#		include <intrin.h>
+#	endif
+#elif defined(_M_ARM64) || defined(__aarch64__)
+#	define TUESL_HAS_NEON
+#	include <arm_neon.h>
+#endif
+
+namespace TUESL::Utility
+{
+	namespace
+	{
+		// Units per Vector Step, either Way
+		constexpr const std::size_t VECTOR_UNITS = 16;
+
+		// Text up to this Long is Converted on the Stack before it is Copied into a String
+		constexpr const std::size_t STACK_UNITS = 256;
+
+		constexpr const std::uint32_t MAX_CODE_POINT = 0x10'FFFF;
+
+		bool isSurrogate(const std::uint32_t p_code_point) noexcept
+		{
+			return p_code_point >= 0xD800 && p_code_point <= 0xDFFF;
+		}
+
+		// Converts the one Code Point at p_source[p_read], Advancing both Positions
+		TranscodeStatus transcodeUTF8Sequence(const std::string_view p_source,
+														  std::size_t&				p_read,
+														  wchar_t*					p_destination,
+														  const std::size_t		p_capacity,
+														  std::size_t&				p_written) noexcept
+		{
+			const auto lead = static_cast<unsigned char>(p_source[p_read]);
+
+			if (lead < 0x80)
+			{
+				if (p_written == p_capacity)
+					return TranscodeStatus::TOO_SMALL;
+
+				p_destination[p_written++] = static_cast<wchar_t>(lead);
+				++p_read;
+				return TranscodeStatus::DONE;
+			}
+
+			std::size_t	  length		 = 0;
+			std::uint32_t code_point = 0;
+			// Smallest Code Point of the Length, anything less is Overlong
+			std::uint32_t minimum = 0;
+
+			if ((lead & 0xE0) == 0xC0)
+			{
+				length	  = 2;
+				code_point = lead & 0x1F;
+				minimum	  = 0x80;
+			}
+			else if ((lead & 0xF0) == 0xE0)
+			{
+				length	  = 3;
+				code_point = lead & 0x0F;
+				minimum	  = 0x800;
+			}
+			else if ((lead & 0xF8) == 0xF0)
+			{
+				length	  = 4;
+				code_point = lead & 0x07;
+				minimum	  = 0x1'0000;
+			}
+			else
+				return TranscodeStatus::INVALID;
+
+			if (std::size(p_source) - p_read < length)
+				return TranscodeStatus::INVALID;
+
+			for (std::size_t i = 1; i < length; ++i)
+			{
+				const auto continuation = static_cast<unsigned char>(p_source[p_read + i]);
+				if ((continuation & 0xC0) != 0x80)
+					return TranscodeStatus::INVALID;
+
+				code_point = (code_point << 6) | (continuation & 0x3F);
+			}
+
+			if (code_point < minimum || code_point > MAX_CODE_POINT || isSurrogate(code_point))
+				return TranscodeStatus::INVALID;
+
+			if (code_point < 0x1'0000)
+			{
+				if (p_written == p_capacity)
+					return TranscodeStatus::TOO_SMALL;
+
+				p_destination[p_written++] = static_cast<wchar_t>(code_point);
+			}
+			else
+			{
+				if (p_capacity - p_written < 2)
+					return TranscodeStatus::TOO_SMALL;
+
+				code_point -= 0x1'0000;
+				p_destination[p_written++] = static_cast<wchar_t>(0xD800 + (code_point >> 10));
+				p_destination[p_written++] = static_cast<wchar_t>(0xDC00 + (code_point & 0x3FF));
+			}
+
+			p_read += length;
+			return TranscodeStatus::DONE;
+		}
+
+		// Converts the one Code Point at p_source[p_read], Advancing both Positions
+		TranscodeStatus transcodeUTF16Sequence(const std::wstring_view p_source,
+															std::size_t&				 p_read,
+															char*						 p_destination,
+															const std::size_t		 p_capacity,
+															std::size_t&				 p_written) noexcept
+		{
+			std::uint32_t code_point = static_cast<std::uint16_t>(p_source[p_read]);
+			std::size_t	  length		 = 1;
+
+			if (code_point >= 0xD800 && code_point <= 0xDBFF)
+			{
+				if (p_read + 1 == std::size(p_source))
+					return TranscodeStatus::INVALID;
+
+				const std::uint32_t low = static_cast<std::uint16_t>(p_source[p_read + 1]);
+				if (low < 0xDC00 || low > 0xDFFF)
+					return TranscodeStatus::INVALID;
+
+				code_point = 0x1'0000 + ((code_point - 0xD800) << 10) + (low - 0xDC00);
+				length	  = 2;
+			}
+			else if (isSurrogate(code_point))
+				return TranscodeStatus::INVALID;
+
+			const std::size_t bytes = code_point < 0x80		 ? 1
+											: code_point < 0x800	 ? 2
+											: code_point < 0x1'0000 ? 3
+																			 : 4;
+			if (p_capacity - p_written < bytes)
+				return TranscodeStatus::TOO_SMALL;
+
+			auto* out = p_destination + p_written;
+			switch (bytes)
+			{
+				case 1:
+					out[0] = static_cast<char>(code_point);
+					break;
+				case 2:
+					out[0] = static_cast<char>(0xC0 | (code_point >> 6));
+					out[1] = static_cast<char>(0x80 | (code_point & 0x3F));
+					break;
+				case 3:
+					out[0] = static_cast<char>(0xE0 | (code_point >> 12));
+					out[1] = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+					out[2] = static_cast<char>(0x80 | (code_point & 0x3F));
+					break;
+				default:
+					out[0] = static_cast<char>(0xF0 | (code_point >> 18));
+					out[1] = static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+					out[2] = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+					out[3] = static_cast<char>(0x80 | (code_point & 0x3F));
+					break;
+			}
+
+			p_read += length;
+			p_written += bytes;
+			return TranscodeStatus::DONE;
+		}
+
+#if defined(TUESL_HAS_SSE2)
+		// Index of the Lowest Set Bit, p_mask must not be 0
+		unsigned lowestBit(const std::uint32_t p_mask) noexcept
+		{
+#	if defined(_MSC_VER)
+			unsigned long index = 0;
+			_BitScanForward(&index, p_mask);
+			return static_cast<unsigned>(index);
+#	else
+			return static_cast<unsigned>(__builtin_ctz(p_mask));
+#	endif
+		}
+#endif
+
+		// Widens the 16 Bytes at p_source as though they were all ASCII
+		// Returns how many of them at the Start really are, the Units after those are Garbage
+		// The Caller Overwrites them, as such p_destination must have Room for all 16
+		std::size_t widenASCII(const char* p_source, wchar_t* p_destination) noexcept
+		{
+#if defined(TUESL_HAS_SSE2)
+			const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_source));
+
+			const __m128i zero = _mm_setzero_si128();
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(p_destination),
+								  _mm_unpacklo_epi8(bytes, zero));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(p_destination + 8),
+								  _mm_unpackhi_epi8(bytes, zero));
+
+			// The High Bit of every Byte which is not ASCII
+			const auto non_ascii = static_cast<std::uint32_t>(_mm_movemask_epi8(bytes));
+			return non_ascii == 0 ? VECTOR_UNITS : lowestBit(non_ascii);
+#elif defined(TUESL_HAS_NEON)
+			// Finding the First Byte which is not ASCII costs more than it Saves here
+			const uint8x16_t bytes = vld1q_u8(reinterpret_cast<const std::uint8_t*>(p_source));
+			if (vmaxvq_u8(bytes) >= 0x80)
+				return 0;
+
+			auto* units = reinterpret_cast<std::uint16_t*>(p_destination);
+			vst1q_u16(units, vmovl_u8(vget_low_u8(bytes)));
+			vst1q_u16(units + 8, vmovl_u8(vget_high_u8(bytes)));
+			return VECTOR_UNITS;
+#else
+			(void)p_source;
+			(void)p_destination;
+			return 0;
+#endif
+		}
+
+		// Narrows the 16 Units at p_source as though they were all ASCII
+		// Returns how many of them at the Start really are, as widenASCII does
+		std::size_t narrowASCII(const wchar_t* p_source, char* p_destination) noexcept
+		{
+#if defined(TUESL_HAS_SSE2)
+			const __m128i low  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_source));
+			const __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_source + 8));
+
+			// Saturates Units above 0xFF, which are not ASCII anyway
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(p_destination),
+								  _mm_packus_epi16(low, high));
+
+			// Any Bit above the Lowest 7 makes a Unit not ASCII
+			const __m128i high_bits = _mm_set1_epi16(static_cast<short>(0xFF80));
+			const __m128i zero		= _mm_setzero_si128();
+			const auto	  low_ascii = static_cast<std::uint32_t>(_mm_movemask_epi8(
+				  _mm_cmpeq_epi16(_mm_and_si128(low, high_bits), zero)));
+			const auto	  high_ascii = static_cast<std::uint32_t>(_mm_movemask_epi8(
+				  _mm_cmpeq_epi16(_mm_and_si128(high, high_bits), zero)));
+
+			// Two Bits per Unit
+			const auto non_ascii = ~(low_ascii | (high_ascii << 16));
+			return non_ascii == 0 ? VECTOR_UNITS : lowestBit(non_ascii) / 2;
+#elif defined(TUESL_HAS_NEON)
+			const auto*		  units = reinterpret_cast<const std::uint16_t*>(p_source);
+			const uint16x8_t low	  = vld1q_u16(units);
+			const uint16x8_t high  = vld1q_u16(units + 8);
+			if (vmaxvq_u16(vorrq_u16(low, high)) >= 0x80)
+				return 0;
+
+			vst1q_u8(reinterpret_cast<std::uint8_t*>(p_destination),
+						vcombine_u8(vmovn_u16(low), vmovn_u16(high)));
+			return VECTOR_UNITS;
+#else
+			(void)p_source;
+			(void)p_destination;
+			return 0;
+#endif
+		}
+	} // namespace
+
+	TranscodeResult utf8ToUTF16(const std::string_view p_source,
+										 wchar_t*					p_destination,
+										 const std::size_t		p_capacity) noexcept
+	{
+		return Kernels::utf8ToUTF16Vector(p_source, p_destination, p_capacity);
+	}
+	TranscodeResult utf16ToUTF8(const std::wstring_view p_source,
+										 char*						 p_destination,
+										 const std::size_t		 p_capacity) noexcept
+	{
+		return Kernels::utf16ToUTF8Vector(p_source, p_destination, p_capacity);
+	}
+
+	std::optional<std::wstring> toUTF16(const std::string_view p_source)
+	{
+		std::wstring text(maxUTF16Length(std::size(p_source)), L'\0');
+
+		const auto result = utf8ToUTF16(p_source, std::data(text), std::size(text));
+		if (result.status != TranscodeStatus::DONE)
+			return std::nullopt;
+
+		text.resize(result.written);
+		return text;
+	}
+	std::optional<std::string> toUTF8(const std::wstring_view p_source)
+	{
+		std::string text(maxUTF8Length(std::size(p_source)), '\0');
+
+		const auto result = utf16ToUTF8(p_source, std::data(text), std::size(text));
+		if (result.status != TranscodeStatus::DONE)
+			return std::nullopt;
+
+		text.resize(result.written);
+		return text;
+	}
+#ifdef TUESL_USING_CPP_WINRT
+	std::optional<winrt::hstring> toHString(const std::string_view p_source)
+	{
+		// Names and Codes Fit on the Stack, as such only the hstring is Allocated
+		if (maxUTF16Length(std::size(p_source)) <= STACK_UNITS)
+		{
+			wchar_t buffer[STACK_UNITS];
+
+			const auto result = utf8ToUTF16(p_source, buffer, STACK_UNITS);
+			if (result.status != TranscodeStatus::DONE)
+				return std::nullopt;
+
+			return winrt::hstring{std::wstring_view{buffer, result.written}};
+		}
+
+		const auto text = toUTF16(p_source);
+		if (!text.has_value())
+			return std::nullopt;
+		return winrt::hstring{text.value()};
+	}
+#endif
+
+	namespace Kernels
+	{
+		TranscodeResult utf8ToUTF16Scalar(const std::string_view p_source,
+													 wchar_t*					p_destination,
+													 const std::size_t		p_capacity) noexcept
+		{
+			TranscodeResult result;
+			while (result.read < std::size(p_source))
+			{
+				// Runs of ASCII need neither Decoding nor a Call per Byte
+				const auto ascii_end =
+					 result.read + (std::min)(std::size(p_source) - result.read,
+													  p_capacity - result.written);
+				while (result.read < ascii_end &&
+						 static_cast<unsigned char>(p_source[result.read]) < 0x80)
+					p_destination[result.written++] = p_source[result.read++];
+
+				if (result.read == std::size(p_source))
+					break;
+
+				result.status = transcodeUTF8Sequence(
+					 p_source, result.read, p_destination, p_capacity, result.written);
+				if (result.status != TranscodeStatus::DONE)
+					return result;
+			}
+			return result;
+		}
+		TranscodeResult utf8ToUTF16Vector(const std::string_view p_source,
+													 wchar_t*					p_destination,
+													 const std::size_t		p_capacity) noexcept
+		{
+			TranscodeResult result;
+			while (result.read < std::size(p_source))
+			{
+				// Up to the next Byte which is not ASCII, 16 at a Time
+				while (std::size(p_source) - result.read >= VECTOR_UNITS &&
+						 p_capacity - result.written >= VECTOR_UNITS)
+				{
+					const auto ascii = widenASCII(std::data(p_source) + result.read,
+															p_destination + result.written);
+					result.read += ascii;
+					result.written += ascii;
+
+					if (ascii != VECTOR_UNITS)
+						break;
+				}
+
+				if (result.read == std::size(p_source))
+					break;
+
+				result.status = transcodeUTF8Sequence(
+					 p_source, result.read, p_destination, p_capacity, result.written);
+				if (result.status != TranscodeStatus::DONE)
+					return result;
+			}
+			return result;
+		}
+
+		TranscodeResult utf16ToUTF8Scalar(const std::wstring_view p_source,
+													 char*						 p_destination,
+													 const std::size_t		 p_capacity) noexcept
+		{
+			TranscodeResult result;
+			while (result.read < std::size(p_source))
+			{
+				const auto ascii_end =
+					 result.read + (std::min)(std::size(p_source) - result.read,
+													  p_capacity - result.written);
+				while (result.read < ascii_end &&
+						 static_cast<std::uint16_t>(p_source[result.read]) < 0x80)
+					p_destination[result.written++] = static_cast<char>(p_source[result.read++]);
+
+				if (result.read == std::size(p_source))
+					break;
+
+				result.status = transcodeUTF16Sequence(
+					 p_source, result.read, p_destination, p_capacity, result.written);
+				if (result.status != TranscodeStatus::DONE)
+					return result;
+			}
+			return result;
+		}
+		TranscodeResult utf16ToUTF8Vector(const std::wstring_view p_source,
+													 char*						 p_destination,
+													 const std::size_t		 p_capacity) noexcept
+		{
+			TranscodeResult result;
+			while (result.read < std::size(p_source))
+			{
+				while (std::size(p_source) - result.read >= VECTOR_UNITS &&
+						 p_capacity - result.written >= VECTOR_UNITS)
+				{
+					const auto ascii = narrowASCII(std::data(p_source) + result.read,
+															 p_destination + result.written);
+					result.read += ascii;
+					result.written += ascii;
+
+					if (ascii != VECTOR_UNITS)
+						break;
+				}
+
+				if (result.read == std::size(p_source))
+					break;
+
+				result.status = transcodeUTF16Sequence(
+					 p_source, result.read, p_destination, p_capacity, result.written);
+				if (result.status != TranscodeStatus::DONE)
+					return result;
+			}
+			return result;
+		}
+	} // namespace Kernels
+} // namespace TUESL::Utility
@@ -0,0 +1,42 @@
+#include "pch.h"
+
+#include "Check.hxx"
+
+#include <iostream>
+
+namespace Tests
+{
+	namespace
+	{
+		std::size_t& mutableFailureCount() noexcept
+		{
+			static std::size_t failures = 0;
+			return failures;
+		}
+	} // namespace
+
+	Registration::Registration(const char* p_name, TestFunction p_function)
+	{
+		registry().push_back(RegisteredTest{p_name, p_function});
+	}
+
+	std::vector<RegisteredTest>& registry()
+	{
+		// Function Local so that it is Constructed before any Registration
+		static std::vector<RegisteredTest> tests;
+		return tests;
+	}
+
+	void fail(const char* p_expression, const char* p_file, const int p_line)
+	{
+		// The Format MSBuild Lists as an Error
+		std::cerr << p_file << "(" << p_line << "): error: Expected " << p_expression
+					 << std::endl;
+		++mutableFailureCount();
+	}
+
+	std::size_t failureCount() noexcept
+	{
+		return mutableFailureCount();
+	}
+} // namespace Tests
@@ -0,0 +1,49 @@
+#pragma once
+
+// Minimal Test Harness
+// A Test Fails if any of its EXPECTs does, or if it Throws
+// Main Runs every Registered Test and Exits with 1 if any Failed
+// As such the RunTests Target of Tests.vcxproj Fails the Build on a Failing Test
+// Build with /p:SkipTests=true to Build without Running them
+//
+// Example
+//	TEST(InteractiveGoesFirst)
+//	{
+//		...
+//		EXPECT(metrics.interactive.granted == 1);
+//	}
+
+#include <cstddef>
+#include <vector>
+
+namespace Tests
+{
+	using TestFunction = void (*)();
+
+	struct Registration
+	{
+		Registration(const char* p_name, TestFunction p_function);
+	};
+
+	struct RegisteredTest
+	{
+		const char*	 name;
+		TestFunction function;
+	};
+
+	std::vector<RegisteredTest>& registry();
+
+	// Reports p_expression with where it is, and Counts the Failure
+	void fail(const char* p_expression, const char* p_file, const int p_line);
+
+	// Failures since the Run Started
+	std::size_t failureCount() noexcept;
+} // namespace Tests
+
+#define TEST(name)                                                \
+	static void							  name();                         \
+	static const Tests::Registration name##_registration{#name, &name}; \
+	static void							  name()
+
+#define EXPECT(expression) \
+	((expression) ? static_cast<void>(0) : Tests::fail(#expression, __FILE__, __LINE__))
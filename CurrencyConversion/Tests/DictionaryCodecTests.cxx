@@ -0,0 +1,193 @@
+#include "pch.h"
+
+#include "Check.hxx"
+
+#include <TUESL/Compression/DictionaryCodec.hxx>
+
+#include <cstdio>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Blocks Encoded and Decoded again must come back Byte for Byte
+// With no Dictionary, and with one far Smaller than the Blocks which Refer into it
+//
+// ArchiveBenchmarks Reports the Ratio and Speed of the same Codec on Responses
+
+namespace
+{
+	using TUESL::Compression::Dictionary;
+	using TUESL::Compression::DictionaryDecoder;
+	using TUESL::Compression::DictionaryEncoder;
+
+	namespace Compression = TUESL::Compression;
+
+	// Rate Responses in the Layout of the Converter API, a few Dozen Bytes each
+	std::vector<std::string> responses(const std::size_t p_count)
+	{
+		std::mt19937							  generator{7};
+		std::uniform_int_distribution<int> code{0, 169};
+		std::uniform_real_distribution<>	  rate{0.5, 2.0};
+
+		std::vector<std::string> texts;
+		for (std::size_t i = 0; i < p_count; ++i)
+		{
+			char text[96];
+			std::snprintf(text,
+							  sizeof(text),
+							  R"({"C%04d_C%04d":{"val":%.6f,"id":"C%04d_C%04d"}})",
+							  code(generator),
+							  code(generator),
+							  rate(generator),
+							  code(generator),
+							  code(generator));
+			texts.emplace_back(text);
+		}
+		return texts;
+	}
+
+	std::vector<std::string_view> viewsOf(const std::vector<std::string>& p_texts)
+	{
+		return std::vector<std::string_view>(std::begin(p_texts), std::end(p_texts));
+	}
+
+	// Bytes no Dictionary nor earlier Bytes hold, as such they are Stored
+	std::string noise(const std::size_t p_size)
+	{
+		std::mt19937_64 generator{11};
+		std::string		 text(p_size, '\0');
+		for (auto& c : text)
+			c = static_cast<char>(generator());
+		return text;
+	}
+
+	// Encodes p_blocks in Turn with the same Encoder, as the Archive does
+	// Each Block must fit encodedBound and Decode back to itself
+	bool roundTrips(const Dictionary& p_dictionary, const std::vector<std::string>& p_blocks)
+	{
+		DictionaryEncoder encoder{p_dictionary};
+		DictionaryDecoder decoder{p_dictionary};
+
+		for (const auto& block : p_blocks)
+		{
+			std::vector<std::byte> encoded;
+			encoder.encode(block, encoded);
+			if (std::size(encoded) > Compression::encodedBound(std::size(block)))
+				return false;
+			if (DictionaryDecoder::decodedSize(std::data(encoded), std::size(encoded)) !=
+				 std::size(block))
+				return false;
+
+			std::string decoded = "kept";
+			if (!decoder.decode(std::data(encoded), std::size(encoded), decoded) ||
+				 decoded != "kept" + block)
+				return false;
+		}
+		return true;
+	}
+
+	// Every Kind of Block, and one of each Size either side of a Nibble or Length Byte
+	std::vector<std::string> edgeBlocks()
+	{
+		std::vector<std::string> blocks = {"", "a", "abc", "abcd", "aaaaaaaa", noise(1'000)};
+
+		for (const std::size_t size : {14, 15, 16, 18, 19, 20, 269, 270, 271})
+			blocks.push_back(std::string(size, 'x'));
+
+		std::string joined;
+		for (const auto& response : responses(300))
+			joined += response;
+		blocks.push_back(joined);
+		blocks.push_back(noise(Compression::MAX_BLOCK_SIZE));
+		blocks.push_back(joined.substr(0, Compression::MAX_BLOCK_SIZE / 2) +
+							  noise(Compression::MAX_BLOCK_SIZE / 2));
+		return blocks;
+	}
+} // namespace
+
+TEST(DictionaryCodecRoundTripsWithoutDictionary)
+{
+	EXPECT(roundTrips(Dictionary{}, edgeBlocks()));
+	EXPECT(roundTrips(Dictionary{}, responses(100)));
+}
+
+// Training on too little to Share yields an Empty Dictionary, which must still Work
+TEST(DictionaryCodecRoundTripsWithEmptyTrainedDictionary)
+{
+	EXPECT(Dictionary::train({}).empty());
+
+	const auto single	 = responses(1);
+	const auto trained = Dictionary::train(viewsOf(single));
+	EXPECT(trained.empty());
+	EXPECT(roundTrips(trained, edgeBlocks()));
+}
+
+// Blocks far Larger than the Dictionary, whose Matches Start in it and Run on past its End
+TEST(DictionaryCodecRoundTripsBlocksLargerThanDictionary)
+{
+	const auto samples	 = responses(200);
+	const auto dictionary = Dictionary::train(viewsOf(samples), 1'024);
+	EXPECT(!dictionary.empty());
+	EXPECT(std::size(dictionary.bytes()) <= 1'024);
+
+	auto blocks = edgeBlocks();
+	blocks.push_back(std::string{dictionary.bytes()});
+	blocks.push_back(std::string{dictionary.bytes()} + std::string{dictionary.bytes()});
+	blocks.push_back(std::string{dictionary.bytes().substr(std::size(dictionary.bytes()) / 2)} +
+						  std::string{dictionary.bytes()});
+	EXPECT(roundTrips(dictionary, blocks));
+	EXPECT(roundTrips(dictionary, responses(1'000)));
+}
+
+TEST(DictionaryCodecRejectsOversizeInput)
+{
+	DictionaryEncoder		 encoder;
+	std::vector<std::byte> encoded;
+
+	bool is_thrown = false;
+	try
+	{
+		encoder.encode(std::string(Compression::MAX_BLOCK_SIZE + 1, 'x'), encoded);
+	}
+	catch (const std::invalid_argument&)
+	{
+		is_thrown = true;
+	}
+	EXPECT(is_thrown);
+
+	is_thrown = false;
+	try
+	{
+		Dictionary{std::string(Dictionary::MAX_CAPACITY + 1, 'x')};
+	}
+	catch (const std::invalid_argument&)
+	{
+		is_thrown = true;
+	}
+	EXPECT(is_thrown);
+}
+
+// A Block which Refers into the Dictionary can not be Decoded without it
+// Nor can one Cut Short, and neither Changes the Output
+TEST(DictionaryCodecRejectsCorruptBlocks)
+{
+	const auto samples	 = responses(200);
+	const auto dictionary = Dictionary::train(viewsOf(samples));
+
+	DictionaryEncoder		 encoder{dictionary};
+	std::vector<std::byte> encoded;
+	encoder.encode(samples.front(), encoded);
+
+	std::string decoded = "kept";
+	EXPECT(!DictionaryDecoder{}.decode(std::data(encoded), std::size(encoded), decoded));
+	EXPECT(decoded == "kept");
+
+	const DictionaryDecoder decoder{dictionary};
+	for (std::size_t size = 0; size < std::size(encoded); ++size)
+	{
+		EXPECT(!decoder.decode(std::data(encoded), size, decoded));
+		EXPECT(decoded == "kept");
+	}
+}
@@ -0,0 +1,212 @@
+#include "pch.h"
+
+#include "Check.hxx"
+
+#include <TUESL/Numeric/FixedPoint.hxx>
+
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+// Money and Rate at the Edges of Money::DECIMALS, and the Kernels of convertAmounts
+// The AVX2 Kernel must give the Scalar one's Result for every Amount, not only for most
+// ConversionBenchmarks Reports how far double is from both
+
+namespace
+{
+	using TUESL::Numeric::Money;
+	using TUESL::Numeric::Rate;
+
+	namespace Numeric = TUESL::Numeric;
+
+	constexpr const std::int64_t INT64_MAXIMUM = (std::numeric_limits<std::int64_t>::max)();
+
+	// Above this the Kernels take the Exact Path rather than the Estimate
+	// 2^50 as ESTIMATE_LIMIT in FixedPoint.cxx, for a Rate below 1
+	constexpr const std::int64_t ESTIMATE_LIMIT = std::int64_t{1} << 50;
+
+	// Both Paths, both Signs, and either side of where one gives way to the other
+	// An Odd Count, as such the AVX2 Kernel also Converts a Tail
+	std::vector<Money> edgeAmounts()
+	{
+		std::vector<Money> amounts;
+		for (const std::int64_t units : {std::int64_t{0},
+													std::int64_t{1},
+													std::int64_t{5},
+													Money::SCALE / 2,
+													Money::SCALE - 1,
+													Money::SCALE,
+													ESTIMATE_LIMIT / 2 - 1,
+													ESTIMATE_LIMIT / 2,
+													ESTIMATE_LIMIT / 2 + 1,
+													ESTIMATE_LIMIT - 1,
+													ESTIMATE_LIMIT,
+													ESTIMATE_LIMIT + 1,
+													INT64_MAXIMUM / 2,
+													INT64_MAXIMUM - 1,
+													INT64_MAXIMUM})
+		{
+			amounts.push_back(Money{units});
+			amounts.push_back(Money{-units});
+		}
+		amounts.push_back(Money{Money::INVALID_UNITS});
+
+		// Fixed Seed, as such a Failure is the same on every Run
+		std::mt19937_64										  generator{20'240'101};
+		std::uniform_int_distribution<std::int64_t> small{-1'000'000'000, 1'000'000'000};
+		std::uniform_int_distribution<std::int64_t> large{-INT64_MAXIMUM, INT64_MAXIMUM};
+		for (int i = 0; i < 4'000; ++i)
+			amounts.push_back(Money{small(generator)});
+		for (int i = 0; i < 1'000; ++i)
+			amounts.push_back(Money{large(generator)});
+
+		return amounts;
+	}
+
+	std::vector<Rate> edgeRates()
+	{
+		return {Rate{0},
+				  Rate{1},
+				  Rate{Rate::SCALE / 2 - 1},
+				  Rate{Rate::SCALE / 2},
+				  Rate{Rate::SCALE - 1},
+				  Rate{Rate::SCALE},
+				  Rate{Rate::SCALE + 1},
+				  *Rate::parse("83.123456789"),
+				  *Rate::parse("0.000012345"),
+				  *Rate::parse("152345.000000001"),
+				  Rate{INT64_MAXIMUM}};
+	}
+} // namespace
+
+TEST(ConvertKernelsAgree)
+{
+	// Without AVX2 convertAmounts only ever Runs the Scalar Kernel
+	if (Numeric::detectInstructionSet() != Numeric::InstructionSet::AVX2)
+		return;
+
+	const auto amounts = edgeAmounts();
+	const auto count	 = std::size(amounts);
+
+	std::vector<Money> scalar(count);
+	std::vector<Money> vector(count);
+	for (const auto rate : edgeRates())
+	{
+		const auto scalar_overflows = Numeric::Kernels::convertAmountsScalar(
+			 std::data(amounts), count, rate, std::data(scalar));
+		const auto vector_overflows = Numeric::Kernels::convertAmountsAVX2(
+			 std::data(amounts), count, rate, std::data(vector));
+
+		EXPECT(scalar_overflows == vector_overflows);
+
+		std::size_t mismatches = 0;
+		for (std::size_t i = 0; i < count; ++i)
+			mismatches += scalar[i] != vector[i] ? 1 : 0;
+		EXPECT(mismatches == 0);
+	}
+}
+
+TEST(ConvertKernelsMatchConvert)
+{
+	const auto amounts = edgeAmounts();
+	const auto count	 = std::size(amounts);
+
+	std::vector<Money> results(count);
+	for (const auto rate : edgeRates())
+	{
+		const auto overflows =
+			 Numeric::convertAmounts(std::data(amounts), count, rate, std::data(results));
+
+		std::size_t mismatches		  = 0;
+		std::size_t invalid_results = 0;
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			const auto single = Numeric::convert(amounts[i], rate);
+			if (!single.has_value())
+				++invalid_results;
+			if (single.value_or(Money{Money::INVALID_UNITS}) != results[i])
+				++mismatches;
+		}
+		EXPECT(mismatches == 0);
+		EXPECT(overflows == invalid_results);
+	}
+}
+
+// Digits past DECIMALS are Rounded Half Away from Zero, on the first of them alone
+TEST(MoneyParseRoundsAtDecimals)
+{
+	static_assert(Money::DECIMALS == 4, "The Texts below are Written for 4 Decimals");
+
+	EXPECT(Money::parse("0.0001")->units == 1);
+	EXPECT(Money::parse("0.00005")->units == 1);
+	EXPECT(Money::parse("-0.00005")->units == -1);
+	EXPECT(Money::parse("0.00004999")->units == 0);
+	EXPECT(Money::parse("-0.00004999")->units == 0);
+	EXPECT(Money::parse("1.23445")->units == 12'345);
+	EXPECT(Money::parse("1.23449999")->units == 12'345);
+	EXPECT(Money::parse("9.99995")->units == 100'000);
+
+	EXPECT(Money{1}.toString() == "0.0001");
+	EXPECT(Money{-12'345}.toString() == "-1.2345");
+	EXPECT(Money{100'000}.toString() == "10");
+	EXPECT(Money{Money::INVALID_UNITS + 1}.toString() == "-922337203685477.5807");
+}
+
+TEST(MoneyParseRejectsOverflow)
+{
+	EXPECT(Money::parse("922337203685477.5807")->units == INT64_MAXIMUM);
+	EXPECT(Money::parse("-922337203685477.5807")->units == -INT64_MAXIMUM);
+	EXPECT(Money::parse("922337203685477.58074")->units == INT64_MAXIMUM);
+
+	EXPECT(!Money::parse("922337203685477.5808").has_value());
+	EXPECT(!Money::parse("922337203685477.58075").has_value());
+	EXPECT(!Money::parse("9223372036854775.807").has_value());
+
+	EXPECT(!Money::fromDouble(1e15).has_value());
+	EXPECT(!Money::fromDouble(-1e15).has_value());
+	EXPECT(!Money::fromDouble(std::numeric_limits<double>::infinity()).has_value());
+	EXPECT(!Money::fromDouble(std::numeric_limits<double>::quiet_NaN()).has_value());
+}
+
+// A Result Half a Unit of Money from two Neighbours is Rounded away from Zero
+TEST(ConvertRoundsHalfAwayFromZero)
+{
+	const auto half		  = *Rate::parse("0.5");
+	const auto below_half = *Rate::parse("0.499999999");
+
+	EXPECT(Numeric::convert(Money{1}, half)->units == 1);
+	EXPECT(Numeric::convert(Money{-1}, half)->units == -1);
+	EXPECT(Numeric::convert(Money{3}, half)->units == 2);
+	EXPECT(Numeric::convert(Money{-3}, half)->units == -2);
+	EXPECT(Numeric::convert(Money{1}, below_half)->units == 0);
+	EXPECT(Numeric::convert(Money{-1}, below_half)->units == 0);
+
+	// As in the Example of FixedPoint.hxx
+	const auto result = Numeric::convert(*Money::parse("1234.56"), *Rate::parse("83.123456789"));
+	EXPECT(result->toString() == "102620.8948");
+}
+
+TEST(ConvertRejectsOverflow)
+{
+	const auto one			= Rate{Rate::SCALE};
+	const auto above_one = Rate{Rate::SCALE + 1};
+
+	EXPECT(Numeric::convert(Money{INT64_MAXIMUM}, one)->units == INT64_MAXIMUM);
+	EXPECT(Numeric::convert(Money{-INT64_MAXIMUM}, one)->units == -INT64_MAXIMUM);
+	EXPECT(!Numeric::convert(Money{INT64_MAXIMUM}, above_one).has_value());
+	EXPECT(!Numeric::convert(Money{-INT64_MAXIMUM}, above_one).has_value());
+	EXPECT(!Numeric::convert(Money{Money::INVALID_UNITS}, one).has_value());
+	EXPECT(!Numeric::convert(Money{1}, Rate{-1}).has_value());
+
+	// The largest Product short of the Limit
+	EXPECT(Numeric::convert(Money{INT64_MAXIMUM / 2}, Rate{2 * Rate::SCALE})->units ==
+			 INT64_MAXIMUM - 1);
+
+	const Money amounts[] = {Money{1}, Money{INT64_MAXIMUM}, Money{-2}};
+	Money			results[3];
+	EXPECT(Numeric::convertAmounts(amounts, 3, above_one, results) == 1);
+	EXPECT(results[0].units == 1);
+	EXPECT(!results[1].isValid());
+	EXPECT(results[2].units == -2);
+}
@@ -0,0 +1,62 @@
+#include "pch.h"
+
+#include "Check.hxx"
+
+#include <exception>
+#include <iostream>
+#include <string>
+
+// Runs every Registered Test
+// Or only those whose Name contains the first Argument
+// Exits with 1 if any Failed
+//
+// Run from Benchmarks, where QueryPlans.baseline is, as the RunTests Target does
+//
+// Example
+//	Tests.exe
+//	Tests.exe Scheduler
+
+int main(int argc, char* argv[])
+{
+	const std::string filter = argc > 1 ? argv[1] : "";
+
+	// The Converter Waits on its Coroutines, which is not Allowed on a Single Threaded Apartment
+	winrt::init_apartment();
+
+	std::size_t run	  = 0;
+	std::size_t failed = 0;
+	for (const auto& test : Tests::registry())
+	{
+		if (!std::empty(filter) && std::string{test.name}.find(filter) == std::string::npos)
+			continue;
+
+		std::cerr << "Running " << test.name << std::endl;
+		const auto failures_before = Tests::failureCount();
+
+		bool is_thrown = false;
+		try
+		{
+			test.function();
+		}
+		catch (const std::exception& p_exception)
+		{
+			is_thrown = true;
+			std::cerr << test.name << ": error: Threw " << p_exception.what() << std::endl;
+		}
+		catch (...)
+		{
+			is_thrown = true;
+			std::cerr << test.name << ": error: Threw" << std::endl;
+		}
+
+		++run;
+		if (is_thrown || Tests::failureCount() != failures_before)
+		{
+			++failed;
+			std::cerr << "Failed " << test.name << std::endl;
+		}
+	}
+
+	std::cerr << run << " Tests Run, " << failed << " Failed" << std::endl;
+	return failed == 0 ? 0 : 1;
+}
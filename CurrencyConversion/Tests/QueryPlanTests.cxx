@@ -0,0 +1,26 @@
+#include "pch.h"
+
+#include "Check.hxx"
+
+#include "Harness.hxx"
+#include "QueryPlanCheck.hxx"
+
+#include <sstream>
+
+// The Plans of every Statement CurrencyConverter Registers, against QueryPlans.baseline
+// A Statement which gains a Scan or a Temp B-Tree Fails, see QueryPlanCheck.hxx
+// Record the Baseline again with Benchmarks.exe --record-query-plans where that is Intended
+
+namespace
+{
+	constexpr const auto BASELINE_FILE = "QueryPlans.baseline";
+} // namespace
+
+TEST(QueryPlansMatchBaseline)
+{
+	// The Counters are for Benchmarks.exe, the Test only Checks the Plans
+	std::ostringstream		counters;
+	Benchmarks::Reporter reporter{counters};
+
+	EXPECT(Benchmarks::checkQueryPlans(reporter, BASELINE_FILE, false) == 0);
+}
@@ -0,0 +1,71 @@
+#include "pch.h"
+
+#include "Check.hxx"
+
+#include "CurrencyConverter.hxx"
+#include "Harness.hxx"
+#include "StandInService.hxx"
+
+#include <TUESL/Numeric/FixedPoint.hxx>
+#include <TUESL/Utility/FileSystem.hxx>
+
+#include <string>
+
+// Rates Imported from a Reference Rate File are of past Days
+// A Lookup must never Serve one as Current, it goes to the Provider instead
+
+namespace
+{
+	using Currency::CurrencyConverter;
+	using Currency::DatabaseMode;
+	using Currency::StorageFolders;
+	using Currency::UpstreamService;
+
+	using TUESL::Numeric::Rate;
+
+	using winrt::hstring;
+
+	using namespace std::string_literals;
+
+	// Far outside the 0.5 to 2.0 the Stand in Service Quotes
+	constexpr const auto IMPORTED_RATE = "9.5";
+
+	// A Day long Past, in the Layout of eurofxref-hist.csv, Quoted against C0000
+	std::wstring writeRateFile(const std::wstring& p_directory)
+	{
+		const auto		  file_name = p_directory + L"\\eurofxref-hist.csv";
+		const std::string text		= "Date,C0001,\r\n2020-01-02,"s + IMPORTED_RATE + ",\r\n";
+
+		TUESL::Utility::FileSystem::appendToFile(file_name, std::data(text), std::size(text));
+		return file_name;
+	}
+} // namespace
+
+TEST(ImportedRatesAreNeverServedAsCurrent)
+{
+	Benchmarks::StandInService service{2};
+	EXPECT(!std::empty(service.rootUrl()));
+
+	const auto directory = Benchmarks::scratchDirectory(L"ReferenceRateTests");
+	const auto file_name = writeRateFile(directory);
+
+	auto upstream								 = UpstreamService::ForConverterAPI();
+	upstream.providers.front().root_url = hstring{service.rootUrl()};
+
+	const StorageFolders folders{hstring{directory}, hstring{directory}};
+	CurrencyConverter		converter{DatabaseMode::IN_MEMORY, folders, upstream};
+
+	const auto imported = converter.ImportReferenceRates(hstring{file_name}, L"C0000");
+	EXPECT(imported.has_value() && imported->rows_inserted == 2);
+
+	// The same File again Stores nothing
+	const auto reimported = converter.ImportReferenceRates(hstring{file_name}, L"C0000");
+	EXPECT(reimported.has_value() && reimported->rows_inserted == 0);
+
+	const auto requests_before = service.requests();
+	const auto units			  = converter.GetConversionRate(L"C0000", L"C0001").get();
+
+	EXPECT(units != 0);
+	EXPECT(units != Rate::parse(IMPORTED_RATE)->units);
+	EXPECT(service.requests() > requests_before);
+}
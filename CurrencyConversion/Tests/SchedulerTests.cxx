@@ -0,0 +1,240 @@
+#include "pch.h"
+
+#include "Check.hxx"
+
+#include <TUESL/Net/RequestScheduler.hxx>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+// Priority and Fairness of the RequestScheduler, on a Stepped Clock
+// As such every Run Grants the same Requests at the same Times
+//
+// UpstreamScheduling in Benchmarks Reports what this comes to over an Hour of Traffic
+
+namespace
+{
+	using TUESL::Net::Priority;
+	using TUESL::Net::RequestScheduler;
+
+	using namespace std::chrono_literals;
+
+	using TimePoint = RequestScheduler::TimePoint;
+
+	// Owns the Clock and the Timer the Scheduler asks to be Woken by
+	// Grants are Recorded in Order, their Permits Held until released
+	class SteppedScheduler
+	{
+	 private:
+		TimePoint					 m_now{};
+		std::optional<TimePoint> m_wake_time;
+
+	 public:
+		std::vector<Priority>						 granted;
+		std::vector<RequestScheduler::Permit> permits;
+
+		RequestScheduler scheduler;
+
+		explicit SteppedScheduler(const RequestScheduler::Options& p_options) :
+			 scheduler{p_options,
+						  [this] { return m_now; },
+						  [this](const TimePoint p_time) { m_wake_time = p_time; }}
+		{
+		}
+
+		// Permits must not outlive the Scheduler, and each Released may Grant another
+		~SteppedScheduler()
+		{
+			while (!std::empty(permits))
+				releaseAll();
+		}
+
+		void submit(const Priority p_priority)
+		{
+			scheduler.submit(p_priority, [this, p_priority](RequestScheduler::Permit p_permit) {
+				granted.push_back(p_priority);
+				permits.push_back(std::move(p_permit));
+			});
+		}
+
+		// Answers every Request in Flight, which may Grant those Queued
+		void releaseAll()
+		{
+			auto answered = std::move(permits);
+			permits.clear();
+			answered.clear();
+		}
+
+		// Moves the Clock on to p_time, Firing the Timer on the way if it is Due
+		void advanceTo(const TimePoint p_time)
+		{
+			m_now = p_time;
+			if (m_wake_time.has_value() && m_wake_time.value() <= m_now)
+			{
+				m_wake_time.reset();
+				scheduler.dispatch();
+			}
+		}
+
+		TimePoint now() const noexcept
+		{
+			return m_now;
+		}
+		std::optional<TimePoint> wakeTime() const noexcept
+		{
+			return m_wake_time;
+		}
+	};
+
+	// Tokens and Slots to spare, as such only the Order of the Lanes is Tested
+	RequestScheduler::Options plentiful()
+	{
+		RequestScheduler::Options options;
+		options.requests_per_second = 1000.0;
+		options.burst					 = 1000.0;
+		options.max_in_flight		 = 1;
+		return options;
+	}
+} // namespace
+
+TEST(SchedulerGrantsInteractiveBeforeQueuedBackground)
+{
+	SteppedScheduler stepped{plentiful()};
+
+	stepped.submit(Priority::BACKGROUND);
+	stepped.submit(Priority::BACKGROUND);
+	stepped.submit(Priority::BACKGROUND);
+	stepped.submit(Priority::INTERACTIVE);
+
+	// The only Slot went to the first, the others Queue behind it
+	EXPECT(stepped.granted == std::vector<Priority>{Priority::BACKGROUND});
+
+	stepped.releaseAll();
+	EXPECT(stepped.granted.back() == Priority::INTERACTIVE);
+
+	stepped.releaseAll();
+	stepped.releaseAll();
+	EXPECT(std::size(stepped.granted) == 4);
+	EXPECT(stepped.scheduler.metrics().background.queue_depth == 0);
+}
+
+TEST(SchedulerKeepsSlotsForInteractive)
+{
+	auto options				  = plentiful();
+	options.max_in_flight	  = 4;
+	options.interactive_slots = 1;
+	SteppedScheduler stepped{options};
+
+	for (int i = 0; i < 10; ++i)
+		stepped.submit(Priority::BACKGROUND);
+	EXPECT(std::size(stepped.granted) == 3);
+
+	// Granted at once, into the Slot Background Left
+	stepped.submit(Priority::INTERACTIVE);
+	EXPECT(std::size(stepped.granted) == 4);
+	EXPECT(stepped.granted.back() == Priority::INTERACTIVE);
+	EXPECT(stepped.scheduler.metrics().interactive.max_wait == 0us);
+}
+
+TEST(SchedulerKeepsTokensForInteractive)
+{
+	RequestScheduler::Options options;
+	options.requests_per_second = 1.0;
+	options.burst					 = 4.0;
+	options.max_in_flight		 = 10;
+	options.interactive_tokens	 = 2.0;
+	SteppedScheduler stepped{options};
+
+	for (int i = 0; i < 10; ++i)
+		stepped.submit(Priority::BACKGROUND);
+	EXPECT(std::size(stepped.granted) == 2);
+
+	// Both Tokens Kept back are there for it
+	stepped.submit(Priority::INTERACTIVE);
+	stepped.submit(Priority::INTERACTIVE);
+	EXPECT((stepped.granted == std::vector<Priority>{Priority::BACKGROUND,
+																	 Priority::BACKGROUND,
+																	 Priority::INTERACTIVE,
+																	 Priority::INTERACTIVE}));
+}
+
+TEST(SchedulerWakesWhenTokensRefill)
+{
+	RequestScheduler::Options options;
+	options.requests_per_second = 1.0;
+	options.burst					 = 1.0;
+	options.max_in_flight		 = 4;
+	SteppedScheduler stepped{options};
+
+	stepped.submit(Priority::BACKGROUND);
+	stepped.submit(Priority::BACKGROUND);
+	EXPECT(std::size(stepped.granted) == 1);
+	EXPECT(stepped.wakeTime() == std::optional<TimePoint>{stepped.now() + 1s});
+
+	stepped.advanceTo(stepped.now() + 999ms);
+	EXPECT(std::size(stepped.granted) == 1);
+
+	stepped.advanceTo(stepped.now() + 1ms);
+	EXPECT(std::size(stepped.granted) == 2);
+	EXPECT(stepped.scheduler.metrics().background.max_wait == 1s);
+}
+
+// A Backlog of Background Requests under a steady Stream of Interactive ones
+// Interactive never Waits on Background, and Background still gets every Token it Spares
+TEST(SchedulerServesBackgroundUnderInteractiveLoad)
+{
+	RequestScheduler::Options options;
+	options.requests_per_second = 1.0;
+	options.burst					 = 4.0;
+	options.max_in_flight		 = 4;
+	options.interactive_tokens	 = 1.0;
+	options.interactive_slots	 = 1;
+	SteppedScheduler stepped{options};
+
+	// More than DURATION Refills Tokens for, as such Background always has one Waiting
+	constexpr const std::size_t BACKLOG				= 1000;
+	constexpr const auto			 INTERACTIVE_PERIOD = 4s;
+	constexpr const auto			 DURATION			= 400s;
+
+	for (std::size_t i = 0; i < BACKLOG; ++i)
+		stepped.submit(Priority::BACKGROUND);
+
+	const auto start		  = stepped.now();
+	auto		  next_arrival = start + INTERACTIVE_PERIOD;
+	std::size_t interactive  = 0;
+	while (stepped.now() < start + DURATION)
+	{
+		// Every Request is Answered before the Clock moves on
+		stepped.releaseAll();
+
+		auto next_time = next_arrival;
+		if (const auto wake_time = stepped.wakeTime(); wake_time.has_value())
+			next_time = (std::min)(next_time, wake_time.value());
+		stepped.advanceTo(next_time);
+
+		if (stepped.now() == next_arrival)
+		{
+			stepped.submit(Priority::INTERACTIVE);
+			++interactive;
+			next_arrival += INTERACTIVE_PERIOD;
+		}
+	}
+
+	const auto metrics = stepped.scheduler.metrics();
+
+	// Priority, each Interactive Request is Granted on Arrival
+	EXPECT(metrics.interactive.granted == interactive);
+	EXPECT(metrics.interactive.max_wait == 0us);
+
+	// Fairness, Background is not Starved, it is Granted every Token Interactive did not Need
+	// A Token a Second, less the Interactive ones and the Token Kept for them
+	const auto tokens		= options.burst + std::chrono::duration<double>(DURATION).count();
+	const auto expected	= tokens - interactive - options.interactive_tokens;
+	const auto background = static_cast<double>(metrics.background.granted);
+	EXPECT(metrics.background.queue_depth != 0);
+	EXPECT(background >= expected - 1.0);
+	EXPECT(background <= expected + 1.0);
+}
@@ -0,0 +1,238 @@
+#include "pch.h"
+
+#include "Check.hxx"
+
+#include "Harness.hxx"
+
+#include <TUESL/TimeSeries/GorillaCodec.hxx>
+#include <TUESL/TimeSeries/TimeSeriesStore.hxx>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+// Samples Encoded and Decoded again must come back Bit for Bit
+// Values are Compared by their Bits, as such NaN Payloads and the Sign of Zero are Checked too
+//
+// TimeSeriesBenchmarks Reports the Size and Speed of the same Streams
+
+namespace
+{
+	using TUESL::TimeSeries::GorillaDecoder;
+	using TUESL::TimeSeries::GorillaEncoder;
+	using TUESL::TimeSeries::Sample;
+	using TUESL::TimeSeries::TimeSeriesStore;
+
+	using Limits = std::numeric_limits<double>;
+
+	constexpr const std::int64_t INT64_MINIMUM = (std::numeric_limits<std::int64_t>::min)();
+	constexpr const std::int64_t INT64_MAXIMUM = (std::numeric_limits<std::int64_t>::max)();
+
+	std::uint64_t toBits(const double p_value) noexcept
+	{
+		std::uint64_t bits;
+		std::memcpy(&bits, &p_value, sizeof(bits));
+		return bits;
+	}
+	double fromBits(const std::uint64_t p_bits) noexcept
+	{
+		double value;
+		std::memcpy(&value, &p_bits, sizeof(value));
+		return value;
+	}
+
+	bool isSame(const std::vector<Sample>& p_lhs, const std::vector<Sample>& p_rhs) noexcept
+	{
+		if (std::size(p_lhs) != std::size(p_rhs))
+			return false;
+
+		for (std::size_t i = 0; i < std::size(p_lhs); ++i)
+		{
+			if (p_lhs[i].time != p_rhs[i].time ||
+				 toBits(p_lhs[i].value) != toBits(p_rhs[i].value))
+				return false;
+		}
+		return true;
+	}
+
+	std::vector<Sample> roundTrip(const std::vector<Sample>& p_samples)
+	{
+		GorillaEncoder encoder;
+		for (const auto& sample : p_samples)
+			encoder.append(sample);
+
+		const auto&	  stream = encoder.stream();
+		GorillaDecoder decoder{
+			 std::data(stream.bytes()), stream.bitLength(), encoder.count()};
+
+		std::vector<Sample> decoded;
+		Sample				  sample{};
+		while (decoder.next(sample))
+			decoded.push_back(sample);
+		return decoded;
+	}
+
+	// Values whose XOR with their Neighbour is 0, a Single Bit, every Bit, or a NaN
+	std::vector<Sample> edgeValues()
+	{
+		const double values[] = {0.0,
+										 -0.0,
+										 0.0,
+										 Limits::quiet_NaN(),
+										 -Limits::quiet_NaN(),
+										 fromBits(0x7FF0'0000'0000'0001), // Signaling NaN
+										 fromBits(0x7FF8'DEAD'BEEF'0001), // NaN with a Payload
+										 fromBits(0x7FF8'DEAD'BEEF'0001),
+										 Limits::infinity(),
+										 -Limits::infinity(),
+										 1.0,
+										 std::nextafter(1.0, 2.0),
+										 Limits::denorm_min(),
+										 (Limits::max)(),
+										 (Limits::lowest)(),
+										 fromBits(0xFFFF'FFFF'FFFF'FFFF),
+										 0.0,
+										 1.0825,
+										 1.0826,
+										 1.0825};
+
+		std::vector<Sample> samples;
+		std::int64_t			time = 1'700'000'000;
+		for (const auto value : values)
+			samples.push_back(Sample{time++, value});
+		return samples;
+	}
+} // namespace
+
+TEST(GorillaRoundTripsNoSamples)
+{
+	GorillaEncoder encoder;
+	EXPECT(encoder.stream().bitLength() == 0);
+	EXPECT(roundTrip({}).empty());
+
+	// Nor does a Stream Declaring more Samples than it holds Yield any
+	GorillaDecoder decoder{nullptr, 0, 1};
+	Sample			sample{};
+	EXPECT(!decoder.next(sample));
+}
+
+TEST(GorillaRoundTripsSingleSample)
+{
+	for (const auto& sample : edgeValues())
+		EXPECT(isSame(roundTrip({sample}), {sample}));
+
+	const std::vector<Sample> extremes[] = {{Sample{INT64_MINIMUM, 1.0}},
+														 {Sample{INT64_MAXIMUM, 1.0}}};
+	for (const auto& samples : extremes)
+		EXPECT(isSame(roundTrip(samples), samples));
+}
+
+TEST(GorillaRoundTripsRepeatedSamples)
+{
+	// Unchanged Time and Value, each a Single Bit
+	const std::vector<Sample> repeated(1'000, Sample{1'700'000'000, 1.0825});
+	EXPECT(isSame(roundTrip(repeated), repeated));
+
+	std::vector<Sample> regular;
+	for (std::int64_t i = 0; i < 1'000; ++i)
+		regular.push_back(Sample{1'700'000'000 + i * 60, 1.0825});
+	EXPECT(isSame(roundTrip(regular), regular));
+}
+
+TEST(GorillaRoundTripsEdgeValues)
+{
+	const auto samples = edgeValues();
+	EXPECT(isSame(roundTrip(samples), samples));
+}
+
+// Either side of each Delta of Delta Bucket, and the largest Delta an int64 holds
+TEST(GorillaRoundTripsEdgeDeltas)
+{
+	std::vector<Sample> samples;
+	std::int64_t			time	= 0;
+	std::int64_t			delta = 0;
+	samples.push_back(Sample{time, 1.0});
+
+	for (const std::int64_t delta_of_delta : {std::int64_t{1},
+															std::int64_t{-63},
+															std::int64_t{64},
+															std::int64_t{-64},
+															std::int64_t{65},
+															std::int64_t{256},
+															std::int64_t{257},
+															std::int64_t{2'048},
+															std::int64_t{-2'048},
+															std::int64_t{2'049},
+															std::int64_t{2'147'483'648},
+															std::int64_t{2'147'483'649},
+															std::int64_t{-2'147'483'648}})
+	{
+		delta += delta_of_delta;
+		time += delta;
+		samples.push_back(Sample{time, 1.0});
+	}
+	EXPECT(isSame(roundTrip(samples), samples));
+
+	// A Delta of INT64_MAXIMUM, then the same again, then None
+	const std::vector<Sample> widest = {Sample{INT64_MINIMUM + 1, 1.0},
+													Sample{0, 2.0},
+													Sample{INT64_MAXIMUM, 3.0},
+													Sample{INT64_MAXIMUM, 4.0}};
+	EXPECT(isSame(roundTrip(widest), widest));
+}
+
+TEST(GorillaRejectsTruncatedStream)
+{
+	const auto samples = edgeValues();
+
+	GorillaEncoder encoder;
+	for (const auto& sample : samples)
+		encoder.append(sample);
+
+	const auto&	  stream = encoder.stream();
+	GorillaDecoder decoder{
+		 std::data(stream.bytes()), stream.bitLength() - 1, encoder.count()};
+
+	std::size_t decoded = 0;
+	Sample		sample{};
+	while (decoder.next(sample))
+		++decoded;
+	EXPECT(decoded == std::size(samples) - 1);
+}
+
+// The same Samples through Blocks on Disk, Read back by a Store Reopened on the Directory
+TEST(TimeSeriesStoreRoundTrips)
+{
+	constexpr const auto		  SERIES_NAME	= L"EUR-USD";
+	constexpr const std::size_t BLOCK_SAMPLES = 4;
+
+	const auto directory = Benchmarks::scratchDirectory(L"TimeSeriesTests");
+
+	// Several Blocks and an Open one, which flush Writes out
+	auto samples = edgeValues();
+	for (std::int64_t i = 0; i < 3; ++i)
+		samples.push_back(samples.back());
+
+	{
+		TimeSeriesStore store{directory, BLOCK_SAMPLES};
+		EXPECT(store.range(SERIES_NAME, INT64_MINIMUM, INT64_MAXIMUM).empty());
+
+		for (const auto& sample : samples)
+			EXPECT(store.append(SERIES_NAME, sample));
+
+		// Time must not go Back
+		EXPECT(!store.append(SERIES_NAME, Sample{samples.front().time - 1, 1.0}));
+		store.flush();
+
+		EXPECT(isSame(store.range(SERIES_NAME, INT64_MINIMUM, INT64_MAXIMUM), samples));
+	}
+
+	TimeSeriesStore reopened{directory, BLOCK_SAMPLES};
+	EXPECT(isSame(reopened.range(SERIES_NAME, INT64_MINIMUM, INT64_MAXIMUM), samples));
+
+	// [from, to) of the Middle, across a Block Boundary
+	const std::vector<Sample> middle(std::begin(samples) + 3, std::begin(samples) + 9);
+	EXPECT(isSame(reopened.range(SERIES_NAME, samples[3].time, samples[9].time), middle));
+}